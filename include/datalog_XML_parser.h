@@ -59,9 +59,14 @@ typedef struct dl_parser_metadata{
 typedef struct dl_parser_doc{
     char* filename;
 
-    dl_parser_literal_t* literals_head; /*!< pointer to the list of literals */
-    dl_parser_rule_t* rules_head;       /*!< pointer to the list of rules */
-    dl_parser_fact_t* facts_head;       /*!< pointer to the list of facts */
+    dl_parser_rule_t* rules;            /*!< array of the parsed rules */
+    int rule_count;                     /*!< number of parsed rules */
+    int rule_size;                      /*!< room in the rules array */
+    dl_parser_fact_t* facts;            /*!< array of the parsed facts */
+    int fact_count;                     /*!< number of parsed facts */
+    int fact_size;                      /*!< room in the facts array */
+
+    dl_parser_arena_t arena;            /*!< literals, terms and strings of the facts and rules */
 
     dl_parser_metadata_t* metadata;     /*!< pointer to the documents parsed metadata */
         
@@ -84,9 +89,14 @@ typedef struct dl_parser_doc{
 typedef struct dl_parser_return_doc{
     char* filename;
 
-    dl_parser_literal_t* literals_head; /*!< pointer to the list of literals */
-    dl_parser_rule_t* rules_head;       /*!< pointer to the list of rules */
-    dl_parser_fact_t* facts_head;       /*!< pointer to the list of facts */
+    dl_parser_rule_t* rules;            /*!< array of the parsed rules */
+    int rule_count;                     /*!< number of parsed rules */
+    int rule_size;                      /*!< room in the rules array */
+    dl_parser_fact_t* facts;            /*!< array of the parsed facts */
+    int fact_count;                     /*!< number of parsed facts */
+    int fact_size;                      /*!< room in the facts array */
+
+    dl_parser_arena_t arena;            /*!< literals, terms and strings of the facts and rules */
 
     dl_parser_metadata_t* metadata;     /*!< pointer to the documents parsed metadata */
 
@@ -172,35 +182,43 @@ void dl_parser_print_fact(dl_parser_fact_t* fact);
 void dl_parser_print_fact_list(dl_parser_doc_t* doc);
 
 /**
-* @brief gets the last dl_parser_rule_t* object in the linked list of parsed rules
+* @brief gets the last dl_parser_rule_t* object in the array of parsed rules
 * 
 * @param doc pointer to parser document stuct
-* @return dl_parser_rule_t* pointer to the last fact in the linked list of parsed rules
+* @return dl_parser_rule_t* pointer to the last rule in the array of parsed rules,
+* NULL if there are none
 */
 dl_parser_rule_t* dl_parser_get_last_rule(dl_parser_doc_t* doc);
 
 /**
-* @brief adds a rule to the end of the linked list of parsed rules
+* @brief copies a rule to the end of the array of parsed rules
+* 
+* The array grows by doubling, so adding N rules takes O(N) time. Pointers to
+* the rules in the array are only valid until the next rule is added.
 * 
 * @param doc pointer to parser document stuct
-* @param rule pointer to a parser rule object that is to be added to the rule list
+* @param rule pointer to a parser rule object that is to be copied to the rule array
 * @return DL_PARSER_ERR_t error message
 */
 DL_PARSER_ERR_t dl_parser_add_rule(dl_parser_doc_t* doc, dl_parser_rule_t* rule);
 
 /**
-* @brief gets the last dl_parser_fact_t* object in the linked list of parsed facts
+* @brief gets the last dl_parser_fact_t* object in the array of parsed facts
 * 
 * @param doc pointer to parser document stuct
-* @return dl_parser_fact_t* pointer to the last fact in the linked list of parsed facts
+* @return dl_parser_fact_t* pointer to the last fact in the array of parsed facts,
+* NULL if there are none
 */
 dl_parser_fact_t* dl_parser_get_last_fact(dl_parser_doc_t* doc);
 
 /**
-* @brief adds a fact to the end of the linked list of parsed rules
+* @brief copies a fact to the end of the array of parsed facts
+* 
+* The array grows by doubling, so adding N facts takes O(N) time. Pointers to
+* the facts in the array are only valid until the next fact is added.
 * 
 * @param doc pointer to parser document stuct
-* @param fact pointer to a parser fact object that is to be added to the fact list
+* @param fact pointer to a parser fact object that is to be copied to the fact array
 * @return DL_PARSER_ERR_t error message
 */
 DL_PARSER_ERR_t dl_parser_add_fact(dl_parser_doc_t* doc, dl_parser_fact_t* fact);
@@ -304,64 +322,47 @@ DL_PARSER_ERR_t dl_parser_metadata(dl_parser_doc_t* doc);
 dl_parser_doc_t* dl_parser_init(char* filename);
 
 /**
-* @brief Frees a term list
+* @brief Allocates memory from an arena
 * 
-* @param Pointer to the term list head
-* @return void
-*/
-void datalog_parser_free_term_list(dl_parser_term_t** term_head);
-
-/**
-* @brief Frees a parser literal object
+* The memory is aligned for any object and is freed with the arena.
 * 
-* @param Double pointer to the literal object to be freed
-* @return void
+* @param arena Arena the memory is taken from
+* @param size Number of bytes
+* @return void* pointer to the zeroed memory, NULL if out of memory
 */
-void datalog_parser_free_literal(dl_parser_literal_t** lit);
+void* dl_parser_arena_alloc(dl_parser_arena_t* arena, size_t size);
 
 /**
-* @brief Frees a parser clause body object
+* @brief Copies a string into an arena
 * 
-* @param Double pointer to the clause body object
-* @return void
-*/
-void datalog_parser_free_clause_body(dl_parser_clause_body_t** body);
-
-/**
-* @brief Frees a parser fact object
-* 
-* @param Double pointer to the fact object
-* @return void
+* @param arena Arena the copy is taken from
+* @param string String to be copied
+* @return char* pointer to the copy, NULL if out of memory
 */
-void datalog_parser_free_fact(dl_parser_fact_t** fact);
+char* dl_parser_arena_strdup(dl_parser_arena_t* arena, const char* string);
 
 /**
-* @brief Frees a fact list
+* @brief Empties an arena, keeping its largest block for reuse
 * 
-* @param Double pointer to the fact list's head
+* @param arena Arena to be emptied
 * @return void
 */
-void datalog_parser_free_fact_list(dl_parser_fact_t** fact_head);
+void dl_parser_arena_reset(dl_parser_arena_t* arena);
 
 /**
-* @brief Frees a rule object 
+* @brief Frees all the memory of an arena
 * 
-* @param Double pointer to the rule object
+* @param arena Arena to be freed
 * @return void
 */
-void datalog_parser_free_rule(dl_parser_rule_t** rule);
-
-/**
-* @brief Frees a rule list
-* 
-* @param Double pointer to the rule list's head
-* @return void
-*/
-void datalog_parser_free_rule_list(dl_parser_rule_t** rule_head);
+void dl_parser_arena_free(dl_parser_arena_t* arena);
 
 /**
 * @brief Deinitialises a return document, freeing memory resources
 * 
+* The facts and rules are freed with their arrays and arena, in a number of
+* calls that does not depend on the number of facts.
+* 
 * @param Double pointer to the return document object to be deinitialised
 * @return DL_PARSER_ERR_t error message
 */
@@ -371,6 +372,9 @@ DL_PARSER_ERR_t dl_parser_deinit_return_doc(dl_parser_return_doc_t** doc);
 * @brief Deinitialises a document object whilst preserving the processed data.
 * Important if the processed data is being pointed to from a return doc object
 * 
+* The XML tree is freed, after which the node pointers of the processed facts
+* and rules are no longer valid.
+* 
 * @param Double pointer to doc object to be freed
 * @return DL_PARSER_ERR_t error message
 */
@@ -385,4 +389,36 @@ DL_PARSER_ERR_t dl_parser_deinit_with_data(dl_parser_doc_t** doc);
 */
 dl_parser_return_doc_t* dl_parser_runtime(char* filename);
 
+/**
+* @brief callback receiving a fact as it is streamed from a XML document, the
+* fact is freed once the callback returns
+*/
+typedef DL_PARSER_ERR_t (*dl_parser_fact_cb_t)(dl_parser_fact_t* fact, void* data);
+
+/**
+* @brief callback receiving a rule as it is streamed from a XML document, the
+* rule is freed once the callback returns
+*/
+typedef DL_PARSER_ERR_t (*dl_parser_rule_cb_t)(dl_parser_rule_t* rule, void* data);
+
+/**
+* @brief streams the facts and rules of the mappings in a XML document to
+* callbacks
+*
+* Unlike dl_parser_runtime the document is read with libxml's xmlTextReader
+* and never held as a whole: each <fact> and <rule> of the <mappings> is
+* expanded, handed to its callback and freed before the next is read, so the
+* memory used does not depend on the size of the document. The metadata is
+* skipped. Invalid facts and rules are reported and skipped.
+* 
+* @param filename spcified the filename of the XML file to be parsed
+* @param fact_cb callback receiving each fact
+* @param rule_cb callback receiving each rule
+* @param data user data passed to the callbacks
+* @return DL_PARSER_ERR_t error message, or the first error returned by a
+* callback, which stops the stream
+*/
+DL_PARSER_ERR_t dl_parser_stream(char* filename, dl_parser_fact_cb_t fact_cb,
+        dl_parser_rule_cb_t rule_cb, void* data);
+
 #endif
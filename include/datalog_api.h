@@ -71,15 +71,17 @@
  * the parser.
 @subsection fact_sec Fact objects
  * A fact in data log is a clause without a body, aka it's a standard literal. Facts are
- * essentailly a literal stored in a container allowing them to be used as elements of a
- * linked list as well as storing a reference to the XML node that corresponds to the fact.
- * The parser will scan the entire document for facts, creating a linked list. This linked
- * list is then traversed and each XML fact node is walked and processed so that each fact
- * is represented by a dl_parser_fact_t object which contains the fact's literal. <br>
+ * essentailly a literal stored in a container allowing them to be used as elements of an
+ * array as well as storing a reference to the XML node that corresponds to the fact.
+ * The parser will scan the entire document for facts, creating an array. This array
+ * is then traversed and each XML fact node is walked and processed so that each fact
+ * is represented by a dl_parser_fact_t object which contains the fact's literal. The 
+ * literals, terms and strings are allocated from the document's arena and are freed
+ * with it. <br>
  * The facts in the XML tree can be found by calling dl_parser_mappings as this will in
  * turn walk the XML tree and call dl_parser_add_fact on all found facts. Found facts are 
  * then processed using dl_parser_process_fact. After processing the found facts can be found
- * pointed to by the linked list head pointer dl_parser_fact_t* facts_head found within the
+ * in the array dl_parser_fact_t* facts, of fact_count entries, found within the
  * dl_parser_doc_t object.
 @subsection rule_sec Rule objects
  * In Datalog rules are clauses that contain a body, the body being a potentially infinite 
@@ -88,10 +90,10 @@
  * the body of the rule by an array of literal pointers. This list is dynamically allocated
  * to allow for potentially infinite length rules. Parsing of rules happens in the same 
  * fashion as facts, in that a call to dl_parser_mappings will walk the XML tree and call
- * dl_parser_add_rule on any found rules. These are then stores in a similar linked list 
- * fashion and processed through calls to dl_parser_process_rule whilst iterating over the
- * linked list. The linked list of processed rules can be found using the head pointer
- * dl_parser_rule_t* rules_head found in the dl_parser_doc_t object.
+ * dl_parser_add_rule on any found rules. These are then stored in a similar array 
+ * and processed through calls to dl_parser_process_rule whilst iterating over the
+ * array. The array of processed rules can be found using the pointer
+ * dl_parser_rule_t* rules, of rule_count entries, found in the dl_parser_doc_t object.
 @section parser_sec XML Parser
  * The XML parser is designed to be used to be able parse XML files
  * to a datalog program to load rules and facts into the
@@ -298,6 +300,9 @@ typedef enum{
     DATALOG_TYPE,
     DATALOG_TERM,
     DATALOG_WRAP,
+    DATALOG_VIEW,
+    DATALOG_FILE,
+    DATALOG_UNSAFE,     /*!< an unsafe clause was skipped */
 }DATALOG_ERR_t;
 
 /**
@@ -330,10 +335,32 @@ struct datalog_query_processed_answers{
     int answer_term_count;
     int answer_count;
     datalog_query_answers_t** answers;
+    char** table;   /**< Terms in row-major order, answers[i]->term_list is row i*/
 
     void (*free)(datalog_query_processed_answers_t**);
 };
 
+/**
+* @typedef datalog_answers_view_t
+* @brief Typdef for datalog_answers_view
+*/
+typedef struct datalog_answers_view datalog_answers_view_t;
+
+/**
+* @struct datalog_answers_view
+* @brief Struct giving indexed access to the answers returned by the library
+* without copying them
+*
+* The terms are read in place from the answers' blocks, so the strings
+* returned by the view are borrowed and live as long as the answers.
+*/
+struct datalog_answers_view{
+    dl_answers_t answers;   /**< Answers read by the view, NULL when none*/
+    bool owned;             /**< Are the answers freed with the view?*/
+    int answer_count;
+    int answer_term_count;
+};
+
 /**
 * @typedef datalog_query_t
 * @brief Typdef for datalog_query
@@ -348,6 +375,8 @@ struct datalog_query{
     datalog_literal_t* literal;
     dl_answers_t* answer;
     datalog_query_processed_answers_t* processed_answer;
+    dl_cursor_t cursor;                 /**< Open cursor, NULL when closed*/
+    struct datalog_replica* replica;    /**< Replica held by the cursor*/
 
     DATALOG_ERR_t (*ask)(datalog_query_t*);
     DATALOG_ERR_t (*print)(datalog_query_t*);
@@ -355,6 +384,13 @@ struct datalog_query{
     void (*free)(datalog_query_t**);
 };
 
+/**
+* @typedef datalog_prepared_t
+* @brief Typdef for datalog_prepared, a query prepared once and asked with
+* different values for its parameters
+*/
+typedef struct datalog_prepared datalog_prepared_t;
+
 /**
 * @typedef datalog_clause_t
 * @brief Typdef for datalog_clause
@@ -377,6 +413,28 @@ struct datalog_clause{
     void (*free)(datalog_clause_t**);
 };
 
+/**
+* @typedef datalog_wal_config_t
+* @brief Typdef for datalog_wal_config
+*/
+typedef struct datalog_wal_config datalog_wal_config_t;
+
+/**
+* @struct datalog_wal_config
+* @brief Settings of the write-ahead log opened by datalog_engine_wal_open
+*
+* Records are written and synced by a flusher thread in groups: every record
+* appended while a sync is running goes out with the next one, so concurrent
+* writers share syncs. A commit interval holds each group back a little
+* longer to make it bigger.
+*/
+struct datalog_wal_config{
+    unsigned int commit_interval_us; /**< Longest wait for more records before a sync, 0 syncs at once*/
+    size_t commit_bytes;    /**< Pending bytes that end the wait early*/
+    bool durable;           /**< Do write calls return only once their records are synced?*/
+    size_t compact_bytes;   /**< Log size that starts a background compaction, 0 for never*/
+};
+
 /**
 * @brief Global database used by datalog library
 */
@@ -390,6 +448,17 @@ extern dl_db_t datalog_db;
 */
 DATALOG_ERR_t datalog_engine_db_init(void);
 
+/**
+* @brief Initialises the datalog database with evaluation options
+*
+* Passing DL_OPT_BOTTOMUP answers queries with the native semi-naive
+* evaluator instead of the tabled Lua prover.
+*
+* @param options DL_OPT_* flags from datalog.h
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_db_init_with(int options);
+
 /**
 * @brief Deinitialises the datalog database
 *
@@ -398,6 +467,182 @@ DATALOG_ERR_t datalog_engine_db_init(void);
 */
 DATALOG_ERR_t datalog_engine_db_deinit(void);
 
+/**
+* @brief Opens a pool of read-only replicas of the datalog database
+*
+* Once the pool is open, datalog_query_ask and datalog_query_aggregate answer
+* queries from a free replica instead of the global database, so queries made
+* from different threads run in parallel. The replicas share the facts of the
+* database rather than copying them. Each query runs on a consistent snapshot
+* of the database: the latest one when the writer is idle, otherwise the one
+* the writer publishes as soon as its current call returns, so queries never
+* wait for asserts and asserts never wait for queries. Clauses are still
+* asserted into the global database, from one thread at a time.
+*
+* @param count Number of replicas, usually the number of querying threads
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_replicas_init(int count);
+
+/**
+* @brief Closes the pool of replicas, queries are then answered by the global
+* database again
+*
+* Waits for the queries running on the replicas to return. The pool is not
+* closed while cursors are open, as they hold their replica until they are
+* closed.
+*
+* @param none
+* @return DATALOG_ERR_t error message, DATALOG_INIT when cursors are open
+*/
+DATALOG_ERR_t datalog_engine_replicas_deinit(void);
+
+/**
+* @brief Publishes the facts and rules of the global database to the replicas
+*
+* The new version replaces the old one atomically, each replica picks it up
+* before its next query. Queries already running finish on the old version,
+* which is freed once no replica holds it. Queries publish versions as they
+* need them, so this is only needed to bound how stale a snapshot taken
+* while the writer is busy can be.
+*
+* @param none
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_publish(void);
+
+/**
+* @brief Saves the global database on a stack of saved databases
+*
+* Saving takes constant time whatever the size of the database: nothing is
+* copied until a predicate next changes, and then only its rules are, its
+* facts being shared until the database changes them.
+*
+* @param none
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_save(void);
+
+/**
+* @brief Reverts the global database to the one last saved and removes it
+* from the stack, empties the database when none is saved
+*
+* @param none
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_restore(void);
+
+/**
+* @brief Takes a snapshot of the global database that can be reverted to
+* any number of times, in constant time like datalog_engine_save
+*
+* @param snapshot Set to the number referring to the snapshot
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_snapshot(int* snapshot);
+
+/**
+* @brief Reverts the global database to a snapshot, taking time in
+* proportion to the number of predicates changed since it was taken
+*
+* @param snapshot Number of the snapshot
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_revert(int snapshot);
+
+/**
+* @brief Releases a snapshot, after which changes to the database stop being
+* saved for it
+*
+* @param snapshot Number of the snapshot
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_release(int snapshot);
+
+/**
+* @brief Saves the facts and rules of the global database to an image file
+*
+* The image holds the fact store columns and the symbol table as the engine
+* keeps them in memory, so it can be loaded by mapping the file instead of
+* asserting the facts again. The file is written under another name and
+* renamed when complete.
+*
+* @param path Name of the image file
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_image_save(const char* path);
+
+/**
+* @brief Loads an image file into the global database
+*
+* The file is mapped into memory and its columns are used in place, so
+* loading takes about the time to page in the file, whatever the number of
+* facts. The database must hold no clauses and the replicas must not have
+* been opened yet. Images are only loaded by the kind of machine that wrote
+* them.
+*
+* @param path Name of the image file
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_image_load(const char* path);
+
+/**
+* @brief Opens a write-ahead log for the global database, recovering the
+* database from it first
+*
+* Every clause asserted or retracted through the API, and every batch of
+* facts, is appended to the log, as the command buffer or facts it was made
+* from, before the call returns. Clauses built on the engine's stack cannot
+* be logged, so datalog_clause_assert is refused while the log is open. The
+* log lives in files named after path: generations of logs, path.N.log, each
+* starting where the image path.N.image, written by a compaction, leaves off. On opening, the latest
+* image is loaded and the logs after it are replayed, a record torn by a
+* crash at the end of the last log being dropped. Compaction writes the image
+* from a replica in a background thread, so writers only wait for the switch
+* to a new log. Restoring or reverting the database writes an image at once,
+* as these are not logged. Once a write or sync of the log, a compaction or
+* an image fails, write calls return DATALOG_FILE without changing the
+* database until the log is closed and opened again.
+*
+* Call it after datalog_engine_db_init and before the replicas are opened.
+*
+* @param path Prefix of the names of the log files
+* @param config Settings of the log, NULL for the defaults: syncs as soon as
+* records are pending, durable writes, compaction every 64 MB of log
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_wal_open(const char* path, 
+        const datalog_wal_config_t* config);
+
+/**
+* @brief Waits until every record appended to the write-ahead log is synced
+*
+* @param none
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_wal_sync(void);
+
+/**
+* @brief Starts compacting the write-ahead log into an image in the background
+*
+* The writer switches to a new log at once, and the image of the database at
+* that moment is written by another thread, after which the older logs and
+* images are removed. Does nothing while a compaction is running.
+*
+* @param none
+* @return DATALOG_ERR_t error message, DATALOG_FILE when this or an earlier
+* compaction failed
+*/
+DATALOG_ERR_t datalog_engine_wal_compact(void);
+
+/**
+* @brief Syncs and closes the write-ahead log, waiting for any compaction
+*
+* @param none
+* @return DATALOG_ERR_t error message 
+*/
+DATALOG_ERR_t datalog_engine_wal_close(void);
+
 //TODO
 void datalog_literal_set_functions(datalog_literal_t* lit);
 
@@ -444,6 +689,19 @@ DATALOG_ERR_t datalog_literal_create(datalog_literal_t* lit);
 */
 DATALOG_ERR_t datalog_literal_create_and_assert(datalog_literal_t* lit);
 
+/**
+* @brief Creates a literal on the Datalog stack and materializes its
+* predicate as a view
+*
+* The facts of the view are kept up to date incrementally as facts are
+* asserted and retracted, so queries on it no longer re-derive them.
+* 
+* @param lit Literal whose predicate is to be materialized, its terms
+* are ignored
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_literal_materialize(datalog_literal_t* lit);
+
 /**
 * @brief Creates and asserts a literal without requiring a literal structure
 *
@@ -465,6 +723,60 @@ DATALOG_ERR_t datalog_literal_create_and_assert(datalog_literal_t* lit);
 DATALOG_ERR_t datalog_literal_stand_alone_create_and_assert(char* predicate,
         int num_of_terms, char** terms, uint32_t term_type_mask, bool assert);
 
+/**
+* @brief Codes the commands that build a literal on the Datalog stack into a
+* command buffer
+*
+* Literals and clauses coded into one buffer are built by a single call into
+* the engine when the buffer is run, instead of several calls per literal and
+* two per term.
+*
+* @param lit Literal to be coded
+* @param cmds Command buffer the commands are added to
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_literal_encode(datalog_literal_t* lit, dl_cmds_t* cmds);
+
+/**
+* @brief Codes the commands that build a clause on the Datalog stack into a
+* command buffer
+*
+* Add DL_OP_ASSERT or DL_OP_RETRACT after the clause to assert or retract it.
+*
+* @param clause Clause to be coded
+* @param cmds Command buffer the commands are added to
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_clause_encode(datalog_clause_t* clause, dl_cmds_t* cmds);
+
+/**
+* @brief Runs a command buffer on the global database in one call into the
+* engine
+*
+* @param cmds Commands to be run
+* @return DATALOG_ERR_t error message, DATALOG_UNSAFE when an unsafe clause was
+* skipped while the other commands were run
+*/
+DATALOG_ERR_t datalog_commands_exec(dl_cmds_t* cmds);
+
+/**
+* @brief Asserts a batch of facts of one predicate in a single call into the
+* Datalog engine
+*
+* Instead of building each fact on the Datalog stack, which takes several
+* calls per fact and two per term, the whole batch is handed to the engine at
+* once. All the terms are constants.
+*
+* @param predicate String representing the facts' predicate
+* @param arity Number of terms in each fact
+* @param count Number of facts
+* @param terms String array holding the terms of the facts in order, arity
+* terms for each fact
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_facts_assert(char* predicate, int arity, int count,
+        char** terms);
+
 /**
 * @brief Prints to contents of a literal
 * 
@@ -538,9 +850,12 @@ DATALOG_ERR_t datalog_clause_create(datalog_clause_t* clause);
 *
 * Pops a literal off the stack to create and assert a clause.
 * Literal must be already on the stack. Ordered appropriatley.
+* As the literals on the stack are not logged, the call is refused while a
+* write-ahead log is open, datalog_clause_create_and_assert is logged.
 * 
 * @param literal_count Number of literals in the body of the clause
-* @return DATALOG_ERR_t error message
+* @return DATALOG_ERR_t error message, DATALOG_INIT when a write-ahead log is
+* open
 */
 DATALOG_ERR_t datalog_clause_assert(int literal_count);
 
@@ -602,6 +917,64 @@ datalog_query_t* datalog_query_init(datalog_literal_t* lit);
 */
 DATALOG_ERR_t datalog_query_ask(datalog_query_t* query);
 
+/**
+* @brief Issues a query whose answers are aggregated by the engine
+*
+* The answers to the literal pointed to from within the query struct are
+* grouped by the selected terms and combined inside the datalog engine, so
+* only one answer per group is returned. Each processed answer holds the
+* group's terms followed by the result of the operation.
+*
+* @param query struct holding a pointer to the literal to be used for the query
+* and a pointer to where the answer should be stored.
+* @param op Aggregate operation, one of DL_AGG_COUNT, DL_AGG_SUM, DL_AGG_MIN or
+* DL_AGG_MAX
+* @param column Index of the term that is summed, or whose minimum or maximum is
+* found. Ignored by DL_AGG_COUNT
+* @param group_mask Bit mask specifying the terms that answers are grouped by.
+* LSB represents the first term.
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_query_aggregate(datalog_query_t* query, int op,
+        int column, uint32_t group_mask);
+
+/**
+* @brief Opens a cursor over the answers to a query, to be fetched in batches
+*
+* No list of every answer is made, the answers are copied a batch at a time
+* into memory that the cursor reuses. The database answering the query, a
+* replica or the global database, is held until the cursor is closed, so
+* that it does not change under the cursor. Without a pool of replicas,
+* asserts from other threads therefore wait for the cursor to close.
+*
+* @param query struct holding a pointer to the literal to be used for the query
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_query_open(datalog_query_t* query);
+
+/**
+* @brief Fetches the next batch of answers from a query's open cursor
+*
+* The batch is read with dl_getconst and dl_getconstlen. It is owned by the
+* cursor and only valid until the next batch is fetched or the cursor is
+* closed, it must not be freed.
+*
+* @param query Query whose cursor is open
+* @param count Maximum number of answers in the batch
+* @param batch Set to the batch, NULL when no answers are left
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_query_next_batch(datalog_query_t* query, int count,
+        dl_answers_t* batch);
+
+/**
+* @brief Closes a query's cursor, releasing the database it holds
+*
+* @param query Query whose cursor is open
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_query_close(datalog_query_t* query);
+
 /**
 * @brief Creates a query and asks the Datalog database with the created query
 * 
@@ -616,6 +989,66 @@ DATALOG_ERR_t datalog_query_ask(datalog_query_t* query);
 datalog_query_processed_answers_t* datalog_query_stand_alone_create_and_ask(
     char* predicate, int num_of_terms, char** terms, uint32_t term_type_mask);
 
+/**
+* @brief Prepares a query to be asked many times with different constants
+*
+* The terms are given as for datalog_query_stand_alone_create_and_ask, except
+* that the terms selected by the parameter mask are parameters, whose values
+* are bound with datalog_prepared_bind before the query is asked. Parameters
+* are numbered from zero in the order of their positions, and their entries
+* in the term array are not read. The query's literal is built once in each
+* database it is asked in, after which asking it only binds the parameters,
+* without building the literal again.
+*
+* A prepared query is used by one thread at a time, and must be freed with
+* datalog_free_prepared before the database is closed.
+*
+* @param predicate The query's predicate
+* @param num_of_terms The number of terms, at most 32
+* @param terms String array storing the terms that are not parameters
+* @param term_type_mask Bit mask specifing if a term is a constant or a
+* variable. LSB represents the first term. 1 for variable, 0 for constant.
+* @param param_mask Bit mask selecting the terms that are parameters
+* @return datalog_prepared_t* Pointer to the prepared query, NULL on error
+*/
+datalog_prepared_t* datalog_query_prepare(char* predicate, int num_of_terms,
+        char** terms, uint32_t term_type_mask, uint32_t param_mask);
+
+/**
+* @brief Binds a parameter of a prepared query to a constant
+*
+* The value is copied, and stays bound until the parameter is bound again.
+*
+* @param prep Pointer to the prepared query
+* @param param Number of the parameter, from zero
+* @param value The constant bound to the parameter
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_prepared_bind(datalog_prepared_t* prep, int param,
+        char* value);
+
+/**
+* @brief Asks a prepared query with the values bound to its parameters
+*
+* @param prep Pointer to the prepared query
+* @param answers Returns the processed answers, NULL when there are none
+* @return DATALOG_ERR_t error message, DATALOG_TERM when a parameter is not
+* bound
+*/
+DATALOG_ERR_t datalog_prepared_ask(datalog_prepared_t* prep,
+        datalog_query_processed_answers_t** answers);
+
+/**
+* @brief Asks a prepared query and keeps its answers as returned by the
+* library, like datalog_query_ask_view
+*
+* @param prep Pointer to the prepared query
+* @param view View to be set up over the answers
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_prepared_ask_view(datalog_prepared_t* prep,
+        datalog_answers_view_t* view);
+
 /**
 * @brief Prints a query object's contents
 * 
@@ -643,6 +1076,10 @@ char* datalog_query_return_answers(datalog_query_t* a);
 
 /**
 * @brief Initializes a stuct that stores processed queries answers
+*
+* Processed answers are allocated as one block holding the struct, the rows,
+* the row-major table of terms and the strings, and are freed with a single
+* call to free. This creates an empty set.
 * 
 * @return datalog_query_processed_answers_t* Pointer to newly created
 * object
@@ -653,13 +1090,71 @@ datalog_query_processed_answers_t* datalog_query_processed_answers_init(void);
 * @brief Processes the answers returned from a query.
 *
 * Takes the answers struct provided by the LUA/C library and exports it
-* into an struct that this API uses to process query answers.
+* into an struct that this API uses to process query answers. The struct is
+* sized from the number of answers and their arity and filled in one pass, 
+* the answers given are not freed.
 * 
 * @param a The queries returned answers
 * @return Pointer to an API query answer struct
 */
 datalog_query_processed_answers_t* datalog_process_answer(dl_answers_t a);
 
+/**
+* @brief Issues a query and keeps its answers as returned by the library
+*
+* Unlike datalog_query_ask, the answers are not processed: no struct or string
+* is allocated per answer or term, the view reads them where the library left
+* them. The view must be freed with datalog_answers_view_free.
+*
+* @param query struct holding a pointer to the literal to be used for the query
+* @param view View to be set up over the answers
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_query_ask_view(datalog_query_t* query,
+        datalog_answers_view_t* view);
+
+/**
+* @brief Sets up a view over a list of answers
+*
+* @param view View to be set up
+* @param a Answers to be viewed, may be NULL
+* @param owned If true, the answers are freed with the view. Batches fetched
+* from a cursor belong to the cursor and must not be owned
+* @return void
+*/
+void datalog_answers_view_init(datalog_answers_view_t* view, dl_answers_t a,
+        bool owned);
+
+/**
+* @brief Returns the predicate of the answers in a view
+*
+* @param view View of the answers
+* @param len Set to the length of the predicate if not NULL
+* @return const char* Borrowed predicate string, NULL when there are no answers
+*/
+const char* datalog_answers_view_predicate(const datalog_answers_view_t* view,
+        size_t* len);
+
+/**
+* @brief Returns a term of an answer in a view
+*
+* @param view View of the answers
+* @param row Index of the answer
+* @param col Index of the term in the answer
+* @param len Set to the length of the term if not NULL
+* @return const char* Borrowed term string, NULL when out of range
+*/
+const char* datalog_answers_view_term(const datalog_answers_view_t* view,
+        int row, int col, size_t* len);
+
+/**
+* @brief Frees the answers of a view if it owns them and empties the view
+*
+* @param view View to be freed
+* @return void
+*/
+void datalog_answers_view_free(datalog_answers_view_t* view);
+
 /**
 * @brief Prints the processed answers structure 
 * 
@@ -702,18 +1197,12 @@ void datalog_free_literal(datalog_literal_t** lit);
 */
 void datalog_free_string_array(char** array, int array_size);
 
-/**
-* @brief Frees a query's answer's list
-* 
-* @param answers Pointer to the answer list 
-* @param answer_count Number of answers in the answer list
-* @return 
-*/
-void datalog_free_query_answers_list(datalog_query_answers_t*** answers, 
-    int answer_count);
-
 /**
 * @brief Frees a processed answers struct
+*
+* The answers' rows and their terms are part of the struct's block and are
+* freed with it, they cannot be freed on their own. This replaces freeing
+* the answer list and each answer.
 * 
 * @param answers Double pointer to the structure to be freed
 * @return void
@@ -728,6 +1217,15 @@ void datalog_free_query_processed_answers(datalog_query_processed_answers_t** an
 */
 void datalog_free_query(datalog_query_t** query);
 
+/**
+* @brief Frees a prepared query, and releases it in the databases it was
+* prepared in
+* 
+* @param Double pointer to the prepared query to be freed
+* @return void
+*/
+void datalog_free_prepared(datalog_prepared_t** prep);
+
 /**
 * @brief Frees a clause object
 * 
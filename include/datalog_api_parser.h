@@ -32,11 +32,34 @@
 /**
  * @brief Calls functions to assert both the rule and fact list 
  *
+ * A fact or rule that cannot be asserted does not stop the rest of the
+ * document from being asserted, the first error is returned. Errors are
+ * reported as by datalog_parser_assert_stream for the same document.
+ *
  * @param doc pointer to parser document stuct
- * @return DATALOG_ERR_t error message
+ * @return DATALOG_ERR_t error message, DATALOG_UNSAFE when an unsafe clause,
+ * such as a fact with a variable, was skipped
  */
 DATALOG_ERR_t datalog_parser_assert_doc(dl_parser_return_doc_t* doc);
 
+/**
+ * @brief Streams a XML document's facts and rules into the engine 
+ *
+ * The document is read with dl_parser_stream and never held as a whole. 
+ * Ground facts are gathered and asserted in batches, the rules and the
+ * facts with variables are coded and asserted whenever a megabyte of
+ * commands has built up, so the memory used stays flat whatever the size
+ * of the document. As with datalog_parser_assert_doc, the rest of the
+ * document is asserted past a fact or rule that cannot be and the first
+ * error is returned.
+ *
+ * @param filename XML file to be asserted
+ * @return DATALOG_ERR_t error message, DATALOG_FILE when the document could
+ * not be read, DATALOG_UNSAFE when an unsafe clause, such as a fact with a
+ * variable, was skipped
+ */
+DATALOG_ERR_t datalog_parser_assert_stream(char* filename);
+
 /**
  * @brief wraps the rule list from the passer into the API and
  * assersts it
@@ -54,10 +77,11 @@ DATALOG_ERR_t datalog_assert_rule_list(dl_parser_return_doc_t* doc);
  * assersts it
  *
  * The linked list of facts is traversed and wrapped into the 
- * datalog_clause_t datatypes
+ * datalog_clause_t datatypes. A batch that fails does not stop the others
+ * from being asserted
  *
  * @param doc pointer to parser document stuct
- * @return DATALOG_ERR_t error message
+ * @return DATALOG_ERR_t error message, the first error met
  */
 DATALOG_ERR_t datalog_assert_fact_list(dl_parser_return_doc_t* doc);
 
@@ -75,8 +75,6 @@ struct dl_parser_fact{
     dl_parser_literal_t* literal;   /*!< fact's literal */
 
     xmlNode* node;                  /*!< node location in the XML tree */
-
-    dl_parser_fact_t* next;         /*!< next fact in a linked list */
 };
 
 /**
@@ -108,10 +106,35 @@ struct dl_parser_rule{
     dl_parser_clause_body_t* body;  /*!< pointer to the body of the rule */
 
     xmlNode* node;                  /*!< XML node */
+};
 
-    dl_parser_rule_t* next;         /*!< next rule in a linked list */
+/**
+* @typedef dl_parser_arena_block_t
+* @brief Typdef for struct dl_parser_arena_block
+*/
+typedef struct dl_parser_arena_block dl_parser_arena_block_t;
 
-    void (*free)(dl_parser_rule_t**);
+/**
+* @struct dl_parser_arena_block
+* @brief A block of memory handed out by an arena
+*/
+struct dl_parser_arena_block{
+    dl_parser_arena_block_t* next;  /*!< block allocated before this one */
+    size_t used;                    /*!< bytes handed out */
+    size_t size;                    /*!< bytes after the header */
 };
 
+/**
+* @typedef dl_parser_arena_t
+* @brief Typdef for struct dl_parser_arena
+*/
+/**
+* @struct dl_parser_arena
+* @brief Hands out the literals, terms and strings of a parsed document from
+* a few large blocks, which are freed all at once
+*/
+typedef struct dl_parser_arena{
+    dl_parser_arena_block_t* blocks;    /*!< newest and largest block first */
+}dl_parser_arena_t;
+
 #endif
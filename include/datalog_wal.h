@@ -0,0 +1,128 @@
+/**
+ * @file        datalog_wal.h
+ * @author      Alexander Hoffman
+ * @email       alxhoff@gmail.com
+ * @website     http://alexhoffman.info
+ * @copyright   GNU GPL v3
+ * @brief       Write-ahead log of the global database of the Datalog API
+ *  
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#ifndef __DATALOG_WAL_H__
+#define __DATALOG_WAL_H__
+
+#include <stdint.h>
+
+#include "datalog_api.h"
+
+//writer lock of the global database, kept by datalog_api.c
+
+/**
+* @brief Takes the writer lock of the global database
+*
+* @param none
+* @return void
+*/
+void datalog_write_lock(void);
+
+/**
+* @brief Releases the writer lock of the global database, counting a change
+* to it when changed is true and ret is 0
+*
+* @param changed did the call holding the lock change the database?
+* @param ret return of the call holding the lock
+* @return int ret
+*/
+int datalog_write_unlock(bool changed, int ret);
+
+/**
+* @brief Publishes the global database to the replicas whether or not it has
+* changed, must hold the writer lock
+*
+* @param none
+* @return int 0 on success
+*/
+int datalog_publish_now_locked(void);
+
+//write-ahead log, kept by datalog_wal.c
+
+/**
+* @brief Is a write-ahead log open on the global database?
+*
+* @param none
+* @return bool true when a log is open
+*/
+bool datalog_wal_is_open(void);
+
+/**
+* @brief Checks that the log takes writes, starting a compaction first when
+* it has grown past the configured size, must hold the writer lock
+*
+* Once a write, a sync, a compaction or an image of the log has failed, the
+* log no longer keeps up with the database, so writes are refused until it is
+* closed and opened again.
+*
+* @param none
+* @return int 0 when writes can be logged
+*/
+int datalog_wal_writable(void);
+
+/**
+* @brief Appends a command buffer that was run on the global database, must
+* hold the writer lock
+*
+* @param cmds command buffer that was run
+* @return uint64_t Bytes appended once it is written, 0 when it could not be
+* appended
+*/
+uint64_t datalog_wal_log_commands(const dl_cmds_t* cmds);
+
+/**
+* @brief Appends a batch of facts asserted into the global database, must
+* hold the writer lock
+*
+* @param predicate predicate of the facts
+* @param pred_len length of the predicate
+* @param arity number of terms of each fact
+* @param count number of facts
+* @param terms count * arity terms, fact by fact
+* @param lens lengths of the terms
+* @return uint64_t Bytes appended once it is written, 0 when it could not be
+* appended
+*/
+uint64_t datalog_wal_log_facts(const char* predicate, size_t pred_len,
+        int arity, size_t count, char** terms, const size_t* lens);
+
+/**
+* @brief Waits for the records of a write call when writes are durable
+*
+* @param upto value returned when the last record of the call was appended
+* @return DATALOG_ERR_t error message
+*/
+DATALOG_ERR_t datalog_wal_commit_wait(uint64_t upto);
+
+/**
+* @brief Writes the image of the database at once, for changes that are not
+* logged, must hold the writer lock
+*
+* @param none
+* @return int 0 on success
+*/
+int datalog_wal_checkpoint_locked(void);
+
+#endif
@@ -26,10 +26,12 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <lua.h>
 #include <lualib.h>
 #include <lauxlib.h>
 #include "datalog.h"
+#include "dl_native.h"
 #include "dl_lua.h"
 
 static int dl_pcall(dl_db_t L, int nargs, int nresults)
@@ -49,8 +51,11 @@ static int dl_pcall(dl_db_t L, int nargs, int nresults)
 static int
 dl_lua(dl_db_t L)
 {
-  int i = luaL_loadbuffer(L, (const char *)datalog_lua_bytes,
-			  sizeof(datalog_lua_bytes), datalog_lua_source);
+  int i;
+  lua_register(L, "dl_kernels", dl_kernels);
+  dl_factstores(L);
+  i = luaL_loadbuffer(L, (const char *)datalog_lua_bytes,
+		      sizeof(datalog_lua_bytes), datalog_lua_source);
   if (i) {
     const char *s = lua_tostring(L, -1);
     if (s)
@@ -96,6 +101,45 @@ dl_open(void)
     return L;
 }
 
+/* The options of a database are stored in the Lua registry using the
+   address of this variable as the key. */
+static const char dl_options_key = 'o';
+
+DATALOG_API dl_db_t
+dl_open_with(int options)
+{
+  lua_State *L = dl_open();
+  if (L && dl_setoptions(L, options)) {
+    lua_close(L);
+    return NULL;
+  }
+  return L;
+}
+
+DATALOG_API int
+dl_setoptions(dl_db_t L, int options)
+{
+  if (!lua_checkstack(L, 2))
+    return 1;
+  lua_pushlightuserdata(L, (void *)&dl_options_key);
+  lua_pushinteger(L, options);
+  lua_rawset(L, LUA_REGISTRYINDEX);
+  return 0;
+}
+
+DATALOG_API int
+dl_getoptions(dl_db_t L)
+{
+  int options;
+  if (!lua_checkstack(L, 1))
+    return 0;
+  lua_pushlightuserdata(L, (void *)&dl_options_key);
+  lua_rawget(L, LUA_REGISTRYINDEX);
+  options = (int)lua_tointeger(L, -1); /* Zero when unset. */
+  lua_pop(L, 1);
+  return options;
+}
+
 DATALOG_API int
 dl_init(dl_db_t L)
 {
@@ -108,6 +152,72 @@ dl_close(dl_db_t L)
   lua_close(L);
 }
 
+/* Replicas are implemented in replica.c. */
+
+DATALOG_API int
+dl_publish(dl_db_t L)
+{
+  if (!lua_checkstack(L, 1))
+    return 1;
+  lua_pushcfunction(L, dl_publish_version);
+  return dl_pcall(L, 0, 0);
+}
+
+DATALOG_API dl_db_t
+dl_open_replica(dl_db_t L)
+{
+  lua_State *R;
+  void *family;
+  if (!lua_checkstack(L, 1))
+    return NULL;
+  lua_pushcfunction(L, dl_family);
+  if (dl_pcall(L, 0, 1))
+    return NULL;
+  family = lua_touserdata(L, -1);
+  lua_pop(L, 1);
+  R = dl_open_with(dl_getoptions(L));
+  if (!R)
+    return NULL;
+  lua_pushcfunction(R, dl_join);
+  lua_pushlightuserdata(R, family);
+  if (dl_pcall(R, 1, 0) || dl_refresh(R)) {
+    lua_close(R);
+    return NULL;
+  }
+  return R;
+}
+
+DATALOG_API int
+dl_refresh(dl_db_t L)
+{
+  if (!lua_checkstack(L, 1))
+    return 1;
+  lua_pushcfunction(L, dl_refresh_version);
+  return dl_pcall(L, 0, 0);
+}
+
+/* Images are implemented in image.c. */
+
+DATALOG_API int
+dl_save_image(dl_db_t L, const char *path)
+{
+  if (!lua_checkstack(L, 2))
+    return 1;
+  lua_pushcfunction(L, dl_image_save);
+  lua_pushstring(L, path);
+  return dl_pcall(L, 1, 0);
+}
+
+DATALOG_API int
+dl_load_image(dl_db_t L, const char *path)
+{
+  if (!lua_checkstack(L, 2))
+    return 1;
+  lua_pushcfunction(L, dl_image_load);
+  lua_pushstring(L, path);
+  return dl_pcall(L, 1, 0);
+}
+
 /* Return package name and version information. */
 DATALOG_API const char *
 dl_version(void)
@@ -198,6 +308,17 @@ dl_addconst(dl_db_t L)
   return dl_pcall(L, 2, 1);
 }
 
+/* Stack: ... table -> ... table */
+DATALOG_API int
+dl_addparam(dl_db_t L)
+{
+  if (!lua_checkstack(L, 1))
+    return 1;
+  lua_getglobal(L, "dl_addparam");
+  lua_insert(L, -2);
+  return dl_pcall(L, 1, 1);
+}
+
 /* Stack: ... table -> ... literal */
 DATALOG_API int
 dl_makeliteral(dl_db_t L)
@@ -270,21 +391,312 @@ dl_retract(dl_db_t L)
   return dl_pcall(L, 1, 0);
 }
 
-/* The dl_ask function returns the list of facts it derives from a
-   literal provided as the function's query.  A pointer to the
-   dl_answers structure represents the list. */
-
-struct dl_answers {
-  size_t arity;
+/* A batch of facts given to dl_assert_facts. */
+typedef struct {
+  const char *pred;
   size_t len;
-  char **pred;
-#if !defined __STDC_VERSION__ || __STDC_VERSION__ < 199901L
-  char **term[1];
-#else
-  char **term[];
-#endif
+  int arity;
+  size_t n;
+  const char **terms;
+  const size_t *lens;
+} dl_facts_t;
+
+/* Stack: ... facts -> ...
+   Called in protected mode, so that running out of memory while the
+   terms are copied into Lua is reported as an error. */
+static int
+dl_assert_batch(lua_State *L)
+{
+  dl_facts_t *f = (dl_facts_t *)lua_touserdata(L, 1);
+  size_t i, m = f->n * f->arity;
+  lua_getglobal(L, "dl_assert_facts");
+  lua_pushlstring(L, f->pred, f->len);
+  lua_pushinteger(L, f->arity);
+  lua_pushinteger(L, (lua_Integer)f->n);
+  lua_createtable(L, m < (size_t)INT_MAX ? (int)m : 0, 0);
+  for (i = 0; i < m; i++) {
+    const char *t = f->terms[i];
+    lua_pushlstring(L, t, f->lens ? f->lens[i] : strlen(t));
+    lua_rawseti(L, -2, i + 1);
+  }
+  lua_call(L, 4, 0);
+  return 0;
+}
+
+DATALOG_API int
+dl_assert_lfacts(dl_db_t L, const char *pred, size_t len, int arity,
+		 size_t n, const char **terms, const size_t *lens)
+{
+  dl_facts_t f;
+  if (arity < 0 || !lua_checkstack(L, 2))
+    return 1;
+  f.pred = pred;
+  f.len = len;
+  f.arity = arity;
+  f.n = n;
+  f.terms = terms;
+  f.lens = lens;
+  lua_pushcfunction(L, dl_assert_batch);
+  lua_pushlightuserdata(L, &f);
+  return dl_pcall(L, 1, 0);
+}
+
+DATALOG_API int
+dl_assert_facts(dl_db_t L, const char *pred, int arity, size_t n,
+		const char **terms)
+{
+  return dl_assert_lfacts(L, pred, strlen(pred), arity, n, terms, NULL);
+}
+
+/* Command buffers are run by a C function called in protected mode,
+   which calls the Lua functions behind each operation directly.  The
+   functions are looked up once, and kept at the bottom of the
+   function's stack, below the items made by the commands. */
+
+static const struct {
+  const char *name;		/* Lua function run by the operation. */
+  int string;			/* Does the operation take a string? */
+  int nargs;			/* Items popped, with the string. */
+  int nresults;			/* Items pushed. */
+} dl_ops[] = {
+  {NULL, 0, 0, 0},
+  {"dl_pushliteral", 0, 0, 1},
+  {"dl_addpred", 1, 2, 1},
+  {"dl_addvar", 1, 2, 1},
+  {"dl_addconst", 1, 2, 1},
+  {"dl_makeliteral", 0, 1, 1},
+  {"dl_pushhead", 0, 1, 1},
+  {"dl_addliteral", 0, 2, 1},
+  {"dl_makeclause", 0, 1, 1},
+  {"dl_assert", 0, 1, 1},
+  {"dl_retract", 0, 1, 0}
 };
 
+#define DL_OPS ((int)(sizeof(dl_ops) / sizeof(dl_ops[0])))
+
+/* The commands given to dl_exec. */
+typedef struct {
+  const unsigned char *buf;
+  size_t len;
+  int unsafe;			/* Was an unsafe clause asserted? */
+} dl_commands_t;
+
+/* Stack: commands -> items left by the commands */
+static int
+dl_run_commands(lua_State *L)
+{
+  dl_commands_t *x = (dl_commands_t *)lua_touserdata(L, 1);
+  const unsigned char *p = x->buf, *end = p + x->len;
+  int op, base = DL_OPS - 1;
+  lua_pop(L, 1);
+  luaL_checkstack(L, DL_OPS + 3, "command buffer");
+  for (op = 1; op < DL_OPS; op++)
+    lua_getglobal(L, dl_ops[op].name);
+  while (p < end) {
+    op = *p++;
+    if (op < 1 || op >= DL_OPS)
+      return luaL_error(L, "bad command %d in command buffer", op);
+    if (lua_gettop(L) - base < dl_ops[op].nargs - dl_ops[op].string)
+      return luaL_error(L, "command buffer stack underflow");
+    luaL_checkstack(L, 3, "command buffer");
+    lua_pushvalue(L, op);
+    lua_insert(L, -1 - (dl_ops[op].nargs - dl_ops[op].string));
+    if (dl_ops[op].string) {	/* The length, then the characters. */
+      size_t n = 0;
+      int shift = 0, c;
+      do {
+	if (p == end || shift >= (int)(8 * sizeof(size_t)))
+	  return luaL_error(L, "bad string in command buffer");
+	c = *p++;
+	n |= (size_t)(c & 0x7f) << shift;
+	shift += 7;
+      } while (c & 0x80);
+      if (n > (size_t)(end - p))
+	return luaL_error(L, "bad string in command buffer");
+      lua_pushlstring(L, (const char *)p, n);
+      p += n;
+    }
+    lua_call(L, dl_ops[op].nargs, dl_ops[op].nresults);
+    if (op == DL_OP_ASSERT) {
+      if (lua_isnil(L, -1))
+	x->unsafe = 1;
+      lua_pop(L, 1);
+    }
+  }
+  return lua_gettop(L) - base;
+}
+
+/* Stack: ... -> ... items left by the commands */
+DATALOG_API int
+dl_exec(dl_db_t L, const void *buf, size_t len)
+{
+  dl_commands_t x;
+  int i;
+  if (!lua_checkstack(L, 2))
+    return 1;
+  x.buf = (const unsigned char *)buf;
+  x.len = len;
+  x.unsafe = 0;
+  lua_pushcfunction(L, dl_run_commands);
+  lua_pushlightuserdata(L, &x);
+  i = dl_pcall(L, 1, LUA_MULTRET);
+  if (i)
+    return i;
+  return -x.unsafe;
+}
+
+DATALOG_API void
+dl_cmds_init(dl_cmds_t *cmds)
+{
+  cmds->buf = NULL;
+  cmds->len = 0;
+  cmds->cap = 0;
+  cmds->err = 0;
+}
+
+/* Makes room for n more bytes. */
+static int
+dl_cmds_reserve(dl_cmds_t *cmds, size_t n)
+{
+  size_t cap;
+  unsigned char *b;
+  if (cmds->err)
+    return 1;
+  if (cmds->len + n <= cmds->cap)
+    return 0;
+  cap = cmds->cap ? 2 * cmds->cap : 256;
+  while (cap < cmds->len + n)
+    cap *= 2;
+  b = (unsigned char *)realloc(cmds->buf, cap);
+  if (!b) {
+    cmds->err = 1;
+    return 1;
+  }
+  cmds->buf = b;
+  cmds->cap = cap;
+  return 0;
+}
+
+DATALOG_API int
+dl_cmd(dl_cmds_t *cmds, int op)
+{
+  if (dl_cmds_reserve(cmds, 1))
+    return 1;
+  cmds->buf[cmds->len++] = (unsigned char)op;
+  return 0;
+}
+
+DATALOG_API int
+dl_cmd_lstring(dl_cmds_t *cmds, int op, const char *s, size_t n)
+{
+  size_t m = n;
+  if (dl_cmds_reserve(cmds, n + 2 + sizeof(size_t) * 8 / 7))
+    return 1;
+  cmds->buf[cmds->len++] = (unsigned char)op;
+  while (m >= 0x80) {
+    cmds->buf[cmds->len++] = (unsigned char)(m | 0x80);
+    m >>= 7;
+  }
+  cmds->buf[cmds->len++] = (unsigned char)m;
+  memcpy(cmds->buf + cmds->len, s, n);
+  cmds->len += n;
+  return 0;
+}
+
+DATALOG_API int
+dl_cmd_string(dl_cmds_t *cmds, int op, const char *s)
+{
+  return dl_cmd_lstring(cmds, op, s, strlen(s));
+}
+
+DATALOG_API void
+dl_cmds_free(dl_cmds_t *cmds)
+{
+  free(cmds->buf);
+  dl_cmds_init(cmds);
+}
+
+/* Stack: ... -> ... */
+DATALOG_API int
+dl_save(dl_db_t L)
+{
+  if (!lua_checkstack(L, 1))
+    return 1;
+  lua_getglobal(L, "dl_save");
+  return dl_pcall(L, 0, 0);
+}
+
+/* Stack: ... -> ... */
+DATALOG_API int
+dl_restore(dl_db_t L)
+{
+  if (!lua_checkstack(L, 1))
+    return 1;
+  lua_getglobal(L, "dl_restore");
+  return dl_pcall(L, 0, 0);
+}
+
+/* Stack: ... -> ... */
+DATALOG_API int
+dl_snapshot(dl_db_t L, int *snapshot)
+{
+  int i;
+  if (!lua_checkstack(L, 1))
+    return 1;
+  lua_getglobal(L, "dl_snapshot");
+  i = dl_pcall(L, 0, 1);
+  if (i)
+    return i;
+  *snapshot = (int)lua_tointeger(L, -1);
+  lua_pop(L, 1);
+  return 0;
+}
+
+/* Stack: ... -> ... */
+DATALOG_API int
+dl_revert(dl_db_t L, int snapshot)
+{
+  if (!lua_checkstack(L, 2))
+    return 1;
+  lua_getglobal(L, "dl_revert");
+  lua_pushinteger(L, snapshot);
+  return dl_pcall(L, 1, 0);
+}
+
+/* Stack: ... -> ... */
+DATALOG_API int
+dl_release(dl_db_t L, int snapshot)
+{
+  if (!lua_checkstack(L, 2))
+    return 1;
+  lua_getglobal(L, "dl_release");
+  lua_pushinteger(L, snapshot);
+  return dl_pcall(L, 1, 0);
+}
+
+/* Stack: ... literal -> ... */
+DATALOG_API int
+dl_materialize(dl_db_t L)
+{
+  int i;
+  if (!lua_checkstack(L, 1))
+    return 1;
+  lua_getglobal(L, "dl_materialize");
+  lua_insert(L, -2);
+  i = dl_pcall(L, 1, 1);
+  if (i)
+    return i;
+  i = lua_isnil(L, -1);		/* Nil indicates a primitive. */
+  lua_pop(L, 1);
+  return -i;
+}
+
+/* The dl_ask function returns the list of facts it derives from a
+   literal provided as the function's query.  A pointer to the
+   dl_answers structure represents the list.  The structure is
+   defined in dl_native.h, as the native evaluator also creates
+   lists. */
+
 /* There are three blocks of memory that make up a list of answers.
    The name of the predicate and all the constant terms are placed in
    one array of characters.  An array of character pointers is used to
@@ -322,9 +734,88 @@ dl_free(dl_answers_t a)
   }
 }
 
+dl_answers_t
+dl_answers_alloc(size_t n, size_t arity, size_t size)
+{
+  char *s = (char *)malloc(size); /* Allocate the three blocks. */
+  char **p = (char **)malloc((n * arity + 2) * sizeof(char *));
+#if !defined __STDC_VERSION__ || __STDC_VERSION__ < 199901L
+  dl_answers_t b = (dl_answers_t)malloc(sizeof(struct dl_answers)
+					+ (n - 1) * sizeof(char **));
+#else
+  dl_answers_t b = (dl_answers_t)malloc(sizeof(struct dl_answers)
+					+ n * sizeof(char **));
+#endif
+  if (!s || !p || !b) {
+    free(s);
+    free(p);
+    free(b);
+    return NULL;
+  }
+  b->arity = arity;
+  b->len = n;
+  p[0] = s;
+  b->pred = p;
+  return b;
+}
+
 /* Stack: ... literal -> ... */
 DATALOG_API int
 dl_ask(dl_db_t L, dl_answers_t *a)
+{
+  return dl_ask_with(L, a, dl_getoptions(L));
+}
+
+/* Stack: ... literal -> ... query preds const, or ... literal when
+   the native evaluator cannot answer the query.  The query is the
+   literal, or the literal rewritten by the magic sets
+   transformation. */
+static int
+dl_program(dl_db_t L, int options)
+{
+  if (!lua_checkstack(L, 4))
+    return 1;
+  lua_getglobal(L, "dl_program");
+  lua_pushvalue(L, -2);
+  lua_pushboolean(L, options & DL_OPT_MAGIC);
+  if (dl_pcall(L, 2, 3)) {
+    lua_pop(L, 1);		/* Pop the literal as dl_ask does. */
+    return 1;
+  }
+  if (lua_isnil(L, -3))		/* Nil selects the tabled prover. */
+    lua_pop(L, 3);
+  else
+    lua_remove(L, -4);
+  return 0;
+}
+
+/* Stack: ... literal -> ... literal, or ... when the native evaluator
+   has answered the query.  Sets done to one in that case. */
+static int
+dl_native(dl_db_t L, dl_answers_t *a, int options, const dl_agg_t *agg,
+	  int *done)
+{
+  int top = lua_gettop(L);
+  *done = 0;
+  if (!(options & DL_OPT_BOTTOMUP))
+    return 0;
+  if (dl_program(L, options))
+    return 1;
+  if (lua_gettop(L) > top) {	/* The native evaluator applies. */
+    int i = dl_seminaive(L, a, agg, options & DL_OPT_PARALLEL
+			 ? DL_OPT_GETTHREADS(options) : 1);
+    lua_pop(L, 3);
+    *done = 1;
+    return i;
+  }
+  return 0;
+}
+
+/* Stack: ... answers -> ...
+   Copies the answers made by the Lua functions dl_ask and
+   dl_aggregate into a freshly allocated list. */
+static int
+dl_unpack(dl_db_t L, dl_answers_t *a)
 {
   int i, j;
   lua_Integer n;		/* Number of answers. */
@@ -335,15 +826,7 @@ dl_ask(dl_db_t L, dl_answers_t *a)
   const char *ls;	   /* A string from lua. */
   char **p;		 /* Stores the location to insert a char *. */
   dl_answers_t b;
-  *a = NULL;
-  if (!lua_checkstack(L, 1))
-    return 1;
 
-  lua_getglobal(L, "dl_ask");
-  lua_insert(L, -2);
-  i = dl_pcall(L, 1, 1);
-  if (i)
-    return i;
   if (!lua_istable(L, -1)) {
     i = !lua_isnil(L, -1);	/* Nil indicates no answers. */
     lua_pop(L, 1);
@@ -382,21 +865,11 @@ dl_ask(dl_db_t L, dl_answers_t *a)
   if (n < 0 || arity < 0 || size < 0)
     return 1;
 
-  s = (char *)malloc(size);	/* Allocate the three blocks. */
-  p = (char **)malloc((n * arity + 2) * sizeof(char *));
-#if !defined __STDC_VERSION__ || __STDC_VERSION__ < 199901L
-  b = (dl_answers_t)malloc(sizeof(struct dl_answers)
-			   + (n - 1) * sizeof(char **));
-#else
-  b = (dl_answers_t)malloc(sizeof(struct dl_answers) + n * sizeof(char **));
-#endif
-  if (!s || !p || !b)
+  b = dl_answers_alloc(n, arity, size);
+  if (!b)
     return 1;		       /* Abort on memory allocation error. */
-
-  b->arity = arity;
-  b->len = n;
-  p[0] = s;
-  b->pred = p;
+  s = b->pred[0];
+  p = b->pred;
 
   lua_pushstring(L, "name");	/* Get predicate name. */
   lua_rawget(L, -2);
@@ -442,6 +915,397 @@ dl_ask(dl_db_t L, dl_answers_t *a)
   return 0;			/* indicate success. */
 }
 
+/* Stack: ... literal -> ... */
+DATALOG_API int
+dl_ask_with(dl_db_t L, dl_answers_t *a, int options)
+{
+  int i, done;
+  *a = NULL;
+  if (!lua_checkstack(L, 1))
+    return 1;
+  i = dl_native(L, a, options, NULL, &done);
+  if (i || done)
+    return i;
+  lua_getglobal(L, "dl_ask");
+  lua_insert(L, -2);
+  i = dl_pcall(L, 1, 1);
+  if (i)
+    return i;
+  return dl_unpack(L, a);
+}
+
+static const char *dl_agg_names[] = {"count", "sum", "min", "max"};
+
+/* Stack: ... literal -> ... */
+DATALOG_API int
+dl_aggregate(dl_db_t L, dl_answers_t *a, int op, int column,
+	     unsigned long group)
+{
+  dl_agg_t agg;
+  int i, j, done;
+  *a = NULL;
+  if (op < DL_AGG_COUNT || op > DL_AGG_MAX) {
+    lua_pop(L, 1);
+    return 1;
+  }
+  if (!lua_checkstack(L, 4)) {
+    lua_pop(L, 1);
+    return 1;
+  }
+  agg.op = op;
+  agg.column = column;
+  agg.group = group;
+  i = dl_native(L, a, dl_getoptions(L), &agg, &done);
+  if (i || done)
+    return i;
+  lua_getglobal(L, "dl_aggregate");
+  lua_insert(L, -2);
+  lua_pushstring(L, dl_agg_names[op]);
+  lua_pushinteger(L, column + 1);
+  lua_newtable(L);
+  for (i = 0, j = 0; i < (int)(8 * sizeof(unsigned long)); i++)
+    if (group & (1UL << i)) {
+      lua_pushinteger(L, i + 1);
+      lua_rawseti(L, -2, ++j);
+    }
+  i = dl_pcall(L, 4, 1);
+  if (i)
+    return i;
+  return dl_unpack(L, a);
+}
+
+/* A cursor hands out the answers to a query in batches laid out like
+   the lists made by dl_ask, using blocks of memory that are reused
+   from one batch to the next.  The tabled prover leaves the answers
+   in the table of facts of the query's subgoal, so the cursor keeps
+   that table in the registry, along with the key of the next answer,
+   and walks it with lua_next.  The native evaluator keeps the
+   relation it computed, whose rows are selected as they are read. */
+
+struct dl_cursor {
+  dl_db_t L;
+  int ref;			/* The facts and the next key. */
+  dl_sn_query_t *native;	/* Or the native evaluation. */
+  char *name;			/* The predicate of the answers. */
+  size_t namelen;
+  size_t arity;
+  int done;			/* Have all answers been read? */
+  dl_answers_t batch;		/* Room for cap answers. */
+  size_t cap;
+  char **ptrs;			/* The char * array of the batch. */
+  size_t *offs;			/* The strings as offsets into chars. */
+  char *chars;			/* The char array of the batch. */
+  size_t nchars, capchars;
+  const char **terms;		/* An answer read from the evaluator. */
+  size_t *lens;
+};
+
+/* Records the predicate of the answers, and makes room for reading
+   one answer. */
+static int
+dl_cursor_init(dl_cursor_t c, const char *name, size_t len, size_t arity)
+{
+  c->name = (char *)malloc(len + 1);
+  c->terms = (const char **)malloc((arity + 1) * sizeof(const char *));
+  c->lens = (size_t *)malloc((arity + 1) * sizeof(size_t));
+  if (!c->name || !c->terms || !c->lens)
+    return 1;
+  memcpy(c->name, name, len);
+  c->name[len] = 0;
+  c->namelen = len;
+  c->arity = arity;
+  return 0;
+}
+
+/* Stack: ... literal -> ... */
+DATALOG_API int
+dl_ask_open(dl_db_t L, dl_cursor_t *cursor)
+{
+  dl_cursor_t c;
+  const char *s;
+  size_t len, arity;
+  int i, top, options = dl_getoptions(L);
+  *cursor = NULL;
+  if (!lua_checkstack(L, 3))
+    return 1;
+  c = (dl_cursor_t)calloc(1, sizeof(struct dl_cursor));
+  if (!c) {
+    lua_pop(L, 1);
+    return 1;
+  }
+  c->L = L;
+  c->ref = LUA_NOREF;
+  top = lua_gettop(L);
+  if (options & DL_OPT_BOTTOMUP) {
+    if (dl_program(L, options)) {
+      free(c);
+      return 1;
+    }
+    if (lua_gettop(L) > top) {	/* The native evaluator applies. */
+      i = dl_seminaive_open(L, &c->native, options & DL_OPT_PARALLEL
+			    ? DL_OPT_GETTHREADS(options) : 1);
+      lua_pop(L, 3);
+      if (i) {
+	free(c);
+	return 1;
+      }
+      s = dl_seminaive_pred(c->native, &len, &arity);
+      c->done = !s;
+      if (dl_cursor_init(c, s ? s : "", len, arity)) {
+	dl_ask_close(c);
+	return 1;
+      }
+      *cursor = c;
+      return 0;
+    }
+  }
+  lua_getglobal(L, "dl_ask_open");
+  lua_insert(L, -2);
+  if (dl_pcall(L, 1, 3)) {
+    free(c);
+    return 1;
+  }
+  s = lua_tolstring(L, -2, &len);
+  arity = (size_t)lua_tointeger(L, -1);
+  i = !s || dl_cursor_init(c, s, len, arity);
+  lua_pop(L, 2);
+  c->ref = luaL_ref(L, LUA_REGISTRYINDEX);
+  if (i) {
+    dl_ask_close(c);
+    return 1;
+  }
+  *cursor = c;
+  return 0;
+}
+
+/* Makes room for a batch of n answers. */
+static int
+dl_cursor_reserve(dl_cursor_t c, size_t n)
+{
+  size_t m = n * c->arity + 2;
+  dl_answers_t b;
+  char **p;
+  size_t *o;
+  if (n <= c->cap)
+    return 0;
+#if !defined __STDC_VERSION__ || __STDC_VERSION__ < 199901L
+  b = (dl_answers_t)realloc(c->batch, sizeof(struct dl_answers)
+			    + (n - 1) * sizeof(char **));
+#else
+  b = (dl_answers_t)realloc(c->batch, sizeof(struct dl_answers)
+			    + n * sizeof(char **));
+#endif
+  if (!b)
+    return 1;
+  c->batch = b;
+  p = (char **)realloc(c->ptrs, m * sizeof(char *));
+  if (!p)
+    return 1;
+  c->ptrs = p;
+  o = (size_t *)realloc(c->offs, m * sizeof(size_t));
+  if (!o)
+    return 1;
+  c->offs = o;
+  c->cap = n;
+  return 0;
+}
+
+/* Adds the kth string of a batch. */
+static int
+dl_cursor_put(dl_cursor_t c, const char *s, size_t len, size_t k)
+{
+  if (c->nchars + len + 1 > c->capchars) {
+    size_t cap = c->capchars ? 2 * c->capchars : 256;
+    char *t;
+    while (cap < c->nchars + len + 1)
+      cap *= 2;
+    t = (char *)realloc(c->chars, cap);
+    if (!t)
+      return 1;
+    c->chars = t;
+    c->capchars = cap;
+  }
+  memcpy(c->chars + c->nchars, s, len);
+  c->chars[c->nchars + len] = 0;
+  c->offs[k] = c->nchars;
+  c->nchars += len + 1;
+  return 0;
+}
+
+/* Reads answers from the table of facts into a batch.  Returns the
+   number read, or -1 when out of memory. */
+static long
+dl_cursor_facts(dl_cursor_t c, size_t n, size_t *k)
+{
+  lua_State *L = c->L;
+  int top = lua_gettop(L);
+  const char *s;
+  size_t i = 0, j, len;
+  if (!lua_checkstack(L, 6))
+    return -1;
+  lua_rawgeti(L, LUA_REGISTRYINDEX, c->ref);
+  lua_rawgeti(L, -1, 1);	/* The facts. */
+  lua_rawgeti(L, -2, 2);	/* The key of the next answer. */
+  while (i < n && lua_next(L, -2)) {
+    for (j = 0; j < c->arity; j++) {
+      lua_rawgeti(L, -1, j + 1);
+      lua_pushstring(L, "id");
+      lua_rawget(L, -2);
+      s = lua_tolstring(L, -1, &len);
+      if (!s || dl_cursor_put(c, s, len, (*k)++)) {
+	lua_settop(L, top);
+	return -1;
+      }
+      lua_pop(L, 2);
+    }
+    lua_pop(L, 1);		/* Keep the key. */
+    i++;
+  }
+  if (i == n)			/* Save the key. */
+    lua_rawseti(L, -3, 2);
+  lua_settop(L, top);
+  return (long)i;
+}
+
+/* Reads answers from the native evaluation into a batch. */
+static long
+dl_cursor_native(dl_cursor_t c, size_t n, size_t *k)
+{
+  size_t i = 0, j;
+  while (i < n && dl_seminaive_next(c->native, c->terms, c->lens)) {
+    for (j = 0; j < c->arity; j++)
+      if (dl_cursor_put(c, c->terms[j], c->lens[j], (*k)++))
+	return -1;
+    i++;
+  }
+  return (long)i;
+}
+
+DATALOG_API int
+dl_ask_next_batch(dl_cursor_t c, size_t n, dl_answers_t *a)
+{
+  size_t i, k = 0;
+  long m;
+  *a = NULL;
+  if (!c || c->done || n == 0)
+    return 0;
+  if (dl_cursor_reserve(c, n))
+    return 1;
+  c->nchars = 0;
+  if (dl_cursor_put(c, c->name, c->namelen, k++))
+    return 1;
+  m = c->native ? dl_cursor_native(c, n, &k) : dl_cursor_facts(c, n, &k);
+  if (m < 0)
+    return 1;
+  if ((size_t)m < n)
+    c->done = 1;
+  if (m == 0)
+    return 0;
+  c->offs[k] = c->nchars;	/* The end of the last string. */
+  for (i = 0; i <= k; i++)
+    c->ptrs[i] = c->chars + c->offs[i];
+  c->batch->arity = c->arity;
+  c->batch->len = (size_t)m;
+  c->batch->pred = c->ptrs;
+  for (i = 0; i < (size_t)m; i++)
+    c->batch->term[i] = c->ptrs + 1 + i * c->arity;
+  *a = c->batch;
+  return 0;
+}
+
+DATALOG_API void
+dl_ask_close(dl_cursor_t c)
+{
+  if (c) {
+    if (c->ref != LUA_NOREF)
+      luaL_unref(c->L, LUA_REGISTRYINDEX, c->ref);
+    dl_seminaive_close(c->native);
+    free(c->name);
+    free(c->terms);
+    free(c->lens);
+    free(c->batch);
+    free(c->ptrs);
+    free(c->offs);
+    free(c->chars);
+    free(c);
+  }
+}
+
+/* A prepared query lives in the registry, along with the table of the
+   values of its parameters.  Its handle is a userdata held by the
+   query, so the handle is freed with the database. */
+
+struct dl_prepared {
+  dl_db_t L;
+  int ref;			/* The prepared query. */
+  int values;			/* The values of its parameters. */
+  int n;			/* The number of parameters. */
+};
+
+/* Stack: ... literal -> ... */
+DATALOG_API int
+dl_prepare(dl_db_t L, dl_prepared_t *prepared)
+{
+  dl_prepared_t p;
+  *prepared = NULL;
+  if (!lua_checkstack(L, 3))
+    return 1;
+  lua_getglobal(L, "dl_prepare");
+  lua_insert(L, -2);
+  p = (dl_prepared_t)lua_newuserdata(L, sizeof(struct dl_prepared));
+  if (dl_pcall(L, 2, 3))
+    return 1;
+  p->L = L;
+  p->n = (int)lua_tointeger(L, -1);
+  lua_pop(L, 1);
+  p->values = luaL_ref(L, LUA_REGISTRYINDEX);
+  p->ref = luaL_ref(L, LUA_REGISTRYINDEX);
+  *prepared = p;
+  return 0;
+}
+
+/* Stack: ... -> ... */
+DATALOG_API int
+dl_bindlstring(dl_prepared_t p, int i, const char *s, size_t n)
+{
+  lua_State *L = p->L;
+  if (i < 0 || i >= p->n || !lua_checkstack(L, 2))
+    return 1;
+  lua_rawgeti(L, LUA_REGISTRYINDEX, p->values);
+  lua_pushlstring(L, s, n);
+  lua_rawseti(L, -2, i + 1);
+  lua_pop(L, 1);
+  return 0;
+}
+
+/* Stack: ... -> ... */
+DATALOG_API int
+dl_bindstring(dl_prepared_t p, int i, const char *s)
+{
+  return dl_bindlstring(p, i, s, strlen(s));
+}
+
+/* Stack: ... -> ... literal */
+DATALOG_API int
+dl_pushprepared(dl_prepared_t p)
+{
+  lua_State *L = p->L;
+  if (!lua_checkstack(L, 2))
+    return 1;
+  lua_getglobal(L, "dl_instantiate");
+  lua_rawgeti(L, LUA_REGISTRYINDEX, p->ref);
+  return dl_pcall(L, 1, 1);
+}
+
+DATALOG_API void
+dl_unprepare(dl_prepared_t p)
+{
+  if (p) {
+    luaL_unref(p->L, LUA_REGISTRYINDEX, p->values);
+    luaL_unref(p->L, LUA_REGISTRYINDEX, p->ref);
+  }
+}
+
 DATALOG_API char *
 dl_getpred(dl_answers_t a)
 {
@@ -469,6 +1333,15 @@ dl_getpredarity(dl_answers_t a)
     return 0;
 }
 
+DATALOG_API size_t
+dl_getlen(dl_answers_t a)
+{
+  if (a)
+    return a->len;
+  else
+    return 0;
+}
+
 DATALOG_API char *
 dl_getconst(dl_answers_t a, int i, int j)
 {
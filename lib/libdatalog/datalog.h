@@ -44,6 +44,43 @@ typedef struct dl_answers *dl_answers_t;
 /* Create a Datalog database. */
 DATALOG_API dl_db_t dl_open(void);
 
+/* Options that select how queries are answered. */
+
+/* Answer queries with the native semi-naive bottom-up evaluator
+   instead of the tabled prover written in Lua.  The evaluator
+   computes every fact derivable for the predicates a query depends
+   on, so it pays off for recursive queries over many facts.  Queries
+   that depend on a primitive other than equality are still answered
+   by the tabled prover. */
+#define DL_OPT_BOTTOMUP 0x1
+
+/* With DL_OPT_BOTTOMUP, rewrite the program for each query with
+   constant arguments using the magic sets transformation, so that
+   the evaluator only derives facts relevant to the query.  Rewritten
+   programs are reused by queries with constants in the same argument
+   positions, until a rule is asserted or retracted. */
+#define DL_OPT_MAGIC 0x2
+
+/* With DL_OPT_BOTTOMUP, share the work of each round of the
+   evaluator that has a large delta between several threads.  The
+   number of threads is given with DL_OPT_THREADS, and when it is
+   zero, one thread per processor is used.  The answers are the same
+   as without the option, but may be listed in a different order. */
+#define DL_OPT_PARALLEL 0x4
+#define DL_OPT_THREADS(n) ((n) << 8)
+#define DL_OPT_GETTHREADS(options) (((options) >> 8) & 0xffff)
+
+/* Create a Datalog database that answers queries as selected by the
+   options. */
+DATALOG_API dl_db_t dl_open_with(int options);
+
+/* Sets the options used by dl_ask. */
+DATALOG_API int dl_setoptions(dl_db_t db, int options);
+
+/* Gets the options used by dl_ask.  For this function, the return
+   value does not indicate success or failure. */
+DATALOG_API int dl_getoptions(dl_db_t db);
+
 /* Initialize a database.  Used when a database structure exists that
    lacks Datalog specific initializations.  This initialization is one
    of the actions performed by dl_open. */
@@ -55,6 +92,52 @@ DATALOG_API void dl_close(dl_db_t db);
 /* Return package name and version information. */
 DATALOG_API const char *dl_version(void);
 
+/* Replicas */
+
+/* A replica is a read-only database answering queries from a version
+   of the facts and rules of another database, which it shares instead
+   of copying them.  A replica is an independent Lua state, so each
+   replica can be used by its own thread while the database changes
+   in another.  Replicas must not be given clauses of their own. */
+
+/* Publishes the facts and rules of a database as its current version.
+   The version is made atomically, and replicas see it when refreshed.
+   A version is a snapshot that copies no facts: the database goes on
+   adding facts after the ones it sees, and only copies the facts of a
+   predicate when one is retracted while a version holds them. */
+DATALOG_API int dl_publish(dl_db_t db);
+
+/* Creates a replica of a database, with its options and the version
+   it last published, publishing one when it has not.  Returns the null
+   pointer on failure.  A replica is disposed with dl_close, and may
+   outlive its database. */
+DATALOG_API dl_db_t dl_open_replica(dl_db_t db);
+
+/* Installs the version last published in a replica, if it has not
+   done so already.  Holding a version keeps its facts alive, so a
+   replica is best refreshed before each query. */
+DATALOG_API int dl_refresh(dl_db_t replica);
+
+/* Images */
+
+/* An image is a file holding the facts and rules of a database, and
+   the ids of its constants, in the layout the database uses in
+   memory.  Loading an image maps the file into memory and uses its
+   facts where they are, so a database starts in about the time it
+   takes to page in the file, rather than the time to assert its
+   facts.  An image can only be loaded by the kind of machine that
+   saved it, and by the version of the library that did. */
+
+/* Saves the facts and rules of a database to an image file.  The
+   file is written under another name, synced to disk, and then
+   renamed, so a reader never sees it partly written.  The caller
+   syncs the directory when the rename must survive a crash. */
+DATALOG_API int dl_save_image(dl_db_t db, const char *path);
+
+/* Loads an image file into a database without clauses, which has not
+   yet published a version for replicas. */
+DATALOG_API int dl_load_image(dl_db_t db, const char *path);
+
 /* There are two ways to build literals and clauses, and assert and
    retract clauses.  The low-level interface builds items by pushing
    each of its component on a stack, and then inserting it into the
@@ -109,6 +192,12 @@ DATALOG_API int dl_addvar(dl_db_t db);
    terms of a literal.  Pops the string from stack. */
 DATALOG_API int dl_addconst(dl_db_t db);
 
+/* Add a parameter to the list of terms of a literal that is to be
+   prepared with dl_prepare.  A parameter is replaced by the constant
+   bound to it each time the prepared query is asked.  Parameters are
+   numbered from zero in the order they are added. */
+DATALOG_API int dl_addparam(dl_db_t db);
+
 /* Finish making a literal after adding all terms and one predicate
    symbol.  Leaves a completed literal on the top of the stack. */
 DATALOG_API int dl_makeliteral(dl_db_t db);
@@ -141,6 +230,109 @@ DATALOG_API int dl_assert(dl_db_t db);
    from the database and popped off the stack. */
 DATALOG_API int dl_retract(dl_db_t db);
 
+/* Asserts n facts of the predicate pred with the given arity, whose
+   terms are the constants listed in order in terms, arity for each
+   fact, as zero terminated strings.  The facts are added in a single
+   call into the database, without building literals and clauses on
+   the stack. */
+DATALOG_API int dl_assert_facts(dl_db_t db, const char *pred, int arity,
+				size_t n, const char **terms);
+
+/* Like dl_assert_facts, but the predicate has length len, and term i
+   has length lens[i], so the strings may contain zeros. */
+DATALOG_API int dl_assert_lfacts(dl_db_t db, const char *pred, size_t len,
+				 int arity, size_t n, const char **terms,
+				 const size_t *lens);
+
+/* Command buffers */
+
+/* A command buffer holds a sequence of the stack operations above,
+   which dl_exec runs in a single call into the database, instead of
+   one call for each operation.  Each operation is coded as one byte.
+   The operations that push a string and add it to a literal are
+   followed by the string, coded as its length, seven bits per byte
+   from the lowest, with the high bit set in all but the last byte,
+   and then its characters. */
+
+#define DL_OP_PUSHLITERAL 1	/* dl_pushliteral */
+#define DL_OP_ADDPRED 2		/* A string, then dl_addpred */
+#define DL_OP_ADDVAR 3		/* A string, then dl_addvar */
+#define DL_OP_ADDCONST 4	/* A string, then dl_addconst */
+#define DL_OP_MAKELITERAL 5	/* dl_makeliteral */
+#define DL_OP_PUSHHEAD 6	/* dl_pushhead */
+#define DL_OP_ADDLITERAL 7	/* dl_addliteral */
+#define DL_OP_MAKECLAUSE 8	/* dl_makeclause */
+#define DL_OP_ASSERT 9		/* dl_assert */
+#define DL_OP_RETRACT 10	/* dl_retract */
+
+/* Runs the len bytes of commands in buf.  The commands start with an
+   empty stack of their own, and the items they leave, such as a
+   literal to be given to dl_ask, are pushed on the stack of the
+   database.  Returns -1 when an unsafe clause was asserted, in which
+   case the other commands are still run.  When a command fails, the
+   commands after it are not run, and the items made so far are
+   popped, but the clauses already asserted or retracted stay so. */
+DATALOG_API int dl_exec(dl_db_t db, const void *buf, size_t len);
+
+/* A growing buffer in which commands are coded. */
+typedef struct dl_cmds {
+  unsigned char *buf;		/* The commands. */
+  size_t len;			/* Their length. */
+  size_t cap;
+  int err;			/* Did coding run out of memory? */
+} dl_cmds_t;
+
+/* Initializes an empty buffer. */
+DATALOG_API void dl_cmds_init(dl_cmds_t *cmds);
+
+/* Adds an operation that takes no string. */
+DATALOG_API int dl_cmd(dl_cmds_t *cmds, int op);
+
+/* Adds an operation followed by a string of length n. */
+DATALOG_API int dl_cmd_lstring(dl_cmds_t *cmds, int op, const char *s,
+			       size_t n);
+
+/* Adds an operation followed by a zero terminated string. */
+DATALOG_API int dl_cmd_string(dl_cmds_t *cmds, int op, const char *s);
+
+/* Frees the space of a buffer, and leaves it empty. */
+DATALOG_API void dl_cmds_free(dl_cmds_t *cmds);
+
+/* A snapshot of a database is taken in constant time, as it copies
+   nothing: the state of a predicate is saved when the predicate is
+   next changed, and its facts are shared with the database until
+   either changes them.  Reverting to a snapshot takes time in
+   proportion to the number of predicates changed since it was
+   taken. */
+
+/* Saves the database on a stack of saved databases. */
+DATALOG_API int dl_save(dl_db_t db);
+
+/* Reverts to the database last saved by dl_save, and removes it from
+   the stack of saved databases.  Empties the database when none is
+   saved. */
+DATALOG_API int dl_restore(dl_db_t db);
+
+/* Takes a snapshot of the database, and returns the number that
+   refers to it via the snapshot parameter. */
+DATALOG_API int dl_snapshot(dl_db_t db, int *snapshot);
+
+/* Reverts to a snapshot.  The snapshot is unchanged, so the database
+   can be reverted to it again. */
+DATALOG_API int dl_revert(dl_db_t db, int snapshot);
+
+/* Releases a snapshot that is no longer needed.  The database saves
+   the predicates it changes for as long as a snapshot is held. */
+DATALOG_API int dl_release(dl_db_t db, int snapshot);
+
+/* Materializes the predicate of the literal on the top of the stack,
+   and pops the literal.  The facts of the predicate, and of every
+   derived predicate it depends on, are stored, and are maintained
+   incrementally by dl_assert and dl_retract, so queries read them
+   instead of deriving them again.  Returns -1 when the predicate is
+   a primitive. */
+DATALOG_API int dl_materialize(dl_db_t db);
+
 /* Computes a list that contains all ground instances of a literal
    that are a logical consequence of the clauses stored in the
    database.  Pops the literal from the stack and returns a freshly
@@ -148,9 +340,89 @@ DATALOG_API int dl_retract(dl_db_t db);
    when there are errors or no answers. */
 DATALOG_API int dl_ask(dl_db_t db, dl_answers_t *a);
 
+/* Like dl_ask, but answers the query as selected by the options
+   instead of those of the database. */
+DATALOG_API int dl_ask_with(dl_db_t db, dl_answers_t *a, int options);
+
+/* Aggregate operations for dl_aggregate. */
+
+#define DL_AGG_COUNT 0		/* The number of answers. */
+#define DL_AGG_SUM 1		/* The sum of a term. */
+#define DL_AGG_MIN 2		/* The least value of a term. */
+#define DL_AGG_MAX 3		/* The greatest value of a term. */
+
+/* Like dl_ask, but groups the answers by the terms selected by group,
+   where bit j selects term j, and returns one answer for each group,
+   without making a list of every answer.  An answer has the constants
+   of the selected terms, in order, followed by the result of the
+   operation op as a number.  Except for DL_AGG_COUNT, the operation
+   applies to term column of the answers in the group, and ignores
+   answers in which it is not a number.  A group in which no answer
+   has a number gives no answer. */
+DATALOG_API int dl_aggregate(dl_db_t db, dl_answers_t *a, int op,
+			     int column, unsigned long group);
+
 /* Frees the space associated with a list of answers. */
 DATALOG_API void dl_free(dl_answers_t a);
 
+/* Cursors */
+
+/* A cursor over the answers to a query. */
+typedef struct dl_cursor *dl_cursor_t;
+
+/* Answers the literal on the top of the stack, as selected by the
+   options of the database, and pops it.  Returns via the cursor
+   parameter a cursor from which the answers are fetched in batches,
+   without making a list of every answer.  The database must not be
+   changed until the cursor is closed. */
+DATALOG_API int dl_ask_open(dl_db_t db, dl_cursor_t *cursor);
+
+/* Fetches the next batch of at most n answers from a cursor.  The
+   batch is a list of answers read with the functions below, and
+   returned via the a parameter, or the null pointer when no answers
+   are left.  The list belongs to the cursor, which reuses its memory
+   for the next batch, so it must not be passed to dl_free. */
+DATALOG_API int dl_ask_next_batch(dl_cursor_t cursor, size_t n,
+				  dl_answers_t *a);
+
+/* Closes a cursor, freeing the space associated with it, including
+   that of the last batch. */
+DATALOG_API void dl_ask_close(dl_cursor_t cursor);
+
+/* Prepared queries */
+
+/* A query compiled once and asked many times with different
+   constants for its parameters. */
+typedef struct dl_prepared *dl_prepared_t;
+
+/* Prepares the literal on the top of the stack, whose parameters were
+   added with dl_addparam, and pops it.  Returns via the prepared
+   parameter a handle to the query.  The handle belongs to the
+   database, and is freed when the database is closed. */
+DATALOG_API int dl_prepare(dl_db_t db, dl_prepared_t *prepared);
+
+/* Binds parameter i of a prepared query to a constant of length n.
+   The binding holds until the parameter is bound again. */
+DATALOG_API int dl_bindlstring(dl_prepared_t prepared, int i,
+			       const char *s, size_t n);
+
+/* Binds parameter i of a prepared query to a zero terminated
+   constant. */
+DATALOG_API int dl_bindstring(dl_prepared_t prepared, int i,
+			      const char *s);
+
+/* Pushes the literal of a prepared query, with its parameters
+   replaced by the constants bound to them, on the top of the stack of
+   its database, ready to be given to dl_ask or dl_ask_open.  No
+   predicate or term is built again, and a constant is only looked up
+   when the value bound to its parameter has changed.  Fails when a
+   parameter is not bound. */
+DATALOG_API int dl_pushprepared(dl_prepared_t prepared);
+
+/* Releases a prepared query that is no longer needed, before its
+   database is closed. */
+DATALOG_API void dl_unprepare(dl_prepared_t prepared);
+
 /* Answers */
 
 /* Gets the predicate associated with the answers.  If the length of
@@ -168,6 +440,10 @@ DATALOG_API size_t dl_getpredlen(dl_answers_t a);
    Returns zero if given the null pointer. */
 DATALOG_API size_t dl_getpredarity(dl_answers_t a);
 
+/* Gets the number of answers.  Returns zero if given the null
+   pointer. */
+DATALOG_API size_t dl_getlen(dl_answers_t a);
+
 /* Gets the constant associated with term j in answer i.  Zero-based
    indexing is used throughout.  If the length of the constant is n,
    n + 1 character locations are returned, and the last location is
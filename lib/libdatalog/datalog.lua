@@ -54,7 +54,7 @@ local function mk_intern(maker)
       end
       return value
    end
-   return intern
+   return intern, tbl
 end
 
 -- A term is either a variable or a constant.
@@ -64,8 +64,17 @@ end
 local Var = {}
 Var.__index = Var
 
+-- Every term has a symbol, a number used in place of its id when
+-- building keys.  Constants have positive symbols, and variables
+-- have negative ones.  Symbols are dense, as they are handed out in
+-- order by counters.
+
+local const_syms = 0
+local var_syms = 0
+
 local function mk_var(id)
-   local tbl = {id = id}
+   var_syms = var_syms - 1
+   local tbl = {id = id, sym = var_syms}
    return setmetatable(tbl, Var)
 end
 
@@ -88,12 +97,20 @@ end
 local Const = {}
 Const.__index = Const
 
+-- The symbol of a new constant is given by the function below, which
+-- is replaced when the database shares its symbols with replicas.
+
+local function const_sym(id)
+   const_syms = const_syms + 1
+   return const_syms
+end
+
 local function mk_const(id)
-   local tbl = {id = id}
+   local tbl = {id = id, sym = const_sym(id)}
    return setmetatable(tbl, Const)
 end
 
-local make_const = mk_intern(mk_const)
+local make_const, const_ids = mk_intern(mk_const)
 
 function Const:is_const()
    return true
@@ -102,51 +119,44 @@ end
 -- Predicate symbols
 
 -- A predicate symbol has a name, an arity, and a database table.  It
--- can also have a function used to implement a primitive.
+-- can also have a function used to implement a primitive, and a store
+-- holding its ground facts, which are kept apart from its rules.  Its id
+-- combines its name and arity, and is used as a key by the database
+-- below.  Predicates also have symbols, numbered from one.
 
-local function mk_pred(id)
-   return {id = id, db = {}}
-end
+-- Predicates are internalized by name and then by arity, so looking
+-- one up does not involve building its id.
 
-local intern_pred = mk_intern(mk_pred)
+local pred_names = {}
+local pred_syms = 0
 
 local function mk_pred_id(pred_name, arity)
    return pred_name .. "/" .. arity
 end
 
 local function make_pred(pred_name, arity)
-   return intern_pred(mk_pred_id(pred_name, arity))
-end
-
-local function last_slash(s)	-- Returns the location of the last slash
-   local i = 0			-- in a string or 0.
-   while true do
-      local j = string.find(s, "/", i + 1)
-      if not j then
-	 return i
-      else
-	 i = j
-      end
+   pred_name = tostring(pred_name)
+   local arities = pred_names[pred_name]
+   if not arities then
+      arities = setmetatable({}, weak_mt)
+      pred_names[pred_name] = arities
    end
+   local pred = arities[arity]
+   if not pred then
+      pred_syms = pred_syms + 1
+      pred = {id = mk_pred_id(pred_name, arity), name = pred_name,
+	      arity = arity, sym = pred_syms, db = {}}
+      arities[arity] = pred
+   end
+   return pred
 end
 
 local function get_name(pred)
-   local i = last_slash(pred.id)
-   return string.sub(pred.id, 1, i - 1)
+   return pred.name
 end
 
 local function get_arity(pred)
-   local i = last_slash(pred.id)
-   return tonumber(string.sub(pred.id, i + 1))
-end
-
--- Duplicates a predicate.  Used to clone databases.
-local function dup(pred)
-   local db = {}
-   for k,v in pairs(pred.db) do
-      db[k] = v
-   end
-   return {id = pred.id, db = db, prim = pred.prim}
+   return pred.arity
 end
 
 -- Literals
@@ -164,8 +174,18 @@ local function make_literal(pred_name, terms)
    return literal
 end
 
-local function add_size(str)
-   return tostring(string.len(str)) .. ":" .. str
+-- Keys are built from the symbols of a predicate and its terms, and
+-- are made once, with a single concatenation.  Symbols are separated
+-- by spaces, so the key of a sequence of symbols determines it.
+
+local key_buf = {}
+
+local function make_key(n)
+   local key = table.concat(key_buf, " ", 1, n)
+   for i=1,n do
+      key_buf[i] = nil
+   end
+   return key
 end
 
 -- A literal's id is computed on demand, but then cached.  It is used
@@ -177,52 +197,49 @@ end
 local function get_id(literal)
    local id = literal.id
    if not id then
-      id = add_size(literal.pred.id)
-      for i=1,#literal do
-	 id = id .. add_size(literal[i]:get_id())
+      local n = #literal
+      key_buf[1] = literal.pred.sym
+      for i=1,n do
+	 key_buf[i + 1] = literal[i].sym
       end
+      id = make_key(n + 1)
       literal.id = id
    end
    return id
 end
 
-function Const:get_id()
-   return "c" .. self.id
-end
-
-function Var:get_id()
-   return "v" .. self.id
-end
-
 -- Variant tag
 
 -- Two literal's variant tags are the same if there is a one-to-one
 -- mapping of variables to variables, such that when the mapping is
 -- applied to one literal, the result is a literal that is the same as
 -- the other one, when compared using structural equality.  The
--- variant tag is used as a key by the subgoal table.
+-- variant tag is used as a key by the subgoal table.  In a tag, each
+-- variable is replaced by minus the position of its first occurrence.
 
 local function get_tag(literal)
    local tag = literal.tag
    if not tag then
       local env = {}
-      tag = add_size(literal.pred.id)
-      for i=1,#literal do
-	 tag = tag .. add_size(literal[i]:get_tag(i, env))
+      local n = #literal
+      key_buf[1] = literal.pred.sym
+      for i=1,n do
+	 key_buf[i + 1] = literal[i]:get_tag(i, env)
       end
+      tag = make_key(n + 1)
       literal.tag = tag
    end
    return tag
 end
 
 function Const:get_tag(i, env)
-   return "c" .. self.id
+   return self.sym
 end
 
 function Var:get_tag(i, env)
    local tag = env[self]
    if not tag then
-      tag = "v" .. tostring(i)
+      tag = -i
       env[self] = tag
    end
    return tag
@@ -397,13 +414,17 @@ end
 -- if they have the same id.  A clause's id is used as a key into the
 -- clause database.
 
+-- The ids of the literals are separated by commas, as spaces
+-- separate the symbols within them.
+
 local function get_clause_id(clause)
    local id = clause.id
    if not id then
-      id = add_size(get_id(clause.head))
+      local ids = {get_id(clause.head)}
       for i=1,#clause do
-	 id = id .. add_size(get_id(clause[i]))
+	 ids[i + 1] = get_id(clause[i])
       end
+      id = table.concat(ids, ",")
       clause.id = id
    end
    return id
@@ -439,6 +460,24 @@ local function rename_clause(clause)
    end
 end
 
+-- Native kernels
+
+-- When loaded by the C library, native versions of the functions
+-- above that make keys, unify, substitute and rename are available.
+-- They behave the same, but avoid method dispatch on each term.
+
+if dl_kernels then
+   local kernels = dl_kernels(Var, mk_fresh_var)
+   get_id = kernels.get_id
+   get_tag = kernels.get_tag
+   unify = kernels.unify
+   subst = kernels.subst
+   shuffle = kernels.shuffle
+   rename = kernels.rename
+   subst_in_clause = kernels.subst_in_clause
+   rename_clause = kernels.rename_clause
+end
+
 -- A clause is safe if every variable in its head is in its body.
 
 local function is_safe(clause)
@@ -466,20 +505,494 @@ end
 -- DATABASE
 
 -- The database stores predicates that contain clauses.  Predicates
--- not in the database are subject to garbage collection.
+-- not in the database are subject to garbage collection.  The rules
+-- of a predicate are in its db table, and its facts in its fact
+-- store, which is described after the clause indexes.
 
 local db = {}
 
+-- Snapshots of the database, described with the functions that take
+-- and revert to them, copy nothing when taken.  Instead, the latest
+-- snapshot saves the state of a predicate the first time it changes,
+-- so every change to the clauses of a predicate, or to whether it is
+-- in the database, is preceded by a call to touch.  The latest
+-- snapshot is weakly held, so nothing is saved when none is in use.
+
+local latest = setmetatable({}, {__mode = "v"})
+
+local function touch(pred)
+   local snap = latest[1]
+   if snap and not snap.saved[pred] then
+      local rules = {}
+      for id,clause in pairs(pred.db) do
+	 rules[id] = clause
+      end
+      snap.saved[pred] = {db = rules,
+			  facts = pred.facts and pred.facts:copy(),
+			  present = db[pred.id] ~= nil}
+   end
+end
+
 local function insert(pred)
+   touch(pred)
    db[pred.id] = pred
    return pred
 end
 
 local function remove(pred)
+   touch(pred)
    db[pred.id] = nil
    return pred
 end
 
+-- CLAUSE INDEXES
+
+-- A predicate's clauses are indexed by the terms in the arguments of
+-- their heads, so that a literal with a constant argument need only
+-- be unified with the clauses that can match it.  For each argument
+-- position, the index maps a constant to the bucket of clauses that
+-- have that constant at the position, and has one more bucket for
+-- the clauses that have a variable at the position.  A bucket counts
+-- its clauses, so the search can pick the smallest one.  The index
+-- also counts the clauses and rules it holds, and each position
+-- counts its distinct constants, which gives the statistics used to
+-- order the bodies of rules.
+
+-- The index of a predicate is built the first time a literal with a
+-- constant argument is searched, and then maintained by assert and
+-- retract.  The fact stores written in Lua are indexed the same way,
+-- so the functions below take any table that stores clauses in its
+-- db field.
+
+local function make_bucket()
+   return {n = 0, clauses = {}}
+end
+
+local function index_clause(index, id, clause)
+   local head = clause.head
+   index.n = index.n + 1
+   if #clause > 0 then
+      index.rules = index.rules + 1
+   end
+   for i=1,#head do
+      local term = head[i]
+      local pos = index[i]
+      local bucket
+      if term:is_const() then
+	 bucket = pos.consts[term]
+	 if not bucket then
+	    bucket = make_bucket()
+	    pos.consts[term] = bucket
+	    pos.distinct = pos.distinct + 1
+	 end
+      else
+	 bucket = pos.vars
+      end
+      if not bucket.clauses[id] then
+	 bucket.n = bucket.n + 1
+	 bucket.clauses[id] = clause
+      end
+   end
+end
+
+local function unindex_clause(index, id, clause)
+   local head = clause.head
+   index.n = index.n - 1
+   if #clause > 0 then
+      index.rules = index.rules - 1
+   end
+   for i=1,#head do
+      local term = head[i]
+      local pos = index[i]
+      local bucket
+      if term:is_const() then
+	 bucket = pos.consts[term]
+      else
+	 bucket = pos.vars
+      end
+      if bucket and bucket.clauses[id] then
+	 bucket.n = bucket.n - 1
+	 bucket.clauses[id] = nil
+	 if bucket.n == 0 and bucket ~= pos.vars then
+	    pos.consts[term] = nil
+	    pos.distinct = pos.distinct - 1
+	 end
+      end
+   end
+end
+
+local function get_index(store, arity)
+   local index = store.index
+   if not index then
+      index = {n = 0, rules = 0}
+      for i=1,arity do
+	 index[i] = {consts = {}, vars = make_bucket(), distinct = 0}
+      end
+      for id,clause in pairs(store.db) do
+	 index_clause(index, id, clause)
+      end
+      store.index = index
+   end
+   return index
+end
+
+-- Returns the buckets holding every clause that might match a
+-- literal, or nil when the literal has no constant arguments.
+
+local no_bucket = make_bucket()
+
+local function candidates(literal, store)
+   local best, vars
+   local size
+   for i=1,#literal do
+      local term = literal[i]
+      if term:is_const() then
+	 local pos = get_index(store, #literal)[i]
+	 local bucket = pos.consts[term] or no_bucket
+	 local n = bucket.n + pos.vars.n
+	 if not size or n < size then
+	    best, vars, size = bucket, pos.vars, n
+	    if n == 0 then
+	       break
+	    end
+	 end
+      end
+   end
+   return best, vars
+end
+
+-- FACT STORES
+
+-- The ground facts of a predicate, and of a materialized view, are
+-- held by a fact store.  When loaded by the C library, a store keeps
+-- each argument position as a column of the symbols of the constants
+-- at that position, with a hash table to remove duplicates, and an
+-- index on a column built the first time a constant at the position
+-- is searched (see factstore.c).  This takes a few bytes per fact,
+-- where a fact stored as a clause takes several tables and a key.
+
+-- A store hands back the facts it finds as new literals, built from
+-- the constants of the symbols in their columns.  The table below
+-- maps the symbol of every constant stored to the constant, so it
+-- keeps those constants alive.  Retracting a fact leaves its
+-- constants in the table, so the table is swept from time to time, as
+-- described after the stores.
+
+local const_of_sym = {}
+
+-- Otherwise, the store below has the same methods, and keeps the
+-- facts as clauses without a body, indexed as above.
+
+local Facts = {}
+Facts.__index = Facts
+
+local function make_facts(arity)
+   return setmetatable({arity = arity, n = 0, db = {}}, Facts)
+end
+
+function Facts:add(literal)
+   local id = get_id(literal)
+   if self.db[id] then
+      return false
+   end
+   local clause = {head = literal}
+   self.db[id] = clause
+   self.n = self.n + 1
+   if self.index then
+      index_clause(self.index, id, clause)
+   end
+   return true
+end
+
+function Facts:remove(literal)
+   local id = get_id(literal)
+   local clause = self.db[id]
+   if not clause then
+      return false
+   end
+   self.db[id] = nil
+   self.n = self.n - 1
+   if self.index then
+      unindex_clause(self.index, id, clause)
+   end
+   return true
+end
+
+function Facts:has(literal)
+   return self.db[get_id(literal)] ~= nil
+end
+
+function Facts:count()
+   return self.n
+end
+
+function Facts:distinct(i)
+   return get_index(self, self.arity)[i].distinct
+end
+
+function Facts:search(literal)
+   local found = {}
+   local consts = candidates(literal, self)
+   for id,clause in pairs(consts and consts.clauses or self.db) do
+      if unify(literal, clause.head) then
+	 table.insert(found, clause.head)
+      end
+   end
+   return found
+end
+
+function Facts:copy()
+   local facts = make_facts(self.arity)
+   for id,clause in pairs(self.db) do
+      facts.db[id] = clause
+   end
+   facts.n = self.n
+   return facts
+end
+
+function Facts:mark(marks)
+   for id,clause in pairs(self.db) do
+      for i=1,#clause.head do
+	 marks[clause.head[i].sym] = true
+      end
+   end
+end
+
+if dl_factstore then
+   make_facts = dl_factstore
+end
+
+-- Sweeping the table of constants of stored symbols.  Every store that
+-- can still be searched is reached from a predicate, its view, or the
+-- states saved by a snapshot that is alive, so the snapshots are kept
+-- in a table with weak keys.  A sweep marks the symbols in the rows of
+-- those stores, and drops the other symbols from the table.  The
+-- constants of symbols that are dropped but still in use elsewhere
+-- keep their symbols, and are put back when stored again.  A sweep
+-- takes time in the number of rows, so one is made when the facts
+-- added since the last outnumber the rows it marked.
+
+local snapshots = setmetatable({}, {__mode = "k"})
+
+local const_adds = 0		-- Facts added since the last sweep.
+local const_sweep = 1024	-- Facts added that cause a sweep.
+
+local function mark_stores(marks)
+   local rows = 0
+   local function mark(facts)
+      if facts then
+	 facts:mark(marks)
+	 rows = rows + facts:count()
+      end
+   end
+   for name,arities in pairs(pred_names) do
+      for arity,pred in pairs(arities) do
+	 mark(pred.facts)
+	 mark(pred.view and pred.view.facts)
+      end
+   end
+   for snap in pairs(snapshots) do
+      for pred,state in pairs(snap.saved) do
+	 mark(state.facts)
+      end
+   end
+   return rows
+end
+
+local function sweep_consts()
+   if const_adds < const_sweep then
+      return
+   end
+   local marks = {}
+   local rows = mark_stores(marks)
+   for sym in pairs(const_of_sym) do
+      if not marks[sym] then
+	 const_of_sym[sym] = nil
+      end
+   end
+   const_adds = 0
+   const_sweep = rows + 1024
+end
+
+-- Adds a fact to a store, counting it toward the next sweep.
+
+local function add_fact(facts, literal)
+   if facts:add(literal, const_of_sym) then
+      const_adds = const_adds + 1
+      return true
+   else
+      return false
+   end
+end
+
+-- BODY ORDERING
+
+-- The prover resolves the body literals of a rule in order, so the
+-- literals of a rule that has just been selected for a subgoal are
+-- reordered to resolve the most selective one first.  The order is
+-- chosen greedily.  The next literal is the one expected to match the
+-- fewest clauses, given the constants in it, and the variables bound
+-- by the literals before it.  Primitives may depend on the order of
+-- the literals, so only the literals between two primitives are
+-- reordered, and the answers do not depend on the order chosen.
+
+-- A fact matching a constant at a position is expected to be one of
+-- the facts with that constant, assuming constants are equally
+-- common.  The facts derived by a rule are unknown, so a rule is
+-- assumed to derive rule_facts facts, of which a bound argument
+-- selects one in rule_select.
+
+local rule_facts = 100
+local rule_select = 10
+
+local function estimate(literal, bound)
+   local pred = literal.pred
+   local store = pred.view and pred.view.facts or pred.facts
+   local facts = store and store:count() or 0
+   local rules = 0
+   if not pred.view then
+      rules = get_index(pred, #literal).rules * rule_facts
+   end
+   for i=1,#literal do
+      local term = literal[i]
+      if term:is_const() or bound[term] then
+	 if facts > 0 then
+	    local distinct = store:distinct(i)
+	    if distinct > 1 then
+	       facts = facts / distinct
+	    end
+	 end
+	 rules = rules / rule_select
+      end
+   end
+   return facts + rules
+end
+
+-- Returns the clause, or a copy with its body reordered.
+
+local function reorder(clause)
+   local n = #clause
+   if n < 2 then
+      return clause
+   end
+   local bound = {}
+   local body = {}
+   local first = 1		-- The first literal of the segment.
+   local changed = false
+   while first <= n do
+      local last = first
+      while last <= n and not clause[last].pred.prim do
+	 last = last + 1
+      end
+      local todo = {}
+      for i=first,last-1 do
+	 todo[i - first + 1] = clause[i]
+      end
+      while #todo > 0 do
+	 local best, cost
+	 for j=1,#todo do
+	    local c = estimate(todo[j], bound)
+	    if not cost or c < cost then
+	       best, cost = j, c
+	    end
+	 end
+	 local literal = table.remove(todo, best)
+	 if literal ~= clause[#body + 1] then
+	    changed = true
+	 end
+	 table.insert(body, literal)
+	 for i=1,#literal do
+	    bound[literal[i]] = true
+	 end
+      end
+      if last <= n then		-- A primitive.
+	 local literal = clause[last]
+	 table.insert(body, literal)
+	 for i=1,#literal do
+	    bound[literal[i]] = true
+	 end
+      end
+      first = last + 1
+   end
+   if not changed then
+      return clause
+   end
+   body.head = clause.head
+   return body
+end
+
+-- ANSWER TABLES
+
+-- The subgoals tabled by the prover are kept between queries, so a
+-- repeated query is answered from its table.  Tables are grouped by
+-- the predicate of their subgoal's literal.  When a clause for a
+-- predicate is asserted or retracted, the tables of that predicate
+-- and of every predicate that depends on it are discarded.
+
+local tables = {}
+
+-- The reverse dependencies of a predicate map each predicate with a
+-- clause that uses it in its body to the number of such clauses.
+
+local rdeps = {}
+
+local function add_rdeps(clause, delta)
+   local head = clause.head.pred
+   for i=1,#clause do
+      local pred = clause[i].pred
+      local users = rdeps[pred]
+      if not users then
+	 users = {}
+	 rdeps[pred] = users
+      end
+      local n = (users[head] or 0) + delta
+      if n > 0 then
+	 users[head] = n
+      else
+	 users[head] = nil
+	 if not next(users) then
+	    rdeps[pred] = nil
+	 end
+      end
+   end
+end
+
+local function invalidate(pred)
+   local seen = {[pred] = true}
+   local todo = {pred}
+   while #todo > 0 do
+      local p = table.remove(todo)
+      tables[p] = nil
+      for user in pairs(rdeps[p] or {}) do
+	 if not seen[user] then
+	    seen[user] = true
+	    table.insert(todo, user)
+	 end
+      end
+   end
+end
+
+-- Programs made by the magic sets transformation below depend on the
+-- rules in the database, but not on its facts, so they are kept
+-- until a rule is asserted or retracted.
+
+local magic_programs = {}
+
+-- The rules are also counted as they change, so that a version
+-- published for replicas only carries rules when they have changed.
+
+local rules_changed = 0
+
+local function invalidate_all()
+   tables = {}
+   magic_programs = {}
+end
+
+-- Materialized views are maintained as clauses are asserted and
+-- retracted by functions defined after the prover.
+
+local view_assert, view_overdelete, view_rederive, view_revert
+
 -- Add a safe clause to the database.
 
 local function assert(clause)
@@ -487,61 +1000,184 @@ local function assert(clause)
       return nil		-- An unsafe clause was detected.
    else
       local pred = clause.head.pred
-      if not pred.prim then	-- Ignore assertions for primitives.
-	 pred.db[get_clause_id(clause)] = clause
-	 insert(pred)
+      if pred.prim then		-- Ignore assertions for primitives.
+	 return clause
+      end
+      touch(pred)
+      if #clause == 0 then	-- A fact, which must be ground.
+	 local facts = pred.facts
+	 if not facts then
+	    facts = make_facts(get_arity(pred))
+	    pred.facts = facts
+	 end
+	 if add_fact(facts, clause.head) then
+	    invalidate(pred)
+	    view_assert(clause)
+	    sweep_consts()
+	 end
+      else
+	 local id = get_clause_id(clause)
+	 if not pred.db[id] then
+	    pred.db[id] = clause
+	    if pred.index then
+	       index_clause(pred.index, id, clause)
+	    end
+	    add_rdeps(clause, 1)
+	    invalidate(pred)
+	    magic_programs = {}
+	    rules_changed = rules_changed + 1
+	    view_assert(clause)
+	 end
       end
+      insert(pred)
       return clause
    end
 end
 
 local function retract(clause)
    local pred = clause.head.pred
-   pred.db[get_clause_id(clause)] = nil
-   if not next(pred.db) and not pred.prim then
+   local facts = pred.facts
+   touch(pred)
+   if #clause == 0 then
+      if facts and facts:has(clause.head) then
+	 local deleted = view_overdelete(clause)
+	 facts:remove(clause.head)
+	 invalidate(pred)
+	 view_rederive(clause, deleted)
+      end
+   else
+      local id = get_clause_id(clause)
+      local old = pred.db[id]
+      if old then
+	 local deleted = view_overdelete(old)
+	 pred.db[id] = nil
+	 if pred.index then
+	    unindex_clause(pred.index, id, old)
+	 end
+	 add_rdeps(old, -1)
+	 invalidate(pred)
+	 magic_programs = {}
+	 rules_changed = rules_changed + 1
+	 view_rederive(old, deleted)
+      end
+   end
+   if not next(pred.db) and not pred.prim
+      and not (facts and facts:count() > 0) then
       remove(pred)
    end
    return clause
 end
 
--- DATABASE CLONING
+-- DATABASE SNAPSHOTS
 
--- A database can be saved and then later restored.  With copy and
--- revert, one can use one copy of a database multiple times to revert
--- to a previous database.  These two functions are not exposed in the
--- C API.
+-- A snapshot is taken in constant time, and holds the state of each
+-- predicate changed after it was taken, as saved by touch: the rules
+-- of the predicate, a copy of its fact store, which shares the facts
+-- until either store changes, and whether it was in the database.
+-- Only the first change after a snapshot saves a state, so a snapshot
+-- links to the next one taken, and the state of a predicate in a
+-- snapshot is the one saved by it or by the first later snapshot that
+-- has one, or else the current state.  Reverting to a snapshot takes
+-- time in proportion to the number of predicates changed since then,
+-- and leaves the snapshot unchanged, so it can be used again.
 
--- Returns a fresh copy of the current database or copies the one
--- given as an argument.
+local function snapshot()
+   local snap = {saved = {}}
+   if latest[1] then
+      latest[1].next = snap
+   end
+   latest[1] = snap
+   snapshots[snap] = true
+   return snap
+end
+
+-- Gives a predicate a saved state, keeping the reverse dependencies
+-- of its rules up to date.  The index of its rules is rebuilt when
+-- next needed.
+
+local function set_state(pred, state)
+   local rules = {}
+   local changed = false
+   for id,clause in pairs(pred.db) do
+      if state.db[id] ~= clause then
+	 add_rdeps(clause, -1)
+	 changed = true
+      end
+   end
+   for id,clause in pairs(state.db) do
+      if pred.db[id] ~= clause then
+	 add_rdeps(clause, 1)
+	 changed = true
+      end
+      rules[id] = clause
+   end
+   if changed then
+      rules_changed = rules_changed + 1
+   end
+   pred.db = rules
+   pred.index = nil
+   pred.facts = state.facts and state.facts:copy()
+   if state.present then
+      insert(pred)
+   else
+      remove(pred)
+   end
+end
+
+local function set_states(states)
+   for pred,state in pairs(states) do
+      touch(pred)
+      set_state(pred, state)
+   end
+   invalidate_all()
+   view_revert()
+end
+
+-- Reverts to a snapshot.
 
-local function copy(src)
-   local clone = {}
-   for k,v in pairs(src or db) do
-      clone[k] = dup(v)
+local function revert(snap)
+   local states = {}
+   while snap do
+      for pred,state in pairs(snap.saved) do
+	 states[pred] = states[pred] or state
+      end
+      snap = snap.next
    end
-   return clone
+   set_states(states)
 end
 
--- Reverts datalog to a previously cloned database.  The database is
--- copied so that the clone can be used more than once.
+-- With copy and revert, one can use one snapshot of a database
+-- multiple times to revert to a previous database.  As a snapshot
+-- never changes, copying one gives the snapshot itself.
 
-local function revert(clone)
-   db = copy(clone)
+local function copy(snap)
+   return snap or snapshot()
 end
 
 -- DATABASE STORE
 
--- A database can be saved and then later restored.
+-- A database can be saved and then later restored.  Restoring when
+-- nothing is saved empties the database, except for primitives.
 
 local store = {}
 
 local function save()
-   table.insert(store, copy())
+   table.insert(store, snapshot())
 end
 
 local function restore()
-   db = table.remove(store)
-   db = db or {}
+   local snap = table.remove(store)
+   if snap then
+      revert(snap)
+   else
+      local states = {}
+      for id,pred in pairs(db) do
+	 if not pred.prim then
+	    states[pred] = {db = {}, present = false}
+	 end
+      end
+      set_states(states)
+   end
 end
 
 -- PROVER
@@ -560,23 +1196,35 @@ No. 1, Jan. 1996, pp. 20-74.
 
 -- The subgoal table
 
-local subgoals
+-- The table of a predicate is a map from the variant tag of a
+-- subgoal's literal to a subgoal.  The subgoals added by the query
+-- being answered are also listed in fresh, so they can be marked
+-- complete when it finishes.  When a query is aborted by an error,
+-- fresh is left set, and every table is discarded by the next query.
 
--- The subgoal table is a map from the variant tag of a subgoal's
--- literal to a subgoal.
+local fresh
 
 local function find(literal)
-   return subgoals[get_tag(literal)]
+   local tbl = tables[literal.pred]
+   return tbl and tbl[get_tag(literal)]
 end
 
 local function merge(subgoal)
-   subgoals[get_tag(subgoal.literal)] = subgoal
+   local pred = subgoal.literal.pred
+   local tbl = tables[pred]
+   if not tbl then
+      tbl = {}
+      tables[pred] = tbl
+   end
+   tbl[get_tag(subgoal.literal)] = subgoal
+   table.insert(fresh, subgoal)
 end
 
 -- A subgoal is the item that is tabled by this algorithm.
 
 -- A subgoal has a literal, a set of facts, and an array of waiters.
--- A waiter is a pair containing a subgoal and a clause.
+-- A waiter is a pair containing a subgoal and a clause.  A complete
+-- subgoal has all its facts, so it has no need for waiters.
 
 local function make_subgoal(literal)
    return {literal = literal, facts = {}, waiters = {}}
@@ -626,7 +1274,9 @@ end
 function rule(subgoal, clause, selected)
    local sg = find(selected)
    if sg then
-      table.insert(sg.waiters, {subgoal = subgoal, clause = clause})
+      if not sg.complete then
+	 table.insert(sg.waiters, {subgoal = subgoal, clause = clause})
+      end
       local todo = {}
       for id,fact in pairs(sg.facts) do
 	 local resolvent = resolve(clause, fact)
@@ -655,19 +1305,42 @@ end
 
 -- Search for derivations of the literal associated with this subgoal.
 
+-- Facts are ground, so they need not be renamed, and a fact found
+-- by the fact store is itself an answer.
+
+local function search_clauses(subgoal, clauses)
+   local literal = subgoal.literal
+   for id,clause in pairs(clauses) do
+      local renamed = rename_clause(clause)
+      local env = unify(literal, renamed.head)
+      if env then
+	 add_clause(subgoal, reorder(subst_in_clause(renamed, env)))
+      end
+   end
+end
+
 function search(subgoal)
    local literal = subgoal.literal
-   if literal.pred.prim then
-      return literal.pred.prim(literal, subgoal)
-   else
-      for id,clause in pairs(literal.pred.db) do
-	 local renamed = rename_clause(clause)
-	 local env = unify(literal, renamed.head)
-	 if env then
-	    add_clause(subgoal, subst_in_clause(renamed, env))
-	 end
+   local pred = literal.pred
+   if pred.prim then
+      return pred.prim(literal, subgoal)
+   end
+   local facts = pred.view and pred.view.facts or pred.facts
+   if facts then
+      local found = facts:search(literal, const_of_sym)
+      for i=1,#found do
+	 fact(subgoal, found[i])
       end
    end
+   if pred.view then		-- The rules are not used.
+      return
+   end
+   local consts, vars = candidates(literal, pred)
+   if not consts then		-- No constant to look up.
+      return search_clauses(subgoal, pred.db)
+   end
+   search_clauses(subgoal, consts.clauses)
+   return search_clauses(subgoal, vars.clauses)
 end
 
 -- Sets up and calls the subgoal search procedure, and then extracts
@@ -675,12 +1348,30 @@ end
 -- the predicate, the predicate's arity, and an array of constant
 -- terms for each answer.  If there are no answers, nil is returned.
 
+-- Once the search returns, every subgoal it added has been completely
+-- evaluated, and remains in its table until invalidated.
+
+local function solve(literal)
+   if fresh then		-- The last query failed.
+      invalidate_all()
+   end
+   fresh = {}
+   local subgoal = find(literal)
+   if not subgoal then
+      subgoal = make_subgoal(literal)
+      merge(subgoal)
+      search(subgoal)
+   end
+   for i=1,#fresh do
+      fresh[i].complete = true
+      fresh[i].waiters = {}
+   end
+   fresh = nil
+   return subgoal
+end
+
 local function ask(literal)
-   subgoals = {}
-   local subgoal = make_subgoal(literal)
-   merge(subgoal)
-   search(subgoal)
-   subgoals = nil
+   local subgoal = solve(literal)
    local answers = {}
    for id,literal in pairs(subgoal.facts) do
       local answer = {}
@@ -698,39 +1389,402 @@ local function ask(literal)
    end
 end
 
--- PRIMITIVES
-
---[[
-
-A primitive predicate, also called a built-in predicate, is
-implemented by code.  Assertions about a primitive predicate are
-ignored, as the code takes precedence.  Use the make_pred function to
-access a primitive by name.
-
-The behavior of a primitive predicate is defined by adding a function
-to the predicate's prim field.  The function takes a literal and a
-subgoal.  The typical primitive derives a set of facts from the
-literal, and for each derived fact f, reports the result by invoking
-fact(subgoal, f).
+-- Aggregates
 
-The equals primitive defined below is protected from garage collection
-because the primitive is bound to a local variable.  A primitive not
-stored in a Lua data structure can be protected by entering it into
-the predicate database used by assert and retract.  For primitives
-created from C, protection may be provided by entering the predicate
-into the Lua registry.
+-- An aggregate query groups the answers to a literal by the terms at
+-- the positions listed in group, and gives one answer per group.  It
+-- has the constants of the group, followed by the result of an
+-- operation on the answers in the group.  The count operation counts
+-- them.  The sum, min and max operations apply to the constants at
+-- position column that are numbers, and other answers are ignored,
+-- along with groups that have none.  Results are formatted like Lua
+-- numbers.  The answers are combined as they are found in the table
+-- of the literal, without making a copy of them.
 
-Use the add_iter_prim function to add a primitive predicate that can
-defined by an iterator which when given a literal, generates a
-sequence of answers, each answer being an array of strings or numbers.
+local aggregate_ops = {
+   count = function(acc, x) return acc + x end,
+   sum = function(acc, x) return acc + x end,
+   min = function(acc, x) return x < acc and x or acc end,
+   max = function(acc, x) return x > acc and x or acc end,
+}
+
+local function aggregate(literal, op, column, group)
+   local combine = aggregate_ops[op]
+   if not combine then
+      error("unknown aggregate operation " .. tostring(op))
+   end
+   local arity = #literal
+   if op ~= "count" and not (column >= 1 and column <= arity) then
+      error("bad aggregate column " .. tostring(column))
+   end
+   for i=1,#group do
+      if not (group[i] >= 1 and group[i] <= arity) then
+	 error("bad aggregate group " .. tostring(group[i]))
+      end
+   end
+   local subgoal = solve(literal)
+   local groups = {}
+   local answers = {}
+   for id,fact in pairs(subgoal.facts) do
+      local value = 1
+      if op ~= "count" then
+	 value = tonumber(fact[column].id)
+      end
+      if value then
+	 for i=1,#group do
+	    key_buf[i] = fact[group[i]].sym
+	 end
+	 local key = make_key(#group)
+	 local answer = groups[key]
+	 if answer then
+	    answer.value = combine(answer.value, value)
+	 else
+	    answer = {value = value}
+	    for i=1,#group do
+	       answer[i] = fact[group[i]].id
+	    end
+	    groups[key] = answer
+	    table.insert(answers, answer)
+	 end
+      end
+   end
+   if #answers == 0 then
+      return nil
+   end
+   for i=1,#answers do
+      local answer = answers[i]
+      answer[#group + 1] = string.format("%.14g", answer.value)
+      answer.value = nil
+   end
+   answers.name = get_name(literal.pred)
+   answers.arity = #group + 1
+   return answers
+end
+
+-- MATERIALIZED VIEWS
+
+--[[
+
+A derived predicate can be materialized, so that its facts are stored
+and kept up to date as clauses are asserted and retracted, rather than
+derived again by the next query.  Every derived predicate the view
+depends on is materialized along with it.  The prover searches the
+stored facts of a view instead of its clauses.
+
+Views are maintained with the delete and rederive algorithm.  A new
+fact is joined with the rest of the body of each view rule that uses
+its predicate, and the facts derived are added and treated the same
+way in turn.  Before a fact is removed, the facts that may depend on
+it are found the same way, and are removed along with it.  Those that
+can still be derived in one step are then put back, and treated as
+new facts.  The work done is proportional to the facts affected by a
+change.  Asserting or retracting a rule that a view depends on
+computes every view again.
+
+]]
+
+local views			-- Set of views, or nil when none.
+local requested = {}		-- Predicates materialized by request.
+
+-- The facts of a view are kept in a fact store of their own, and its
+-- rules are kept apart.
+
+local function view_add(pred, literal)
+   return add_fact(pred.view.facts, literal)
+end
+
+local function view_remove(pred, literal)
+   return pred.view.facts:remove(literal)
+end
+
+-- Returns the facts that follow from a clause.  The facts of views
+-- change while they are maintained, so the prover is given subgoal
+-- tables that are discarded afterwards, and the head of the clause is
+-- not tabled, as the clause is not the only way to derive it.
+
+local function prove(clause)
+   local saved_tables, saved_fresh = tables, fresh
+   tables, fresh = {}, {}
+   local subgoal = make_subgoal(clause.head)
+   add_clause(subgoal, clause)
+   tables, fresh = saved_tables, saved_fresh
+   return subgoal.facts
+end
+
+-- Returns the facts that follow from a rule when the fact given is
+-- used for the ith literal in its body.
+
+local function derive(clause, i, literal)
+   local renamed = rename_clause(clause)
+   local env = unify(renamed[i], literal)
+   if not env then
+      return {}
+   end
+   local new = {head = subst(renamed.head, env)}
+   for j=1,#renamed do
+      if j ~= i then
+	 table.insert(new, subst(renamed[j], env))
+      end
+   end
+   return prove(new)
+end
+
+-- Returns the facts derived in one step by the view rules that use
+-- the predicate of a fact, when given the fact.
+
+local function consequences(literal)
+   local result = {}
+   for user in pairs(rdeps[literal.pred] or {}) do
+      if user.view then
+	 for id,clause in pairs(user.view.rules) do
+	    for i=1,#clause do
+	       if clause[i].pred == literal.pred then
+		  for id,fact in pairs(derive(clause, i, literal)) do
+		     table.insert(result, fact)
+		  end
+	       end
+	    end
+	 end
+      end
+   end
+   return result
+end
+
+local function propagate_insert(todo)
+   while #todo > 0 do
+      local facts = consequences(table.remove(todo))
+      for i=1,#facts do
+	 if view_add(facts[i].pred, facts[i]) then
+	    table.insert(todo, facts[i])
+	 end
+      end
+   end
+end
+
+-- Can a fact removed from a view be derived in one step from what
+-- remains?
+
+local function derivable(literal)
+   local pred = literal.pred
+   if pred.facts and pred.facts:has(literal) then
+      return true
+   end
+   for id,clause in pairs(pred.view.rules) do
+      local renamed = rename_clause(clause)
+      local env = unify(renamed.head, literal)
+      if env and next(prove(subst_in_clause(renamed, env))) then
+	 return true
+      end
+   end
+   return false
+end
+
+-- Computes the facts of the views derived from scratch.
+
+local function fill(preds)
+   local saved_tables, saved_fresh = tables, fresh
+   tables, fresh = {}, {}
+   local facts = {}
+   for pred in pairs(preds) do
+      local literal = {pred = pred}
+      for i=1,get_arity(pred) do
+	 literal[i] = mk_fresh_var()
+      end
+      local subgoal = make_subgoal(literal)
+      merge(subgoal)
+      search(subgoal)
+      facts[pred] = subgoal.facts
+   end
+   tables, fresh = saved_tables, saved_fresh
+   for pred in pairs(preds) do
+      local rules = {}
+      for id,clause in pairs(pred.db) do
+	 if #clause > 0 then
+	    rules[id] = clause
+	 end
+      end
+      pred.view = {facts = make_facts(get_arity(pred)), rules = rules}
+      for id,literal in pairs(facts[pred]) do
+	 view_add(pred, literal)
+      end
+   end
+end
+
+-- Materializes a predicate and the derived predicates it depends on.
+
+local function materialize(pred)
+   if pred.prim or pred.view then
+      return pred
+   end
+   requested[pred] = true
+   local preds = {}
+   local function visit(p)
+      if preds[p] or p.prim or p.view then
+	 return
+      end
+      for id,clause in pairs(p.db) do
+	 if #clause > 0 then
+	    preds[p] = true
+	    for i=1,#clause do
+	       visit(clause[i].pred)
+	    end
+	 end
+      end
+   end
+   visit(pred)
+   preds[pred] = true
+   fill(preds)
+   views = views or {}
+   for p in pairs(preds) do
+      views[p] = true
+   end
+   return pred
+end
+
+-- Is a view affected by a change to the clauses of a predicate?
+
+local function affects_views(pred)
+   local seen = {[pred] = true}
+   local todo = {pred}
+   while #todo > 0 do
+      local p = table.remove(todo)
+      if p.view then
+	 return true
+      end
+      for user in pairs(rdeps[p] or {}) do
+	 if not seen[user] then
+	    seen[user] = true
+	    table.insert(todo, user)
+	 end
+      end
+   end
+   return false
+end
+
+local function rematerialize()
+   for pred in pairs(views) do
+      pred.view = nil
+   end
+   views = nil
+   for pred in pairs(requested) do
+      materialize(pred)
+   end
+end
+
+function view_assert(clause)
+   if not views then
+      return
+   end
+   local literal = clause.head
+   if #clause > 0 then
+      if affects_views(literal.pred) then
+	 rematerialize()
+      end
+   elseif not literal.pred.view or view_add(literal.pred, literal) then
+      propagate_insert({literal})
+   end
+end
+
+-- Called before a clause is removed from the database.  Returns the
+-- facts removed from views, which are then removed by view_rederive.
+
+function view_overdelete(clause)
+   if not views or #clause > 0 then
+      return nil
+   end
+   local deleted = {}
+   local seen = {}
+   local todo = {}
+   local function over(literal)
+      local id = get_id(literal)
+      if not seen[id] then
+	 seen[id] = true
+	 table.insert(deleted, literal)
+	 table.insert(todo, literal)
+      end
+   end
+   local literal = clause.head
+   if literal.pred.view then
+      over(literal)
+   else
+      table.insert(todo, literal)
+   end
+   while #todo > 0 do
+      local facts = consequences(table.remove(todo))
+      for i=1,#facts do
+	 over(facts[i])
+      end
+   end
+   return deleted
+end
+
+-- Called after a clause is removed from the database.
+
+function view_rederive(clause, deleted)
+   if not views then
+      return
+   end
+   if #clause > 0 then
+      if affects_views(clause.head.pred) then
+	 rematerialize()
+      end
+      return
+   end
+   for i=1,#deleted do
+      view_remove(deleted[i].pred, deleted[i])
+   end
+   local back = {}
+   for i=1,#deleted do
+      if derivable(deleted[i]) then
+	 view_add(deleted[i].pred, deleted[i])
+	 table.insert(back, deleted[i])
+      end
+   end
+   propagate_insert(back)
+end
+
+-- Called after reverting to a snapshot.
+
+function view_revert()
+   if views then
+      rematerialize()
+   end
+end
+
+-- PRIMITIVES
+
+--[[
+
+A primitive predicate, also called a built-in predicate, is
+implemented by code.  Assertions about a primitive predicate are
+ignored, as the code takes precedence.  Use the make_pred function to
+access a primitive by name.
+
+The behavior of a primitive predicate is defined by adding a function
+to the predicate's prim field.  The function takes a literal and a
+subgoal.  The typical primitive derives a set of facts from the
+literal, and for each derived fact f, reports the result by invoking
+fact(subgoal, f).
+
+The equals primitive defined below is protected from garage collection
+because the primitive is bound to a local variable.  A primitive not
+stored in a Lua data structure can be protected by entering it into
+the predicate database used by assert and retract.  For primitives
+created from C, protection may be provided by entering the predicate
+into the Lua registry.
+
+Use the add_iter_prim function to add a primitive predicate that can
+defined by an iterator which when given a literal, generates a
+sequence of answers, each answer being an array of strings or numbers.
 
 ]]
 
 -- Other parts of the Datalog system depend on the equality primitive,
 -- so carefully consider any modifications to it.
 
+local binary_equals_pred = make_pred("=", 2)
+
 do				-- equals primitive
-   local binary_equals_pred = make_pred("=", 2)
 
    local function equals_primitive(literal, subgoal)
       local x = literal[1]
@@ -811,6 +1865,8 @@ local function add_iter_prim(name, arity, iter)
       end
    end
    pred.prim = prim
+   invalidate(pred)
+   magic_programs = {}
    return insert(pred)
 end
 
@@ -863,6 +1919,421 @@ datalog.add_iter_prim("succ", 2, succ)
 
 --]]
 
+-- MAGIC SETS
+
+--[[
+
+A bottom-up evaluation computes every fact of every predicate a query
+depends on, even when the query has constant arguments and needs few
+of them.  The magic sets transformation rewrites the rules so that
+they only derive facts relevant to the query.  See "Magic Sets and
+Other Strange Ways to Implement Logic Programs", Bancilhon, F.,
+Maier, D., Sagiv, Y., and Ullman, J. D., PODS 1986, pp. 1-15.
+
+A predicate with rules is adorned with a string that has a "b" for
+each argument that is bound when it is called, and an "f" for each
+free one.  Each adorned predicate is given a magic predicate, whose
+facts are the bound arguments of the calls made to it.  A rule for
+the adorned predicate first looks up its bound arguments in the magic
+predicate.  Body literals are called from left to right, so an
+argument is bound if it is a constant, a bound variable of the head,
+or a variable of an earlier literal.  Each call to a predicate with
+rules adds a magic rule that derives its bound arguments from those
+of the head and the earlier literals.  Facts of a predicate with
+rules are reached through a rule that reads the unchanged predicate,
+which the evaluator loads without its rules.
+
+The query supplies the single seed fact of its magic predicate.  The
+rewritten program depends only on the predicate and adornment of the
+query, and is reused by later queries with the same binding pattern.
+
+]]
+
+local function has_rules(pred)
+   for id,clause in pairs(pred.db) do
+      if #clause > 0 then
+	 return true
+      end
+   end
+   return false
+end
+
+-- Returns the adornment of a literal, given the set of bound
+-- variables.
+
+local function adornment(literal, bound)
+   local a = {}
+   for i=1,#literal do
+      local term = literal[i]
+      if term:is_const() or bound[term] then
+	 a[i] = "b"
+      else
+	 a[i] = "f"
+      end
+   end
+   return table.concat(a)
+end
+
+-- Returns a literal with the terms of a literal at the bound
+-- positions of an adornment.
+
+local function bound_args(pred, literal, a)
+   local new = {pred = pred}
+   for i=1,#literal do
+      if string.sub(a, i, i) == "b" then
+	 table.insert(new, literal[i])
+      end
+   end
+   return new
+end
+
+-- Rewrites the program for a predicate and adornment.  The result
+-- lists the predicates read by the evaluator, in the format returned
+-- by dl_program, and has the adorned and magic predicates of the
+-- query.  Nil is returned when the program uses a primitive other
+-- than equality.
+
+local function magic_rewrite(pred, a)
+   local preds = {}
+   local originals = {}
+   local adorned = {}
+   local todo = {}
+
+   local function add_pred(p, name, arity, facts)
+      table.insert(preds, {pred = p, name = name, arity = arity,
+			   equals = p == binary_equals_pred,
+			   facts = facts})
+   end
+
+   local function original(p)
+      if not originals[p] then
+	 originals[p] = true
+	 add_pred(p, p.name, p.arity, true)
+      end
+   end
+
+   local function adorn(p, a)
+      local key = p.id .. "/" .. a
+      local entry = adorned[key]
+      if not entry then
+	 local _, n = string.gsub(a, "b", "")
+	 entry = {pred = p, adornment = a,
+		  answer = {name = p.name, arity = p.arity, db = {}},
+		  magic = {name = "magic " .. key, arity = n, db = {}}}
+	 adorned[key] = entry
+	 add_pred(entry.answer, p.name, p.arity)
+	 add_pred(entry.magic, entry.magic.name, n)
+	 table.insert(todo, entry)
+      end
+      return entry
+   end
+
+   local function rewrite(entry, clause)
+      local head = clause.head
+      local a = entry.adornment
+      local bound = {}
+      for i=1,#head do
+	 if string.sub(a, i, i) == "b" and not head[i]:is_const() then
+	    bound[head[i]] = true
+	 end
+      end
+      local body = {bound_args(entry.magic, head, a)}
+      for j=1,#clause do
+	 local literal = clause[j]
+	 local p = literal.pred
+	 if p == binary_equals_pred then
+	    original(p)
+	    local x, y = literal[1], literal[2]
+	    if x:is_const() or bound[x] then
+	       bound[y] = true
+	    elseif y:is_const() or bound[y] then
+	       bound[x] = true
+	    end
+	 else
+	    if p.prim then
+	       return false
+	    elseif has_rules(p) then
+	       local callee = adorn(p, adornment(literal, bound))
+	       local magic = {}
+	       for k=1,#body do
+		  magic[k] = body[k]
+	       end
+	       magic.head = bound_args(callee.magic, literal,
+				       callee.adornment)
+	       table.insert(callee.magic.db, magic)
+	       local new = {pred = callee.answer}
+	       for i=1,#literal do
+		  new[i] = literal[i]
+	       end
+	       literal = new
+	    else
+	       original(p)
+	    end
+	    for i=1,#literal do
+	       bound[literal[i]] = true
+	    end
+	 end
+	 table.insert(body, literal)
+      end
+      body.head = {pred = entry.answer}
+      for i=1,#head do
+	 body.head[i] = head[i]
+      end
+      table.insert(entry.answer.db, body)
+      return true
+   end
+
+   local query = adorn(pred, a)
+   while #todo > 0 do
+      local entry = table.remove(todo)
+      local p = entry.pred
+      local facts = {pred = p}
+      for i=1,p.arity do
+	 facts[i] = make_var(i)
+      end
+      original(p)
+      local rule = {bound_args(entry.magic, facts, entry.adornment), facts}
+      rule.head = {pred = entry.answer}
+      for i=1,p.arity do
+	 rule.head[i] = facts[i]
+      end
+      table.insert(entry.answer.db, rule)
+      for id,clause in pairs(p.db) do
+	 if #clause > 0 and not rewrite(entry, clause) then
+	    return nil
+	 end
+      end
+   end
+   return {preds = preds, answer = query.answer, magic = query.magic}
+end
+
+-- REPLICAS
+
+-- A database can publish a version of its facts and rules, which
+-- replicas install.  A replica is a database in another Lua state,
+-- possibly used by another thread.  The C library keeps versions
+-- outside of any Lua state, and a replica installs the facts of a
+-- version as fact stores that share their rows with the stores of the
+-- database, so they are not copied.  The rules are copied, as they are
+-- few.  For the rows to mean the same thing everywhere, a database
+-- and its replicas number their constants with one symbol table, kept
+-- by the C library.
+
+-- Numbers constants with the shared symbol table.  The function
+-- symbol returns the symbol of an id, adding it to the table if need
+-- be, using the symbol given as its second argument when there is
+-- one, and the function name returns the id of a symbol.  The
+-- constants made so far keep their symbols, which are added to the
+-- table, or given new ones when theirs are taken.  The constants of
+-- the symbols in the rows of the stores are made first, and held
+-- until then, as the table of constants may hold them weakly.
+-- Constants of symbols first seen in the rows of a replica's stores
+-- are made when looked up.  When weak is true, name knows every
+-- symbol, so the table of constants holds them weakly, as they can be
+-- made again.  The C library reclaims the symbols no database of the
+-- family uses, asking each for its own with dl_symbols.
+
+local sharing = false		-- Are symbols shared?
+
+function dl_share_symbols(symbol, name, weak)
+   local marks = {}
+   mark_stores(marks)
+   local stored = {}
+   for sym in pairs(marks) do
+      local const = const_of_sym[sym]
+      if const then
+	 stored[const] = true
+      end
+   end
+   for sym,const in pairs(const_of_sym) do
+      stored[const] = true
+      const_of_sym[sym] = nil
+   end
+   sharing = true
+   for id,const in pairs(const_ids) do
+      const.sym = symbol(id, const.sym)
+   end
+   for const in pairs(stored) do
+      const_of_sym[const.sym] = const
+   end
+   const_sym = symbol
+   setmetatable(const_of_sym, {
+		   __mode = weak and "v" or nil,
+		   __index = function(tbl, sym)
+		      local const = make_const(name(sym))
+		      tbl[sym] = const
+		      return const
+		   end
+		})
+   invalidate_all()
+end
+
+-- Returns a table whose keys are the symbols used by the database,
+-- those in the rows of its stores and those of its constants.
+
+function dl_symbols()
+   local marks = {}
+   mark_stores(marks)
+   for id,const in pairs(const_ids) do
+      marks[const.sym] = true
+   end
+   return marks
+end
+
+-- Returns the predicates with facts, and when the rules have changed
+-- since the count given, an array with every rule, followed by the
+-- current count.
+
+function dl_publish(changed)
+   local preds = {}
+   for id,pred in pairs(db) do
+      if not pred.prim and pred.facts and pred.facts:count() > 0 then
+	 table.insert(preds, pred)
+      end
+   end
+   if changed == rules_changed then
+      return preds, nil, rules_changed
+   end
+   local rules = {}
+   for id,pred in pairs(db) do
+      for id,clause in pairs(pred.db) do
+	 table.insert(rules, clause)
+      end
+   end
+   return preds, rules, rules_changed
+end
+
+-- The predicates given facts by the last version installed, and the
+-- rules it added.
+
+local installed_preds = {}
+local installed_rules = {}
+
+-- Installs a version in a replica.  Each entry of preds has the name,
+-- the arity, and the fact store of a predicate.  The rules, when
+-- given, replace the ones installed before.  A rule is an array of
+-- literals, head first, and a literal has the name of its predicate,
+-- and an array of terms, which are the symbols of constants, or the
+-- negative symbols of variables, as numbered by the publisher.
+
+local function install_rule(code)
+   local vars = {}
+   local literals = {}
+   for i=1,#code do
+      local terms = {}
+      for j=1,#code[i] do
+	 local term = code[i][j]
+	 if term > 0 then
+	    terms[j] = const_of_sym[term]
+	 else
+	    local var = vars[term]
+	    if not var then
+	       var = make_var(-term)
+	       vars[term] = var
+	    end
+	    terms[j] = var
+	 end
+      end
+      literals[i] = make_literal(code[i].name, terms)
+   end
+   local clause = {head = literals[1]}
+   for i=2,#literals do
+      clause[i - 1] = literals[i]
+   end
+   return assert(clause)
+end
+
+function dl_refresh(preds, rules)
+   local fresh = {}
+   for i=1,#preds do
+      local pred = make_pred(preds[i].name, preds[i].arity)
+      pred.facts = preds[i].facts
+      fresh[pred] = true
+      insert(pred)
+   end
+   for pred in pairs(installed_preds) do
+      if not fresh[pred] then
+	 pred.facts = nil
+	 if not next(pred.db) and not pred.prim then
+	    remove(pred)
+	 end
+      end
+   end
+   installed_preds = fresh
+   if rules then
+      for i=1,#installed_rules do
+	 retract(installed_rules[i])
+      end
+      installed_rules = {}
+      for i=1,#rules do
+	 local clause = install_rule(rules[i])
+	 if clause then
+	    table.insert(installed_rules, clause)
+	 end
+      end
+   end
+   invalidate_all()
+end
+
+-- IMAGES
+
+-- An image is a file holding the facts and rules of a database, and
+-- the ids of the symbols they use, written so that its fact stores
+-- can use the rows in the file as it is mapped into memory.  A
+-- database loading an image numbers its constants as the database
+-- that saved it did, using the symbol table of the image, so the rows
+-- need no change, and the constants of their symbols are made when
+-- looked up, as in a replica.
+
+-- Returns the predicates with facts and every rule, as dl_publish
+-- does, and the table mapping symbols to constants, holding the
+-- constants of the rules too.
+
+function dl_image()
+   local preds, rules = dl_publish()
+   for i=1,#rules do
+      local clause = rules[i]
+      for j=0,#clause do
+	 local literal = j == 0 and clause.head or clause[j]
+	 for k=1,#literal do
+	    local term = literal[k]
+	    if term:is_const() then
+	       const_of_sym[term.sym] = term
+	    end
+	 end
+      end
+   end
+   return preds, rules, const_of_sym
+end
+
+-- Loads an image into a database without clauses.  The functions
+-- symbol and name are those of the symbol table of the image, and the
+-- predicates and rules are given as for dl_refresh.  The name of a
+-- symbol given to an id not in the image is not known, so the table of
+-- constants holds them.
+
+function dl_load_image(symbol, name, preds, rules)
+   if sharing then
+      error("cannot load an image into a database sharing its symbols")
+   end
+   for id,pred in pairs(db) do
+      if not pred.prim and
+	 (next(pred.db) or pred.facts and pred.facts:count() > 0) then
+	 error("cannot load an image into a database with clauses")
+      end
+   end
+   dl_share_symbols(symbol, name)
+   for i=1,#preds do
+      local pred = make_pred(preds[i].name, preds[i].arity)
+      pred.facts = preds[i].facts
+      insert(pred)
+   end
+   for i=1,#rules do
+      install_rule(rules[i])
+   end
+   invalidate_all()
+end
+
 -- EXPORTED FUNCTIONS
 
 -- The C API
@@ -892,6 +2363,17 @@ function dl_makeliteral(tbl)
    return tbl
 end
 
+-- A parameter is held by a fresh variable until the literal is
+-- prepared, and its position is recorded in the literal.
+
+function dl_addparam(tbl)
+   table.insert(tbl, mk_fresh_var())
+   local params = tbl.params or {}
+   params[#params + 1] = #tbl
+   tbl.params = params
+   return tbl
+end
+
 function dl_pushhead(literal)
    return {head = literal}
 end
@@ -909,6 +2391,81 @@ dl_assert = assert
 
 dl_retract = retract
 
+-- Asserts a batch of n facts for the C function dl_assert_facts.  The
+-- ids of the constants of the facts are listed in order in terms.
+-- Unless views have to be maintained, the facts go straight into the
+-- fact store of the predicate, whose tables are invalidated once.
+
+function dl_assert_facts(name, arity, n, terms)
+   local pred = make_pred(name, arity)
+   if pred.prim or n == 0 then
+      return
+   end
+   if views then
+      for i=0,n-1 do
+	 local literal = {pred = pred}
+	 for j=1,arity do
+	    literal[j] = make_const(terms[i * arity + j])
+	 end
+	 assert({head = literal})
+      end
+      return
+   end
+   touch(pred)
+   local facts = pred.facts
+   if not facts then
+      facts = make_facts(arity)
+      pred.facts = facts
+   end
+   local added = false
+   for i=0,n-1 do
+      local literal = {pred = pred}
+      for j=1,arity do
+	 literal[j] = make_const(terms[i * arity + j])
+      end
+      if add_fact(facts, literal) then
+	 added = true
+      end
+   end
+   if added then
+      invalidate(pred)
+      sweep_consts()
+   end
+   insert(pred)
+end
+
+dl_save = save
+
+dl_restore = restore
+
+-- Snapshots taken from C are referred to by number.
+
+local numbered_snapshots = {n = 0}
+
+function dl_snapshot()
+   numbered_snapshots.n = numbered_snapshots.n + 1
+   numbered_snapshots[numbered_snapshots.n] = snapshot()
+   return numbered_snapshots.n
+end
+
+function dl_revert(n)
+   local snap = numbered_snapshots[n]
+   if not snap then
+      error("no snapshot numbered " .. tostring(n))
+   end
+   revert(snap)
+end
+
+function dl_release(n)
+   numbered_snapshots[n] = nil
+end
+
+function dl_materialize(literal)
+   if not literal.pred.prim then
+      return materialize(literal.pred)
+   end
+end
+
 -- This C API function is more complicated than the others because it
 -- is computing the total size of the character array that will be
 -- allocated by the C routine using this function.  The character
@@ -916,8 +2473,7 @@ dl_retract = retract
 -- terms in the answer.  Each item also needs room for the zero
 -- character used to terminate each string.
 
-function dl_ask(literal)
-   local answers = ask(literal)
+local function hand_back(answers)
    if not answers then
       return answers
    end
@@ -935,6 +2491,147 @@ function dl_ask(literal)
    return answers
 end
 
+function dl_ask(literal)
+   return hand_back(ask(literal))
+end
+
+-- Answers a literal for the C function dl_ask_open, which reads the
+-- answers from the table of facts returned in the first slot of an
+-- array, keeping the key of the next answer in the second.
+
+function dl_ask_open(literal)
+   local subgoal = solve(literal)
+   return {subgoal.facts}, get_name(literal.pred), get_arity(literal.pred)
+end
+
+-- A prepared query keeps a template of its literal, in which each
+-- parameter holds the constant it was last bound to.  Values are set
+-- from C as strings in the array of values, and a constant is only
+-- looked up when the value of its parameter has changed, so making
+-- the literal to ask copies the template and little else.  The handle
+-- is the userdata used by C.
+
+function dl_prepare(literal, handle)
+   local params = literal.params or {}
+   literal.params = nil
+   local values = {}
+   for i=1,#params do
+      values[i] = false
+   end
+   local prep = {handle = handle, literal = literal, params = params,
+		 values = values, ids = {}}
+   return prep, values, #params
+end
+
+function dl_instantiate(prep)
+   local template = prep.literal
+   local params = prep.params
+   local values = prep.values
+   local ids = prep.ids
+   for i=1,#params do
+      local value = values[i]
+      if value ~= ids[i] then
+	 if not value then
+	    error("parameter " .. i - 1 .. " is not bound")
+	 end
+	 template[params[i]] = make_const(value)
+	 ids[i] = value
+      end
+   end
+   local literal = {pred = template.pred}
+   for i=1,#template do
+      literal[i] = template[i]
+   end
+   return literal
+end
+
+-- The group is an array of positions.
+
+function dl_aggregate(literal, op, column, group)
+   return hand_back(aggregate(literal, op, column, group))
+end
+
+-- Uses the magic sets transformation to make the program for a
+-- literal with constant arguments.  The query is answered by the
+-- literal returned, whose predicate is the adorned one.
+
+local function magic_program(literal)
+   local pred = literal.pred
+   local a = adornment(literal, {})
+   if not string.find(a, "b") or not has_rules(pred) then
+      return nil
+   end
+   local programs = magic_programs[pred]
+   if not programs then
+      programs = {}
+      magic_programs[pred] = programs
+   end
+   local program = programs[a]
+   if program == nil then
+      program = magic_rewrite(pred, a) or false
+      programs[a] = program
+   end
+   if not program then
+      return nil
+   end
+   program.magic.db.seed = {head = bound_args(program.magic, literal, a)}
+   program.preds.consts = const_of_sym
+   local query = {pred = program.answer}
+   for i=1,#literal do
+      query[i] = literal[i]
+   end
+   return query, program.preds
+end
+
+-- Collects the predicates a literal depends on for the native
+-- bottom-up evaluator.  The result is the literal to answer, an array
+-- with one entry for each predicate, giving the predicate, its name,
+-- its arity, whether it is the equality primitive, and whether only
+-- its facts are used, and the metatable shared by constants.  When
+-- magic is true, the program is rewritten for the constant arguments
+-- of the literal.  If the evaluator cannot handle the literal,
+-- because it depends on a primitive other than equality, nil is
+-- returned, and the caller falls back to the tabled prover.
+
+function dl_program(literal, magic)
+   if literal.pred.prim then
+      return nil
+   end
+   if magic then
+      local query, preds = magic_program(literal)
+      if query then
+	 return query, preds, Const
+      end
+   end
+   local preds = {}
+   local seen = {}
+   local function visit(pred)
+      if seen[pred] then
+	 return true
+      end
+      seen[pred] = true
+      local equals = pred == binary_equals_pred
+      if pred.prim and not equals then
+	 return false
+      end
+      table.insert(preds, {pred = pred, name = get_name(pred),
+			   arity = get_arity(pred), equals = equals})
+      for id,clause in pairs(pred.db) do
+	 for i=1,#clause do
+	    if not visit(clause[i].pred) then
+	       return false
+	    end
+	 end
+      end
+      return true
+   end
+   if not visit(literal.pred) then
+      return nil
+   end
+   preds.consts = const_of_sym
+   return literal, preds, Const
+end
+
 -- The Lua API
 
 datalog = {
@@ -954,6 +2651,8 @@ datalog = {
    copy = copy,
    revert = revert,
    ask = ask,
+   aggregate = aggregate,
+   materialize = materialize,
    add_iter_prim = add_iter_prim,
 }
 
@@ -99,504 +99,1320 @@ static const unsigned char datalog_lua_bytes[] = {
    61, 32,118, 97,108,117,101, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10,
    32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,118, 97,108,117,101,
    10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,
-  105,110,116,101,114,110, 10,101,110,100, 10, 10, 45, 45, 32, 65, 32,116,
-  101,114,109, 32,105,115, 32,101,105,116,104,101,114, 32, 97, 32,118, 97,
-  114,105, 97, 98,108,101, 32,111,114, 32, 97, 32, 99,111,110,115,116, 97,
-  110,116, 46, 10, 10, 45, 45, 32, 86, 97,114,105, 97, 98,108,101,115, 32,
-   97,115, 32,115,105,109,112,108,101, 32,111, 98,106,101, 99,116,115, 46,
-   10, 10,108,111, 99, 97,108, 32, 86, 97,114, 32, 61, 32,123,125, 10, 86,
-   97,114, 46, 95, 95,105,110,100,101,120, 32, 61, 32, 86, 97,114, 10, 10,
+  105,110,116,101,114,110, 44, 32,116, 98,108, 10,101,110,100, 10, 10, 45,
+   45, 32, 65, 32,116,101,114,109, 32,105,115, 32,101,105,116,104,101,114,
+   32, 97, 32,118, 97,114,105, 97, 98,108,101, 32,111,114, 32, 97, 32, 99,
+  111,110,115,116, 97,110,116, 46, 10, 10, 45, 45, 32, 86, 97,114,105, 97,
+   98,108,101,115, 32, 97,115, 32,115,105,109,112,108,101, 32,111, 98,106,
+  101, 99,116,115, 46, 10, 10,108,111, 99, 97,108, 32, 86, 97,114, 32, 61,
+   32,123,125, 10, 86, 97,114, 46, 95, 95,105,110,100,101,120, 32, 61, 32,
+   86, 97,114, 10, 10, 45, 45, 32, 69,118,101,114,121, 32,116,101,114,109,
+   32,104, 97,115, 32, 97, 32,115,121,109, 98,111,108, 44, 32, 97, 32,110,
+  117,109, 98,101,114, 32,117,115,101,100, 32,105,110, 32,112,108, 97, 99,
+  101, 32,111,102, 32,105,116,115, 32,105,100, 32,119,104,101,110, 10, 45,
+   45, 32, 98,117,105,108,100,105,110,103, 32,107,101,121,115, 46, 32, 32,
+   67,111,110,115,116, 97,110,116,115, 32,104, 97,118,101, 32,112,111,115,
+  105,116,105,118,101, 32,115,121,109, 98,111,108,115, 44, 32, 97,110,100,
+   32,118, 97,114,105, 97, 98,108,101,115, 10, 45, 45, 32,104, 97,118,101,
+   32,110,101,103, 97,116,105,118,101, 32,111,110,101,115, 46, 32, 32, 83,
+  121,109, 98,111,108,115, 32, 97,114,101, 32,100,101,110,115,101, 44, 32,
+   97,115, 32,116,104,101,121, 32, 97,114,101, 32,104, 97,110,100,101,100,
+   32,111,117,116, 32,105,110, 10, 45, 45, 32,111,114,100,101,114, 32, 98,
+  121, 32, 99,111,117,110,116,101,114,115, 46, 10, 10,108,111, 99, 97,108,
+   32, 99,111,110,115,116, 95,115,121,109,115, 32, 61, 32, 48, 10,108,111,
+   99, 97,108, 32,118, 97,114, 95,115,121,109,115, 32, 61, 32, 48, 10, 10,
   108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,109,107, 95,
-  118, 97,114, 40,105,100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,116,
-   98,108, 32, 61, 32,123,105,100, 32, 61, 32,105,100,125, 10, 32, 32, 32,
-  114,101,116,117,114,110, 32,115,101,116,109,101,116, 97,116, 97, 98,108,
-  101, 40,116, 98,108, 44, 32, 86, 97,114, 41, 10,101,110,100, 10, 10,108,
-  111, 99, 97,108, 32,109, 97,107,101, 95,118, 97,114, 32, 61, 32,109,107,
-   95,105,110,116,101,114,110, 40,109,107, 95,118, 97,114, 41, 10, 10,108,
-  111, 99, 97,108, 32,102,114,101,115,104, 95,118, 97,114, 95,115,116, 97,
-  116,101, 32, 61, 32, 48, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,
-  116,105,111,110, 32,109,107, 95,102,114,101,115,104, 95,118, 97,114, 40,
-   41, 10, 32, 32, 32,108,111, 99, 97,108, 32,105,100, 32, 61, 32,116,111,
-  115,116,114,105,110,103, 40,102,114,101,115,104, 95,118, 97,114, 95,115,
-  116, 97,116,101, 41, 10, 32, 32, 32,102,114,101,115,104, 95,118, 97,114,
-   95,115,116, 97,116,101, 32, 61, 32,102,114,101,115,104, 95,118, 97,114,
-   95,115,116, 97,116,101, 32, 43, 32, 49, 32, 45, 45, 32, 84,111, 32,101,
-  110,115,117,114,101, 32,102,114,101,115,104,110,101,115,115, 44, 10, 32,
-   32, 32,114,101,116,117,114,110, 32,109,107, 95,118, 97,114, 40,105,100,
-   41, 59,  9,  9, 45, 45, 32,100,111,110, 39,116, 32,105,110,116,101,114,
-  110, 32,116,104,105,115, 32,118, 97,114,105, 97, 98,108,101, 46, 10,101,
-  110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 86, 97,114, 58,105,
-  115, 95, 99,111,110,115,116, 40, 41, 10, 32, 32, 32,114,101,116,117,114,
-  110, 32,102, 97,108,115,101, 10,101,110,100, 10, 10, 45, 45, 32, 67,111,
-  110,115,116, 97,110,116,115, 32, 97,115, 32,115,105,109,112,108,101, 32,
-  111, 98,106,101, 99,116,115, 46, 10, 10,108,111, 99, 97,108, 32, 67,111,
-  110,115,116, 32, 61, 32,123,125, 10, 67,111,110,115,116, 46, 95, 95,105,
-  110,100,101,120, 32, 61, 32, 67,111,110,115,116, 10, 10,108,111, 99, 97,
-  108, 32,102,117,110, 99,116,105,111,110, 32,109,107, 95, 99,111,110,115,
-  116, 40,105,100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,116, 98,108,
-   32, 61, 32,123,105,100, 32, 61, 32,105,100,125, 10, 32, 32, 32,114,101,
+  118, 97,114, 40,105,100, 41, 10, 32, 32, 32,118, 97,114, 95,115,121,109,
+  115, 32, 61, 32,118, 97,114, 95,115,121,109,115, 32, 45, 32, 49, 10, 32,
+   32, 32,108,111, 99, 97,108, 32,116, 98,108, 32, 61, 32,123,105,100, 32,
+   61, 32,105,100, 44, 32,115,121,109, 32, 61, 32,118, 97,114, 95,115,121,
+  109,115,125, 10, 32, 32, 32,114,101,116,117,114,110, 32,115,101,116,109,
+  101,116, 97,116, 97, 98,108,101, 40,116, 98,108, 44, 32, 86, 97,114, 41,
+   10,101,110,100, 10, 10,108,111, 99, 97,108, 32,109, 97,107,101, 95,118,
+   97,114, 32, 61, 32,109,107, 95,105,110,116,101,114,110, 40,109,107, 95,
+  118, 97,114, 41, 10, 10,108,111, 99, 97,108, 32,102,114,101,115,104, 95,
+  118, 97,114, 95,115,116, 97,116,101, 32, 61, 32, 48, 10, 10,108,111, 99,
+   97,108, 32,102,117,110, 99,116,105,111,110, 32,109,107, 95,102,114,101,
+  115,104, 95,118, 97,114, 40, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,
+  105,100, 32, 61, 32,116,111,115,116,114,105,110,103, 40,102,114,101,115,
+  104, 95,118, 97,114, 95,115,116, 97,116,101, 41, 10, 32, 32, 32,102,114,
+  101,115,104, 95,118, 97,114, 95,115,116, 97,116,101, 32, 61, 32,102,114,
+  101,115,104, 95,118, 97,114, 95,115,116, 97,116,101, 32, 43, 32, 49, 32,
+   45, 45, 32, 84,111, 32,101,110,115,117,114,101, 32,102,114,101,115,104,
+  110,101,115,115, 44, 10, 32, 32, 32,114,101,116,117,114,110, 32,109,107,
+   95,118, 97,114, 40,105,100, 41, 59,  9,  9, 45, 45, 32,100,111,110, 39,
+  116, 32,105,110,116,101,114,110, 32,116,104,105,115, 32,118, 97,114,105,
+   97, 98,108,101, 46, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,
+  110, 32, 86, 97,114, 58,105,115, 95, 99,111,110,115,116, 40, 41, 10, 32,
+   32, 32,114,101,116,117,114,110, 32,102, 97,108,115,101, 10,101,110,100,
+   10, 10, 45, 45, 32, 67,111,110,115,116, 97,110,116,115, 32, 97,115, 32,
+  115,105,109,112,108,101, 32,111, 98,106,101, 99,116,115, 46, 10, 10,108,
+  111, 99, 97,108, 32, 67,111,110,115,116, 32, 61, 32,123,125, 10, 67,111,
+  110,115,116, 46, 95, 95,105,110,100,101,120, 32, 61, 32, 67,111,110,115,
+  116, 10, 10, 45, 45, 32, 84,104,101, 32,115,121,109, 98,111,108, 32,111,
+  102, 32, 97, 32,110,101,119, 32, 99,111,110,115,116, 97,110,116, 32,105,
+  115, 32,103,105,118,101,110, 32, 98,121, 32,116,104,101, 32,102,117,110,
+   99,116,105,111,110, 32, 98,101,108,111,119, 44, 32,119,104,105, 99,104,
+   10, 45, 45, 32,105,115, 32,114,101,112,108, 97, 99,101,100, 32,119,104,
+  101,110, 32,116,104,101, 32,100, 97,116, 97, 98, 97,115,101, 32,115,104,
+   97,114,101,115, 32,105,116,115, 32,115,121,109, 98,111,108,115, 32,119,
+  105,116,104, 32,114,101,112,108,105, 99, 97,115, 46, 10, 10,108,111, 99,
+   97,108, 32,102,117,110, 99,116,105,111,110, 32, 99,111,110,115,116, 95,
+  115,121,109, 40,105,100, 41, 10, 32, 32, 32, 99,111,110,115,116, 95,115,
+  121,109,115, 32, 61, 32, 99,111,110,115,116, 95,115,121,109,115, 32, 43,
+   32, 49, 10, 32, 32, 32,114,101,116,117,114,110, 32, 99,111,110,115,116,
+   95,115,121,109,115, 10,101,110,100, 10, 10,108,111, 99, 97,108, 32,102,
+  117,110, 99,116,105,111,110, 32,109,107, 95, 99,111,110,115,116, 40,105,
+  100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,116, 98,108, 32, 61, 32,
+  123,105,100, 32, 61, 32,105,100, 44, 32,115,121,109, 32, 61, 32, 99,111,
+  110,115,116, 95,115,121,109, 40,105,100, 41,125, 10, 32, 32, 32,114,101,
   116,117,114,110, 32,115,101,116,109,101,116, 97,116, 97, 98,108,101, 40,
   116, 98,108, 44, 32, 67,111,110,115,116, 41, 10,101,110,100, 10, 10,108,
-  111, 99, 97,108, 32,109, 97,107,101, 95, 99,111,110,115,116, 32, 61, 32,
-  109,107, 95,105,110,116,101,114,110, 40,109,107, 95, 99,111,110,115,116,
-   41, 10, 10,102,117,110, 99,116,105,111,110, 32, 67,111,110,115,116, 58,
-  105,115, 95, 99,111,110,115,116, 40, 41, 10, 32, 32, 32,114,101,116,117,
-  114,110, 32,116,114,117,101, 10,101,110,100, 10, 10, 45, 45, 32, 80,114,
-  101,100,105, 99, 97,116,101, 32,115,121,109, 98,111,108,115, 10, 10, 45,
-   45, 32, 65, 32,112,114,101,100,105, 99, 97,116,101, 32,115,121,109, 98,
-  111,108, 32,104, 97,115, 32, 97, 32,110, 97,109,101, 44, 32, 97,110, 32,
-   97,114,105,116,121, 44, 32, 97,110,100, 32, 97, 32,100, 97,116, 97, 98,
-   97,115,101, 32,116, 97, 98,108,101, 46, 32, 32, 73,116, 10, 45, 45, 32,
-   99, 97,110, 32, 97,108,115,111, 32,104, 97,118,101, 32, 97, 32,102,117,
-  110, 99,116,105,111,110, 32,117,115,101,100, 32,116,111, 32,105,109,112,
-  108,101,109,101,110,116, 32, 97, 32,112,114,105,109,105,116,105,118,101,
-   46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,
-  109,107, 95,112,114,101,100, 40,105,100, 41, 10, 32, 32, 32,114,101,116,
-  117,114,110, 32,123,105,100, 32, 61, 32,105,100, 44, 32,100, 98, 32, 61,
-   32,123,125,125, 10,101,110,100, 10, 10,108,111, 99, 97,108, 32,105,110,
-  116,101,114,110, 95,112,114,101,100, 32, 61, 32,109,107, 95,105,110,116,
-  101,114,110, 40,109,107, 95,112,114,101,100, 41, 10, 10,108,111, 99, 97,
-  108, 32,102,117,110, 99,116,105,111,110, 32,109,107, 95,112,114,101,100,
-   95,105,100, 40,112,114,101,100, 95,110, 97,109,101, 44, 32, 97,114,105,
-  116,121, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,112,114,101,100,
-   95,110, 97,109,101, 32, 46, 46, 32, 34, 47, 34, 32, 46, 46, 32, 97,114,
-  105,116,121, 10,101,110,100, 10, 10,108,111, 99, 97,108, 32,102,117,110,
-   99,116,105,111,110, 32,109, 97,107,101, 95,112,114,101,100, 40,112,114,
+  111, 99, 97,108, 32,109, 97,107,101, 95, 99,111,110,115,116, 44, 32, 99,
+  111,110,115,116, 95,105,100,115, 32, 61, 32,109,107, 95,105,110,116,101,
+  114,110, 40,109,107, 95, 99,111,110,115,116, 41, 10, 10,102,117,110, 99,
+  116,105,111,110, 32, 67,111,110,115,116, 58,105,115, 95, 99,111,110,115,
+  116, 40, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,116,114,117,101,
+   10,101,110,100, 10, 10, 45, 45, 32, 80,114,101,100,105, 99, 97,116,101,
+   32,115,121,109, 98,111,108,115, 10, 10, 45, 45, 32, 65, 32,112,114,101,
+  100,105, 99, 97,116,101, 32,115,121,109, 98,111,108, 32,104, 97,115, 32,
+   97, 32,110, 97,109,101, 44, 32, 97,110, 32, 97,114,105,116,121, 44, 32,
+   97,110,100, 32, 97, 32,100, 97,116, 97, 98, 97,115,101, 32,116, 97, 98,
+  108,101, 46, 32, 32, 73,116, 10, 45, 45, 32, 99, 97,110, 32, 97,108,115,
+  111, 32,104, 97,118,101, 32, 97, 32,102,117,110, 99,116,105,111,110, 32,
+  117,115,101,100, 32,116,111, 32,105,109,112,108,101,109,101,110,116, 32,
+   97, 32,112,114,105,109,105,116,105,118,101, 44, 32, 97,110,100, 32, 97,
+   32,115,116,111,114,101, 10, 45, 45, 32,104,111,108,100,105,110,103, 32,
+  105,116,115, 32,103,114,111,117,110,100, 32,102, 97, 99,116,115, 44, 32,
+  119,104,105, 99,104, 32, 97,114,101, 32,107,101,112,116, 32, 97,112, 97,
+  114,116, 32,102,114,111,109, 32,105,116,115, 32,114,117,108,101,115, 46,
+   32, 32, 73,116,115, 32,105,100, 10, 45, 45, 32, 99,111,109, 98,105,110,
+  101,115, 32,105,116,115, 32,110, 97,109,101, 32, 97,110,100, 32, 97,114,
+  105,116,121, 44, 32, 97,110,100, 32,105,115, 32,117,115,101,100, 32, 97,
+  115, 32, 97, 32,107,101,121, 32, 98,121, 32,116,104,101, 32,100, 97,116,
+   97, 98, 97,115,101, 10, 45, 45, 32, 98,101,108,111,119, 46, 32, 32, 80,
+  114,101,100,105, 99, 97,116,101,115, 32, 97,108,115,111, 32,104, 97,118,
+  101, 32,115,121,109, 98,111,108,115, 44, 32,110,117,109, 98,101,114,101,
+  100, 32,102,114,111,109, 32,111,110,101, 46, 10, 10, 45, 45, 32, 80,114,
+  101,100,105, 99, 97,116,101,115, 32, 97,114,101, 32,105,110,116,101,114,
+  110, 97,108,105,122,101,100, 32, 98,121, 32,110, 97,109,101, 32, 97,110,
+  100, 32,116,104,101,110, 32, 98,121, 32, 97,114,105,116,121, 44, 32,115,
+  111, 32,108,111,111,107,105,110,103, 10, 45, 45, 32,111,110,101, 32,117,
+  112, 32,100,111,101,115, 32,110,111,116, 32,105,110,118,111,108,118,101,
+   32, 98,117,105,108,100,105,110,103, 32,105,116,115, 32,105,100, 46, 10,
+   10,108,111, 99, 97,108, 32,112,114,101,100, 95,110, 97,109,101,115, 32,
+   61, 32,123,125, 10,108,111, 99, 97,108, 32,112,114,101,100, 95,115,121,
+  109,115, 32, 61, 32, 48, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,
+  116,105,111,110, 32,109,107, 95,112,114,101,100, 95,105,100, 40,112,114,
   101,100, 95,110, 97,109,101, 44, 32, 97,114,105,116,121, 41, 10, 32, 32,
-   32,114,101,116,117,114,110, 32,105,110,116,101,114,110, 95,112,114,101,
-  100, 40,109,107, 95,112,114,101,100, 95,105,100, 40,112,114,101,100, 95,
-  110, 97,109,101, 44, 32, 97,114,105,116,121, 41, 41, 10,101,110,100, 10,
-   10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,108, 97,
-  115,116, 95,115,108, 97,115,104, 40,115, 41,  9, 45, 45, 32, 82,101,116,
-  117,114,110,115, 32,116,104,101, 32,108,111, 99, 97,116,105,111,110, 32,
-  111,102, 32,116,104,101, 32,108, 97,115,116, 32,115,108, 97,115,104, 10,
-   32, 32, 32,108,111, 99, 97,108, 32,105, 32, 61, 32, 48,  9,  9,  9, 45,
-   45, 32,105,110, 32, 97, 32,115,116,114,105,110,103, 32,111,114, 32, 48,
-   46, 10, 32, 32, 32,119,104,105,108,101, 32,116,114,117,101, 32,100,111,
-   10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,106, 32, 61, 32,115,
-  116,114,105,110,103, 46,102,105,110,100, 40,115, 44, 32, 34, 47, 34, 44,
-   32,105, 32, 43, 32, 49, 41, 10, 32, 32, 32, 32, 32, 32,105,102, 32,110,
-  111,116, 32,106, 32,116,104,101,110, 10,  9, 32,114,101,116,117,114,110,
-   32,105, 10, 32, 32, 32, 32, 32, 32,101,108,115,101, 10,  9, 32,105, 32,
-   61, 32,106, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,
-  110,100, 10,101,110,100, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,
-  116,105,111,110, 32,103,101,116, 95,110, 97,109,101, 40,112,114,101,100,
-   41, 10, 32, 32, 32,108,111, 99, 97,108, 32,105, 32, 61, 32,108, 97,115,
-  116, 95,115,108, 97,115,104, 40,112,114,101,100, 46,105,100, 41, 10, 32,
-   32, 32,114,101,116,117,114,110, 32,115,116,114,105,110,103, 46,115,117,
-   98, 40,112,114,101,100, 46,105,100, 44, 32, 49, 44, 32,105, 32, 45, 32,
-   49, 41, 10,101,110,100, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,
-  116,105,111,110, 32,103,101,116, 95, 97,114,105,116,121, 40,112,114,101,
-  100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,105, 32, 61, 32,108, 97,
-  115,116, 95,115,108, 97,115,104, 40,112,114,101,100, 46,105,100, 41, 10,
-   32, 32, 32,114,101,116,117,114,110, 32,116,111,110,117,109, 98,101,114,
-   40,115,116,114,105,110,103, 46,115,117, 98, 40,112,114,101,100, 46,105,
-  100, 44, 32,105, 32, 43, 32, 49, 41, 41, 10,101,110,100, 10, 10, 45, 45,
-   32, 68,117,112,108,105, 99, 97,116,101,115, 32, 97, 32,112,114,101,100,
-  105, 99, 97,116,101, 46, 32, 32, 85,115,101,100, 32,116,111, 32, 99,108,
-  111,110,101, 32,100, 97,116, 97, 98, 97,115,101,115, 46, 10,108,111, 99,
-   97,108, 32,102,117,110, 99,116,105,111,110, 32,100,117,112, 40,112,114,
-  101,100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,100, 98, 32, 61, 32,
-  123,125, 10, 32, 32, 32,102,111,114, 32,107, 44,118, 32,105,110, 32,112,
-   97,105,114,115, 40,112,114,101,100, 46,100, 98, 41, 32,100,111, 10, 32,
-   32, 32, 32, 32, 32,100, 98, 91,107, 93, 32, 61, 32,118, 10, 32, 32, 32,
-  101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,123,105,100, 32,
-   61, 32,112,114,101,100, 46,105,100, 44, 32,100, 98, 32, 61, 32,100, 98,
-   44, 32,112,114,105,109, 32, 61, 32,112,114,101,100, 46,112,114,105,109,
-  125, 10,101,110,100, 10, 10, 45, 45, 32, 76,105,116,101,114, 97,108,115,
-   10, 10, 45, 45, 32, 65, 32,108,105,116,101,114, 97,108, 32,105,115, 32,
-   97, 32,112,114,101,100,105, 99, 97,116,101, 32, 97,110,100, 32, 97, 32,
-  115,101,113,117,101,110, 99,101, 32,111,102, 32,116,101,114,109,115, 44,
-   32,116,104,101, 32,110,117,109, 98,101,114, 32,111,102, 10, 45, 45, 32,
-  119,104,105, 99,104, 32,109,117,115,116, 32,109, 97,116, 99,104, 32,116,
-  104,101, 32,112,114,101,100,105, 99, 97,116,101, 39,115, 32, 97,114,105,
-  116,121, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,
-  110, 32,109, 97,107,101, 95,108,105,116,101,114, 97,108, 40,112,114,101,
-  100, 95,110, 97,109,101, 44, 32,116,101,114,109,115, 41, 10, 32, 32, 32,
-  108,111, 99, 97,108, 32, 97,114,105,116,121, 32, 61, 32, 35,116,101,114,
-  109,115, 10, 32, 32, 32,108,111, 99, 97,108, 32,112,114,101,100, 32, 61,
-   32,109, 97,107,101, 95,112,114,101,100, 40,112,114,101,100, 95,110, 97,
-  109,101, 44, 32, 97,114,105,116,121, 41, 10, 32, 32, 32,108,111, 99, 97,
-  108, 32,108,105,116,101,114, 97,108, 32, 61, 32,123,112,114,101,100, 32,
-   61, 32,112,114,101,100,125, 10, 32, 32, 32,102,111,114, 32,105, 61, 49,
-   44, 97,114,105,116,121, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,105,
-  116,101,114, 97,108, 91,105, 93, 32, 61, 32,116,101,114,109,115, 91,105,
-   93, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110,
-   32,108,105,116,101,114, 97,108, 10,101,110,100, 10, 10,108,111, 99, 97,
-  108, 32,102,117,110, 99,116,105,111,110, 32, 97,100,100, 95,115,105,122,
-  101, 40,115,116,114, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,116,
-  111,115,116,114,105,110,103, 40,115,116,114,105,110,103, 46,108,101,110,
-   40,115,116,114, 41, 41, 32, 46, 46, 32, 34, 58, 34, 32, 46, 46, 32,115,
-  116,114, 10,101,110,100, 10, 10, 45, 45, 32, 65, 32,108,105,116,101,114,
-   97,108, 39,115, 32,105,100, 32,105,115, 32, 99,111,109,112,117,116,101,
-  100, 32,111,110, 32,100,101,109, 97,110,100, 44, 32, 98,117,116, 32,116,
-  104,101,110, 32, 99, 97, 99,104,101,100, 46, 32, 32, 73,116, 32,105,115,
-   32,117,115,101,100, 10, 45, 45, 32, 98,121, 32, 97, 32, 99,108, 97,117,
-  115,101, 32,119,104,101,110, 32, 99,114,101, 97,116,105,110,103, 32,105,
-  116,115, 32,105,100, 46, 10, 10, 45, 45, 32, 84,104,101, 32,105,100, 39,
-  115, 32,101,110, 99,111,100,105,110,103, 32,101,110,115,117,114,101,115,
-   32,116,104, 97,116, 32,116,119,111, 32,108,105,116,101,114, 97,108,115,
-   32, 97,114,101, 32,115,116,114,117, 99,116,117,114, 97,108,108,121, 32,
-  116,104,101, 10, 45, 45, 32,115, 97,109,101, 32,105,102, 32,116,104,101,
-  121, 32,104, 97,118,101, 32,116,104,101, 32,115, 97,109,101, 32,105,100,
-   46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,
-  103,101,116, 95,105,100, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32,
-   32,108,111, 99, 97,108, 32,105,100, 32, 61, 32,108,105,116,101,114, 97,
-  108, 46,105,100, 10, 32, 32, 32,105,102, 32,110,111,116, 32,105,100, 32,
-  116,104,101,110, 10, 32, 32, 32, 32, 32, 32,105,100, 32, 61, 32, 97,100,
-  100, 95,115,105,122,101, 40,108,105,116,101,114, 97,108, 46,112,114,101,
-  100, 46,105,100, 41, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105, 61,
-   49, 44, 35,108,105,116,101,114, 97,108, 32,100,111, 10,  9, 32,105,100,
-   32, 61, 32,105,100, 32, 46, 46, 32, 97,100,100, 95,115,105,122,101, 40,
-  108,105,116,101,114, 97,108, 91,105, 93, 58,103,101,116, 95,105,100, 40,
-   41, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32,
-   32,108,105,116,101,114, 97,108, 46,105,100, 32, 61, 32,105,100, 10, 32,
-   32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,105,100,
-   10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 67,111,110,
-  115,116, 58,103,101,116, 95,105,100, 40, 41, 10, 32, 32, 32,114,101,116,
-  117,114,110, 32, 34, 99, 34, 32, 46, 46, 32,115,101,108,102, 46,105,100,
-   10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 86, 97,114,
-   58,103,101,116, 95,105,100, 40, 41, 10, 32, 32, 32,114,101,116,117,114,
-  110, 32, 34,118, 34, 32, 46, 46, 32,115,101,108,102, 46,105,100, 10,101,
-  110,100, 10, 10, 45, 45, 32, 86, 97,114,105, 97,110,116, 32,116, 97,103,
-   10, 10, 45, 45, 32, 84,119,111, 32,108,105,116,101,114, 97,108, 39,115,
-   32,118, 97,114,105, 97,110,116, 32,116, 97,103,115, 32, 97,114,101, 32,
-  116,104,101, 32,115, 97,109,101, 32,105,102, 32,116,104,101,114,101, 32,
-  105,115, 32, 97, 32,111,110,101, 45,116,111, 45,111,110,101, 10, 45, 45,
-   32,109, 97,112,112,105,110,103, 32,111,102, 32,118, 97,114,105, 97, 98,
-  108,101,115, 32,116,111, 32,118, 97,114,105, 97, 98,108,101,115, 44, 32,
-  115,117, 99,104, 32,116,104, 97,116, 32,119,104,101,110, 32,116,104,101,
-   32,109, 97,112,112,105,110,103, 32,105,115, 10, 45, 45, 32, 97,112,112,
-  108,105,101,100, 32,116,111, 32,111,110,101, 32,108,105,116,101,114, 97,
-  108, 44, 32,116,104,101, 32,114,101,115,117,108,116, 32,105,115, 32, 97,
-   32,108,105,116,101,114, 97,108, 32,116,104, 97,116, 32,105,115, 32,116,
-  104,101, 32,115, 97,109,101, 32, 97,115, 10, 45, 45, 32,116,104,101, 32,
-  111,116,104,101,114, 32,111,110,101, 44, 32,119,104,101,110, 32, 99,111,
-  109,112, 97,114,101,100, 32,117,115,105,110,103, 32,115,116,114,117, 99,
-  116,117,114, 97,108, 32,101,113,117, 97,108,105,116,121, 46, 32, 32, 84,
-  104,101, 10, 45, 45, 32,118, 97,114,105, 97,110,116, 32,116, 97,103, 32,
-  105,115, 32,117,115,101,100, 32, 97,115, 32, 97, 32,107,101,121, 32, 98,
-  121, 32,116,104,101, 32,115,117, 98,103,111, 97,108, 32,116, 97, 98,108,
-  101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110,
-   32,103,101,116, 95,116, 97,103, 40,108,105,116,101,114, 97,108, 41, 10,
-   32, 32, 32,108,111, 99, 97,108, 32,116, 97,103, 32, 61, 32,108,105,116,
-  101,114, 97,108, 46,116, 97,103, 10, 32, 32, 32,105,102, 32,110,111,116,
-   32,116, 97,103, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,108,111,
-   99, 97,108, 32,101,110,118, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32,
-   32,116, 97,103, 32, 61, 32, 97,100,100, 95,115,105,122,101, 40,108,105,
-  116,101,114, 97,108, 46,112,114,101,100, 46,105,100, 41, 10, 32, 32, 32,
-   32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,108,105,116,101,114, 97,
-  108, 32,100,111, 10,  9, 32,116, 97,103, 32, 61, 32,116, 97,103, 32, 46,
-   46, 32, 97,100,100, 95,115,105,122,101, 40,108,105,116,101,114, 97,108,
-   91,105, 93, 58,103,101,116, 95,116, 97,103, 40,105, 44, 32,101,110,118,
-   41, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32,
-   32,108,105,116,101,114, 97,108, 46,116, 97,103, 32, 61, 32,116, 97,103,
-   10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,
-  116, 97,103, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,
-   67,111,110,115,116, 58,103,101,116, 95,116, 97,103, 40,105, 44, 32,101,
-  110,118, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32, 34, 99, 34, 32,
-   46, 46, 32,115,101,108,102, 46,105,100, 10,101,110,100, 10, 10,102,117,
-  110, 99,116,105,111,110, 32, 86, 97,114, 58,103,101,116, 95,116, 97,103,
-   40,105, 44, 32,101,110,118, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,
-  116, 97,103, 32, 61, 32,101,110,118, 91,115,101,108,102, 93, 10, 32, 32,
-   32,105,102, 32,110,111,116, 32,116, 97,103, 32,116,104,101,110, 10, 32,
-   32, 32, 32, 32, 32,116, 97,103, 32, 61, 32, 34,118, 34, 32, 46, 46, 32,
-  116,111,115,116,114,105,110,103, 40,105, 41, 10, 32, 32, 32, 32, 32, 32,
-  101,110,118, 91,115,101,108,102, 93, 32, 61, 32,116, 97,103, 10, 32, 32,
-   32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,116, 97,103,
-   10,101,110,100, 10, 10, 45, 45, 32, 83,117, 98,115,116,105,116,117,116,
-  105,111,110, 10, 10, 45, 45, 32, 65,110, 32,101,110,118,105,114,111,110,
-  109,101,110,116, 32,105,115, 32, 97, 32,109, 97,112, 32,102,114,111,109,
-   32,118, 97,114,105, 97, 98,108,101,115, 32,116,111, 32,116,101,114,109,
-  115, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110,
-   32,115,117, 98,115,116, 40,108,105,116,101,114, 97,108, 44, 32,101,110,
-  118, 41, 10, 32, 32, 32,105,102, 32,110,111,116, 32,110,101,120,116, 40,
-  101,110,118, 41, 32,116,104,101,110,  9, 45, 45, 32, 70,111,117,110,100,
-   32, 97,110, 32,101,109,112,116,121, 32,109, 97,112, 46, 10, 32, 32, 32,
-   32, 32, 32,114,101,116,117,114,110, 32,108,105,116,101,114, 97,108, 10,
-   32, 32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32, 97,114,
-  105,116,121, 32, 61, 32, 35,108,105,116,101,114, 97,108, 10, 32, 32, 32,
-  108,111, 99, 97,108, 32,110,101,119, 32, 61, 32,123,112,114,101,100, 32,
-   61, 32,108,105,116,101,114, 97,108, 46,112,114,101,100,125, 10, 32, 32,
-   32,102,111,114, 32,105, 61, 49, 44, 97,114,105,116,121, 32,100,111, 10,
-   32, 32, 32, 32, 32, 32,110,101,119, 91,105, 93, 32, 61, 32,108,105,116,
-  101,114, 97,108, 91,105, 93, 58,115,117, 98,115,116, 40,101,110,118, 41,
+   32,114,101,116,117,114,110, 32,112,114,101,100, 95,110, 97,109,101, 32,
+   46, 46, 32, 34, 47, 34, 32, 46, 46, 32, 97,114,105,116,121, 10,101,110,
+  100, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,
+  109, 97,107,101, 95,112,114,101,100, 40,112,114,101,100, 95,110, 97,109,
+  101, 44, 32, 97,114,105,116,121, 41, 10, 32, 32, 32,112,114,101,100, 95,
+  110, 97,109,101, 32, 61, 32,116,111,115,116,114,105,110,103, 40,112,114,
+  101,100, 95,110, 97,109,101, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,
+   97,114,105,116,105,101,115, 32, 61, 32,112,114,101,100, 95,110, 97,109,
+  101,115, 91,112,114,101,100, 95,110, 97,109,101, 93, 10, 32, 32, 32,105,
+  102, 32,110,111,116, 32, 97,114,105,116,105,101,115, 32,116,104,101,110,
+   10, 32, 32, 32, 32, 32, 32, 97,114,105,116,105,101,115, 32, 61, 32,115,
+  101,116,109,101,116, 97,116, 97, 98,108,101, 40,123,125, 44, 32,119,101,
+   97,107, 95,109,116, 41, 10, 32, 32, 32, 32, 32, 32,112,114,101,100, 95,
+  110, 97,109,101,115, 91,112,114,101,100, 95,110, 97,109,101, 93, 32, 61,
+   32, 97,114,105,116,105,101,115, 10, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,112,114,101,100, 32, 61, 32, 97,114,105,116,
+  105,101,115, 91, 97,114,105,116,121, 93, 10, 32, 32, 32,105,102, 32,110,
+  111,116, 32,112,114,101,100, 32,116,104,101,110, 10, 32, 32, 32, 32, 32,
+   32,112,114,101,100, 95,115,121,109,115, 32, 61, 32,112,114,101,100, 95,
+  115,121,109,115, 32, 43, 32, 49, 10, 32, 32, 32, 32, 32, 32,112,114,101,
+  100, 32, 61, 32,123,105,100, 32, 61, 32,109,107, 95,112,114,101,100, 95,
+  105,100, 40,112,114,101,100, 95,110, 97,109,101, 44, 32, 97,114,105,116,
+  121, 41, 44, 32,110, 97,109,101, 32, 61, 32,112,114,101,100, 95,110, 97,
+  109,101, 44, 10,  9, 32, 32, 32, 32, 32, 32, 97,114,105,116,121, 32, 61,
+   32, 97,114,105,116,121, 44, 32,115,121,109, 32, 61, 32,112,114,101,100,
+   95,115,121,109,115, 44, 32,100, 98, 32, 61, 32,123,125,125, 10, 32, 32,
+   32, 32, 32, 32, 97,114,105,116,105,101,115, 91, 97,114,105,116,121, 93,
+   32, 61, 32,112,114,101,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  114,101,116,117,114,110, 32,112,114,101,100, 10,101,110,100, 10, 10,108,
+  111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,103,101,116, 95,
+  110, 97,109,101, 40,112,114,101,100, 41, 10, 32, 32, 32,114,101,116,117,
+  114,110, 32,112,114,101,100, 46,110, 97,109,101, 10,101,110,100, 10, 10,
+  108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,103,101,116,
+   95, 97,114,105,116,121, 40,112,114,101,100, 41, 10, 32, 32, 32,114,101,
+  116,117,114,110, 32,112,114,101,100, 46, 97,114,105,116,121, 10,101,110,
+  100, 10, 10, 45, 45, 32, 76,105,116,101,114, 97,108,115, 10, 10, 45, 45,
+   32, 65, 32,108,105,116,101,114, 97,108, 32,105,115, 32, 97, 32,112,114,
+  101,100,105, 99, 97,116,101, 32, 97,110,100, 32, 97, 32,115,101,113,117,
+  101,110, 99,101, 32,111,102, 32,116,101,114,109,115, 44, 32,116,104,101,
+   32,110,117,109, 98,101,114, 32,111,102, 10, 45, 45, 32,119,104,105, 99,
+  104, 32,109,117,115,116, 32,109, 97,116, 99,104, 32,116,104,101, 32,112,
+  114,101,100,105, 99, 97,116,101, 39,115, 32, 97,114,105,116,121, 46, 10,
+   10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,109, 97,
+  107,101, 95,108,105,116,101,114, 97,108, 40,112,114,101,100, 95,110, 97,
+  109,101, 44, 32,116,101,114,109,115, 41, 10, 32, 32, 32,108,111, 99, 97,
+  108, 32, 97,114,105,116,121, 32, 61, 32, 35,116,101,114,109,115, 10, 32,
+   32, 32,108,111, 99, 97,108, 32,112,114,101,100, 32, 61, 32,109, 97,107,
+  101, 95,112,114,101,100, 40,112,114,101,100, 95,110, 97,109,101, 44, 32,
+   97,114,105,116,121, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,108,105,
+  116,101,114, 97,108, 32, 61, 32,123,112,114,101,100, 32, 61, 32,112,114,
+  101,100,125, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 97,114,105,
+  116,121, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,105,116,101,114, 97,
+  108, 91,105, 93, 32, 61, 32,116,101,114,109,115, 91,105, 93, 10, 32, 32,
+   32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,108,105,116,
+  101,114, 97,108, 10,101,110,100, 10, 10, 45, 45, 32, 75,101,121,115, 32,
+   97,114,101, 32, 98,117,105,108,116, 32,102,114,111,109, 32,116,104,101,
+   32,115,121,109, 98,111,108,115, 32,111,102, 32, 97, 32,112,114,101,100,
+  105, 99, 97,116,101, 32, 97,110,100, 32,105,116,115, 32,116,101,114,109,
+  115, 44, 32, 97,110,100, 10, 45, 45, 32, 97,114,101, 32,109, 97,100,101,
+   32,111,110, 99,101, 44, 32,119,105,116,104, 32, 97, 32,115,105,110,103,
+  108,101, 32, 99,111,110, 99, 97,116,101,110, 97,116,105,111,110, 46, 32,
+   32, 83,121,109, 98,111,108,115, 32, 97,114,101, 32,115,101,112, 97,114,
+   97,116,101,100, 10, 45, 45, 32, 98,121, 32,115,112, 97, 99,101,115, 44,
+   32,115,111, 32,116,104,101, 32,107,101,121, 32,111,102, 32, 97, 32,115,
+  101,113,117,101,110, 99,101, 32,111,102, 32,115,121,109, 98,111,108,115,
+   32,100,101,116,101,114,109,105,110,101,115, 32,105,116, 46, 10, 10,108,
+  111, 99, 97,108, 32,107,101,121, 95, 98,117,102, 32, 61, 32,123,125, 10,
+   10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,109, 97,
+  107,101, 95,107,101,121, 40,110, 41, 10, 32, 32, 32,108,111, 99, 97,108,
+   32,107,101,121, 32, 61, 32,116, 97, 98,108,101, 46, 99,111,110, 99, 97,
+  116, 40,107,101,121, 95, 98,117,102, 44, 32, 34, 32, 34, 44, 32, 49, 44,
+   32,110, 41, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44,110, 32,100,
+  111, 10, 32, 32, 32, 32, 32, 32,107,101,121, 95, 98,117,102, 91,105, 93,
+   32, 61, 32,110,105,108, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,
+  101,116,117,114,110, 32,107,101,121, 10,101,110,100, 10, 10, 45, 45, 32,
+   65, 32,108,105,116,101,114, 97,108, 39,115, 32,105,100, 32,105,115, 32,
+   99,111,109,112,117,116,101,100, 32,111,110, 32,100,101,109, 97,110,100,
+   44, 32, 98,117,116, 32,116,104,101,110, 32, 99, 97, 99,104,101,100, 46,
+   32, 32, 73,116, 32,105,115, 32,117,115,101,100, 10, 45, 45, 32, 98,121,
+   32, 97, 32, 99,108, 97,117,115,101, 32,119,104,101,110, 32, 99,114,101,
+   97,116,105,110,103, 32,105,116,115, 32,105,100, 46, 10, 10, 45, 45, 32,
+   84,104,101, 32,105,100, 39,115, 32,101,110, 99,111,100,105,110,103, 32,
+  101,110,115,117,114,101,115, 32,116,104, 97,116, 32,116,119,111, 32,108,
+  105,116,101,114, 97,108,115, 32, 97,114,101, 32,115,116,114,117, 99,116,
+  117,114, 97,108,108,121, 32,116,104,101, 10, 45, 45, 32,115, 97,109,101,
+   32,105,102, 32,116,104,101,121, 32,104, 97,118,101, 32,116,104,101, 32,
+  115, 97,109,101, 32,105,100, 46, 10, 10,108,111, 99, 97,108, 32,102,117,
+  110, 99,116,105,111,110, 32,103,101,116, 95,105,100, 40,108,105,116,101,
+  114, 97,108, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,105,100, 32, 61,
+   32,108,105,116,101,114, 97,108, 46,105,100, 10, 32, 32, 32,105,102, 32,
+  110,111,116, 32,105,100, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,
+  108,111, 99, 97,108, 32,110, 32, 61, 32, 35,108,105,116,101,114, 97,108,
+   10, 32, 32, 32, 32, 32, 32,107,101,121, 95, 98,117,102, 91, 49, 93, 32,
+   61, 32,108,105,116,101,114, 97,108, 46,112,114,101,100, 46,115,121,109,
+   10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44,110, 32,100,
+  111, 10,  9, 32,107,101,121, 95, 98,117,102, 91,105, 32, 43, 32, 49, 93,
+   32, 61, 32,108,105,116,101,114, 97,108, 91,105, 93, 46,115,121,109, 10,
+   32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,105,100,
+   32, 61, 32,109, 97,107,101, 95,107,101,121, 40,110, 32, 43, 32, 49, 41,
+   10, 32, 32, 32, 32, 32, 32,108,105,116,101,114, 97,108, 46,105,100, 32,
+   61, 32,105,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,
+  117,114,110, 32,105,100, 10,101,110,100, 10, 10, 45, 45, 32, 86, 97,114,
+  105, 97,110,116, 32,116, 97,103, 10, 10, 45, 45, 32, 84,119,111, 32,108,
+  105,116,101,114, 97,108, 39,115, 32,118, 97,114,105, 97,110,116, 32,116,
+   97,103,115, 32, 97,114,101, 32,116,104,101, 32,115, 97,109,101, 32,105,
+  102, 32,116,104,101,114,101, 32,105,115, 32, 97, 32,111,110,101, 45,116,
+  111, 45,111,110,101, 10, 45, 45, 32,109, 97,112,112,105,110,103, 32,111,
+  102, 32,118, 97,114,105, 97, 98,108,101,115, 32,116,111, 32,118, 97,114,
+  105, 97, 98,108,101,115, 44, 32,115,117, 99,104, 32,116,104, 97,116, 32,
+  119,104,101,110, 32,116,104,101, 32,109, 97,112,112,105,110,103, 32,105,
+  115, 10, 45, 45, 32, 97,112,112,108,105,101,100, 32,116,111, 32,111,110,
+  101, 32,108,105,116,101,114, 97,108, 44, 32,116,104,101, 32,114,101,115,
+  117,108,116, 32,105,115, 32, 97, 32,108,105,116,101,114, 97,108, 32,116,
+  104, 97,116, 32,105,115, 32,116,104,101, 32,115, 97,109,101, 32, 97,115,
+   10, 45, 45, 32,116,104,101, 32,111,116,104,101,114, 32,111,110,101, 44,
+   32,119,104,101,110, 32, 99,111,109,112, 97,114,101,100, 32,117,115,105,
+  110,103, 32,115,116,114,117, 99,116,117,114, 97,108, 32,101,113,117, 97,
+  108,105,116,121, 46, 32, 32, 84,104,101, 10, 45, 45, 32,118, 97,114,105,
+   97,110,116, 32,116, 97,103, 32,105,115, 32,117,115,101,100, 32, 97,115,
+   32, 97, 32,107,101,121, 32, 98,121, 32,116,104,101, 32,115,117, 98,103,
+  111, 97,108, 32,116, 97, 98,108,101, 46, 32, 32, 73,110, 32, 97, 32,116,
+   97,103, 44, 32,101, 97, 99,104, 10, 45, 45, 32,118, 97,114,105, 97, 98,
+  108,101, 32,105,115, 32,114,101,112,108, 97, 99,101,100, 32, 98,121, 32,
+  109,105,110,117,115, 32,116,104,101, 32,112,111,115,105,116,105,111,110,
+   32,111,102, 32,105,116,115, 32,102,105,114,115,116, 32,111, 99, 99,117,
+  114,114,101,110, 99,101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110,
+   99,116,105,111,110, 32,103,101,116, 95,116, 97,103, 40,108,105,116,101,
+  114, 97,108, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,116, 97,103, 32,
+   61, 32,108,105,116,101,114, 97,108, 46,116, 97,103, 10, 32, 32, 32,105,
+  102, 32,110,111,116, 32,116, 97,103, 32,116,104,101,110, 10, 32, 32, 32,
+   32, 32, 32,108,111, 99, 97,108, 32,101,110,118, 32, 61, 32,123,125, 10,
+   32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,110, 32, 61, 32, 35,108,
+  105,116,101,114, 97,108, 10, 32, 32, 32, 32, 32, 32,107,101,121, 95, 98,
+  117,102, 91, 49, 93, 32, 61, 32,108,105,116,101,114, 97,108, 46,112,114,
+  101,100, 46,115,121,109, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,
+   61, 49, 44,110, 32,100,111, 10,  9, 32,107,101,121, 95, 98,117,102, 91,
+  105, 32, 43, 32, 49, 93, 32, 61, 32,108,105,116,101,114, 97,108, 91,105,
+   93, 58,103,101,116, 95,116, 97,103, 40,105, 44, 32,101,110,118, 41, 10,
+   32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,116, 97,
+  103, 32, 61, 32,109, 97,107,101, 95,107,101,121, 40,110, 32, 43, 32, 49,
+   41, 10, 32, 32, 32, 32, 32, 32,108,105,116,101,114, 97,108, 46,116, 97,
+  103, 32, 61, 32,116, 97,103, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  114,101,116,117,114,110, 32,116, 97,103, 10,101,110,100, 10, 10,102,117,
+  110, 99,116,105,111,110, 32, 67,111,110,115,116, 58,103,101,116, 95,116,
+   97,103, 40,105, 44, 32,101,110,118, 41, 10, 32, 32, 32,114,101,116,117,
+  114,110, 32,115,101,108,102, 46,115,121,109, 10,101,110,100, 10, 10,102,
+  117,110, 99,116,105,111,110, 32, 86, 97,114, 58,103,101,116, 95,116, 97,
+  103, 40,105, 44, 32,101,110,118, 41, 10, 32, 32, 32,108,111, 99, 97,108,
+   32,116, 97,103, 32, 61, 32,101,110,118, 91,115,101,108,102, 93, 10, 32,
+   32, 32,105,102, 32,110,111,116, 32,116, 97,103, 32,116,104,101,110, 10,
+   32, 32, 32, 32, 32, 32,116, 97,103, 32, 61, 32, 45,105, 10, 32, 32, 32,
+   32, 32, 32,101,110,118, 91,115,101,108,102, 93, 32, 61, 32,116, 97,103,
    10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,
-  110,101,119, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,
-   67,111,110,115,116, 58,115,117, 98,115,116, 40,101,110,118, 41, 10, 32,
-   32, 32,114,101,116,117,114,110, 32,115,101,108,102, 10,101,110,100, 10,
-   10,102,117,110, 99,116,105,111,110, 32, 86, 97,114, 58,115,117, 98,115,
-  116, 40,101,110,118, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,116,101,
-  114,109, 32, 61, 32,101,110,118, 91,115,101,108,102, 93, 10, 32, 32, 32,
-  105,102, 32,116,101,114,109, 32,116,104,101,110, 10, 32, 32, 32, 32, 32,
-   32,114,101,116,117,114,110, 32,116,101,114,109, 10, 32, 32, 32,101,108,
+  116, 97,103, 10,101,110,100, 10, 10, 45, 45, 32, 83,117, 98,115,116,105,
+  116,117,116,105,111,110, 10, 10, 45, 45, 32, 65,110, 32,101,110,118,105,
+  114,111,110,109,101,110,116, 32,105,115, 32, 97, 32,109, 97,112, 32,102,
+  114,111,109, 32,118, 97,114,105, 97, 98,108,101,115, 32,116,111, 32,116,
+  101,114,109,115, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,
+  105,111,110, 32,115,117, 98,115,116, 40,108,105,116,101,114, 97,108, 44,
+   32,101,110,118, 41, 10, 32, 32, 32,105,102, 32,110,111,116, 32,110,101,
+  120,116, 40,101,110,118, 41, 32,116,104,101,110,  9, 45, 45, 32, 70,111,
+  117,110,100, 32, 97,110, 32,101,109,112,116,121, 32,109, 97,112, 46, 10,
+   32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,108,105,116,101,114,
+   97,108, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108,
+   32, 97,114,105,116,121, 32, 61, 32, 35,108,105,116,101,114, 97,108, 10,
+   32, 32, 32,108,111, 99, 97,108, 32,110,101,119, 32, 61, 32,123,112,114,
+  101,100, 32, 61, 32,108,105,116,101,114, 97,108, 46,112,114,101,100,125,
+   10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 97,114,105,116,121, 32,
+  100,111, 10, 32, 32, 32, 32, 32, 32,110,101,119, 91,105, 93, 32, 61, 32,
+  108,105,116,101,114, 97,108, 91,105, 93, 58,115,117, 98,115,116, 40,101,
+  110,118, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,
+  114,110, 32,110,101,119, 10,101,110,100, 10, 10,102,117,110, 99,116,105,
+  111,110, 32, 67,111,110,115,116, 58,115,117, 98,115,116, 40,101,110,118,
+   41, 10, 32, 32, 32,114,101,116,117,114,110, 32,115,101,108,102, 10,101,
+  110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 86, 97,114, 58,115,
+  117, 98,115,116, 40,101,110,118, 41, 10, 32, 32, 32,108,111, 99, 97,108,
+   32,116,101,114,109, 32, 61, 32,101,110,118, 91,115,101,108,102, 93, 10,
+   32, 32, 32,105,102, 32,116,101,114,109, 32,116,104,101,110, 10, 32, 32,
+   32, 32, 32, 32,114,101,116,117,114,110, 32,116,101,114,109, 10, 32, 32,
+   32,101,108,115,101, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110,
+   32,115,101,108,102, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,
+   45, 45, 32, 83,104,117,102,102,108,101, 32, 99,114,101, 97,116,101,115,
+   32, 97,110, 32,101,110,118,105,114,111,110,109,101,110,116, 32,105,110,
+   32,119,104,105, 99,104, 32, 97,108,108, 32,118, 97,114,105, 97, 98,108,
+  101,115, 32, 97,114,101, 32,109, 97,112,112,101,100, 32,116,111, 10, 45,
+   45, 32,102,114,101,115,104,108,121, 32,103,101,110,101,114, 97,116,101,
+  100, 32,118, 97,114,105, 97, 98,108,101,115, 46, 10, 10,108,111, 99, 97,
+  108, 32,102,117,110, 99,116,105,111,110, 32,115,104,117,102,102,108,101,
+   40,108,105,116,101,114, 97,108, 44, 32,101,110,118, 41, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32,109, 97,112, 32, 61, 32,101,110,118, 32,111,114,
+   32,123,125, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,108,105,
+  116,101,114, 97,108, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,105,116,
+  101,114, 97,108, 91,105, 93, 58,115,104,117,102,102,108,101, 40,109, 97,
+  112, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,
+  110, 32,109, 97,112, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,
+  110, 32, 86, 97,114, 58,115,104,117,102,102,108,101, 40,101,110,118, 41,
+   10, 32, 32, 32,105,102, 32,110,111,116, 32,101,110,118, 91,115,101,108,
+  102, 93, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,101,110,118, 91,
+  115,101,108,102, 93, 32, 61, 32,109,107, 95,102,114,101,115,104, 95,118,
+   97,114, 40, 41, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,102,
+  117,110, 99,116,105,111,110, 32, 67,111,110,115,116, 58,115,104,117,102,
+  102,108,101, 40,101,110,118, 41, 10,101,110,100, 10, 10, 45, 45, 32, 82,
+  101,110, 97,109,101,115, 32, 97, 32,108,105,116,101,114, 97,108, 32,117,
+  115,105,110,103, 32, 97,110, 32,101,110,118,105,114,111,110,109,101,110,
+  116, 32,103,101,110,101,114, 97,116,101,100, 32, 98,121, 32,115,104,117,
+  102,102,108,101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,
+  105,111,110, 32,114,101,110, 97,109,101, 40,108,105,116,101,114, 97,108,
+   41, 10, 32, 32, 32,114,101,116,117,114,110, 32,115,117, 98,115,116, 40,
+  108,105,116,101,114, 97,108, 44, 32,115,104,117,102,102,108,101, 40,108,
+  105,116,101,114, 97,108, 41, 41, 10,101,110,100, 10, 10, 45, 45, 32, 85,
+  110,105,102,121, 32,116,119,111, 32,108,105,116,101,114, 97,108,115, 46,
+   32, 32, 84,104,101, 32,114,101,115,117,108,116, 32,105,115, 32,101,105,
+  116,104,101,114, 32, 97,110, 32,101,110,118,105,114,111,110,109,101,110,
+  116, 32,111,114, 32,110,105,108, 46, 10, 45, 45, 32, 78,105,108, 32,105,
+  115, 32,114,101,116,117,114,110,101,100, 32,119,104,101,110, 32,116,104,
+  101, 32,116,119,111, 32,108,105,116,101,114, 97,108,115, 32, 99, 97,110,
+  110,111,116, 32, 98,101, 32,117,110,105,102,105,101,100, 46, 32, 32, 87,
+  104,101,110, 32,116,104,101,121, 10, 45, 45, 32, 99, 97,110, 44, 32, 97,
+  112,112,108,121,105,110,103, 32,116,104,101, 32,115,117, 98,115,116,105,
+  116,117,116,105,111,110,115, 32,100,101,102,105,110,101,100, 32, 98,121,
+   32,116,104,101, 32,101,110,118,105,114,111,110,109,101,110,116, 32,111,
+  110, 32, 98,111,116,104, 10, 45, 45, 32,108,105,116,101,114, 97,108,115,
+   32,119,105,108,108, 32, 99,114,101, 97,116,101, 32,116,119,111, 32,108,
+  105,116,101,114, 97,108,115, 32,116,104, 97,116, 32, 97,114,101, 32,115,
+  116,114,117, 99,116,117,114, 97,108,108,121, 32,101,113,117, 97,108, 46,
+   10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,117,
+  110,105,102,121, 40,108,105,116,101,114, 97,108, 44, 32,111,116,104,101,
+  114, 41, 10, 32, 32, 32,105,102, 32,108,105,116,101,114, 97,108, 46,112,
+  114,101,100, 32,126, 61, 32,111,116,104,101,114, 46,112,114,101,100, 32,
+  116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,
+  110,105,108, 10, 32, 32, 32,101,108,115,101, 10, 32, 32, 32, 32, 32, 32,
+  108,111, 99, 97,108, 32,101,110,118, 32, 61, 32,123,125, 10, 32, 32, 32,
+   32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,108,105,116,101,114, 97,
+  108, 32,100,111, 10,  9, 32,108,111, 99, 97,108, 32,108,105,116,101,114,
+   97,108, 95,105, 32, 61, 32,108,105,116,101,114, 97,108, 91,105, 93, 58,
+   99,104, 97,115,101, 40,101,110,118, 41, 10,  9, 32,108,111, 99, 97,108,
+   32,111,116,104,101,114, 95,105, 32, 61, 32,111,116,104,101,114, 91,105,
+   93, 58, 99,104, 97,115,101, 40,101,110,118, 41, 10,  9, 32,105,102, 32,
+  108,105,116,101,114, 97,108, 95,105, 32,126, 61, 32,111,116,104,101,114,
+   95,105, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,101,110,118, 32, 61,
+   32,108,105,116,101,114, 97,108, 95,105, 58,117,110,105,102,121, 40,111,
+  116,104,101,114, 95,105, 44, 32,101,110,118, 41, 10,  9, 32, 32, 32, 32,
+  105,102, 32,110,111,116, 32,101,110,118, 32,116,104,101,110, 10,  9, 32,
+   32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,101,110,118, 10,  9,
+   32, 32, 32, 32,101,110,100, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32,
+   32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110,
+   32,101,110,118, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10, 45,
+   45, 32, 67,104, 97,115,101, 32,114,101,116,117,114,110,115, 32, 97, 32,
+   99,111,110,115,116, 97,110,116, 32,111,114, 32, 97,110, 32,117,110, 98,
+  111,117,110,100, 32,118, 97,114,105, 97, 98,108,101, 46, 10, 10,102,117,
+  110, 99,116,105,111,110, 32, 67,111,110,115,116, 58, 99,104, 97,115,101,
+   40,101,110,118, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,115,101,
+  108,102, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 86,
+   97,114, 58, 99,104, 97,115,101, 40,101,110,118, 41, 10, 32, 32, 32,108,
+  111, 99, 97,108, 32,116,101,114,109, 32, 61, 32,101,110,118, 91,115,101,
+  108,102, 93, 10, 32, 32, 32,105,102, 32,116,101,114,109, 32,116,104,101,
+  110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,116,101,114,
+  109, 58, 99,104, 97,115,101, 40,101,110,118, 41, 10, 32, 32, 32,101,108,
   115,101, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,115,101,
   108,102, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10, 45, 45, 32,
-   83,104,117,102,102,108,101, 32, 99,114,101, 97,116,101,115, 32, 97,110,
-   32,101,110,118,105,114,111,110,109,101,110,116, 32,105,110, 32,119,104,
-  105, 99,104, 32, 97,108,108, 32,118, 97,114,105, 97, 98,108,101,115, 32,
-   97,114,101, 32,109, 97,112,112,101,100, 32,116,111, 10, 45, 45, 32,102,
-  114,101,115,104,108,121, 32,103,101,110,101,114, 97,116,101,100, 32,118,
-   97,114,105, 97, 98,108,101,115, 46, 10, 10,108,111, 99, 97,108, 32,102,
-  117,110, 99,116,105,111,110, 32,115,104,117,102,102,108,101, 40,108,105,
-  116,101,114, 97,108, 44, 32,101,110,118, 41, 10, 32, 32, 32,108,111, 99,
-   97,108, 32,109, 97,112, 32, 61, 32,101,110,118, 32,111,114, 32,123,125,
-   10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,108,105,116,101,114,
-   97,108, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,105,116,101,114, 97,
-  108, 91,105, 93, 58,115,104,117,102,102,108,101, 40,109, 97,112, 41, 10,
-   32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,109,
-   97,112, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 86,
-   97,114, 58,115,104,117,102,102,108,101, 40,101,110,118, 41, 10, 32, 32,
-   32,105,102, 32,110,111,116, 32,101,110,118, 91,115,101,108,102, 93, 32,
-  116,104,101,110, 10, 32, 32, 32, 32, 32, 32,101,110,118, 91,115,101,108,
-  102, 93, 32, 61, 32,109,107, 95,102,114,101,115,104, 95,118, 97,114, 40,
-   41, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,102,117,110, 99,
-  116,105,111,110, 32, 67,111,110,115,116, 58,115,104,117,102,102,108,101,
-   40,101,110,118, 41, 10,101,110,100, 10, 10, 45, 45, 32, 82,101,110, 97,
-  109,101,115, 32, 97, 32,108,105,116,101,114, 97,108, 32,117,115,105,110,
-  103, 32, 97,110, 32,101,110,118,105,114,111,110,109,101,110,116, 32,103,
-  101,110,101,114, 97,116,101,100, 32, 98,121, 32,115,104,117,102,102,108,
-  101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110,
-   32,114,101,110, 97,109,101, 40,108,105,116,101,114, 97,108, 41, 10, 32,
-   32, 32,114,101,116,117,114,110, 32,115,117, 98,115,116, 40,108,105,116,
-  101,114, 97,108, 44, 32,115,104,117,102,102,108,101, 40,108,105,116,101,
-  114, 97,108, 41, 41, 10,101,110,100, 10, 10, 45, 45, 32, 85,110,105,102,
-  121, 32,116,119,111, 32,108,105,116,101,114, 97,108,115, 46, 32, 32, 84,
-  104,101, 32,114,101,115,117,108,116, 32,105,115, 32,101,105,116,104,101,
-  114, 32, 97,110, 32,101,110,118,105,114,111,110,109,101,110,116, 32,111,
-  114, 32,110,105,108, 46, 10, 45, 45, 32, 78,105,108, 32,105,115, 32,114,
-  101,116,117,114,110,101,100, 32,119,104,101,110, 32,116,104,101, 32,116,
-  119,111, 32,108,105,116,101,114, 97,108,115, 32, 99, 97,110,110,111,116,
-   32, 98,101, 32,117,110,105,102,105,101,100, 46, 32, 32, 87,104,101,110,
-   32,116,104,101,121, 10, 45, 45, 32, 99, 97,110, 44, 32, 97,112,112,108,
-  121,105,110,103, 32,116,104,101, 32,115,117, 98,115,116,105,116,117,116,
-  105,111,110,115, 32,100,101,102,105,110,101,100, 32, 98,121, 32,116,104,
-  101, 32,101,110,118,105,114,111,110,109,101,110,116, 32,111,110, 32, 98,
-  111,116,104, 10, 45, 45, 32,108,105,116,101,114, 97,108,115, 32,119,105,
-  108,108, 32, 99,114,101, 97,116,101, 32,116,119,111, 32,108,105,116,101,
-  114, 97,108,115, 32,116,104, 97,116, 32, 97,114,101, 32,115,116,114,117,
-   99,116,117,114, 97,108,108,121, 32,101,113,117, 97,108, 46, 10, 10,108,
-  111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,117,110,105,102,
-  121, 40,108,105,116,101,114, 97,108, 44, 32,111,116,104,101,114, 41, 10,
-   32, 32, 32,105,102, 32,108,105,116,101,114, 97,108, 46,112,114,101,100,
-   32,126, 61, 32,111,116,104,101,114, 46,112,114,101,100, 32,116,104,101,
-  110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108,
-   10, 32, 32, 32,101,108,115,101, 10, 32, 32, 32, 32, 32, 32,108,111, 99,
-   97,108, 32,101,110,118, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32, 32,
-  102,111,114, 32,105, 61, 49, 44, 35,108,105,116,101,114, 97,108, 32,100,
-  111, 10,  9, 32,108,111, 99, 97,108, 32,108,105,116,101,114, 97,108, 95,
-  105, 32, 61, 32,108,105,116,101,114, 97,108, 91,105, 93, 58, 99,104, 97,
-  115,101, 40,101,110,118, 41, 10,  9, 32,108,111, 99, 97,108, 32,111,116,
-  104,101,114, 95,105, 32, 61, 32,111,116,104,101,114, 91,105, 93, 58, 99,
-  104, 97,115,101, 40,101,110,118, 41, 10,  9, 32,105,102, 32,108,105,116,
-  101,114, 97,108, 95,105, 32,126, 61, 32,111,116,104,101,114, 95,105, 32,
-  116,104,101,110, 10,  9, 32, 32, 32, 32,101,110,118, 32, 61, 32,108,105,
-  116,101,114, 97,108, 95,105, 58,117,110,105,102,121, 40,111,116,104,101,
-  114, 95,105, 44, 32,101,110,118, 41, 10,  9, 32, 32, 32, 32,105,102, 32,
-  110,111,116, 32,101,110,118, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,
-   32, 32, 32,114,101,116,117,114,110, 32,101,110,118, 10,  9, 32, 32, 32,
-   32,101,110,100, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,
-  110,100, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,101,110,
-  118, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10, 45, 45, 32, 67,
-  104, 97,115,101, 32,114,101,116,117,114,110,115, 32, 97, 32, 99,111,110,
-  115,116, 97,110,116, 32,111,114, 32, 97,110, 32,117,110, 98,111,117,110,
-  100, 32,118, 97,114,105, 97, 98,108,101, 46, 10, 10,102,117,110, 99,116,
-  105,111,110, 32, 67,111,110,115,116, 58, 99,104, 97,115,101, 40,101,110,
-  118, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,115,101,108,102, 10,
-  101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 86, 97,114, 58,
-   99,104, 97,115,101, 40,101,110,118, 41, 10, 32, 32, 32,108,111, 99, 97,
-  108, 32,116,101,114,109, 32, 61, 32,101,110,118, 91,115,101,108,102, 93,
-   10, 32, 32, 32,105,102, 32,116,101,114,109, 32,116,104,101,110, 10, 32,
-   32, 32, 32, 32, 32,114,101,116,117,114,110, 32,116,101,114,109, 58, 99,
-  104, 97,115,101, 40,101,110,118, 41, 10, 32, 32, 32,101,108,115,101, 10,
-   32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,115,101,108,102, 10,
-   32, 32, 32,101,110,100, 10,101,110,100, 10, 10, 45, 45, 32, 84,104,101,
-   32, 99, 97,115,101, 32, 97,110, 97,108,121,115,105,115, 32,102,111,114,
-   32,117,110,105,102,121,105,110,103, 32,116,119,111, 32,116,101,114,109,
-  115, 32,105,115, 32,104, 97,110,100,108,101,100, 32, 98,121, 32,109,101,
-  116,104,111,100, 10, 45, 45, 32,100,105,115,112, 97,116, 99,104, 46, 10,
-   10,102,117,110, 99,116,105,111,110, 32, 67,111,110,115,116, 58,117,110,
-  105,102,121, 40,116,101,114,109, 44, 32,101,110,118, 41, 10, 32, 32, 32,
-  114,101,116,117,114,110, 32,116,101,114,109, 58,117,110,105,102,121, 95,
-   99,111,110,115,116, 40,115,101,108,102, 44, 32,101,110,118, 41, 10,101,
-  110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 67,111,110,115,116,
-   58,117,110,105,102,121, 95, 99,111,110,115,116, 40, 99,111,110,115,116,
-   44, 32,101,110,118, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,110,
-  105,108, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 86,
-   97,114, 58,117,110,105,102,121, 95, 99,111,110,115,116, 40, 99,111,110,
-  115,116, 44, 32,101,110,118, 41, 10, 32, 32, 32,101,110,118, 91,115,101,
-  108,102, 93, 32, 61, 32, 99,111,110,115,116, 10, 32, 32, 32,114,101,116,
-  117,114,110, 32,101,110,118, 10,101,110,100, 10, 10,102,117,110, 99,116,
-  105,111,110, 32, 86, 97,114, 58,117,110,105,102,121, 40,116,101,114,109,
-   44, 32,101,110,118, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,116,
-  101,114,109, 58,117,110,105,102,121, 95,118, 97,114, 40,115,101,108,102,
-   44, 32,101,110,118, 41, 10,101,110,100, 10, 10,102,117,110, 99,116,105,
-  111,110, 32, 67,111,110,115,116, 58,117,110,105,102,121, 95,118, 97,114,
-   40,118, 97,114, 44, 32,101,110,118, 41, 10, 32, 32, 32,114,101,116,117,
-  114,110, 32,118, 97,114, 58,117,110,105,102,121, 95, 99,111,110,115,116,
-   40,115,101,108,102, 44, 32,101,110,118, 41, 10,101,110,100, 10, 10,102,
-  117,110, 99,116,105,111,110, 32, 86, 97,114, 58,117,110,105,102,121, 95,
-  118, 97,114, 40,118, 97,114, 44, 32,101,110,118, 41, 10, 32, 32, 32,101,
-  110,118, 91,118, 97,114, 93, 32, 61, 32,115,101,108,102, 10, 32, 32, 32,
-  114,101,116,117,114,110, 32,101,110,118, 10,101,110,100, 10, 10, 45, 45,
-   32, 68,111,101,115, 32, 97, 32,108,105,116,101,114, 97,108, 32,104, 97,
-  118,101, 32, 97, 32,103,105,118,101,110, 32,116,101,114,109, 63, 32, 32,
-   73,110,116,101,114,110, 97,108,105,122,105,110,103, 32,116,101,114,109,
-  115, 32,101,110,115,117,114,101,115, 32, 97,110, 10, 45, 45, 32,101,102,
-  102,105, 99,105,101,110,116, 32,105,109,112,108,101,109,101,110,116, 97,
-  116,105,111,110, 32,111,102, 32,116,104,105,115, 32,111,112,101,114, 97,
-  116,105,111,110, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,
-  105,111,110, 32,105,115, 95,105,110, 40,116,101,114,109, 44, 32,108,105,
-  116,101,114, 97,108, 41, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44,
-   35,108,105,116,101,114, 97,108, 32,100,111, 10, 32, 32, 32, 32, 32, 32,
-  105,102, 32,108,105,116,101,114, 97,108, 91,105, 93, 32, 61, 61, 32,116,
-  101,114,109, 32,116,104,101,110, 10,  9, 32,114,101,116,117,114,110, 32,
-  116,114,117,101, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,
-  101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,102, 97,108,115,
-  101, 10,101,110,100, 10, 10, 45, 45, 32, 84,104,101,115,101, 32,109,101,
-  116,104,111,100,115, 32, 97,114,101, 32,117,115,101,100, 32,116,111, 32,
-  104, 97,110,100,108,101, 32, 97, 32,115,101,116, 32,111,102, 32,102, 97,
-   99,116,115, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
-  111,110, 32,105,115, 95,109,101,109, 98,101,114, 40,108,105,116,101,114,
-   97,108, 44, 32,116, 98,108, 41, 10, 32, 32, 32,114,101,116,117,114,110,
-   32,116, 98,108, 91,103,101,116, 95,105,100, 40,108,105,116,101,114, 97,
-  108, 41, 93, 10,101,110,100, 10, 10,108,111, 99, 97,108, 32,102,117,110,
-   99,116,105,111,110, 32, 97,100,106,111,105,110, 40,108,105,116,101,114,
-   97,108, 44, 32,116, 98,108, 41, 10, 32, 32, 32,116, 98,108, 91,103,101,
-  116, 95,105,100, 40,108,105,116,101,114, 97,108, 41, 93, 32, 61, 32,108,
-  105,116,101,114, 97,108, 10,101,110,100, 10, 10, 45, 45, 32, 67,108, 97,
-  117,115,101,115, 10, 10, 45, 45, 32, 65, 32, 99,108, 97,117,115,101, 32,
-  104, 97,115, 32, 97, 32,104,101, 97,100, 32,108,105,116,101,114, 97,108,
-   44, 32, 97,110,100, 32, 97, 32,115,101,113,117,101,110, 99,101, 32,111,
-  102, 32,108,105,116,101,114, 97,108,115, 32,116,104, 97,116, 32,102,111,
-  114,109, 10, 45, 45, 32,105,116,115, 32, 98,111,100,121, 46, 32, 32, 73,
-  102, 32,116,104,101,114,101, 32, 97,114,101, 32,110,111, 32,108,105,116,
-  101,114, 97,108,115, 32,105,110, 32,105,116,115, 32, 98,111,100,121, 44,
-   32,116,104,101, 32, 99,108, 97,117,115,101, 32,105,115, 10, 45, 45, 32,
-   99, 97,108,108,101,100, 32, 97, 32,102, 97, 99,116, 46, 32, 32, 73,102,
-   32,116,104,101,114,101, 32,105,115, 32, 97,116, 32,108,101, 97,115,116,
-   32,111,110,101, 32,108,105,116,101,114, 97,108, 32,105,110, 32,105,116,
-  115, 32, 98,111,100,121, 44, 32,105,116, 32,105,115, 10, 45, 45, 32, 99,
-   97,108,108,101,100, 32, 97, 32,114,117,108,101, 46, 10, 10, 45, 45, 32,
-   65, 32, 99,108, 97,117,115,101, 32, 97,115,115,101,114,116,115, 32,116,
-  104, 97,116, 32,105,116,115, 32,104,101, 97,100, 32,105,115, 32,116,114,
-  117,101, 32,105,102, 32,101,118,101,114,121, 32,108,105,116,101,114, 97,
-  108, 32,105,110, 32,105,116,115, 32, 98,111,100,121, 32,105,115, 10, 45,
-   45, 32,116,114,117,101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110,
-   99,116,105,111,110, 32,109, 97,107,101, 95, 99,108, 97,117,115,101, 40,
-  104,101, 97,100, 44, 32, 98,111,100,121, 41, 10, 32, 32, 32,108,111, 99,
-   97,108, 32, 99,108, 97,117,115,101, 32, 61, 32,123,104,101, 97,100, 32,
-   61, 32,104,101, 97,100,125, 10, 32, 32, 32,102,111,114, 32,105, 61, 49,
-   44, 35, 98,111,100,121, 32,100,111, 10, 32, 32, 32, 32, 32, 32, 99,108,
-   97,117,115,101, 91,105, 93, 32, 61, 32, 98,111,100,121, 91,105, 93, 10,
-   32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32, 99,
-  108, 97,117,115,101, 10,101,110,100, 10, 10, 45, 45, 32, 65, 32, 99,108,
-   97,117,115,101, 39,115, 32,105,100, 32,105,115, 32, 99,111,109,112,117,
-  116,101,100, 32,111,110, 32,100,101,109, 97,110,100, 44, 32, 98,117,116,
-   32,116,104,101,110, 32, 99, 97, 99,104,101,100, 46, 10, 10, 45, 45, 32,
-   84,104,101, 32,105,100, 39,115, 32,101,110, 99,111,100,105,110,103, 32,
-  101,110,115,117,114,101,115, 32,116,104, 97,116, 32,116,119,111, 32, 99,
-  108, 97,117,115,101,115, 32, 97,114,101, 32,115,116,114,117, 99,116,117,
-  114, 97,108,108,121, 32,101,113,117, 97,108, 10, 45, 45, 32,105,102, 32,
-  116,104,101,121, 32,104, 97,118,101, 32,116,104,101, 32,115, 97,109,101,
-   32,105,100, 46, 32, 32, 65, 32, 99,108, 97,117,115,101, 39,115, 32,105,
-  100, 32,105,115, 32,117,115,101,100, 32, 97,115, 32, 97, 32,107,101,121,
-   32,105,110,116,111, 32,116,104,101, 10, 45, 45, 32, 99,108, 97,117,115,
-  101, 32,100, 97,116, 97, 98, 97,115,101, 46, 10, 10,108,111, 99, 97,108,
-   32,102,117,110, 99,116,105,111,110, 32,103,101,116, 95, 99,108, 97,117,
-  115,101, 95,105,100, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,108,
-  111, 99, 97,108, 32,105,100, 32, 61, 32, 99,108, 97,117,115,101, 46,105,
-  100, 10, 32, 32, 32,105,102, 32,110,111,116, 32,105,100, 32,116,104,101,
-  110, 10, 32, 32, 32, 32, 32, 32,105,100, 32, 61, 32, 97,100,100, 95,115,
-  105,122,101, 40,103,101,116, 95,105,100, 40, 99,108, 97,117,115,101, 46,
-  104,101, 97,100, 41, 41, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,
-   61, 49, 44, 35, 99,108, 97,117,115,101, 32,100,111, 10,  9, 32,105,100,
-   32, 61, 32,105,100, 32, 46, 46, 32, 97,100,100, 95,115,105,122,101, 40,
-  103,101,116, 95,105,100, 40, 99,108, 97,117,115,101, 91,105, 93, 41, 41,
-   10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32, 99,
-  108, 97,117,115,101, 46,105,100, 32, 61, 32,105,100, 10, 32, 32, 32,101,
-  110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,105,100, 10,101,110,
-  100, 10, 10, 45, 45, 32, 67,108, 97,117,115,101, 32,115,117, 98,115,116,
-  105,116,117,116,105,111,110, 32,105,110, 32,119,104,105, 99,104, 32,116,
-  104,101, 32,115,117, 98,115,116,105,116,117,116,105,111,110, 32,105,115,
-   32, 97,112,112,108,105,101,100, 32,116,111, 32,101, 97, 99,104, 10, 45,
-   45, 32,101, 97, 99,104, 32,108,105,116,101,114, 97,108, 32,116,104, 97,
-  116, 32,109, 97,107,101,115, 32,117,112, 32,116,104,101, 32, 99,108, 97,
-  117,115,101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
-  111,110, 32,115,117, 98,115,116, 95,105,110, 95, 99,108, 97,117,115,101,
-   40, 99,108, 97,117,115,101, 44, 32,101,110,118, 41, 10, 32, 32, 32,105,
-  102, 32,110,111,116, 32,110,101,120,116, 40,101,110,118, 41, 32,116,104,
-  101,110,  9, 45, 45, 32, 70,111,117,110,100, 32, 97,110, 32,101,109,112,
-  116,121, 32,109, 97,112, 46, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,
-  114,110, 32, 99,108, 97,117,115,101, 10, 32, 32, 32,101,110,100, 10, 32,
-   32, 32,108,111, 99, 97,108, 32,110,101,119, 32, 61, 32,123,104,101, 97,
-  100, 32, 61, 32,115,117, 98,115,116, 40, 99,108, 97,117,115,101, 46,104,
-  101, 97,100, 44, 32,101,110,118, 41,125, 10, 32, 32, 32,102,111,114, 32,
-  105, 61, 49, 44, 35, 99,108, 97,117,115,101, 32,100,111, 10, 32, 32, 32,
-   32, 32, 32,110,101,119, 91,105, 93, 32, 61, 32,115,117, 98,115,116, 40,
-   99,108, 97,117,115,101, 91,105, 93, 44, 32,101,110,118, 41, 10, 32, 32,
-   32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,110,101,119,
-   10,101,110,100, 10, 10, 45, 45, 32, 82,101,110, 97,109,101,115, 32,116,
-  104,101, 32,118, 97,114,105, 97, 98,108,101,115, 32,105,110, 32, 97, 32,
-   99,108, 97,117,115,101, 46, 32, 32, 69,118,101,114,121, 32,118, 97,114,
-  105, 97, 98,108,101, 32,105,110, 32,116,104,101, 32,104,101, 97,100, 32,
-  105,115, 10, 45, 45, 32,105,110, 32,116,104,101, 32, 98,111,100,121, 44,
-   32,115,111, 32,116,104,101, 32,104,101, 97,100, 32, 99, 97,110, 32, 98,
-  101, 32,105,103,110,111,114,101,100, 32,119,104,105,108,101, 32,103,101,
-  110,101,114, 97,116,105,110,103, 32, 97,110, 10, 45, 45, 32,101,110,118,
-  105,114,111,110,109,101,110,116, 46, 10, 10,108,111, 99, 97,108, 32,102,
-  117,110, 99,116,105,111,110, 32,114,101,110, 97,109,101, 95, 99,108, 97,
-  117,115,101, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,108,111, 99,
-   97,108, 32,101,110,118, 32, 61, 32,123,125, 10, 32, 32, 32,102,111,114,
-   32,105, 61, 49, 44, 35, 99,108, 97,117,115,101, 32,100,111, 10, 32, 32,
-   32, 32, 32, 32,101,110,118, 32, 61, 32,115,104,117,102,102,108,101, 40,
-   99,108, 97,117,115,101, 91,105, 93, 44, 32,101,110,118, 41, 10, 32, 32,
-   32,101,110,100, 10, 32, 32, 32,105,102, 32,110,111,116, 32,110,101,120,
-  116, 40,101,110,118, 41, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,
-  114,101,116,117,114,110, 32, 99,108, 97,117,115,101, 10, 32, 32, 32,101,
-  108,115,101, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,115,
-  117, 98,115,116, 95,105,110, 95, 99,108, 97,117,115,101, 40, 99,108, 97,
-  117,115,101, 44, 32,101,110,118, 41, 10, 32, 32, 32,101,110,100, 10,101,
-  110,100, 10, 10, 45, 45, 32, 65, 32, 99,108, 97,117,115,101, 32,105,115,
-   32,115, 97,102,101, 32,105,102, 32,101,118,101,114,121, 32,118, 97,114,
-  105, 97, 98,108,101, 32,105,110, 32,105,116,115, 32,104,101, 97,100, 32,
-  105,115, 32,105,110, 32,105,116,115, 32, 98,111,100,121, 46, 10, 10,108,
-  111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,105,115, 95,115,
-   97,102,101, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,102,111,114,
-   32,105, 61, 49, 44, 35, 99,108, 97,117,115,101, 46,104,101, 97,100, 32,
-  100,111, 10, 32, 32, 32, 32, 32, 32,105,102, 32,110,111,116, 32, 99,108,
-   97,117,115,101, 46,104,101, 97,100, 91,105, 93, 58,105,115, 95,115, 97,
-  102,101, 40, 99,108, 97,117,115,101, 41, 32,116,104,101,110, 10,  9, 32,
-  114,101,116,117,114,110, 32,102, 97,108,115,101, 10, 32, 32, 32, 32, 32,
-   32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,
+   84,104,101, 32, 99, 97,115,101, 32, 97,110, 97,108,121,115,105,115, 32,
+  102,111,114, 32,117,110,105,102,121,105,110,103, 32,116,119,111, 32,116,
+  101,114,109,115, 32,105,115, 32,104, 97,110,100,108,101,100, 32, 98,121,
+   32,109,101,116,104,111,100, 10, 45, 45, 32,100,105,115,112, 97,116, 99,
+  104, 46, 10, 10,102,117,110, 99,116,105,111,110, 32, 67,111,110,115,116,
+   58,117,110,105,102,121, 40,116,101,114,109, 44, 32,101,110,118, 41, 10,
+   32, 32, 32,114,101,116,117,114,110, 32,116,101,114,109, 58,117,110,105,
+  102,121, 95, 99,111,110,115,116, 40,115,101,108,102, 44, 32,101,110,118,
+   41, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 67,111,
+  110,115,116, 58,117,110,105,102,121, 95, 99,111,110,115,116, 40, 99,111,
+  110,115,116, 44, 32,101,110,118, 41, 10, 32, 32, 32,114,101,116,117,114,
+  110, 32,110,105,108, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,
+  110, 32, 86, 97,114, 58,117,110,105,102,121, 95, 99,111,110,115,116, 40,
+   99,111,110,115,116, 44, 32,101,110,118, 41, 10, 32, 32, 32,101,110,118,
+   91,115,101,108,102, 93, 32, 61, 32, 99,111,110,115,116, 10, 32, 32, 32,
+  114,101,116,117,114,110, 32,101,110,118, 10,101,110,100, 10, 10,102,117,
+  110, 99,116,105,111,110, 32, 86, 97,114, 58,117,110,105,102,121, 40,116,
+  101,114,109, 44, 32,101,110,118, 41, 10, 32, 32, 32,114,101,116,117,114,
+  110, 32,116,101,114,109, 58,117,110,105,102,121, 95,118, 97,114, 40,115,
+  101,108,102, 44, 32,101,110,118, 41, 10,101,110,100, 10, 10,102,117,110,
+   99,116,105,111,110, 32, 67,111,110,115,116, 58,117,110,105,102,121, 95,
+  118, 97,114, 40,118, 97,114, 44, 32,101,110,118, 41, 10, 32, 32, 32,114,
+  101,116,117,114,110, 32,118, 97,114, 58,117,110,105,102,121, 95, 99,111,
+  110,115,116, 40,115,101,108,102, 44, 32,101,110,118, 41, 10,101,110,100,
+   10, 10,102,117,110, 99,116,105,111,110, 32, 86, 97,114, 58,117,110,105,
+  102,121, 95,118, 97,114, 40,118, 97,114, 44, 32,101,110,118, 41, 10, 32,
+   32, 32,101,110,118, 91,118, 97,114, 93, 32, 61, 32,115,101,108,102, 10,
+   32, 32, 32,114,101,116,117,114,110, 32,101,110,118, 10,101,110,100, 10,
+   10, 45, 45, 32, 68,111,101,115, 32, 97, 32,108,105,116,101,114, 97,108,
+   32,104, 97,118,101, 32, 97, 32,103,105,118,101,110, 32,116,101,114,109,
+   63, 32, 32, 73,110,116,101,114,110, 97,108,105,122,105,110,103, 32,116,
+  101,114,109,115, 32,101,110,115,117,114,101,115, 32, 97,110, 10, 45, 45,
+   32,101,102,102,105, 99,105,101,110,116, 32,105,109,112,108,101,109,101,
+  110,116, 97,116,105,111,110, 32,111,102, 32,116,104,105,115, 32,111,112,
+  101,114, 97,116,105,111,110, 46, 10, 10,108,111, 99, 97,108, 32,102,117,
+  110, 99,116,105,111,110, 32,105,115, 95,105,110, 40,116,101,114,109, 44,
+   32,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,102,111,114, 32,105,
+   61, 49, 44, 35,108,105,116,101,114, 97,108, 32,100,111, 10, 32, 32, 32,
+   32, 32, 32,105,102, 32,108,105,116,101,114, 97,108, 91,105, 93, 32, 61,
+   61, 32,116,101,114,109, 32,116,104,101,110, 10,  9, 32,114,101,116,117,
+  114,110, 32,116,114,117,101, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,102,
+   97,108,115,101, 10,101,110,100, 10, 10, 45, 45, 32, 84,104,101,115,101,
+   32,109,101,116,104,111,100,115, 32, 97,114,101, 32,117,115,101,100, 32,
+  116,111, 32,104, 97,110,100,108,101, 32, 97, 32,115,101,116, 32,111,102,
+   32,102, 97, 99,116,115, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110,
+   99,116,105,111,110, 32,105,115, 95,109,101,109, 98,101,114, 40,108,105,
+  116,101,114, 97,108, 44, 32,116, 98,108, 41, 10, 32, 32, 32,114,101,116,
+  117,114,110, 32,116, 98,108, 91,103,101,116, 95,105,100, 40,108,105,116,
+  101,114, 97,108, 41, 93, 10,101,110,100, 10, 10,108,111, 99, 97,108, 32,
+  102,117,110, 99,116,105,111,110, 32, 97,100,106,111,105,110, 40,108,105,
+  116,101,114, 97,108, 44, 32,116, 98,108, 41, 10, 32, 32, 32,116, 98,108,
+   91,103,101,116, 95,105,100, 40,108,105,116,101,114, 97,108, 41, 93, 32,
+   61, 32,108,105,116,101,114, 97,108, 10,101,110,100, 10, 10, 45, 45, 32,
+   67,108, 97,117,115,101,115, 10, 10, 45, 45, 32, 65, 32, 99,108, 97,117,
+  115,101, 32,104, 97,115, 32, 97, 32,104,101, 97,100, 32,108,105,116,101,
+  114, 97,108, 44, 32, 97,110,100, 32, 97, 32,115,101,113,117,101,110, 99,
+  101, 32,111,102, 32,108,105,116,101,114, 97,108,115, 32,116,104, 97,116,
+   32,102,111,114,109, 10, 45, 45, 32,105,116,115, 32, 98,111,100,121, 46,
+   32, 32, 73,102, 32,116,104,101,114,101, 32, 97,114,101, 32,110,111, 32,
+  108,105,116,101,114, 97,108,115, 32,105,110, 32,105,116,115, 32, 98,111,
+  100,121, 44, 32,116,104,101, 32, 99,108, 97,117,115,101, 32,105,115, 10,
+   45, 45, 32, 99, 97,108,108,101,100, 32, 97, 32,102, 97, 99,116, 46, 32,
+   32, 73,102, 32,116,104,101,114,101, 32,105,115, 32, 97,116, 32,108,101,
+   97,115,116, 32,111,110,101, 32,108,105,116,101,114, 97,108, 32,105,110,
+   32,105,116,115, 32, 98,111,100,121, 44, 32,105,116, 32,105,115, 10, 45,
+   45, 32, 99, 97,108,108,101,100, 32, 97, 32,114,117,108,101, 46, 10, 10,
+   45, 45, 32, 65, 32, 99,108, 97,117,115,101, 32, 97,115,115,101,114,116,
+  115, 32,116,104, 97,116, 32,105,116,115, 32,104,101, 97,100, 32,105,115,
+   32,116,114,117,101, 32,105,102, 32,101,118,101,114,121, 32,108,105,116,
+  101,114, 97,108, 32,105,110, 32,105,116,115, 32, 98,111,100,121, 32,105,
+  115, 10, 45, 45, 32,116,114,117,101, 46, 10, 10,108,111, 99, 97,108, 32,
+  102,117,110, 99,116,105,111,110, 32,109, 97,107,101, 95, 99,108, 97,117,
+  115,101, 40,104,101, 97,100, 44, 32, 98,111,100,121, 41, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32, 99,108, 97,117,115,101, 32, 61, 32,123,104,101,
+   97,100, 32, 61, 32,104,101, 97,100,125, 10, 32, 32, 32,102,111,114, 32,
+  105, 61, 49, 44, 35, 98,111,100,121, 32,100,111, 10, 32, 32, 32, 32, 32,
+   32, 99,108, 97,117,115,101, 91,105, 93, 32, 61, 32, 98,111,100,121, 91,
+  105, 93, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,
+  110, 32, 99,108, 97,117,115,101, 10,101,110,100, 10, 10, 45, 45, 32, 65,
+   32, 99,108, 97,117,115,101, 39,115, 32,105,100, 32,105,115, 32, 99,111,
+  109,112,117,116,101,100, 32,111,110, 32,100,101,109, 97,110,100, 44, 32,
+   98,117,116, 32,116,104,101,110, 32, 99, 97, 99,104,101,100, 46, 10, 10,
+   45, 45, 32, 84,104,101, 32,105,100, 39,115, 32,101,110, 99,111,100,105,
+  110,103, 32,101,110,115,117,114,101,115, 32,116,104, 97,116, 32,116,119,
+  111, 32, 99,108, 97,117,115,101,115, 32, 97,114,101, 32,115,116,114,117,
+   99,116,117,114, 97,108,108,121, 32,101,113,117, 97,108, 10, 45, 45, 32,
+  105,102, 32,116,104,101,121, 32,104, 97,118,101, 32,116,104,101, 32,115,
+   97,109,101, 32,105,100, 46, 32, 32, 65, 32, 99,108, 97,117,115,101, 39,
+  115, 32,105,100, 32,105,115, 32,117,115,101,100, 32, 97,115, 32, 97, 32,
+  107,101,121, 32,105,110,116,111, 32,116,104,101, 10, 45, 45, 32, 99,108,
+   97,117,115,101, 32,100, 97,116, 97, 98, 97,115,101, 46, 10, 10, 45, 45,
+   32, 84,104,101, 32,105,100,115, 32,111,102, 32,116,104,101, 32,108,105,
+  116,101,114, 97,108,115, 32, 97,114,101, 32,115,101,112, 97,114, 97,116,
+  101,100, 32, 98,121, 32, 99,111,109,109, 97,115, 44, 32, 97,115, 32,115,
+  112, 97, 99,101,115, 10, 45, 45, 32,115,101,112, 97,114, 97,116,101, 32,
+  116,104,101, 32,115,121,109, 98,111,108,115, 32,119,105,116,104,105,110,
+   32,116,104,101,109, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,
+  116,105,111,110, 32,103,101,116, 95, 99,108, 97,117,115,101, 95,105,100,
+   40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,
+  105,100, 32, 61, 32, 99,108, 97,117,115,101, 46,105,100, 10, 32, 32, 32,
+  105,102, 32,110,111,116, 32,105,100, 32,116,104,101,110, 10, 32, 32, 32,
+   32, 32, 32,108,111, 99, 97,108, 32,105,100,115, 32, 61, 32,123,103,101,
+  116, 95,105,100, 40, 99,108, 97,117,115,101, 46,104,101, 97,100, 41,125,
+   10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35, 99,108,
+   97,117,115,101, 32,100,111, 10,  9, 32,105,100,115, 91,105, 32, 43, 32,
+   49, 93, 32, 61, 32,103,101,116, 95,105,100, 40, 99,108, 97,117,115,101,
+   91,105, 93, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+   32, 32, 32,105,100, 32, 61, 32,116, 97, 98,108,101, 46, 99,111,110, 99,
+   97,116, 40,105,100,115, 44, 32, 34, 44, 34, 41, 10, 32, 32, 32, 32, 32,
+   32, 99,108, 97,117,115,101, 46,105,100, 32, 61, 32,105,100, 10, 32, 32,
+   32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,105,100, 10,
+  101,110,100, 10, 10, 45, 45, 32, 67,108, 97,117,115,101, 32,115,117, 98,
+  115,116,105,116,117,116,105,111,110, 32,105,110, 32,119,104,105, 99,104,
+   32,116,104,101, 32,115,117, 98,115,116,105,116,117,116,105,111,110, 32,
+  105,115, 32, 97,112,112,108,105,101,100, 32,116,111, 32,101, 97, 99,104,
+   10, 45, 45, 32,101, 97, 99,104, 32,108,105,116,101,114, 97,108, 32,116,
+  104, 97,116, 32,109, 97,107,101,115, 32,117,112, 32,116,104,101, 32, 99,
+  108, 97,117,115,101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,
+  116,105,111,110, 32,115,117, 98,115,116, 95,105,110, 95, 99,108, 97,117,
+  115,101, 40, 99,108, 97,117,115,101, 44, 32,101,110,118, 41, 10, 32, 32,
+   32,105,102, 32,110,111,116, 32,110,101,120,116, 40,101,110,118, 41, 32,
+  116,104,101,110,  9, 45, 45, 32, 70,111,117,110,100, 32, 97,110, 32,101,
+  109,112,116,121, 32,109, 97,112, 46, 10, 32, 32, 32, 32, 32, 32,114,101,
+  116,117,114,110, 32, 99,108, 97,117,115,101, 10, 32, 32, 32,101,110,100,
+   10, 32, 32, 32,108,111, 99, 97,108, 32,110,101,119, 32, 61, 32,123,104,
+  101, 97,100, 32, 61, 32,115,117, 98,115,116, 40, 99,108, 97,117,115,101,
+   46,104,101, 97,100, 44, 32,101,110,118, 41,125, 10, 32, 32, 32,102,111,
+  114, 32,105, 61, 49, 44, 35, 99,108, 97,117,115,101, 32,100,111, 10, 32,
+   32, 32, 32, 32, 32,110,101,119, 91,105, 93, 32, 61, 32,115,117, 98,115,
+  116, 40, 99,108, 97,117,115,101, 91,105, 93, 44, 32,101,110,118, 41, 10,
+   32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,110,
+  101,119, 10,101,110,100, 10, 10, 45, 45, 32, 82,101,110, 97,109,101,115,
+   32,116,104,101, 32,118, 97,114,105, 97, 98,108,101,115, 32,105,110, 32,
+   97, 32, 99,108, 97,117,115,101, 46, 32, 32, 69,118,101,114,121, 32,118,
+   97,114,105, 97, 98,108,101, 32,105,110, 32,116,104,101, 32,104,101, 97,
+  100, 32,105,115, 10, 45, 45, 32,105,110, 32,116,104,101, 32, 98,111,100,
+  121, 44, 32,115,111, 32,116,104,101, 32,104,101, 97,100, 32, 99, 97,110,
+   32, 98,101, 32,105,103,110,111,114,101,100, 32,119,104,105,108,101, 32,
+  103,101,110,101,114, 97,116,105,110,103, 32, 97,110, 10, 45, 45, 32,101,
+  110,118,105,114,111,110,109,101,110,116, 46, 10, 10,108,111, 99, 97,108,
+   32,102,117,110, 99,116,105,111,110, 32,114,101,110, 97,109,101, 95, 99,
+  108, 97,117,115,101, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,108,
+  111, 99, 97,108, 32,101,110,118, 32, 61, 32,123,125, 10, 32, 32, 32,102,
+  111,114, 32,105, 61, 49, 44, 35, 99,108, 97,117,115,101, 32,100,111, 10,
+   32, 32, 32, 32, 32, 32,101,110,118, 32, 61, 32,115,104,117,102,102,108,
+  101, 40, 99,108, 97,117,115,101, 91,105, 93, 44, 32,101,110,118, 41, 10,
+   32, 32, 32,101,110,100, 10, 32, 32, 32,105,102, 32,110,111,116, 32,110,
+  101,120,116, 40,101,110,118, 41, 32,116,104,101,110, 10, 32, 32, 32, 32,
+   32, 32,114,101,116,117,114,110, 32, 99,108, 97,117,115,101, 10, 32, 32,
+   32,101,108,115,101, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110,
+   32,115,117, 98,115,116, 95,105,110, 95, 99,108, 97,117,115,101, 40, 99,
+  108, 97,117,115,101, 44, 32,101,110,118, 41, 10, 32, 32, 32,101,110,100,
+   10,101,110,100, 10, 10, 45, 45, 32, 78, 97,116,105,118,101, 32,107,101,
+  114,110,101,108,115, 10, 10, 45, 45, 32, 87,104,101,110, 32,108,111, 97,
+  100,101,100, 32, 98,121, 32,116,104,101, 32, 67, 32,108,105, 98,114, 97,
+  114,121, 44, 32,110, 97,116,105,118,101, 32,118,101,114,115,105,111,110,
+  115, 32,111,102, 32,116,104,101, 32,102,117,110, 99,116,105,111,110,115,
+   10, 45, 45, 32, 97, 98,111,118,101, 32,116,104, 97,116, 32,109, 97,107,
+  101, 32,107,101,121,115, 44, 32,117,110,105,102,121, 44, 32,115,117, 98,
+  115,116,105,116,117,116,101, 32, 97,110,100, 32,114,101,110, 97,109,101,
+   32, 97,114,101, 32, 97,118, 97,105,108, 97, 98,108,101, 46, 10, 45, 45,
+   32, 84,104,101,121, 32, 98,101,104, 97,118,101, 32,116,104,101, 32,115,
+   97,109,101, 44, 32, 98,117,116, 32, 97,118,111,105,100, 32,109,101,116,
+  104,111,100, 32,100,105,115,112, 97,116, 99,104, 32,111,110, 32,101, 97,
+   99,104, 32,116,101,114,109, 46, 10, 10,105,102, 32,100,108, 95,107,101,
+  114,110,101,108,115, 32,116,104,101,110, 10, 32, 32, 32,108,111, 99, 97,
+  108, 32,107,101,114,110,101,108,115, 32, 61, 32,100,108, 95,107,101,114,
+  110,101,108,115, 40, 86, 97,114, 44, 32,109,107, 95,102,114,101,115,104,
+   95,118, 97,114, 41, 10, 32, 32, 32,103,101,116, 95,105,100, 32, 61, 32,
+  107,101,114,110,101,108,115, 46,103,101,116, 95,105,100, 10, 32, 32, 32,
+  103,101,116, 95,116, 97,103, 32, 61, 32,107,101,114,110,101,108,115, 46,
+  103,101,116, 95,116, 97,103, 10, 32, 32, 32,117,110,105,102,121, 32, 61,
+   32,107,101,114,110,101,108,115, 46,117,110,105,102,121, 10, 32, 32, 32,
+  115,117, 98,115,116, 32, 61, 32,107,101,114,110,101,108,115, 46,115,117,
+   98,115,116, 10, 32, 32, 32,115,104,117,102,102,108,101, 32, 61, 32,107,
+  101,114,110,101,108,115, 46,115,104,117,102,102,108,101, 10, 32, 32, 32,
+  114,101,110, 97,109,101, 32, 61, 32,107,101,114,110,101,108,115, 46,114,
+  101,110, 97,109,101, 10, 32, 32, 32,115,117, 98,115,116, 95,105,110, 95,
+   99,108, 97,117,115,101, 32, 61, 32,107,101,114,110,101,108,115, 46,115,
+  117, 98,115,116, 95,105,110, 95, 99,108, 97,117,115,101, 10, 32, 32, 32,
+  114,101,110, 97,109,101, 95, 99,108, 97,117,115,101, 32, 61, 32,107,101,
+  114,110,101,108,115, 46,114,101,110, 97,109,101, 95, 99,108, 97,117,115,
+  101, 10,101,110,100, 10, 10, 45, 45, 32, 65, 32, 99,108, 97,117,115,101,
+   32,105,115, 32,115, 97,102,101, 32,105,102, 32,101,118,101,114,121, 32,
+  118, 97,114,105, 97, 98,108,101, 32,105,110, 32,105,116,115, 32,104,101,
+   97,100, 32,105,115, 32,105,110, 32,105,116,115, 32, 98,111,100,121, 46,
+   10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,105,
+  115, 95,115, 97,102,101, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,
+  102,111,114, 32,105, 61, 49, 44, 35, 99,108, 97,117,115,101, 46,104,101,
+   97,100, 32,100,111, 10, 32, 32, 32, 32, 32, 32,105,102, 32,110,111,116,
+   32, 99,108, 97,117,115,101, 46,104,101, 97,100, 91,105, 93, 58,105,115,
+   95,115, 97,102,101, 40, 99,108, 97,117,115,101, 41, 32,116,104,101,110,
+   10,  9, 32,114,101,116,117,114,110, 32,102, 97,108,115,101, 10, 32, 32,
+   32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  114,101,116,117,114,110, 32,116,114,117,101, 10,101,110,100, 10, 10,102,
+  117,110, 99,116,105,111,110, 32, 67,111,110,115,116, 58,105,115, 95,115,
+   97,102,101, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,114,101,116,
   117,114,110, 32,116,114,117,101, 10,101,110,100, 10, 10,102,117,110, 99,
-  116,105,111,110, 32, 67,111,110,115,116, 58,105,115, 95,115, 97,102,101,
-   40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,114,101,116,117,114,110,
-   32,116,114,117,101, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,
-  110, 32, 86, 97,114, 58,105,115, 95,115, 97,102,101, 40, 99,108, 97,117,
-  115,101, 41, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35, 99,108,
-   97,117,115,101, 32,100,111, 10, 32, 32, 32, 32, 32, 32,105,102, 32,105,
-  115, 95,105,110, 40,115,101,108,102, 44, 32, 99,108, 97,117,115,101, 91,
-  105, 93, 41, 32,116,104,101,110, 10,  9, 32,114,101,116,117,114,110, 32,
-  116,114,117,101, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,
-  101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,102, 97,108,115,
-  101, 10,101,110,100, 10, 10, 45, 45, 32, 68, 65, 84, 65, 66, 65, 83, 69,
-   10, 10, 45, 45, 32, 84,104,101, 32,100, 97,116, 97, 98, 97,115,101, 32,
-  115,116,111,114,101,115, 32,112,114,101,100,105, 99, 97,116,101,115, 32,
-  116,104, 97,116, 32, 99,111,110,116, 97,105,110, 32, 99,108, 97,117,115,
-  101,115, 46, 32, 32, 80,114,101,100,105, 99, 97,116,101,115, 10, 45, 45,
-   32,110,111,116, 32,105,110, 32,116,104,101, 32,100, 97,116, 97, 98, 97,
-  115,101, 32, 97,114,101, 32,115,117, 98,106,101, 99,116, 32,116,111, 32,
-  103, 97,114, 98, 97,103,101, 32, 99,111,108,108,101, 99,116,105,111,110,
-   46, 10, 10,108,111, 99, 97,108, 32,100, 98, 32, 61, 32,123,125, 10, 10,
-  108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,105,110,115,
-  101,114,116, 40,112,114,101,100, 41, 10, 32, 32, 32,100, 98, 91,112,114,
-  101,100, 46,105,100, 93, 32, 61, 32,112,114,101,100, 10, 32, 32, 32,114,
-  101,116,117,114,110, 32,112,114,101,100, 10,101,110,100, 10, 10,108,111,
-   99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,114,101,109,111,118,
-  101, 40,112,114,101,100, 41, 10, 32, 32, 32,100, 98, 91,112,114,101,100,
-   46,105,100, 93, 32, 61, 32,110,105,108, 10, 32, 32, 32,114,101,116,117,
-  114,110, 32,112,114,101,100, 10,101,110,100, 10, 10, 45, 45, 32, 65,100,
+  116,105,111,110, 32, 86, 97,114, 58,105,115, 95,115, 97,102,101, 40, 99,
+  108, 97,117,115,101, 41, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44,
+   35, 99,108, 97,117,115,101, 32,100,111, 10, 32, 32, 32, 32, 32, 32,105,
+  102, 32,105,115, 95,105,110, 40,115,101,108,102, 44, 32, 99,108, 97,117,
+  115,101, 91,105, 93, 41, 32,116,104,101,110, 10,  9, 32,114,101,116,117,
+  114,110, 32,116,114,117,101, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,102,
+   97,108,115,101, 10,101,110,100, 10, 10, 45, 45, 32, 68, 65, 84, 65, 66,
+   65, 83, 69, 10, 10, 45, 45, 32, 84,104,101, 32,100, 97,116, 97, 98, 97,
+  115,101, 32,115,116,111,114,101,115, 32,112,114,101,100,105, 99, 97,116,
+  101,115, 32,116,104, 97,116, 32, 99,111,110,116, 97,105,110, 32, 99,108,
+   97,117,115,101,115, 46, 32, 32, 80,114,101,100,105, 99, 97,116,101,115,
+   10, 45, 45, 32,110,111,116, 32,105,110, 32,116,104,101, 32,100, 97,116,
+   97, 98, 97,115,101, 32, 97,114,101, 32,115,117, 98,106,101, 99,116, 32,
+  116,111, 32,103, 97,114, 98, 97,103,101, 32, 99,111,108,108,101, 99,116,
+  105,111,110, 46, 32, 32, 84,104,101, 32,114,117,108,101,115, 10, 45, 45,
+   32,111,102, 32, 97, 32,112,114,101,100,105, 99, 97,116,101, 32, 97,114,
+  101, 32,105,110, 32,105,116,115, 32,100, 98, 32,116, 97, 98,108,101, 44,
+   32, 97,110,100, 32,105,116,115, 32,102, 97, 99,116,115, 32,105,110, 32,
+  105,116,115, 32,102, 97, 99,116, 10, 45, 45, 32,115,116,111,114,101, 44,
+   32,119,104,105, 99,104, 32,105,115, 32,100,101,115, 99,114,105, 98,101,
+  100, 32, 97,102,116,101,114, 32,116,104,101, 32, 99,108, 97,117,115,101,
+   32,105,110,100,101,120,101,115, 46, 10, 10,108,111, 99, 97,108, 32,100,
+   98, 32, 61, 32,123,125, 10, 10, 45, 45, 32, 83,110, 97,112,115,104,111,
+  116,115, 32,111,102, 32,116,104,101, 32,100, 97,116, 97, 98, 97,115,101,
+   44, 32,100,101,115, 99,114,105, 98,101,100, 32,119,105,116,104, 32,116,
+  104,101, 32,102,117,110, 99,116,105,111,110,115, 32,116,104, 97,116, 32,
+  116, 97,107,101, 10, 45, 45, 32, 97,110,100, 32,114,101,118,101,114,116,
+   32,116,111, 32,116,104,101,109, 44, 32, 99,111,112,121, 32,110,111,116,
+  104,105,110,103, 32,119,104,101,110, 32,116, 97,107,101,110, 46, 32, 32,
+   73,110,115,116,101, 97,100, 44, 32,116,104,101, 32,108, 97,116,101,115,
+  116, 10, 45, 45, 32,115,110, 97,112,115,104,111,116, 32,115, 97,118,101,
+  115, 32,116,104,101, 32,115,116, 97,116,101, 32,111,102, 32, 97, 32,112,
+  114,101,100,105, 99, 97,116,101, 32,116,104,101, 32,102,105,114,115,116,
+   32,116,105,109,101, 32,105,116, 32, 99,104, 97,110,103,101,115, 44, 10,
+   45, 45, 32,115,111, 32,101,118,101,114,121, 32, 99,104, 97,110,103,101,
+   32,116,111, 32,116,104,101, 32, 99,108, 97,117,115,101,115, 32,111,102,
+   32, 97, 32,112,114,101,100,105, 99, 97,116,101, 44, 32,111,114, 32,116,
+  111, 32,119,104,101,116,104,101,114, 32,105,116, 32,105,115, 10, 45, 45,
+   32,105,110, 32,116,104,101, 32,100, 97,116, 97, 98, 97,115,101, 44, 32,
+  105,115, 32,112,114,101, 99,101,100,101,100, 32, 98,121, 32, 97, 32, 99,
+   97,108,108, 32,116,111, 32,116,111,117, 99,104, 46, 32, 32, 84,104,101,
+   32,108, 97,116,101,115,116, 10, 45, 45, 32,115,110, 97,112,115,104,111,
+  116, 32,105,115, 32,119,101, 97,107,108,121, 32,104,101,108,100, 44, 32,
+  115,111, 32,110,111,116,104,105,110,103, 32,105,115, 32,115, 97,118,101,
+  100, 32,119,104,101,110, 32,110,111,110,101, 32,105,115, 32,105,110, 32,
+  117,115,101, 46, 10, 10,108,111, 99, 97,108, 32,108, 97,116,101,115,116,
+   32, 61, 32,115,101,116,109,101,116, 97,116, 97, 98,108,101, 40,123,125,
+   44, 32,123, 95, 95,109,111,100,101, 32, 61, 32, 34,118, 34,125, 41, 10,
+   10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,116,111,
+  117, 99,104, 40,112,114,101,100, 41, 10, 32, 32, 32,108,111, 99, 97,108,
+   32,115,110, 97,112, 32, 61, 32,108, 97,116,101,115,116, 91, 49, 93, 10,
+   32, 32, 32,105,102, 32,115,110, 97,112, 32, 97,110,100, 32,110,111,116,
+   32,115,110, 97,112, 46,115, 97,118,101,100, 91,112,114,101,100, 93, 32,
+  116,104,101,110, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,114,
+  117,108,101,115, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32, 32,102,111,
+  114, 32,105,100, 44, 99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,
+  114,115, 40,112,114,101,100, 46,100, 98, 41, 32,100,111, 10,  9, 32,114,
+  117,108,101,115, 91,105,100, 93, 32, 61, 32, 99,108, 97,117,115,101, 10,
+   32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,115,110,
+   97,112, 46,115, 97,118,101,100, 91,112,114,101,100, 93, 32, 61, 32,123,
+  100, 98, 32, 61, 32,114,117,108,101,115, 44, 10,  9,  9,  9, 32, 32,102,
+   97, 99,116,115, 32, 61, 32,112,114,101,100, 46,102, 97, 99,116,115, 32,
+   97,110,100, 32,112,114,101,100, 46,102, 97, 99,116,115, 58, 99,111,112,
+  121, 40, 41, 44, 10,  9,  9,  9, 32, 32,112,114,101,115,101,110,116, 32,
+   61, 32,100, 98, 91,112,114,101,100, 46,105,100, 93, 32,126, 61, 32,110,
+  105,108,125, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,108,111,
+   99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,105,110,115,101,114,
+  116, 40,112,114,101,100, 41, 10, 32, 32, 32,116,111,117, 99,104, 40,112,
+  114,101,100, 41, 10, 32, 32, 32,100, 98, 91,112,114,101,100, 46,105,100,
+   93, 32, 61, 32,112,114,101,100, 10, 32, 32, 32,114,101,116,117,114,110,
+   32,112,114,101,100, 10,101,110,100, 10, 10,108,111, 99, 97,108, 32,102,
+  117,110, 99,116,105,111,110, 32,114,101,109,111,118,101, 40,112,114,101,
+  100, 41, 10, 32, 32, 32,116,111,117, 99,104, 40,112,114,101,100, 41, 10,
+   32, 32, 32,100, 98, 91,112,114,101,100, 46,105,100, 93, 32, 61, 32,110,
+  105,108, 10, 32, 32, 32,114,101,116,117,114,110, 32,112,114,101,100, 10,
+  101,110,100, 10, 10, 45, 45, 32, 67, 76, 65, 85, 83, 69, 32, 73, 78, 68,
+   69, 88, 69, 83, 10, 10, 45, 45, 32, 65, 32,112,114,101,100,105, 99, 97,
+  116,101, 39,115, 32, 99,108, 97,117,115,101,115, 32, 97,114,101, 32,105,
+  110,100,101,120,101,100, 32, 98,121, 32,116,104,101, 32,116,101,114,109,
+  115, 32,105,110, 32,116,104,101, 32, 97,114,103,117,109,101,110,116,115,
+   32,111,102, 10, 45, 45, 32,116,104,101,105,114, 32,104,101, 97,100,115,
+   44, 32,115,111, 32,116,104, 97,116, 32, 97, 32,108,105,116,101,114, 97,
+  108, 32,119,105,116,104, 32, 97, 32, 99,111,110,115,116, 97,110,116, 32,
+   97,114,103,117,109,101,110,116, 32,110,101,101,100, 32,111,110,108,121,
+   10, 45, 45, 32, 98,101, 32,117,110,105,102,105,101,100, 32,119,105,116,
+  104, 32,116,104,101, 32, 99,108, 97,117,115,101,115, 32,116,104, 97,116,
+   32, 99, 97,110, 32,109, 97,116, 99,104, 32,105,116, 46, 32, 32, 70,111,
+  114, 32,101, 97, 99,104, 32, 97,114,103,117,109,101,110,116, 10, 45, 45,
+   32,112,111,115,105,116,105,111,110, 44, 32,116,104,101, 32,105,110,100,
+  101,120, 32,109, 97,112,115, 32, 97, 32, 99,111,110,115,116, 97,110,116,
+   32,116,111, 32,116,104,101, 32, 98,117, 99,107,101,116, 32,111,102, 32,
+   99,108, 97,117,115,101,115, 32,116,104, 97,116, 10, 45, 45, 32,104, 97,
+  118,101, 32,116,104, 97,116, 32, 99,111,110,115,116, 97,110,116, 32, 97,
+  116, 32,116,104,101, 32,112,111,115,105,116,105,111,110, 44, 32, 97,110,
+  100, 32,104, 97,115, 32,111,110,101, 32,109,111,114,101, 32, 98,117, 99,
+  107,101,116, 32,102,111,114, 10, 45, 45, 32,116,104,101, 32, 99,108, 97,
+  117,115,101,115, 32,116,104, 97,116, 32,104, 97,118,101, 32, 97, 32,118,
+   97,114,105, 97, 98,108,101, 32, 97,116, 32,116,104,101, 32,112,111,115,
+  105,116,105,111,110, 46, 32, 32, 65, 32, 98,117, 99,107,101,116, 32, 99,
+  111,117,110,116,115, 10, 45, 45, 32,105,116,115, 32, 99,108, 97,117,115,
+  101,115, 44, 32,115,111, 32,116,104,101, 32,115,101, 97,114, 99,104, 32,
+   99, 97,110, 32,112,105, 99,107, 32,116,104,101, 32,115,109, 97,108,108,
+  101,115,116, 32,111,110,101, 46, 32, 32, 84,104,101, 32,105,110,100,101,
+  120, 10, 45, 45, 32, 97,108,115,111, 32, 99,111,117,110,116,115, 32,116,
+  104,101, 32, 99,108, 97,117,115,101,115, 32, 97,110,100, 32,114,117,108,
+  101,115, 32,105,116, 32,104,111,108,100,115, 44, 32, 97,110,100, 32,101,
+   97, 99,104, 32,112,111,115,105,116,105,111,110, 10, 45, 45, 32, 99,111,
+  117,110,116,115, 32,105,116,115, 32,100,105,115,116,105,110, 99,116, 32,
+   99,111,110,115,116, 97,110,116,115, 44, 32,119,104,105, 99,104, 32,103,
+  105,118,101,115, 32,116,104,101, 32,115,116, 97,116,105,115,116,105, 99,
+  115, 32,117,115,101,100, 32,116,111, 10, 45, 45, 32,111,114,100,101,114,
+   32,116,104,101, 32, 98,111,100,105,101,115, 32,111,102, 32,114,117,108,
+  101,115, 46, 10, 10, 45, 45, 32, 84,104,101, 32,105,110,100,101,120, 32,
+  111,102, 32, 97, 32,112,114,101,100,105, 99, 97,116,101, 32,105,115, 32,
+   98,117,105,108,116, 32,116,104,101, 32,102,105,114,115,116, 32,116,105,
+  109,101, 32, 97, 32,108,105,116,101,114, 97,108, 32,119,105,116,104, 32,
+   97, 10, 45, 45, 32, 99,111,110,115,116, 97,110,116, 32, 97,114,103,117,
+  109,101,110,116, 32,105,115, 32,115,101, 97,114, 99,104,101,100, 44, 32,
+   97,110,100, 32,116,104,101,110, 32,109, 97,105,110,116, 97,105,110,101,
+  100, 32, 98,121, 32, 97,115,115,101,114,116, 32, 97,110,100, 10, 45, 45,
+   32,114,101,116,114, 97, 99,116, 46, 32, 32, 84,104,101, 32,102, 97, 99,
+  116, 32,115,116,111,114,101,115, 32,119,114,105,116,116,101,110, 32,105,
+  110, 32, 76,117, 97, 32, 97,114,101, 32,105,110,100,101,120,101,100, 32,
+  116,104,101, 32,115, 97,109,101, 32,119, 97,121, 44, 10, 45, 45, 32,115,
+  111, 32,116,104,101, 32,102,117,110, 99,116,105,111,110,115, 32, 98,101,
+  108,111,119, 32,116, 97,107,101, 32, 97,110,121, 32,116, 97, 98,108,101,
+   32,116,104, 97,116, 32,115,116,111,114,101,115, 32, 99,108, 97,117,115,
+  101,115, 32,105,110, 32,105,116,115, 10, 45, 45, 32,100, 98, 32,102,105,
+  101,108,100, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
+  111,110, 32,109, 97,107,101, 95, 98,117, 99,107,101,116, 40, 41, 10, 32,
+   32, 32,114,101,116,117,114,110, 32,123,110, 32, 61, 32, 48, 44, 32, 99,
+  108, 97,117,115,101,115, 32, 61, 32,123,125,125, 10,101,110,100, 10, 10,
+  108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,105,110,100,
+  101,120, 95, 99,108, 97,117,115,101, 40,105,110,100,101,120, 44, 32,105,
+  100, 44, 32, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,108,111, 99, 97,
+  108, 32,104,101, 97,100, 32, 61, 32, 99,108, 97,117,115,101, 46,104,101,
+   97,100, 10, 32, 32, 32,105,110,100,101,120, 46,110, 32, 61, 32,105,110,
+  100,101,120, 46,110, 32, 43, 32, 49, 10, 32, 32, 32,105,102, 32, 35, 99,
+  108, 97,117,115,101, 32, 62, 32, 48, 32,116,104,101,110, 10, 32, 32, 32,
+   32, 32, 32,105,110,100,101,120, 46,114,117,108,101,115, 32, 61, 32,105,
+  110,100,101,120, 46,114,117,108,101,115, 32, 43, 32, 49, 10, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,104,101,
+   97,100, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,
+  116,101,114,109, 32, 61, 32,104,101, 97,100, 91,105, 93, 10, 32, 32, 32,
+   32, 32, 32,108,111, 99, 97,108, 32,112,111,115, 32, 61, 32,105,110,100,
+  101,120, 91,105, 93, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,
+   98,117, 99,107,101,116, 10, 32, 32, 32, 32, 32, 32,105,102, 32,116,101,
+  114,109, 58,105,115, 95, 99,111,110,115,116, 40, 41, 32,116,104,101,110,
+   10,  9, 32, 98,117, 99,107,101,116, 32, 61, 32,112,111,115, 46, 99,111,
+  110,115,116,115, 91,116,101,114,109, 93, 10,  9, 32,105,102, 32,110,111,
+  116, 32, 98,117, 99,107,101,116, 32,116,104,101,110, 10,  9, 32, 32, 32,
+   32, 98,117, 99,107,101,116, 32, 61, 32,109, 97,107,101, 95, 98,117, 99,
+  107,101,116, 40, 41, 10,  9, 32, 32, 32, 32,112,111,115, 46, 99,111,110,
+  115,116,115, 91,116,101,114,109, 93, 32, 61, 32, 98,117, 99,107,101,116,
+   10,  9, 32, 32, 32, 32,112,111,115, 46,100,105,115,116,105,110, 99,116,
+   32, 61, 32,112,111,115, 46,100,105,115,116,105,110, 99,116, 32, 43, 32,
+   49, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,108,115,101,
+   10,  9, 32, 98,117, 99,107,101,116, 32, 61, 32,112,111,115, 46,118, 97,
+  114,115, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32,
+   32,105,102, 32,110,111,116, 32, 98,117, 99,107,101,116, 46, 99,108, 97,
+  117,115,101,115, 91,105,100, 93, 32,116,104,101,110, 10,  9, 32, 98,117,
+   99,107,101,116, 46,110, 32, 61, 32, 98,117, 99,107,101,116, 46,110, 32,
+   43, 32, 49, 10,  9, 32, 98,117, 99,107,101,116, 46, 99,108, 97,117,115,
+  101,115, 91,105,100, 93, 32, 61, 32, 99,108, 97,117,115,101, 10, 32, 32,
+   32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10,101,110,100,
+   10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,117,
+  110,105,110,100,101,120, 95, 99,108, 97,117,115,101, 40,105,110,100,101,
+  120, 44, 32,105,100, 44, 32, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32,104,101, 97,100, 32, 61, 32, 99,108, 97,117,115,
+  101, 46,104,101, 97,100, 10, 32, 32, 32,105,110,100,101,120, 46,110, 32,
+   61, 32,105,110,100,101,120, 46,110, 32, 45, 32, 49, 10, 32, 32, 32,105,
+  102, 32, 35, 99,108, 97,117,115,101, 32, 62, 32, 48, 32,116,104,101,110,
+   10, 32, 32, 32, 32, 32, 32,105,110,100,101,120, 46,114,117,108,101,115,
+   32, 61, 32,105,110,100,101,120, 46,114,117,108,101,115, 32, 45, 32, 49,
+   10, 32, 32, 32,101,110,100, 10, 32, 32, 32,102,111,114, 32,105, 61, 49,
+   44, 35,104,101, 97,100, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111,
+   99, 97,108, 32,116,101,114,109, 32, 61, 32,104,101, 97,100, 91,105, 93,
+   10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,112,111,115, 32, 61,
+   32,105,110,100,101,120, 91,105, 93, 10, 32, 32, 32, 32, 32, 32,108,111,
+   99, 97,108, 32, 98,117, 99,107,101,116, 10, 32, 32, 32, 32, 32, 32,105,
+  102, 32,116,101,114,109, 58,105,115, 95, 99,111,110,115,116, 40, 41, 32,
+  116,104,101,110, 10,  9, 32, 98,117, 99,107,101,116, 32, 61, 32,112,111,
+  115, 46, 99,111,110,115,116,115, 91,116,101,114,109, 93, 10, 32, 32, 32,
+   32, 32, 32,101,108,115,101, 10,  9, 32, 98,117, 99,107,101,116, 32, 61,
+   32,112,111,115, 46,118, 97,114,115, 10, 32, 32, 32, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32, 32, 32, 32,105,102, 32, 98,117, 99,107,101,116, 32,
+   97,110,100, 32, 98,117, 99,107,101,116, 46, 99,108, 97,117,115,101,115,
+   91,105,100, 93, 32,116,104,101,110, 10,  9, 32, 98,117, 99,107,101,116,
+   46,110, 32, 61, 32, 98,117, 99,107,101,116, 46,110, 32, 45, 32, 49, 10,
+    9, 32, 98,117, 99,107,101,116, 46, 99,108, 97,117,115,101,115, 91,105,
+  100, 93, 32, 61, 32,110,105,108, 10,  9, 32,105,102, 32, 98,117, 99,107,
+  101,116, 46,110, 32, 61, 61, 32, 48, 32, 97,110,100, 32, 98,117, 99,107,
+  101,116, 32,126, 61, 32,112,111,115, 46,118, 97,114,115, 32,116,104,101,
+  110, 10,  9, 32, 32, 32, 32,112,111,115, 46, 99,111,110,115,116,115, 91,
+  116,101,114,109, 93, 32, 61, 32,110,105,108, 10,  9, 32, 32, 32, 32,112,
+  111,115, 46,100,105,115,116,105,110, 99,116, 32, 61, 32,112,111,115, 46,
+  100,105,115,116,105,110, 99,116, 32, 45, 32, 49, 10,  9, 32,101,110,100,
+   10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10,
+  101,110,100, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,
+  110, 32,103,101,116, 95,105,110,100,101,120, 40,115,116,111,114,101, 44,
+   32, 97,114,105,116,121, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,105,
+  110,100,101,120, 32, 61, 32,115,116,111,114,101, 46,105,110,100,101,120,
+   10, 32, 32, 32,105,102, 32,110,111,116, 32,105,110,100,101,120, 32,116,
+  104,101,110, 10, 32, 32, 32, 32, 32, 32,105,110,100,101,120, 32, 61, 32,
+  123,110, 32, 61, 32, 48, 44, 32,114,117,108,101,115, 32, 61, 32, 48,125,
+   10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 97,114,105,
+  116,121, 32,100,111, 10,  9, 32,105,110,100,101,120, 91,105, 93, 32, 61,
+   32,123, 99,111,110,115,116,115, 32, 61, 32,123,125, 44, 32,118, 97,114,
+  115, 32, 61, 32,109, 97,107,101, 95, 98,117, 99,107,101,116, 40, 41, 44,
+   32,100,105,115,116,105,110, 99,116, 32, 61, 32, 48,125, 10, 32, 32, 32,
+   32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,
+  100, 44, 99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,114,115, 40,
+  115,116,111,114,101, 46,100, 98, 41, 32,100,111, 10,  9, 32,105,110,100,
+  101,120, 95, 99,108, 97,117,115,101, 40,105,110,100,101,120, 44, 32,105,
+  100, 44, 32, 99,108, 97,117,115,101, 41, 10, 32, 32, 32, 32, 32, 32,101,
+  110,100, 10, 32, 32, 32, 32, 32, 32,115,116,111,114,101, 46,105,110,100,
+  101,120, 32, 61, 32,105,110,100,101,120, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,114,101,116,117,114,110, 32,105,110,100,101,120, 10,101,110,
+  100, 10, 10, 45, 45, 32, 82,101,116,117,114,110,115, 32,116,104,101, 32,
+   98,117, 99,107,101,116,115, 32,104,111,108,100,105,110,103, 32,101,118,
+  101,114,121, 32, 99,108, 97,117,115,101, 32,116,104, 97,116, 32,109,105,
+  103,104,116, 32,109, 97,116, 99,104, 32, 97, 10, 45, 45, 32,108,105,116,
+  101,114, 97,108, 44, 32,111,114, 32,110,105,108, 32,119,104,101,110, 32,
+  116,104,101, 32,108,105,116,101,114, 97,108, 32,104, 97,115, 32,110,111,
+   32, 99,111,110,115,116, 97,110,116, 32, 97,114,103,117,109,101,110,116,
+  115, 46, 10, 10,108,111, 99, 97,108, 32,110,111, 95, 98,117, 99,107,101,
+  116, 32, 61, 32,109, 97,107,101, 95, 98,117, 99,107,101,116, 40, 41, 10,
+   10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32, 99, 97,
+  110,100,105,100, 97,116,101,115, 40,108,105,116,101,114, 97,108, 44, 32,
+  115,116,111,114,101, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32, 98,101,
+  115,116, 44, 32,118, 97,114,115, 10, 32, 32, 32,108,111, 99, 97,108, 32,
+  115,105,122,101, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,108,
+  105,116,101,114, 97,108, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111,
+   99, 97,108, 32,116,101,114,109, 32, 61, 32,108,105,116,101,114, 97,108,
+   91,105, 93, 10, 32, 32, 32, 32, 32, 32,105,102, 32,116,101,114,109, 58,
+  105,115, 95, 99,111,110,115,116, 40, 41, 32,116,104,101,110, 10,  9, 32,
+  108,111, 99, 97,108, 32,112,111,115, 32, 61, 32,103,101,116, 95,105,110,
+  100,101,120, 40,115,116,111,114,101, 44, 32, 35,108,105,116,101,114, 97,
+  108, 41, 91,105, 93, 10,  9, 32,108,111, 99, 97,108, 32, 98,117, 99,107,
+  101,116, 32, 61, 32,112,111,115, 46, 99,111,110,115,116,115, 91,116,101,
+  114,109, 93, 32,111,114, 32,110,111, 95, 98,117, 99,107,101,116, 10,  9,
+   32,108,111, 99, 97,108, 32,110, 32, 61, 32, 98,117, 99,107,101,116, 46,
+  110, 32, 43, 32,112,111,115, 46,118, 97,114,115, 46,110, 10,  9, 32,105,
+  102, 32,110,111,116, 32,115,105,122,101, 32,111,114, 32,110, 32, 60, 32,
+  115,105,122,101, 32,116,104,101,110, 10,  9, 32, 32, 32, 32, 98,101,115,
+  116, 44, 32,118, 97,114,115, 44, 32,115,105,122,101, 32, 61, 32, 98,117,
+   99,107,101,116, 44, 32,112,111,115, 46,118, 97,114,115, 44, 32,110, 10,
+    9, 32, 32, 32, 32,105,102, 32,110, 32, 61, 61, 32, 48, 32,116,104,101,
+  110, 10,  9, 32, 32, 32, 32, 32, 32, 32, 98,114,101, 97,107, 10,  9, 32,
+   32, 32, 32,101,110,100, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32,
+   32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,
+  117,114,110, 32, 98,101,115,116, 44, 32,118, 97,114,115, 10,101,110,100,
+   10, 10, 45, 45, 32, 70, 65, 67, 84, 32, 83, 84, 79, 82, 69, 83, 10, 10,
+   45, 45, 32, 84,104,101, 32,103,114,111,117,110,100, 32,102, 97, 99,116,
+  115, 32,111,102, 32, 97, 32,112,114,101,100,105, 99, 97,116,101, 44, 32,
+   97,110,100, 32,111,102, 32, 97, 32,109, 97,116,101,114,105, 97,108,105,
+  122,101,100, 32,118,105,101,119, 44, 32, 97,114,101, 10, 45, 45, 32,104,
+  101,108,100, 32, 98,121, 32, 97, 32,102, 97, 99,116, 32,115,116,111,114,
+  101, 46, 32, 32, 87,104,101,110, 32,108,111, 97,100,101,100, 32, 98,121,
+   32,116,104,101, 32, 67, 32,108,105, 98,114, 97,114,121, 44, 32, 97, 32,
+  115,116,111,114,101, 32,107,101,101,112,115, 10, 45, 45, 32,101, 97, 99,
+  104, 32, 97,114,103,117,109,101,110,116, 32,112,111,115,105,116,105,111,
+  110, 32, 97,115, 32, 97, 32, 99,111,108,117,109,110, 32,111,102, 32,116,
+  104,101, 32,115,121,109, 98,111,108,115, 32,111,102, 32,116,104,101, 32,
+   99,111,110,115,116, 97,110,116,115, 10, 45, 45, 32, 97,116, 32,116,104,
+   97,116, 32,112,111,115,105,116,105,111,110, 44, 32,119,105,116,104, 32,
+   97, 32,104, 97,115,104, 32,116, 97, 98,108,101, 32,116,111, 32,114,101,
+  109,111,118,101, 32,100,117,112,108,105, 99, 97,116,101,115, 44, 32, 97,
+  110,100, 32, 97,110, 10, 45, 45, 32,105,110,100,101,120, 32,111,110, 32,
+   97, 32, 99,111,108,117,109,110, 32, 98,117,105,108,116, 32,116,104,101,
+   32,102,105,114,115,116, 32,116,105,109,101, 32, 97, 32, 99,111,110,115,
+  116, 97,110,116, 32, 97,116, 32,116,104,101, 32,112,111,115,105,116,105,
+  111,110, 10, 45, 45, 32,105,115, 32,115,101, 97,114, 99,104,101,100, 32,
+   40,115,101,101, 32,102, 97, 99,116,115,116,111,114,101, 46, 99, 41, 46,
+   32, 32, 84,104,105,115, 32,116, 97,107,101,115, 32, 97, 32,102,101,119,
+   32, 98,121,116,101,115, 32,112,101,114, 32,102, 97, 99,116, 44, 10, 45,
+   45, 32,119,104,101,114,101, 32, 97, 32,102, 97, 99,116, 32,115,116,111,
+  114,101,100, 32, 97,115, 32, 97, 32, 99,108, 97,117,115,101, 32,116, 97,
+  107,101,115, 32,115,101,118,101,114, 97,108, 32,116, 97, 98,108,101,115,
+   32, 97,110,100, 32, 97, 32,107,101,121, 46, 10, 10, 45, 45, 32, 65, 32,
+  115,116,111,114,101, 32,104, 97,110,100,115, 32, 98, 97, 99,107, 32,116,
+  104,101, 32,102, 97, 99,116,115, 32,105,116, 32,102,105,110,100,115, 32,
+   97,115, 32,110,101,119, 32,108,105,116,101,114, 97,108,115, 44, 32, 98,
+  117,105,108,116, 32,102,114,111,109, 10, 45, 45, 32,116,104,101, 32, 99,
+  111,110,115,116, 97,110,116,115, 32,111,102, 32,116,104,101, 32,115,121,
+  109, 98,111,108,115, 32,105,110, 32,116,104,101,105,114, 32, 99,111,108,
+  117,109,110,115, 46, 32, 32, 84,104,101, 32,116, 97, 98,108,101, 32, 98,
+  101,108,111,119, 10, 45, 45, 32,109, 97,112,115, 32,116,104,101, 32,115,
+  121,109, 98,111,108, 32,111,102, 32,101,118,101,114,121, 32, 99,111,110,
+  115,116, 97,110,116, 32,115,116,111,114,101,100, 32,116,111, 32,116,104,
+  101, 32, 99,111,110,115,116, 97,110,116, 44, 32,115,111, 32,105,116, 10,
+   45, 45, 32,107,101,101,112,115, 32,116,104,111,115,101, 32, 99,111,110,
+  115,116, 97,110,116,115, 32, 97,108,105,118,101, 46, 32, 32, 82,101,116,
+  114, 97, 99,116,105,110,103, 32, 97, 32,102, 97, 99,116, 32,108,101, 97,
+  118,101,115, 32,105,116,115, 10, 45, 45, 32, 99,111,110,115,116, 97,110,
+  116,115, 32,105,110, 32,116,104,101, 32,116, 97, 98,108,101, 44, 32,115,
+  111, 32,116,104,101, 32,116, 97, 98,108,101, 32,105,115, 32,115,119,101,
+  112,116, 32,102,114,111,109, 32,116,105,109,101, 32,116,111, 32,116,105,
+  109,101, 44, 32, 97,115, 10, 45, 45, 32,100,101,115, 99,114,105, 98,101,
+  100, 32, 97,102,116,101,114, 32,116,104,101, 32,115,116,111,114,101,115,
+   46, 10, 10,108,111, 99, 97,108, 32, 99,111,110,115,116, 95,111,102, 95,
+  115,121,109, 32, 61, 32,123,125, 10, 10, 45, 45, 32, 79,116,104,101,114,
+  119,105,115,101, 44, 32,116,104,101, 32,115,116,111,114,101, 32, 98,101,
+  108,111,119, 32,104, 97,115, 32,116,104,101, 32,115, 97,109,101, 32,109,
+  101,116,104,111,100,115, 44, 32, 97,110,100, 32,107,101,101,112,115, 32,
+  116,104,101, 10, 45, 45, 32,102, 97, 99,116,115, 32, 97,115, 32, 99,108,
+   97,117,115,101,115, 32,119,105,116,104,111,117,116, 32, 97, 32, 98,111,
+  100,121, 44, 32,105,110,100,101,120,101,100, 32, 97,115, 32, 97, 98,111,
+  118,101, 46, 10, 10,108,111, 99, 97,108, 32, 70, 97, 99,116,115, 32, 61,
+   32,123,125, 10, 70, 97, 99,116,115, 46, 95, 95,105,110,100,101,120, 32,
+   61, 32, 70, 97, 99,116,115, 10, 10,108,111, 99, 97,108, 32,102,117,110,
+   99,116,105,111,110, 32,109, 97,107,101, 95,102, 97, 99,116,115, 40, 97,
+  114,105,116,121, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,115,101,
+  116,109,101,116, 97,116, 97, 98,108,101, 40,123, 97,114,105,116,121, 32,
+   61, 32, 97,114,105,116,121, 44, 32,110, 32, 61, 32, 48, 44, 32,100, 98,
+   32, 61, 32,123,125,125, 44, 32, 70, 97, 99,116,115, 41, 10,101,110,100,
+   10, 10,102,117,110, 99,116,105,111,110, 32, 70, 97, 99,116,115, 58, 97,
+  100,100, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,108,111, 99,
+   97,108, 32,105,100, 32, 61, 32,103,101,116, 95,105,100, 40,108,105,116,
+  101,114, 97,108, 41, 10, 32, 32, 32,105,102, 32,115,101,108,102, 46,100,
+   98, 91,105,100, 93, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,
+  101,116,117,114,110, 32,102, 97,108,115,101, 10, 32, 32, 32,101,110,100,
+   10, 32, 32, 32,108,111, 99, 97,108, 32, 99,108, 97,117,115,101, 32, 61,
+   32,123,104,101, 97,100, 32, 61, 32,108,105,116,101,114, 97,108,125, 10,
+   32, 32, 32,115,101,108,102, 46,100, 98, 91,105,100, 93, 32, 61, 32, 99,
+  108, 97,117,115,101, 10, 32, 32, 32,115,101,108,102, 46,110, 32, 61, 32,
+  115,101,108,102, 46,110, 32, 43, 32, 49, 10, 32, 32, 32,105,102, 32,115,
+  101,108,102, 46,105,110,100,101,120, 32,116,104,101,110, 10, 32, 32, 32,
+   32, 32, 32,105,110,100,101,120, 95, 99,108, 97,117,115,101, 40,115,101,
+  108,102, 46,105,110,100,101,120, 44, 32,105,100, 44, 32, 99,108, 97,117,
+  115,101, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,
+  114,110, 32,116,114,117,101, 10,101,110,100, 10, 10,102,117,110, 99,116,
+  105,111,110, 32, 70, 97, 99,116,115, 58,114,101,109,111,118,101, 40,108,
+  105,116,101,114, 97,108, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,105,
+  100, 32, 61, 32,103,101,116, 95,105,100, 40,108,105,116,101,114, 97,108,
+   41, 10, 32, 32, 32,108,111, 99, 97,108, 32, 99,108, 97,117,115,101, 32,
+   61, 32,115,101,108,102, 46,100, 98, 91,105,100, 93, 10, 32, 32, 32,105,
+  102, 32,110,111,116, 32, 99,108, 97,117,115,101, 32,116,104,101,110, 10,
+   32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,102, 97,108,115,101,
+   10, 32, 32, 32,101,110,100, 10, 32, 32, 32,115,101,108,102, 46,100, 98,
+   91,105,100, 93, 32, 61, 32,110,105,108, 10, 32, 32, 32,115,101,108,102,
+   46,110, 32, 61, 32,115,101,108,102, 46,110, 32, 45, 32, 49, 10, 32, 32,
+   32,105,102, 32,115,101,108,102, 46,105,110,100,101,120, 32,116,104,101,
+  110, 10, 32, 32, 32, 32, 32, 32,117,110,105,110,100,101,120, 95, 99,108,
+   97,117,115,101, 40,115,101,108,102, 46,105,110,100,101,120, 44, 32,105,
+  100, 44, 32, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,114,101,116,117,114,110, 32,116,114,117,101, 10,101,110,100,
+   10, 10,102,117,110, 99,116,105,111,110, 32, 70, 97, 99,116,115, 58,104,
+   97,115, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,114,101,116,
+  117,114,110, 32,115,101,108,102, 46,100, 98, 91,103,101,116, 95,105,100,
+   40,108,105,116,101,114, 97,108, 41, 93, 32,126, 61, 32,110,105,108, 10,
+  101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 70, 97, 99,116,
+  115, 58, 99,111,117,110,116, 40, 41, 10, 32, 32, 32,114,101,116,117,114,
+  110, 32,115,101,108,102, 46,110, 10,101,110,100, 10, 10,102,117,110, 99,
+  116,105,111,110, 32, 70, 97, 99,116,115, 58,100,105,115,116,105,110, 99,
+  116, 40,105, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,103,101,116,
+   95,105,110,100,101,120, 40,115,101,108,102, 44, 32,115,101,108,102, 46,
+   97,114,105,116,121, 41, 91,105, 93, 46,100,105,115,116,105,110, 99,116,
+   10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 70, 97, 99,
+  116,115, 58,115,101, 97,114, 99,104, 40,108,105,116,101,114, 97,108, 41,
+   10, 32, 32, 32,108,111, 99, 97,108, 32,102,111,117,110,100, 32, 61, 32,
+  123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32, 99,111,110,115,116,115,
+   32, 61, 32, 99, 97,110,100,105,100, 97,116,101,115, 40,108,105,116,101,
+  114, 97,108, 44, 32,115,101,108,102, 41, 10, 32, 32, 32,102,111,114, 32,
+  105,100, 44, 99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,114,115,
+   40, 99,111,110,115,116,115, 32, 97,110,100, 32, 99,111,110,115,116,115,
+   46, 99,108, 97,117,115,101,115, 32,111,114, 32,115,101,108,102, 46,100,
+   98, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,105,102, 32,117,110,105,
+  102,121, 40,108,105,116,101,114, 97,108, 44, 32, 99,108, 97,117,115,101,
+   46,104,101, 97,100, 41, 32,116,104,101,110, 10,  9, 32,116, 97, 98,108,
+  101, 46,105,110,115,101,114,116, 40,102,111,117,110,100, 44, 32, 99,108,
+   97,117,115,101, 46,104,101, 97,100, 41, 10, 32, 32, 32, 32, 32, 32,101,
+  110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,
+  110, 32,102,111,117,110,100, 10,101,110,100, 10, 10,102,117,110, 99,116,
+  105,111,110, 32, 70, 97, 99,116,115, 58, 99,111,112,121, 40, 41, 10, 32,
+   32, 32,108,111, 99, 97,108, 32,102, 97, 99,116,115, 32, 61, 32,109, 97,
+  107,101, 95,102, 97, 99,116,115, 40,115,101,108,102, 46, 97,114,105,116,
+  121, 41, 10, 32, 32, 32,102,111,114, 32,105,100, 44, 99,108, 97,117,115,
+  101, 32,105,110, 32,112, 97,105,114,115, 40,115,101,108,102, 46,100, 98,
+   41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,102, 97, 99,116,115, 46,100,
+   98, 91,105,100, 93, 32, 61, 32, 99,108, 97,117,115,101, 10, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,102, 97, 99,116,115, 46,110, 32, 61, 32,115,
+  101,108,102, 46,110, 10, 32, 32, 32,114,101,116,117,114,110, 32,102, 97,
+   99,116,115, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,
+   70, 97, 99,116,115, 58,109, 97,114,107, 40,109, 97,114,107,115, 41, 10,
+   32, 32, 32,102,111,114, 32,105,100, 44, 99,108, 97,117,115,101, 32,105,
+  110, 32,112, 97,105,114,115, 40,115,101,108,102, 46,100, 98, 41, 32,100,
+  111, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35, 99,
+  108, 97,117,115,101, 46,104,101, 97,100, 32,100,111, 10,  9, 32,109, 97,
+  114,107,115, 91, 99,108, 97,117,115,101, 46,104,101, 97,100, 91,105, 93,
+   46,115,121,109, 93, 32, 61, 32,116,114,117,101, 10, 32, 32, 32, 32, 32,
+   32,101,110,100, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,105,
+  102, 32,100,108, 95,102, 97, 99,116,115,116,111,114,101, 32,116,104,101,
+  110, 10, 32, 32, 32,109, 97,107,101, 95,102, 97, 99,116,115, 32, 61, 32,
+  100,108, 95,102, 97, 99,116,115,116,111,114,101, 10,101,110,100, 10, 10,
+   45, 45, 32, 83,119,101,101,112,105,110,103, 32,116,104,101, 32,116, 97,
+   98,108,101, 32,111,102, 32, 99,111,110,115,116, 97,110,116,115, 32,111,
+  102, 32,115,116,111,114,101,100, 32,115,121,109, 98,111,108,115, 46, 32,
+   32, 69,118,101,114,121, 32,115,116,111,114,101, 32,116,104, 97,116, 10,
+   45, 45, 32, 99, 97,110, 32,115,116,105,108,108, 32, 98,101, 32,115,101,
+   97,114, 99,104,101,100, 32,105,115, 32,114,101, 97, 99,104,101,100, 32,
+  102,114,111,109, 32, 97, 32,112,114,101,100,105, 99, 97,116,101, 44, 32,
+  105,116,115, 32,118,105,101,119, 44, 32,111,114, 32,116,104,101, 10, 45,
+   45, 32,115,116, 97,116,101,115, 32,115, 97,118,101,100, 32, 98,121, 32,
+   97, 32,115,110, 97,112,115,104,111,116, 32,116,104, 97,116, 32,105,115,
+   32, 97,108,105,118,101, 44, 32,115,111, 32,116,104,101, 32,115,110, 97,
+  112,115,104,111,116,115, 32, 97,114,101, 32,107,101,112,116, 10, 45, 45,
+   32,105,110, 32, 97, 32,116, 97, 98,108,101, 32,119,105,116,104, 32,119,
+  101, 97,107, 32,107,101,121,115, 46, 32, 32, 65, 32,115,119,101,101,112,
+   32,109, 97,114,107,115, 32,116,104,101, 32,115,121,109, 98,111,108,115,
+   32,105,110, 32,116,104,101, 32,114,111,119,115, 32,111,102, 10, 45, 45,
+   32,116,104,111,115,101, 32,115,116,111,114,101,115, 44, 32, 97,110,100,
+   32,100,114,111,112,115, 32,116,104,101, 32,111,116,104,101,114, 32,115,
+  121,109, 98,111,108,115, 32,102,114,111,109, 32,116,104,101, 32,116, 97,
+   98,108,101, 46, 32, 32, 84,104,101, 10, 45, 45, 32, 99,111,110,115,116,
+   97,110,116,115, 32,111,102, 32,115,121,109, 98,111,108,115, 32,116,104,
+   97,116, 32, 97,114,101, 32,100,114,111,112,112,101,100, 32, 98,117,116,
+   32,115,116,105,108,108, 32,105,110, 32,117,115,101, 32,101,108,115,101,
+  119,104,101,114,101, 10, 45, 45, 32,107,101,101,112, 32,116,104,101,105,
+  114, 32,115,121,109, 98,111,108,115, 44, 32, 97,110,100, 32, 97,114,101,
+   32,112,117,116, 32, 98, 97, 99,107, 32,119,104,101,110, 32,115,116,111,
+  114,101,100, 32, 97,103, 97,105,110, 46, 32, 32, 65, 32,115,119,101,101,
+  112, 10, 45, 45, 32,116, 97,107,101,115, 32,116,105,109,101, 32,105,110,
+   32,116,104,101, 32,110,117,109, 98,101,114, 32,111,102, 32,114,111,119,
+  115, 44, 32,115,111, 32,111,110,101, 32,105,115, 32,109, 97,100,101, 32,
+  119,104,101,110, 32,116,104,101, 32,102, 97, 99,116,115, 10, 45, 45, 32,
+   97,100,100,101,100, 32,115,105,110, 99,101, 32,116,104,101, 32,108, 97,
+  115,116, 32,111,117,116,110,117,109, 98,101,114, 32,116,104,101, 32,114,
+  111,119,115, 32,105,116, 32,109, 97,114,107,101,100, 46, 10, 10,108,111,
+   99, 97,108, 32,115,110, 97,112,115,104,111,116,115, 32, 61, 32,115,101,
+  116,109,101,116, 97,116, 97, 98,108,101, 40,123,125, 44, 32,123, 95, 95,
+  109,111,100,101, 32, 61, 32, 34,107, 34,125, 41, 10, 10,108,111, 99, 97,
+  108, 32, 99,111,110,115,116, 95, 97,100,100,115, 32, 61, 32, 48,  9,  9,
+   45, 45, 32, 70, 97, 99,116,115, 32, 97,100,100,101,100, 32,115,105,110,
+   99,101, 32,116,104,101, 32,108, 97,115,116, 32,115,119,101,101,112, 46,
+   10,108,111, 99, 97,108, 32, 99,111,110,115,116, 95,115,119,101,101,112,
+   32, 61, 32, 49, 48, 50, 52,  9, 45, 45, 32, 70, 97, 99,116,115, 32, 97,
+  100,100,101,100, 32,116,104, 97,116, 32, 99, 97,117,115,101, 32, 97, 32,
+  115,119,101,101,112, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,
+  116,105,111,110, 32,109, 97,114,107, 95,115,116,111,114,101,115, 40,109,
+   97,114,107,115, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,114,111,119,
+  115, 32, 61, 32, 48, 10, 32, 32, 32,108,111, 99, 97,108, 32,102,117,110,
+   99,116,105,111,110, 32,109, 97,114,107, 40,102, 97, 99,116,115, 41, 10,
+   32, 32, 32, 32, 32, 32,105,102, 32,102, 97, 99,116,115, 32,116,104,101,
+  110, 10,  9, 32,102, 97, 99,116,115, 58,109, 97,114,107, 40,109, 97,114,
+  107,115, 41, 10,  9, 32,114,111,119,115, 32, 61, 32,114,111,119,115, 32,
+   43, 32,102, 97, 99,116,115, 58, 99,111,117,110,116, 40, 41, 10, 32, 32,
+   32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  102,111,114, 32,110, 97,109,101, 44, 97,114,105,116,105,101,115, 32,105,
+  110, 32,112, 97,105,114,115, 40,112,114,101,100, 95,110, 97,109,101,115,
+   41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32, 97,114,105,
+  116,121, 44,112,114,101,100, 32,105,110, 32,112, 97,105,114,115, 40, 97,
+  114,105,116,105,101,115, 41, 32,100,111, 10,  9, 32,109, 97,114,107, 40,
+  112,114,101,100, 46,102, 97, 99,116,115, 41, 10,  9, 32,109, 97,114,107,
+   40,112,114,101,100, 46,118,105,101,119, 32, 97,110,100, 32,112,114,101,
+  100, 46,118,105,101,119, 46,102, 97, 99,116,115, 41, 10, 32, 32, 32, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,102,111,
+  114, 32,115,110, 97,112, 32,105,110, 32,112, 97,105,114,115, 40,115,110,
+   97,112,115,104,111,116,115, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,
+  102,111,114, 32,112,114,101,100, 44,115,116, 97,116,101, 32,105,110, 32,
+  112, 97,105,114,115, 40,115,110, 97,112, 46,115, 97,118,101,100, 41, 32,
+  100,111, 10,  9, 32,109, 97,114,107, 40,115,116, 97,116,101, 46,102, 97,
+   99,116,115, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,114,111,119,115,
+   10,101,110,100, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
+  111,110, 32,115,119,101,101,112, 95, 99,111,110,115,116,115, 40, 41, 10,
+   32, 32, 32,105,102, 32, 99,111,110,115,116, 95, 97,100,100,115, 32, 60,
+   32, 99,111,110,115,116, 95,115,119,101,101,112, 32,116,104,101,110, 10,
+   32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 10, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32,108,111, 99, 97,108, 32,109, 97,114,107,115, 32, 61,
+   32,123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32,114,111,119,115, 32,
+   61, 32,109, 97,114,107, 95,115,116,111,114,101,115, 40,109, 97,114,107,
+  115, 41, 10, 32, 32, 32,102,111,114, 32,115,121,109, 32,105,110, 32,112,
+   97,105,114,115, 40, 99,111,110,115,116, 95,111,102, 95,115,121,109, 41,
+   32,100,111, 10, 32, 32, 32, 32, 32, 32,105,102, 32,110,111,116, 32,109,
+   97,114,107,115, 91,115,121,109, 93, 32,116,104,101,110, 10,  9, 32, 99,
+  111,110,115,116, 95,111,102, 95,115,121,109, 91,115,121,109, 93, 32, 61,
+   32,110,105,108, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32, 99,111,110,115,116, 95, 97,100,100,115, 32,
+   61, 32, 48, 10, 32, 32, 32, 99,111,110,115,116, 95,115,119,101,101,112,
+   32, 61, 32,114,111,119,115, 32, 43, 32, 49, 48, 50, 52, 10,101,110,100,
+   10, 10, 45, 45, 32, 65,100,100,115, 32, 97, 32,102, 97, 99,116, 32,116,
+  111, 32, 97, 32,115,116,111,114,101, 44, 32, 99,111,117,110,116,105,110,
+  103, 32,105,116, 32,116,111,119, 97,114,100, 32,116,104,101, 32,110,101,
+  120,116, 32,115,119,101,101,112, 46, 10, 10,108,111, 99, 97,108, 32,102,
+  117,110, 99,116,105,111,110, 32, 97,100,100, 95,102, 97, 99,116, 40,102,
+   97, 99,116,115, 44, 32,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,
+  105,102, 32,102, 97, 99,116,115, 58, 97,100,100, 40,108,105,116,101,114,
+   97,108, 44, 32, 99,111,110,115,116, 95,111,102, 95,115,121,109, 41, 32,
+  116,104,101,110, 10, 32, 32, 32, 32, 32, 32, 99,111,110,115,116, 95, 97,
+  100,100,115, 32, 61, 32, 99,111,110,115,116, 95, 97,100,100,115, 32, 43,
+   32, 49, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,116,114,
+  117,101, 10, 32, 32, 32,101,108,115,101, 10, 32, 32, 32, 32, 32, 32,114,
+  101,116,117,114,110, 32,102, 97,108,115,101, 10, 32, 32, 32,101,110,100,
+   10,101,110,100, 10, 10, 45, 45, 32, 66, 79, 68, 89, 32, 79, 82, 68, 69,
+   82, 73, 78, 71, 10, 10, 45, 45, 32, 84,104,101, 32,112,114,111,118,101,
+  114, 32,114,101,115,111,108,118,101,115, 32,116,104,101, 32, 98,111,100,
+  121, 32,108,105,116,101,114, 97,108,115, 32,111,102, 32, 97, 32,114,117,
+  108,101, 32,105,110, 32,111,114,100,101,114, 44, 32,115,111, 32,116,104,
+  101, 10, 45, 45, 32,108,105,116,101,114, 97,108,115, 32,111,102, 32, 97,
+   32,114,117,108,101, 32,116,104, 97,116, 32,104, 97,115, 32,106,117,115,
+  116, 32, 98,101,101,110, 32,115,101,108,101, 99,116,101,100, 32,102,111,
+  114, 32, 97, 32,115,117, 98,103,111, 97,108, 32, 97,114,101, 10, 45, 45,
+   32,114,101,111,114,100,101,114,101,100, 32,116,111, 32,114,101,115,111,
+  108,118,101, 32,116,104,101, 32,109,111,115,116, 32,115,101,108,101, 99,
+  116,105,118,101, 32,111,110,101, 32,102,105,114,115,116, 46, 32, 32, 84,
+  104,101, 32,111,114,100,101,114, 32,105,115, 10, 45, 45, 32, 99,104,111,
+  115,101,110, 32,103,114,101,101,100,105,108,121, 46, 32, 32, 84,104,101,
+   32,110,101,120,116, 32,108,105,116,101,114, 97,108, 32,105,115, 32,116,
+  104,101, 32,111,110,101, 32,101,120,112,101, 99,116,101,100, 32,116,111,
+   32,109, 97,116, 99,104, 32,116,104,101, 10, 45, 45, 32,102,101,119,101,
+  115,116, 32, 99,108, 97,117,115,101,115, 44, 32,103,105,118,101,110, 32,
+  116,104,101, 32, 99,111,110,115,116, 97,110,116,115, 32,105,110, 32,105,
+  116, 44, 32, 97,110,100, 32,116,104,101, 32,118, 97,114,105, 97, 98,108,
+  101,115, 32, 98,111,117,110,100, 10, 45, 45, 32, 98,121, 32,116,104,101,
+   32,108,105,116,101,114, 97,108,115, 32, 98,101,102,111,114,101, 32,105,
+  116, 46, 32, 32, 80,114,105,109,105,116,105,118,101,115, 32,109, 97,121,
+   32,100,101,112,101,110,100, 32,111,110, 32,116,104,101, 32,111,114,100,
+  101,114, 32,111,102, 10, 45, 45, 32,116,104,101, 32,108,105,116,101,114,
+   97,108,115, 44, 32,115,111, 32,111,110,108,121, 32,116,104,101, 32,108,
+  105,116,101,114, 97,108,115, 32, 98,101,116,119,101,101,110, 32,116,119,
+  111, 32,112,114,105,109,105,116,105,118,101,115, 32, 97,114,101, 10, 45,
+   45, 32,114,101,111,114,100,101,114,101,100, 44, 32, 97,110,100, 32,116,
+  104,101, 32, 97,110,115,119,101,114,115, 32,100,111, 32,110,111,116, 32,
+  100,101,112,101,110,100, 32,111,110, 32,116,104,101, 32,111,114,100,101,
+  114, 32, 99,104,111,115,101,110, 46, 10, 10, 45, 45, 32, 65, 32,102, 97,
+   99,116, 32,109, 97,116, 99,104,105,110,103, 32, 97, 32, 99,111,110,115,
+  116, 97,110,116, 32, 97,116, 32, 97, 32,112,111,115,105,116,105,111,110,
+   32,105,115, 32,101,120,112,101, 99,116,101,100, 32,116,111, 32, 98,101,
+   32,111,110,101, 32,111,102, 10, 45, 45, 32,116,104,101, 32,102, 97, 99,
+  116,115, 32,119,105,116,104, 32,116,104, 97,116, 32, 99,111,110,115,116,
+   97,110,116, 44, 32, 97,115,115,117,109,105,110,103, 32, 99,111,110,115,
+  116, 97,110,116,115, 32, 97,114,101, 32,101,113,117, 97,108,108,121, 10,
+   45, 45, 32, 99,111,109,109,111,110, 46, 32, 32, 84,104,101, 32,102, 97,
+   99,116,115, 32,100,101,114,105,118,101,100, 32, 98,121, 32, 97, 32,114,
+  117,108,101, 32, 97,114,101, 32,117,110,107,110,111,119,110, 44, 32,115,
+  111, 32, 97, 32,114,117,108,101, 32,105,115, 10, 45, 45, 32, 97,115,115,
+  117,109,101,100, 32,116,111, 32,100,101,114,105,118,101, 32,114,117,108,
+  101, 95,102, 97, 99,116,115, 32,102, 97, 99,116,115, 44, 32,111,102, 32,
+  119,104,105, 99,104, 32, 97, 32, 98,111,117,110,100, 32, 97,114,103,117,
+  109,101,110,116, 10, 45, 45, 32,115,101,108,101, 99,116,115, 32,111,110,
+  101, 32,105,110, 32,114,117,108,101, 95,115,101,108,101, 99,116, 46, 10,
+   10,108,111, 99, 97,108, 32,114,117,108,101, 95,102, 97, 99,116,115, 32,
+   61, 32, 49, 48, 48, 10,108,111, 99, 97,108, 32,114,117,108,101, 95,115,
+  101,108,101, 99,116, 32, 61, 32, 49, 48, 10, 10,108,111, 99, 97,108, 32,
+  102,117,110, 99,116,105,111,110, 32,101,115,116,105,109, 97,116,101, 40,
+  108,105,116,101,114, 97,108, 44, 32, 98,111,117,110,100, 41, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,112,114,101,100, 32, 61, 32,108,105,116,101,
+  114, 97,108, 46,112,114,101,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,
+  115,116,111,114,101, 32, 61, 32,112,114,101,100, 46,118,105,101,119, 32,
+   97,110,100, 32,112,114,101,100, 46,118,105,101,119, 46,102, 97, 99,116,
+  115, 32,111,114, 32,112,114,101,100, 46,102, 97, 99,116,115, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,102, 97, 99,116,115, 32, 61, 32,115,116,111,
+  114,101, 32, 97,110,100, 32,115,116,111,114,101, 58, 99,111,117,110,116,
+   40, 41, 32,111,114, 32, 48, 10, 32, 32, 32,108,111, 99, 97,108, 32,114,
+  117,108,101,115, 32, 61, 32, 48, 10, 32, 32, 32,105,102, 32,110,111,116,
+   32,112,114,101,100, 46,118,105,101,119, 32,116,104,101,110, 10, 32, 32,
+   32, 32, 32, 32,114,117,108,101,115, 32, 61, 32,103,101,116, 95,105,110,
+  100,101,120, 40,112,114,101,100, 44, 32, 35,108,105,116,101,114, 97,108,
+   41, 46,114,117,108,101,115, 32, 42, 32,114,117,108,101, 95,102, 97, 99,
+  116,115, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,102,111,114, 32,105,
+   61, 49, 44, 35,108,105,116,101,114, 97,108, 32,100,111, 10, 32, 32, 32,
+   32, 32, 32,108,111, 99, 97,108, 32,116,101,114,109, 32, 61, 32,108,105,
+  116,101,114, 97,108, 91,105, 93, 10, 32, 32, 32, 32, 32, 32,105,102, 32,
+  116,101,114,109, 58,105,115, 95, 99,111,110,115,116, 40, 41, 32,111,114,
+   32, 98,111,117,110,100, 91,116,101,114,109, 93, 32,116,104,101,110, 10,
+    9, 32,105,102, 32,102, 97, 99,116,115, 32, 62, 32, 48, 32,116,104,101,
+  110, 10,  9, 32, 32, 32, 32,108,111, 99, 97,108, 32,100,105,115,116,105,
+  110, 99,116, 32, 61, 32,115,116,111,114,101, 58,100,105,115,116,105,110,
+   99,116, 40,105, 41, 10,  9, 32, 32, 32, 32,105,102, 32,100,105,115,116,
+  105,110, 99,116, 32, 62, 32, 49, 32,116,104,101,110, 10,  9, 32, 32, 32,
+   32, 32, 32, 32,102, 97, 99,116,115, 32, 61, 32,102, 97, 99,116,115, 32,
+   47, 32,100,105,115,116,105,110, 99,116, 10,  9, 32, 32, 32, 32,101,110,
+  100, 10,  9, 32,101,110,100, 10,  9, 32,114,117,108,101,115, 32, 61, 32,
+  114,117,108,101,115, 32, 47, 32,114,117,108,101, 95,115,101,108,101, 99,
+  116, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100,
+   10, 32, 32, 32,114,101,116,117,114,110, 32,102, 97, 99,116,115, 32, 43,
+   32,114,117,108,101,115, 10,101,110,100, 10, 10, 45, 45, 32, 82,101,116,
+  117,114,110,115, 32,116,104,101, 32, 99,108, 97,117,115,101, 44, 32,111,
+  114, 32, 97, 32, 99,111,112,121, 32,119,105,116,104, 32,105,116,115, 32,
+   98,111,100,121, 32,114,101,111,114,100,101,114,101,100, 46, 10, 10,108,
+  111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,114,101,111,114,
+  100,101,114, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,108,111, 99,
+   97,108, 32,110, 32, 61, 32, 35, 99,108, 97,117,115,101, 10, 32, 32, 32,
+  105,102, 32,110, 32, 60, 32, 50, 32,116,104,101,110, 10, 32, 32, 32, 32,
+   32, 32,114,101,116,117,114,110, 32, 99,108, 97,117,115,101, 10, 32, 32,
+   32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32, 98,111,117,110,
+  100, 32, 61, 32,123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32, 98,111,
+  100,121, 32, 61, 32,123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32,102,
+  105,114,115,116, 32, 61, 32, 49,  9,  9, 45, 45, 32, 84,104,101, 32,102,
+  105,114,115,116, 32,108,105,116,101,114, 97,108, 32,111,102, 32,116,104,
+  101, 32,115,101,103,109,101,110,116, 46, 10, 32, 32, 32,108,111, 99, 97,
+  108, 32, 99,104, 97,110,103,101,100, 32, 61, 32,102, 97,108,115,101, 10,
+   32, 32, 32,119,104,105,108,101, 32,102,105,114,115,116, 32, 60, 61, 32,
+  110, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,108,
+   97,115,116, 32, 61, 32,102,105,114,115,116, 10, 32, 32, 32, 32, 32, 32,
+  119,104,105,108,101, 32,108, 97,115,116, 32, 60, 61, 32,110, 32, 97,110,
+  100, 32,110,111,116, 32, 99,108, 97,117,115,101, 91,108, 97,115,116, 93,
+   46,112,114,101,100, 46,112,114,105,109, 32,100,111, 10,  9, 32,108, 97,
+  115,116, 32, 61, 32,108, 97,115,116, 32, 43, 32, 49, 10, 32, 32, 32, 32,
+   32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,
+  116,111,100,111, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32, 32,102,111,
+  114, 32,105, 61,102,105,114,115,116, 44,108, 97,115,116, 45, 49, 32,100,
+  111, 10,  9, 32,116,111,100,111, 91,105, 32, 45, 32,102,105,114,115,116,
+   32, 43, 32, 49, 93, 32, 61, 32, 99,108, 97,117,115,101, 91,105, 93, 10,
+   32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,119,104,
+  105,108,101, 32, 35,116,111,100,111, 32, 62, 32, 48, 32,100,111, 10,  9,
+   32,108,111, 99, 97,108, 32, 98,101,115,116, 44, 32, 99,111,115,116, 10,
+    9, 32,102,111,114, 32,106, 61, 49, 44, 35,116,111,100,111, 32,100,111,
+   10,  9, 32, 32, 32, 32,108,111, 99, 97,108, 32, 99, 32, 61, 32,101,115,
+  116,105,109, 97,116,101, 40,116,111,100,111, 91,106, 93, 44, 32, 98,111,
+  117,110,100, 41, 10,  9, 32, 32, 32, 32,105,102, 32,110,111,116, 32, 99,
+  111,115,116, 32,111,114, 32, 99, 32, 60, 32, 99,111,115,116, 32,116,104,
+  101,110, 10,  9, 32, 32, 32, 32, 32, 32, 32, 98,101,115,116, 44, 32, 99,
+  111,115,116, 32, 61, 32,106, 44, 32, 99, 10,  9, 32, 32, 32, 32,101,110,
+  100, 10,  9, 32,101,110,100, 10,  9, 32,108,111, 99, 97,108, 32,108,105,
+  116,101,114, 97,108, 32, 61, 32,116, 97, 98,108,101, 46,114,101,109,111,
+  118,101, 40,116,111,100,111, 44, 32, 98,101,115,116, 41, 10,  9, 32,105,
+  102, 32,108,105,116,101,114, 97,108, 32,126, 61, 32, 99,108, 97,117,115,
+  101, 91, 35, 98,111,100,121, 32, 43, 32, 49, 93, 32,116,104,101,110, 10,
+    9, 32, 32, 32, 32, 99,104, 97,110,103,101,100, 32, 61, 32,116,114,117,
+  101, 10,  9, 32,101,110,100, 10,  9, 32,116, 97, 98,108,101, 46,105,110,
+  115,101,114,116, 40, 98,111,100,121, 44, 32,108,105,116,101,114, 97,108,
+   41, 10,  9, 32,102,111,114, 32,105, 61, 49, 44, 35,108,105,116,101,114,
+   97,108, 32,100,111, 10,  9, 32, 32, 32, 32, 98,111,117,110,100, 91,108,
+  105,116,101,114, 97,108, 91,105, 93, 93, 32, 61, 32,116,114,117,101, 10,
+    9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32,
+   32, 32, 32, 32,105,102, 32,108, 97,115,116, 32, 60, 61, 32,110, 32,116,
+  104,101,110,  9,  9, 45, 45, 32, 65, 32,112,114,105,109,105,116,105,118,
+  101, 46, 10,  9, 32,108,111, 99, 97,108, 32,108,105,116,101,114, 97,108,
+   32, 61, 32, 99,108, 97,117,115,101, 91,108, 97,115,116, 93, 10,  9, 32,
+  116, 97, 98,108,101, 46,105,110,115,101,114,116, 40, 98,111,100,121, 44,
+   32,108,105,116,101,114, 97,108, 41, 10,  9, 32,102,111,114, 32,105, 61,
+   49, 44, 35,108,105,116,101,114, 97,108, 32,100,111, 10,  9, 32, 32, 32,
+   32, 98,111,117,110,100, 91,108,105,116,101,114, 97,108, 91,105, 93, 93,
+   32, 61, 32,116,114,117,101, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32,
+   32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,102,105,114,115,116, 32,
+   61, 32,108, 97,115,116, 32, 43, 32, 49, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,105,102, 32,110,111,116, 32, 99,104, 97,110,103,101,100, 32,
+  116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,
+   99,108, 97,117,115,101, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32, 98,
+  111,100,121, 46,104,101, 97,100, 32, 61, 32, 99,108, 97,117,115,101, 46,
+  104,101, 97,100, 10, 32, 32, 32,114,101,116,117,114,110, 32, 98,111,100,
+  121, 10,101,110,100, 10, 10, 45, 45, 32, 65, 78, 83, 87, 69, 82, 32, 84,
+   65, 66, 76, 69, 83, 10, 10, 45, 45, 32, 84,104,101, 32,115,117, 98,103,
+  111, 97,108,115, 32,116, 97, 98,108,101,100, 32, 98,121, 32,116,104,101,
+   32,112,114,111,118,101,114, 32, 97,114,101, 32,107,101,112,116, 32, 98,
+  101,116,119,101,101,110, 32,113,117,101,114,105,101,115, 44, 32,115,111,
+   32, 97, 10, 45, 45, 32,114,101,112,101, 97,116,101,100, 32,113,117,101,
+  114,121, 32,105,115, 32, 97,110,115,119,101,114,101,100, 32,102,114,111,
+  109, 32,105,116,115, 32,116, 97, 98,108,101, 46, 32, 32, 84, 97, 98,108,
+  101,115, 32, 97,114,101, 32,103,114,111,117,112,101,100, 32, 98,121, 10,
+   45, 45, 32,116,104,101, 32,112,114,101,100,105, 99, 97,116,101, 32,111,
+  102, 32,116,104,101,105,114, 32,115,117, 98,103,111, 97,108, 39,115, 32,
+  108,105,116,101,114, 97,108, 46, 32, 32, 87,104,101,110, 32, 97, 32, 99,
+  108, 97,117,115,101, 32,102,111,114, 32, 97, 10, 45, 45, 32,112,114,101,
+  100,105, 99, 97,116,101, 32,105,115, 32, 97,115,115,101,114,116,101,100,
+   32,111,114, 32,114,101,116,114, 97, 99,116,101,100, 44, 32,116,104,101,
+   32,116, 97, 98,108,101,115, 32,111,102, 32,116,104, 97,116, 32,112,114,
+  101,100,105, 99, 97,116,101, 10, 45, 45, 32, 97,110,100, 32,111,102, 32,
+  101,118,101,114,121, 32,112,114,101,100,105, 99, 97,116,101, 32,116,104,
+   97,116, 32,100,101,112,101,110,100,115, 32,111,110, 32,105,116, 32, 97,
+  114,101, 32,100,105,115, 99, 97,114,100,101,100, 46, 10, 10,108,111, 99,
+   97,108, 32,116, 97, 98,108,101,115, 32, 61, 32,123,125, 10, 10, 45, 45,
+   32, 84,104,101, 32,114,101,118,101,114,115,101, 32,100,101,112,101,110,
+  100,101,110, 99,105,101,115, 32,111,102, 32, 97, 32,112,114,101,100,105,
+   99, 97,116,101, 32,109, 97,112, 32,101, 97, 99,104, 32,112,114,101,100,
+  105, 99, 97,116,101, 32,119,105,116,104, 32, 97, 10, 45, 45, 32, 99,108,
+   97,117,115,101, 32,116,104, 97,116, 32,117,115,101,115, 32,105,116, 32,
+  105,110, 32,105,116,115, 32, 98,111,100,121, 32,116,111, 32,116,104,101,
+   32,110,117,109, 98,101,114, 32,111,102, 32,115,117, 99,104, 32, 99,108,
+   97,117,115,101,115, 46, 10, 10,108,111, 99, 97,108, 32,114,100,101,112,
+  115, 32, 61, 32,123,125, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,
+  116,105,111,110, 32, 97,100,100, 95,114,100,101,112,115, 40, 99,108, 97,
+  117,115,101, 44, 32,100,101,108,116, 97, 41, 10, 32, 32, 32,108,111, 99,
+   97,108, 32,104,101, 97,100, 32, 61, 32, 99,108, 97,117,115,101, 46,104,
+  101, 97,100, 46,112,114,101,100, 10, 32, 32, 32,102,111,114, 32,105, 61,
+   49, 44, 35, 99,108, 97,117,115,101, 32,100,111, 10, 32, 32, 32, 32, 32,
+   32,108,111, 99, 97,108, 32,112,114,101,100, 32, 61, 32, 99,108, 97,117,
+  115,101, 91,105, 93, 46,112,114,101,100, 10, 32, 32, 32, 32, 32, 32,108,
+  111, 99, 97,108, 32,117,115,101,114,115, 32, 61, 32,114,100,101,112,115,
+   91,112,114,101,100, 93, 10, 32, 32, 32, 32, 32, 32,105,102, 32,110,111,
+  116, 32,117,115,101,114,115, 32,116,104,101,110, 10,  9, 32,117,115,101,
+  114,115, 32, 61, 32,123,125, 10,  9, 32,114,100,101,112,115, 91,112,114,
+  101,100, 93, 32, 61, 32,117,115,101,114,115, 10, 32, 32, 32, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,110, 32,
+   61, 32, 40,117,115,101,114,115, 91,104,101, 97,100, 93, 32,111,114, 32,
+   48, 41, 32, 43, 32,100,101,108,116, 97, 10, 32, 32, 32, 32, 32, 32,105,
+  102, 32,110, 32, 62, 32, 48, 32,116,104,101,110, 10,  9, 32,117,115,101,
+  114,115, 91,104,101, 97,100, 93, 32, 61, 32,110, 10, 32, 32, 32, 32, 32,
+   32,101,108,115,101, 10,  9, 32,117,115,101,114,115, 91,104,101, 97,100,
+   93, 32, 61, 32,110,105,108, 10,  9, 32,105,102, 32,110,111,116, 32,110,
+  101,120,116, 40,117,115,101,114,115, 41, 32,116,104,101,110, 10,  9, 32,
+   32, 32, 32,114,100,101,112,115, 91,112,114,101,100, 93, 32, 61, 32,110,
+  105,108, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,100,
+   10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,108,111, 99, 97,108,
+   32,102,117,110, 99,116,105,111,110, 32,105,110,118, 97,108,105,100, 97,
+  116,101, 40,112,114,101,100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,
+  115,101,101,110, 32, 61, 32,123, 91,112,114,101,100, 93, 32, 61, 32,116,
+  114,117,101,125, 10, 32, 32, 32,108,111, 99, 97,108, 32,116,111,100,111,
+   32, 61, 32,123,112,114,101,100,125, 10, 32, 32, 32,119,104,105,108,101,
+   32, 35,116,111,100,111, 32, 62, 32, 48, 32,100,111, 10, 32, 32, 32, 32,
+   32, 32,108,111, 99, 97,108, 32,112, 32, 61, 32,116, 97, 98,108,101, 46,
+  114,101,109,111,118,101, 40,116,111,100,111, 41, 10, 32, 32, 32, 32, 32,
+   32,116, 97, 98,108,101,115, 91,112, 93, 32, 61, 32,110,105,108, 10, 32,
+   32, 32, 32, 32, 32,102,111,114, 32,117,115,101,114, 32,105,110, 32,112,
+   97,105,114,115, 40,114,100,101,112,115, 91,112, 93, 32,111,114, 32,123,
+  125, 41, 32,100,111, 10,  9, 32,105,102, 32,110,111,116, 32,115,101,101,
+  110, 91,117,115,101,114, 93, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,
+  115,101,101,110, 91,117,115,101,114, 93, 32, 61, 32,116,114,117,101, 10,
+    9, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40,
+  116,111,100,111, 44, 32,117,115,101,114, 41, 10,  9, 32,101,110,100, 10,
+   32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10,101,
+  110,100, 10, 10, 45, 45, 32, 80,114,111,103,114, 97,109,115, 32,109, 97,
+  100,101, 32, 98,121, 32,116,104,101, 32,109, 97,103,105, 99, 32,115,101,
+  116,115, 32,116,114, 97,110,115,102,111,114,109, 97,116,105,111,110, 32,
+   98,101,108,111,119, 32,100,101,112,101,110,100, 32,111,110, 32,116,104,
+  101, 10, 45, 45, 32,114,117,108,101,115, 32,105,110, 32,116,104,101, 32,
+  100, 97,116, 97, 98, 97,115,101, 44, 32, 98,117,116, 32,110,111,116, 32,
+  111,110, 32,105,116,115, 32,102, 97, 99,116,115, 44, 32,115,111, 32,116,
+  104,101,121, 32, 97,114,101, 32,107,101,112,116, 10, 45, 45, 32,117,110,
+  116,105,108, 32, 97, 32,114,117,108,101, 32,105,115, 32, 97,115,115,101,
+  114,116,101,100, 32,111,114, 32,114,101,116,114, 97, 99,116,101,100, 46,
+   10, 10,108,111, 99, 97,108, 32,109, 97,103,105, 99, 95,112,114,111,103,
+  114, 97,109,115, 32, 61, 32,123,125, 10, 10, 45, 45, 32, 84,104,101, 32,
+  114,117,108,101,115, 32, 97,114,101, 32, 97,108,115,111, 32, 99,111,117,
+  110,116,101,100, 32, 97,115, 32,116,104,101,121, 32, 99,104, 97,110,103,
+  101, 44, 32,115,111, 32,116,104, 97,116, 32, 97, 32,118,101,114,115,105,
+  111,110, 10, 45, 45, 32,112,117, 98,108,105,115,104,101,100, 32,102,111,
+  114, 32,114,101,112,108,105, 99, 97,115, 32,111,110,108,121, 32, 99, 97,
+  114,114,105,101,115, 32,114,117,108,101,115, 32,119,104,101,110, 32,116,
+  104,101,121, 32,104, 97,118,101, 32, 99,104, 97,110,103,101,100, 46, 10,
+   10,108,111, 99, 97,108, 32,114,117,108,101,115, 95, 99,104, 97,110,103,
+  101,100, 32, 61, 32, 48, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,
+  116,105,111,110, 32,105,110,118, 97,108,105,100, 97,116,101, 95, 97,108,
+  108, 40, 41, 10, 32, 32, 32,116, 97, 98,108,101,115, 32, 61, 32,123,125,
+   10, 32, 32, 32,109, 97,103,105, 99, 95,112,114,111,103,114, 97,109,115,
+   32, 61, 32,123,125, 10,101,110,100, 10, 10, 45, 45, 32, 77, 97,116,101,
+  114,105, 97,108,105,122,101,100, 32,118,105,101,119,115, 32, 97,114,101,
+   32,109, 97,105,110,116, 97,105,110,101,100, 32, 97,115, 32, 99,108, 97,
+  117,115,101,115, 32, 97,114,101, 32, 97,115,115,101,114,116,101,100, 32,
+   97,110,100, 10, 45, 45, 32,114,101,116,114, 97, 99,116,101,100, 32, 98,
+  121, 32,102,117,110, 99,116,105,111,110,115, 32,100,101,102,105,110,101,
+  100, 32, 97,102,116,101,114, 32,116,104,101, 32,112,114,111,118,101,114,
+   46, 10, 10,108,111, 99, 97,108, 32,118,105,101,119, 95, 97,115,115,101,
+  114,116, 44, 32,118,105,101,119, 95,111,118,101,114,100,101,108,101,116,
+  101, 44, 32,118,105,101,119, 95,114,101,100,101,114,105,118,101, 44, 32,
+  118,105,101,119, 95,114,101,118,101,114,116, 10, 10, 45, 45, 32, 65,100,
   100, 32, 97, 32,115, 97,102,101, 32, 99,108, 97,117,115,101, 32,116,111,
    32,116,104,101, 32,100, 97,116, 97, 98, 97,115,101, 46, 10, 10,108,111,
    99, 97,108, 32,102,117,110, 99,116,105,111,110, 32, 97,115,115,101,114,
@@ -608,632 +1424,2471 @@ static const unsigned char datalog_lua_bytes[] = {
   100, 46, 10, 32, 32, 32,101,108,115,101, 10, 32, 32, 32, 32, 32, 32,108,
   111, 99, 97,108, 32,112,114,101,100, 32, 61, 32, 99,108, 97,117,115,101,
    46,104,101, 97,100, 46,112,114,101,100, 10, 32, 32, 32, 32, 32, 32,105,
-  102, 32,110,111,116, 32,112,114,101,100, 46,112,114,105,109, 32,116,104,
-  101,110,  9, 45, 45, 32, 73,103,110,111,114,101, 32, 97,115,115,101,114,
-  116,105,111,110,115, 32,102,111,114, 32,112,114,105,109,105,116,105,118,
-  101,115, 46, 10,  9, 32,112,114,101,100, 46,100, 98, 91,103,101,116, 95,
-   99,108, 97,117,115,101, 95,105,100, 40, 99,108, 97,117,115,101, 41, 93,
-   32, 61, 32, 99,108, 97,117,115,101, 10,  9, 32,105,110,115,101,114,116,
-   40,112,114,101,100, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+  102, 32,112,114,101,100, 46,112,114,105,109, 32,116,104,101,110,  9,  9,
+   45, 45, 32, 73,103,110,111,114,101, 32, 97,115,115,101,114,116,105,111,
+  110,115, 32,102,111,114, 32,112,114,105,109,105,116,105,118,101,115, 46,
+   10,  9, 32,114,101,116,117,114,110, 32, 99,108, 97,117,115,101, 10, 32,
+   32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,116,111,117,
+   99,104, 40,112,114,101,100, 41, 10, 32, 32, 32, 32, 32, 32,105,102, 32,
+   35, 99,108, 97,117,115,101, 32, 61, 61, 32, 48, 32,116,104,101,110,  9,
+   45, 45, 32, 65, 32,102, 97, 99,116, 44, 32,119,104,105, 99,104, 32,109,
+  117,115,116, 32, 98,101, 32,103,114,111,117,110,100, 46, 10,  9, 32,108,
+  111, 99, 97,108, 32,102, 97, 99,116,115, 32, 61, 32,112,114,101,100, 46,
+  102, 97, 99,116,115, 10,  9, 32,105,102, 32,110,111,116, 32,102, 97, 99,
+  116,115, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,102, 97, 99,116,115,
+   32, 61, 32,109, 97,107,101, 95,102, 97, 99,116,115, 40,103,101,116, 95,
+   97,114,105,116,121, 40,112,114,101,100, 41, 41, 10,  9, 32, 32, 32, 32,
+  112,114,101,100, 46,102, 97, 99,116,115, 32, 61, 32,102, 97, 99,116,115,
+   10,  9, 32,101,110,100, 10,  9, 32,105,102, 32, 97,100,100, 95,102, 97,
+   99,116, 40,102, 97, 99,116,115, 44, 32, 99,108, 97,117,115,101, 46,104,
+  101, 97,100, 41, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,105,110,118,
+   97,108,105,100, 97,116,101, 40,112,114,101,100, 41, 10,  9, 32, 32, 32,
+   32,118,105,101,119, 95, 97,115,115,101,114,116, 40, 99,108, 97,117,115,
+  101, 41, 10,  9, 32, 32, 32, 32,115,119,101,101,112, 95, 99,111,110,115,
+  116,115, 40, 41, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,
+  108,115,101, 10,  9, 32,108,111, 99, 97,108, 32,105,100, 32, 61, 32,103,
+  101,116, 95, 99,108, 97,117,115,101, 95,105,100, 40, 99,108, 97,117,115,
+  101, 41, 10,  9, 32,105,102, 32,110,111,116, 32,112,114,101,100, 46,100,
+   98, 91,105,100, 93, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,112,114,
+  101,100, 46,100, 98, 91,105,100, 93, 32, 61, 32, 99,108, 97,117,115,101,
+   10,  9, 32, 32, 32, 32,105,102, 32,112,114,101,100, 46,105,110,100,101,
+  120, 32,116,104,101,110, 10,  9, 32, 32, 32, 32, 32, 32, 32,105,110,100,
+  101,120, 95, 99,108, 97,117,115,101, 40,112,114,101,100, 46,105,110,100,
+  101,120, 44, 32,105,100, 44, 32, 99,108, 97,117,115,101, 41, 10,  9, 32,
+   32, 32, 32,101,110,100, 10,  9, 32, 32, 32, 32, 97,100,100, 95,114,100,
+  101,112,115, 40, 99,108, 97,117,115,101, 44, 32, 49, 41, 10,  9, 32, 32,
+   32, 32,105,110,118, 97,108,105,100, 97,116,101, 40,112,114,101,100, 41,
+   10,  9, 32, 32, 32, 32,109, 97,103,105, 99, 95,112,114,111,103,114, 97,
+  109,115, 32, 61, 32,123,125, 10,  9, 32, 32, 32, 32,114,117,108,101,115,
+   95, 99,104, 97,110,103,101,100, 32, 61, 32,114,117,108,101,115, 95, 99,
+  104, 97,110,103,101,100, 32, 43, 32, 49, 10,  9, 32, 32, 32, 32,118,105,
+  101,119, 95, 97,115,115,101,114,116, 40, 99,108, 97,117,115,101, 41, 10,
+    9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32,
+   32, 32, 32, 32,105,110,115,101,114,116, 40,112,114,101,100, 41, 10, 32,
    32, 32, 32, 32, 32,114,101,116,117,114,110, 32, 99,108, 97,117,115,101,
    10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,108,111, 99, 97,108,
    32,102,117,110, 99,116,105,111,110, 32,114,101,116,114, 97, 99,116, 40,
    99,108, 97,117,115,101, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,112,
   114,101,100, 32, 61, 32, 99,108, 97,117,115,101, 46,104,101, 97,100, 46,
-  112,114,101,100, 10, 32, 32, 32,112,114,101,100, 46,100, 98, 91,103,101,
-  116, 95, 99,108, 97,117,115,101, 95,105,100, 40, 99,108, 97,117,115,101,
-   41, 93, 32, 61, 32,110,105,108, 10, 32, 32, 32,105,102, 32,110,111,116,
-   32,110,101,120,116, 40,112,114,101,100, 46,100, 98, 41, 32, 97,110,100,
-   32,110,111,116, 32,112,114,101,100, 46,112,114,105,109, 32,116,104,101,
-  110, 10, 32, 32, 32, 32, 32, 32,114,101,109,111,118,101, 40,112,114,101,
-  100, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,
-  110, 32, 99,108, 97,117,115,101, 10,101,110,100, 10, 10, 45, 45, 32, 68,
-   65, 84, 65, 66, 65, 83, 69, 32, 67, 76, 79, 78, 73, 78, 71, 10, 10, 45,
-   45, 32, 65, 32,100, 97,116, 97, 98, 97,115,101, 32, 99, 97,110, 32, 98,
-  101, 32,115, 97,118,101,100, 32, 97,110,100, 32,116,104,101,110, 32,108,
-   97,116,101,114, 32,114,101,115,116,111,114,101,100, 46, 32, 32, 87,105,
-  116,104, 32, 99,111,112,121, 32, 97,110,100, 10, 45, 45, 32,114,101,118,
-  101,114,116, 44, 32,111,110,101, 32, 99, 97,110, 32,117,115,101, 32,111,
-  110,101, 32, 99,111,112,121, 32,111,102, 32, 97, 32,100, 97,116, 97, 98,
-   97,115,101, 32,109,117,108,116,105,112,108,101, 32,116,105,109,101,115,
-   32,116,111, 32,114,101,118,101,114,116, 10, 45, 45, 32,116,111, 32, 97,
-   32,112,114,101,118,105,111,117,115, 32,100, 97,116, 97, 98, 97,115,101,
-   46, 32, 32, 84,104,101,115,101, 32,116,119,111, 32,102,117,110, 99,116,
-  105,111,110,115, 32, 97,114,101, 32,110,111,116, 32,101,120,112,111,115,
-  101,100, 32,105,110, 32,116,104,101, 10, 45, 45, 32, 67, 32, 65, 80, 73,
-   46, 10, 10, 45, 45, 32, 82,101,116,117,114,110,115, 32, 97, 32,102,114,
-  101,115,104, 32, 99,111,112,121, 32,111,102, 32,116,104,101, 32, 99,117,
-  114,114,101,110,116, 32,100, 97,116, 97, 98, 97,115,101, 32,111,114, 32,
-   99,111,112,105,101,115, 32,116,104,101, 32,111,110,101, 10, 45, 45, 32,
-  103,105,118,101,110, 32, 97,115, 32, 97,110, 32, 97,114,103,117,109,101,
-  110,116, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,
-  110, 32, 99,111,112,121, 40,115,114, 99, 41, 10, 32, 32, 32,108,111, 99,
-   97,108, 32, 99,108,111,110,101, 32, 61, 32,123,125, 10, 32, 32, 32,102,
-  111,114, 32,107, 44,118, 32,105,110, 32,112, 97,105,114,115, 40,115,114,
-   99, 32,111,114, 32,100, 98, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,
-   99,108,111,110,101, 91,107, 93, 32, 61, 32,100,117,112, 40,118, 41, 10,
-   32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32, 99,
-  108,111,110,101, 10,101,110,100, 10, 10, 45, 45, 32, 82,101,118,101,114,
-  116,115, 32,100, 97,116, 97,108,111,103, 32,116,111, 32, 97, 32,112,114,
-  101,118,105,111,117,115,108,121, 32, 99,108,111,110,101,100, 32,100, 97,
-  116, 97, 98, 97,115,101, 46, 32, 32, 84,104,101, 32,100, 97,116, 97, 98,
-   97,115,101, 32,105,115, 10, 45, 45, 32, 99,111,112,105,101,100, 32,115,
-  111, 32,116,104, 97,116, 32,116,104,101, 32, 99,108,111,110,101, 32, 99,
-   97,110, 32, 98,101, 32,117,115,101,100, 32,109,111,114,101, 32,116,104,
-   97,110, 32,111,110, 99,101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,
-  110, 99,116,105,111,110, 32,114,101,118,101,114,116, 40, 99,108,111,110,
-  101, 41, 10, 32, 32, 32,100, 98, 32, 61, 32, 99,111,112,121, 40, 99,108,
-  111,110,101, 41, 10,101,110,100, 10, 10, 45, 45, 32, 68, 65, 84, 65, 66,
-   65, 83, 69, 32, 83, 84, 79, 82, 69, 10, 10, 45, 45, 32, 65, 32,100, 97,
-  116, 97, 98, 97,115,101, 32, 99, 97,110, 32, 98,101, 32,115, 97,118,101,
-  100, 32, 97,110,100, 32,116,104,101,110, 32,108, 97,116,101,114, 32,114,
-  101,115,116,111,114,101,100, 46, 10, 10,108,111, 99, 97,108, 32,115,116,
-  111,114,101, 32, 61, 32,123,125, 10, 10,108,111, 99, 97,108, 32,102,117,
-  110, 99,116,105,111,110, 32,115, 97,118,101, 40, 41, 10, 32, 32, 32,116,
-   97, 98,108,101, 46,105,110,115,101,114,116, 40,115,116,111,114,101, 44,
-   32, 99,111,112,121, 40, 41, 41, 10,101,110,100, 10, 10,108,111, 99, 97,
-  108, 32,102,117,110, 99,116,105,111,110, 32,114,101,115,116,111,114,101,
-   40, 41, 10, 32, 32, 32,100, 98, 32, 61, 32,116, 97, 98,108,101, 46,114,
-  101,109,111,118,101, 40,115,116,111,114,101, 41, 10, 32, 32, 32,100, 98,
-   32, 61, 32,100, 98, 32,111,114, 32,123,125, 10,101,110,100, 10, 10, 45,
-   45, 32, 80, 82, 79, 86, 69, 82, 10, 10, 45, 45, 91, 91, 10, 10, 84,104,
-  101, 32,114,101,109, 97,105,110,105,110,103, 32,102,117,110, 99,116,105,
-  111,110,115, 32,105,110, 32,116,104,105,115, 32,102,105,108,101, 32,105,
-  109,112,108,101,109,101,110,116, 32,116,104,101, 32,116, 97, 98,108,101,
-  100, 32,108,111,103,105, 99, 10,112,114,111,103,114, 97,109,109,105,110,
-  103, 32, 97,108,103,111,114,105,116,104,109, 32,100,101,115, 99,114,105,
-   98,101,100, 32,105,110, 32, 34, 69,102,102,105, 99,105,101,110,116, 32,
-   84,111,112, 45, 68,111,119,110, 32, 67,111,109,112,117,116, 97,116,105,
-  111,110, 32,111,102, 10, 81,117,101,114,105,101,115, 32,117,110,100,101,
-  114, 32,116,104,101, 32, 87,101,108,108, 45, 70,111,117,110,100,101,100,
-   32, 83,101,109, 97,110,116,105, 99,115, 34, 44, 32, 67,104,101,110, 44,
-   32, 87, 46, 44, 32, 83,119,105,102,116, 44, 32, 84, 46, 44, 32, 97,110,
-  100, 10, 87, 97,114,114,101,110, 44, 32, 68, 46, 32, 83, 46, 44, 32, 74,
-   46, 32, 76,111,103,105, 99, 32, 80,114,111,103, 46, 32, 86,111,108, 46,
-   32, 50, 52, 44, 32, 78,111, 46, 32, 51, 44, 32, 83,101,112, 46, 32, 49,
-   57, 57, 53, 44, 32,112,112, 46, 32, 49, 54, 49, 45, 49, 57, 57, 46, 10,
-   65,110,111,116,104,101,114, 32,105,109,112,111,114,116, 97,110,116, 32,
-  114,101,102,101,114,101,110, 99,101, 32,105,115, 32, 34, 84, 97, 98,108,
-  101,100, 32, 69,118, 97,108,117, 97,116,105,111,110, 32,119,105,116,104,
-   32, 68,101,108, 97,121,105,110,103, 32,102,111,114, 10, 71,101,110,101,
-  114, 97,108, 32, 76,111,103,105, 99, 32, 80,114,111,103,114, 97,109,115,
-   34, 44, 32, 67,104,101,110, 44, 32, 87, 46, 44, 32, 97,110,100, 32, 87,
-   97,114,114,101,110, 44, 32, 68, 46, 32, 83, 46, 44, 32, 74, 46, 32, 65,
-   67, 77, 44, 32, 86,111,108, 46, 32, 52, 51, 44, 10, 78,111, 46, 32, 49,
-   44, 32, 74, 97,110, 46, 32, 49, 57, 57, 54, 44, 32,112,112, 46, 32, 50,
-   48, 45, 55, 52, 46, 10, 10, 93, 93, 10, 10, 45, 45, 32, 84,104,101, 32,
-  115,117, 98,103,111, 97,108, 32,116, 97, 98,108,101, 10, 10,108,111, 99,
-   97,108, 32,115,117, 98,103,111, 97,108,115, 10, 10, 45, 45, 32, 84,104,
-  101, 32,115,117, 98,103,111, 97,108, 32,116, 97, 98,108,101, 32,105,115,
-   32, 97, 32,109, 97,112, 32,102,114,111,109, 32,116,104,101, 32,118, 97,
-  114,105, 97,110,116, 32,116, 97,103, 32,111,102, 32, 97, 32,115,117, 98,
-  103,111, 97,108, 39,115, 10, 45, 45, 32,108,105,116,101,114, 97,108, 32,
-  116,111, 32, 97, 32,115,117, 98,103,111, 97,108, 46, 10, 10,108,111, 99,
-   97,108, 32,102,117,110, 99,116,105,111,110, 32,102,105,110,100, 40,108,
-  105,116,101,114, 97,108, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,
-  115,117, 98,103,111, 97,108,115, 91,103,101,116, 95,116, 97,103, 40,108,
-  105,116,101,114, 97,108, 41, 93, 10,101,110,100, 10, 10,108,111, 99, 97,
-  108, 32,102,117,110, 99,116,105,111,110, 32,109,101,114,103,101, 40,115,
-  117, 98,103,111, 97,108, 41, 10, 32, 32, 32,115,117, 98,103,111, 97,108,
-  115, 91,103,101,116, 95,116, 97,103, 40,115,117, 98,103,111, 97,108, 46,
-  108,105,116,101,114, 97,108, 41, 93, 32, 61, 32,115,117, 98,103,111, 97,
-  108, 10,101,110,100, 10, 10, 45, 45, 32, 65, 32,115,117, 98,103,111, 97,
-  108, 32,105,115, 32,116,104,101, 32,105,116,101,109, 32,116,104, 97,116,
-   32,105,115, 32,116, 97, 98,108,101,100, 32, 98,121, 32,116,104,105,115,
-   32, 97,108,103,111,114,105,116,104,109, 46, 10, 10, 45, 45, 32, 65, 32,
-  115,117, 98,103,111, 97,108, 32,104, 97,115, 32, 97, 32,108,105,116,101,
-  114, 97,108, 44, 32, 97, 32,115,101,116, 32,111,102, 32,102, 97, 99,116,
-  115, 44, 32, 97,110,100, 32, 97,110, 32, 97,114,114, 97,121, 32,111,102,
-   32,119, 97,105,116,101,114,115, 46, 10, 45, 45, 32, 65, 32,119, 97,105,
-  116,101,114, 32,105,115, 32, 97, 32,112, 97,105,114, 32, 99,111,110,116,
-   97,105,110,105,110,103, 32, 97, 32,115,117, 98,103,111, 97,108, 32, 97,
-  110,100, 32, 97, 32, 99,108, 97,117,115,101, 46, 10, 10,108,111, 99, 97,
-  108, 32,102,117,110, 99,116,105,111,110, 32,109, 97,107,101, 95,115,117,
-   98,103,111, 97,108, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,
-  114,101,116,117,114,110, 32,123,108,105,116,101,114, 97,108, 32, 61, 32,
-  108,105,116,101,114, 97,108, 44, 32,102, 97, 99,116,115, 32, 61, 32,123,
-  125, 44, 32,119, 97,105,116,101,114,115, 32, 61, 32,123,125,125, 10,101,
-  110,100, 10, 10, 45, 45, 32, 82,101,115,111,108,118,101, 32,116,104,101,
-   32,115,101,108,101, 99,116,101,100, 32,108,105,116,101,114, 97,108, 32,
-  111,102, 32, 97, 32, 99,108, 97,117,115,101, 32,119,105,116,104, 32, 97,
-   32,108,105,116,101,114, 97,108, 46, 32, 32, 84,104,101, 10, 45, 45, 32,
-  115,101,108,101, 99,116,101,100, 32,108,105,116,101,114, 97,108, 32,105,
-  115, 32,116,104,101, 32,102,105,114,115,116, 32,108,105,116,101,114, 97,
-  108, 32,105,110, 32, 98,111,100,121, 32,111,102, 32, 97, 32,114,117,108,
-  101, 46, 32, 32, 73,102, 32,116,104,101, 10, 45, 45, 32,116,119,111, 32,
-  108,105,116,101,114, 97,108,115, 32,117,110,105,102,121, 44, 32, 97, 32,
-  110,101,119, 32, 99,108, 97,117,115,101, 32,105,115, 32,103,101,110,101,
-  114, 97,116,101,100, 32,116,104, 97,116, 32,104, 97,115, 32, 97, 32, 98,
-  111,100,121, 32,119,105,116,104, 10, 45, 45, 32,111,110,101, 32,108,101,
-  115,115, 32,108,105,116,101,114, 97,108, 46, 10, 10,108,111, 99, 97,108,
-   32,102,117,110, 99,116,105,111,110, 32,114,101,115,111,108,118,101, 40,
-   99,108, 97,117,115,101, 44, 32,108,105,116,101,114, 97,108, 41, 10, 32,
-   32, 32,108,111, 99, 97,108, 32,110, 32, 61, 32, 35, 99,108, 97,117,115,
-  101, 10, 32, 32, 32,105,102, 32,110, 32, 61, 61, 32, 48, 32,116,104,101,
-  110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108,
-   10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,101,
-  110,118, 32, 61, 32,117,110,105,102,121, 40, 99,108, 97,117,115,101, 91,
-   49, 93, 44, 32,114,101,110, 97,109,101, 40,108,105,116,101,114, 97,108,
-   41, 41, 10, 32, 32, 32,105,102, 32,110,111,116, 32,101,110,118, 32,116,
-  104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,
-  105,108, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,110, 32, 61, 32,110,
-   32, 45, 32, 49, 10, 32, 32, 32,108,111, 99, 97,108, 32,110,101,119, 32,
-   61, 32,123,104,101, 97,100, 32, 61, 32,115,117, 98,115,116, 40, 99,108,
-   97,117,115,101, 46,104,101, 97,100, 44, 32,101,110,118, 41,125, 10, 32,
-   32, 32,102,111,114, 32,105, 61, 49, 44,110, 32,100,111, 10, 32, 32, 32,
-   32, 32, 32,110,101,119, 91,105, 93, 32, 61, 32,115,117, 98,115,116, 40,
-   99,108, 97,117,115,101, 91,105, 32, 43, 32, 49, 93, 44, 32,101,110,118,
-   41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110,
-   32,110,101,119, 10,101,110,100, 10, 10, 45, 45, 32, 83,116,111,114,101,
-   32, 97, 32,102, 97, 99,116, 44, 32, 97,110,100, 32,105,110,102,111,114,
-  109, 32, 97,108,108, 32,119, 97,105,116,101,114,115, 32,111,102, 32,116,
-  104,101, 32,102, 97, 99,116, 32,116,111,111, 46, 10, 10,108,111, 99, 97,
-  108, 32,102, 97, 99,116, 44, 32,114,117,108,101, 44, 32, 97,100,100, 95,
-   99,108, 97,117,115,101, 44, 32,115,101, 97,114, 99,104, 10, 10,102,117,
-  110, 99,116,105,111,110, 32,102, 97, 99,116, 40,115,117, 98,103,111, 97,
-  108, 44, 32,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,105,102, 32,
-  110,111,116, 32,105,115, 95,109,101,109, 98,101,114, 40,108,105,116,101,
-  114, 97,108, 44, 32,115,117, 98,103,111, 97,108, 46,102, 97, 99,116,115,
-   41, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32, 97,100,106,111,105,
-  110, 40,108,105,116,101,114, 97,108, 44, 32,115,117, 98,103,111, 97,108,
-   46,102, 97, 99,116,115, 41, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,
-  105, 61, 49, 44, 35,115,117, 98,103,111, 97,108, 46,119, 97,105,116,101,
-  114,115, 32,100,111, 10,  9, 32,108,111, 99, 97,108, 32,119, 97,105,116,
-  101,114, 32, 61, 32,115,117, 98,103,111, 97,108, 46,119, 97,105,116,101,
-  114,115, 91,105, 93, 10,  9, 32,108,111, 99, 97,108, 32,114,101,115,111,
-  108,118,101,110,116, 32, 61, 32,114,101,115,111,108,118,101, 40,119, 97,
-  105,116,101,114, 46, 99,108, 97,117,115,101, 44, 32,108,105,116,101,114,
-   97,108, 41, 10,  9, 32,105,102, 32,114,101,115,111,108,118,101,110,116,
-   32,116,104,101,110, 10,  9, 32, 32, 32, 32, 97,100,100, 95, 99,108, 97,
-  117,115,101, 40,119, 97,105,116,101,114, 46,115,117, 98,103,111, 97,108,
-   44, 32,114,101,115,111,108,118,101,110,116, 41, 10,  9, 32,101,110,100,
-   10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10,
-  101,110,100, 10, 10, 45, 45, 32, 85,115,101, 32, 97, 32,110,101,119,108,
-  121, 32,100,101,114,105,118,101,100, 32,114,117,108,101, 46, 10, 10,102,
-  117,110, 99,116,105,111,110, 32,114,117,108,101, 40,115,117, 98,103,111,
-   97,108, 44, 32, 99,108, 97,117,115,101, 44, 32,115,101,108,101, 99,116,
-  101,100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,115,103, 32, 61, 32,
-  102,105,110,100, 40,115,101,108,101, 99,116,101,100, 41, 10, 32, 32, 32,
-  105,102, 32,115,103, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,116,
-   97, 98,108,101, 46,105,110,115,101,114,116, 40,115,103, 46,119, 97,105,
-  116,101,114,115, 44, 32,123,115,117, 98,103,111, 97,108, 32, 61, 32,115,
-  117, 98,103,111, 97,108, 44, 32, 99,108, 97,117,115,101, 32, 61, 32, 99,
-  108, 97,117,115,101,125, 41, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,
-  108, 32,116,111,100,111, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32, 32,
-  102,111,114, 32,105,100, 44,102, 97, 99,116, 32,105,110, 32,112, 97,105,
-  114,115, 40,115,103, 46,102, 97, 99,116,115, 41, 32,100,111, 10,  9, 32,
-  108,111, 99, 97,108, 32,114,101,115,111,108,118,101,110,116, 32, 61, 32,
-  114,101,115,111,108,118,101, 40, 99,108, 97,117,115,101, 44, 32,102, 97,
-   99,116, 41, 10,  9, 32,105,102, 32,114,101,115,111,108,118,101,110,116,
-   32,116,104,101,110, 10,  9, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,
-  110,115,101,114,116, 40,116,111,100,111, 44, 32,114,101,115,111,108,118,
-  101,110,116, 41, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,
-  110,100, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,
-  116,111,100,111, 32,100,111, 10,  9, 32, 97,100,100, 95, 99,108, 97,117,
-  115,101, 40,115,117, 98,103,111, 97,108, 44, 32,116,111,100,111, 91,105,
-   93, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,108,
-  115,101, 10, 32, 32, 32, 32, 32, 32,115,103, 32, 61, 32,109, 97,107,101,
-   95,115,117, 98,103,111, 97,108, 40,115,101,108,101, 99,116,101,100, 41,
-   10, 32, 32, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,
-  116, 40,115,103, 46,119, 97,105,116,101,114,115, 44, 32,123,115,117, 98,
-  103,111, 97,108, 32, 61, 32,115,117, 98,103,111, 97,108, 44, 32, 99,108,
-   97,117,115,101, 32, 61, 32, 99,108, 97,117,115,101,125, 41, 10, 32, 32,
-   32, 32, 32, 32,109,101,114,103,101, 40,115,103, 41, 10, 32, 32, 32, 32,
-   32, 32,114,101,116,117,114,110, 32,115,101, 97,114, 99,104, 40,115,103,
-   41, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,102,117,110, 99,
-  116,105,111,110, 32, 97,100,100, 95, 99,108, 97,117,115,101, 40,115,117,
-   98,103,111, 97,108, 44, 32, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,
-  105,102, 32, 35, 99,108, 97,117,115,101, 32, 61, 61, 32, 48, 32,116,104,
-  101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,102, 97,
-   99,116, 40,115,117, 98,103,111, 97,108, 44, 32, 99,108, 97,117,115,101,
-   46,104,101, 97,100, 41, 10, 32, 32, 32,101,108,115,101, 10, 32, 32, 32,
-   32, 32, 32,114,101,116,117,114,110, 32,114,117,108,101, 40,115,117, 98,
-  103,111, 97,108, 44, 32, 99,108, 97,117,115,101, 44, 32, 99,108, 97,117,
-  115,101, 91, 49, 93, 41, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10,
-   10, 45, 45, 32, 83,101, 97,114, 99,104, 32,102,111,114, 32,100,101,114,
-  105,118, 97,116,105,111,110,115, 32,111,102, 32,116,104,101, 32,108,105,
-  116,101,114, 97,108, 32, 97,115,115,111, 99,105, 97,116,101,100, 32,119,
-  105,116,104, 32,116,104,105,115, 32,115,117, 98,103,111, 97,108, 46, 10,
-   10,102,117,110, 99,116,105,111,110, 32,115,101, 97,114, 99,104, 40,115,
-  117, 98,103,111, 97,108, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,108,
-  105,116,101,114, 97,108, 32, 61, 32,115,117, 98,103,111, 97,108, 46,108,
-  105,116,101,114, 97,108, 10, 32, 32, 32,105,102, 32,108,105,116,101,114,
-   97,108, 46,112,114,101,100, 46,112,114,105,109, 32,116,104,101,110, 10,
-   32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,108,105,116,101,114,
-   97,108, 46,112,114,101,100, 46,112,114,105,109, 40,108,105,116,101,114,
-   97,108, 44, 32,115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32,101,108,
-  115,101, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,100, 44, 99,108,
-   97,117,115,101, 32,105,110, 32,112, 97,105,114,115, 40,108,105,116,101,
-  114, 97,108, 46,112,114,101,100, 46,100, 98, 41, 32,100,111, 10,  9, 32,
-  108,111, 99, 97,108, 32,114,101,110, 97,109,101,100, 32, 61, 32,114,101,
-  110, 97,109,101, 95, 99,108, 97,117,115,101, 40, 99,108, 97,117,115,101,
-   41, 10,  9, 32,108,111, 99, 97,108, 32,101,110,118, 32, 61, 32,117,110,
-  105,102,121, 40,108,105,116,101,114, 97,108, 44, 32,114,101,110, 97,109,
-  101,100, 46,104,101, 97,100, 41, 10,  9, 32,105,102, 32,101,110,118, 32,
+  112,114,101,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,102, 97, 99,116,
+  115, 32, 61, 32,112,114,101,100, 46,102, 97, 99,116,115, 10, 32, 32, 32,
+  116,111,117, 99,104, 40,112,114,101,100, 41, 10, 32, 32, 32,105,102, 32,
+   35, 99,108, 97,117,115,101, 32, 61, 61, 32, 48, 32,116,104,101,110, 10,
+   32, 32, 32, 32, 32, 32,105,102, 32,102, 97, 99,116,115, 32, 97,110,100,
+   32,102, 97, 99,116,115, 58,104, 97,115, 40, 99,108, 97,117,115,101, 46,
+  104,101, 97,100, 41, 32,116,104,101,110, 10,  9, 32,108,111, 99, 97,108,
+   32,100,101,108,101,116,101,100, 32, 61, 32,118,105,101,119, 95,111,118,
+  101,114,100,101,108,101,116,101, 40, 99,108, 97,117,115,101, 41, 10,  9,
+   32,102, 97, 99,116,115, 58,114,101,109,111,118,101, 40, 99,108, 97,117,
+  115,101, 46,104,101, 97,100, 41, 10,  9, 32,105,110,118, 97,108,105,100,
+   97,116,101, 40,112,114,101,100, 41, 10,  9, 32,118,105,101,119, 95,114,
+  101,100,101,114,105,118,101, 40, 99,108, 97,117,115,101, 44, 32,100,101,
+  108,101,116,101,100, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,101,108,115,101, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108,
+   32,105,100, 32, 61, 32,103,101,116, 95, 99,108, 97,117,115,101, 95,105,
+  100, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32, 32, 32, 32,108,111,
+   99, 97,108, 32,111,108,100, 32, 61, 32,112,114,101,100, 46,100, 98, 91,
+  105,100, 93, 10, 32, 32, 32, 32, 32, 32,105,102, 32,111,108,100, 32,116,
+  104,101,110, 10,  9, 32,108,111, 99, 97,108, 32,100,101,108,101,116,101,
+  100, 32, 61, 32,118,105,101,119, 95,111,118,101,114,100,101,108,101,116,
+  101, 40,111,108,100, 41, 10,  9, 32,112,114,101,100, 46,100, 98, 91,105,
+  100, 93, 32, 61, 32,110,105,108, 10,  9, 32,105,102, 32,112,114,101,100,
+   46,105,110,100,101,120, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,117,
+  110,105,110,100,101,120, 95, 99,108, 97,117,115,101, 40,112,114,101,100,
+   46,105,110,100,101,120, 44, 32,105,100, 44, 32,111,108,100, 41, 10,  9,
+   32,101,110,100, 10,  9, 32, 97,100,100, 95,114,100,101,112,115, 40,111,
+  108,100, 44, 32, 45, 49, 41, 10,  9, 32,105,110,118, 97,108,105,100, 97,
+  116,101, 40,112,114,101,100, 41, 10,  9, 32,109, 97,103,105, 99, 95,112,
+  114,111,103,114, 97,109,115, 32, 61, 32,123,125, 10,  9, 32,114,117,108,
+  101,115, 95, 99,104, 97,110,103,101,100, 32, 61, 32,114,117,108,101,115,
+   95, 99,104, 97,110,103,101,100, 32, 43, 32, 49, 10,  9, 32,118,105,101,
+  119, 95,114,101,100,101,114,105,118,101, 40,111,108,100, 44, 32,100,101,
+  108,101,116,101,100, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,105,102, 32,110,111,116, 32,110,101,
+  120,116, 40,112,114,101,100, 46,100, 98, 41, 32, 97,110,100, 32,110,111,
+  116, 32,112,114,101,100, 46,112,114,105,109, 10, 32, 32, 32, 32, 32, 32,
+   97,110,100, 32,110,111,116, 32, 40,102, 97, 99,116,115, 32, 97,110,100,
+   32,102, 97, 99,116,115, 58, 99,111,117,110,116, 40, 41, 32, 62, 32, 48,
+   41, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,109,111,118,
+  101, 40,112,114,101,100, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  114,101,116,117,114,110, 32, 99,108, 97,117,115,101, 10,101,110,100, 10,
+   10, 45, 45, 32, 68, 65, 84, 65, 66, 65, 83, 69, 32, 83, 78, 65, 80, 83,
+   72, 79, 84, 83, 10, 10, 45, 45, 32, 65, 32,115,110, 97,112,115,104,111,
+  116, 32,105,115, 32,116, 97,107,101,110, 32,105,110, 32, 99,111,110,115,
+  116, 97,110,116, 32,116,105,109,101, 44, 32, 97,110,100, 32,104,111,108,
+  100,115, 32,116,104,101, 32,115,116, 97,116,101, 32,111,102, 32,101, 97,
+   99,104, 10, 45, 45, 32,112,114,101,100,105, 99, 97,116,101, 32, 99,104,
+   97,110,103,101,100, 32, 97,102,116,101,114, 32,105,116, 32,119, 97,115,
+   32,116, 97,107,101,110, 44, 32, 97,115, 32,115, 97,118,101,100, 32, 98,
+  121, 32,116,111,117, 99,104, 58, 32,116,104,101, 32,114,117,108,101,115,
+   10, 45, 45, 32,111,102, 32,116,104,101, 32,112,114,101,100,105, 99, 97,
+  116,101, 44, 32, 97, 32, 99,111,112,121, 32,111,102, 32,105,116,115, 32,
+  102, 97, 99,116, 32,115,116,111,114,101, 44, 32,119,104,105, 99,104, 32,
+  115,104, 97,114,101,115, 32,116,104,101, 32,102, 97, 99,116,115, 10, 45,
+   45, 32,117,110,116,105,108, 32,101,105,116,104,101,114, 32,115,116,111,
+  114,101, 32, 99,104, 97,110,103,101,115, 44, 32, 97,110,100, 32,119,104,
+  101,116,104,101,114, 32,105,116, 32,119, 97,115, 32,105,110, 32,116,104,
+  101, 32,100, 97,116, 97, 98, 97,115,101, 46, 10, 45, 45, 32, 79,110,108,
+  121, 32,116,104,101, 32,102,105,114,115,116, 32, 99,104, 97,110,103,101,
+   32, 97,102,116,101,114, 32, 97, 32,115,110, 97,112,115,104,111,116, 32,
+  115, 97,118,101,115, 32, 97, 32,115,116, 97,116,101, 44, 32,115,111, 32,
+   97, 32,115,110, 97,112,115,104,111,116, 10, 45, 45, 32,108,105,110,107,
+  115, 32,116,111, 32,116,104,101, 32,110,101,120,116, 32,111,110,101, 32,
+  116, 97,107,101,110, 44, 32, 97,110,100, 32,116,104,101, 32,115,116, 97,
+  116,101, 32,111,102, 32, 97, 32,112,114,101,100,105, 99, 97,116,101, 32,
+  105,110, 32, 97, 10, 45, 45, 32,115,110, 97,112,115,104,111,116, 32,105,
+  115, 32,116,104,101, 32,111,110,101, 32,115, 97,118,101,100, 32, 98,121,
+   32,105,116, 32,111,114, 32, 98,121, 32,116,104,101, 32,102,105,114,115,
+  116, 32,108, 97,116,101,114, 32,115,110, 97,112,115,104,111,116, 32,116,
+  104, 97,116, 10, 45, 45, 32,104, 97,115, 32,111,110,101, 44, 32,111,114,
+   32,101,108,115,101, 32,116,104,101, 32, 99,117,114,114,101,110,116, 32,
+  115,116, 97,116,101, 46, 32, 32, 82,101,118,101,114,116,105,110,103, 32,
+  116,111, 32, 97, 32,115,110, 97,112,115,104,111,116, 32,116, 97,107,101,
+  115, 10, 45, 45, 32,116,105,109,101, 32,105,110, 32,112,114,111,112,111,
+  114,116,105,111,110, 32,116,111, 32,116,104,101, 32,110,117,109, 98,101,
+  114, 32,111,102, 32,112,114,101,100,105, 99, 97,116,101,115, 32, 99,104,
+   97,110,103,101,100, 32,115,105,110, 99,101, 32,116,104,101,110, 44, 10,
+   45, 45, 32, 97,110,100, 32,108,101, 97,118,101,115, 32,116,104,101, 32,
+  115,110, 97,112,115,104,111,116, 32,117,110, 99,104, 97,110,103,101,100,
+   44, 32,115,111, 32,105,116, 32, 99, 97,110, 32, 98,101, 32,117,115,101,
+  100, 32, 97,103, 97,105,110, 46, 10, 10,108,111, 99, 97,108, 32,102,117,
+  110, 99,116,105,111,110, 32,115,110, 97,112,115,104,111,116, 40, 41, 10,
+   32, 32, 32,108,111, 99, 97,108, 32,115,110, 97,112, 32, 61, 32,123,115,
+   97,118,101,100, 32, 61, 32,123,125,125, 10, 32, 32, 32,105,102, 32,108,
+   97,116,101,115,116, 91, 49, 93, 32,116,104,101,110, 10, 32, 32, 32, 32,
+   32, 32,108, 97,116,101,115,116, 91, 49, 93, 46,110,101,120,116, 32, 61,
+   32,115,110, 97,112, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108, 97,
+  116,101,115,116, 91, 49, 93, 32, 61, 32,115,110, 97,112, 10, 32, 32, 32,
+  115,110, 97,112,115,104,111,116,115, 91,115,110, 97,112, 93, 32, 61, 32,
+  116,114,117,101, 10, 32, 32, 32,114,101,116,117,114,110, 32,115,110, 97,
+  112, 10,101,110,100, 10, 10, 45, 45, 32, 71,105,118,101,115, 32, 97, 32,
+  112,114,101,100,105, 99, 97,116,101, 32, 97, 32,115, 97,118,101,100, 32,
+  115,116, 97,116,101, 44, 32,107,101,101,112,105,110,103, 32,116,104,101,
+   32,114,101,118,101,114,115,101, 32,100,101,112,101,110,100,101,110, 99,
+  105,101,115, 10, 45, 45, 32,111,102, 32,105,116,115, 32,114,117,108,101,
+  115, 32,117,112, 32,116,111, 32,100, 97,116,101, 46, 32, 32, 84,104,101,
+   32,105,110,100,101,120, 32,111,102, 32,105,116,115, 32,114,117,108,101,
+  115, 32,105,115, 32,114,101, 98,117,105,108,116, 32,119,104,101,110, 10,
+   45, 45, 32,110,101,120,116, 32,110,101,101,100,101,100, 46, 10, 10,108,
+  111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,115,101,116, 95,
+  115,116, 97,116,101, 40,112,114,101,100, 44, 32,115,116, 97,116,101, 41,
+   10, 32, 32, 32,108,111, 99, 97,108, 32,114,117,108,101,115, 32, 61, 32,
+  123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32, 99,104, 97,110,103,101,
+  100, 32, 61, 32,102, 97,108,115,101, 10, 32, 32, 32,102,111,114, 32,105,
+  100, 44, 99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,114,115, 40,
+  112,114,101,100, 46,100, 98, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,
+  105,102, 32,115,116, 97,116,101, 46,100, 98, 91,105,100, 93, 32,126, 61,
+   32, 99,108, 97,117,115,101, 32,116,104,101,110, 10,  9, 32, 97,100,100,
+   95,114,100,101,112,115, 40, 99,108, 97,117,115,101, 44, 32, 45, 49, 41,
+   10,  9, 32, 99,104, 97,110,103,101,100, 32, 61, 32,116,114,117,101, 10,
+   32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,102,111,114, 32,105,100, 44, 99,108, 97,117,115,101, 32,105,110,
+   32,112, 97,105,114,115, 40,115,116, 97,116,101, 46,100, 98, 41, 32,100,
+  111, 10, 32, 32, 32, 32, 32, 32,105,102, 32,112,114,101,100, 46,100, 98,
+   91,105,100, 93, 32,126, 61, 32, 99,108, 97,117,115,101, 32,116,104,101,
+  110, 10,  9, 32, 97,100,100, 95,114,100,101,112,115, 40, 99,108, 97,117,
+  115,101, 44, 32, 49, 41, 10,  9, 32, 99,104, 97,110,103,101,100, 32, 61,
+   32,116,114,117,101, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32,
+   32, 32, 32, 32,114,117,108,101,115, 91,105,100, 93, 32, 61, 32, 99,108,
+   97,117,115,101, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,105,102, 32,
+   99,104, 97,110,103,101,100, 32,116,104,101,110, 10, 32, 32, 32, 32, 32,
+   32,114,117,108,101,115, 95, 99,104, 97,110,103,101,100, 32, 61, 32,114,
+  117,108,101,115, 95, 99,104, 97,110,103,101,100, 32, 43, 32, 49, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,112,114,101,100, 46,100, 98, 32, 61,
+   32,114,117,108,101,115, 10, 32, 32, 32,112,114,101,100, 46,105,110,100,
+  101,120, 32, 61, 32,110,105,108, 10, 32, 32, 32,112,114,101,100, 46,102,
+   97, 99,116,115, 32, 61, 32,115,116, 97,116,101, 46,102, 97, 99,116,115,
+   32, 97,110,100, 32,115,116, 97,116,101, 46,102, 97, 99,116,115, 58, 99,
+  111,112,121, 40, 41, 10, 32, 32, 32,105,102, 32,115,116, 97,116,101, 46,
+  112,114,101,115,101,110,116, 32,116,104,101,110, 10, 32, 32, 32, 32, 32,
+   32,105,110,115,101,114,116, 40,112,114,101,100, 41, 10, 32, 32, 32,101,
+  108,115,101, 10, 32, 32, 32, 32, 32, 32,114,101,109,111,118,101, 40,112,
+  114,101,100, 41, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,108,
+  111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,115,101,116, 95,
+  115,116, 97,116,101,115, 40,115,116, 97,116,101,115, 41, 10, 32, 32, 32,
+  102,111,114, 32,112,114,101,100, 44,115,116, 97,116,101, 32,105,110, 32,
+  112, 97,105,114,115, 40,115,116, 97,116,101,115, 41, 32,100,111, 10, 32,
+   32, 32, 32, 32, 32,116,111,117, 99,104, 40,112,114,101,100, 41, 10, 32,
+   32, 32, 32, 32, 32,115,101,116, 95,115,116, 97,116,101, 40,112,114,101,
+  100, 44, 32,115,116, 97,116,101, 41, 10, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,105,110,118, 97,108,105,100, 97,116,101, 95, 97,108,108, 40, 41,
+   10, 32, 32, 32,118,105,101,119, 95,114,101,118,101,114,116, 40, 41, 10,
+  101,110,100, 10, 10, 45, 45, 32, 82,101,118,101,114,116,115, 32,116,111,
+   32, 97, 32,115,110, 97,112,115,104,111,116, 46, 10, 10,108,111, 99, 97,
+  108, 32,102,117,110, 99,116,105,111,110, 32,114,101,118,101,114,116, 40,
+  115,110, 97,112, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,115,116, 97,
+  116,101,115, 32, 61, 32,123,125, 10, 32, 32, 32,119,104,105,108,101, 32,
+  115,110, 97,112, 32,100,111, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,
+  112,114,101,100, 44,115,116, 97,116,101, 32,105,110, 32,112, 97,105,114,
+  115, 40,115,110, 97,112, 46,115, 97,118,101,100, 41, 32,100,111, 10,  9,
+   32,115,116, 97,116,101,115, 91,112,114,101,100, 93, 32, 61, 32,115,116,
+   97,116,101,115, 91,112,114,101,100, 93, 32,111,114, 32,115,116, 97,116,
+  101, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,
+  115,110, 97,112, 32, 61, 32,115,110, 97,112, 46,110,101,120,116, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,115,101,116, 95,115,116, 97,116,101,
+  115, 40,115,116, 97,116,101,115, 41, 10,101,110,100, 10, 10, 45, 45, 32,
+   87,105,116,104, 32, 99,111,112,121, 32, 97,110,100, 32,114,101,118,101,
+  114,116, 44, 32,111,110,101, 32, 99, 97,110, 32,117,115,101, 32,111,110,
+  101, 32,115,110, 97,112,115,104,111,116, 32,111,102, 32, 97, 32,100, 97,
+  116, 97, 98, 97,115,101, 10, 45, 45, 32,109,117,108,116,105,112,108,101,
+   32,116,105,109,101,115, 32,116,111, 32,114,101,118,101,114,116, 32,116,
+  111, 32, 97, 32,112,114,101,118,105,111,117,115, 32,100, 97,116, 97, 98,
+   97,115,101, 46, 32, 32, 65,115, 32, 97, 32,115,110, 97,112,115,104,111,
+  116, 10, 45, 45, 32,110,101,118,101,114, 32, 99,104, 97,110,103,101,115,
+   44, 32, 99,111,112,121,105,110,103, 32,111,110,101, 32,103,105,118,101,
+  115, 32,116,104,101, 32,115,110, 97,112,115,104,111,116, 32,105,116,115,
+  101,108,102, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
+  111,110, 32, 99,111,112,121, 40,115,110, 97,112, 41, 10, 32, 32, 32,114,
+  101,116,117,114,110, 32,115,110, 97,112, 32,111,114, 32,115,110, 97,112,
+  115,104,111,116, 40, 41, 10,101,110,100, 10, 10, 45, 45, 32, 68, 65, 84,
+   65, 66, 65, 83, 69, 32, 83, 84, 79, 82, 69, 10, 10, 45, 45, 32, 65, 32,
+  100, 97,116, 97, 98, 97,115,101, 32, 99, 97,110, 32, 98,101, 32,115, 97,
+  118,101,100, 32, 97,110,100, 32,116,104,101,110, 32,108, 97,116,101,114,
+   32,114,101,115,116,111,114,101,100, 46, 32, 32, 82,101,115,116,111,114,
+  105,110,103, 32,119,104,101,110, 10, 45, 45, 32,110,111,116,104,105,110,
+  103, 32,105,115, 32,115, 97,118,101,100, 32,101,109,112,116,105,101,115,
+   32,116,104,101, 32,100, 97,116, 97, 98, 97,115,101, 44, 32,101,120, 99,
+  101,112,116, 32,102,111,114, 32,112,114,105,109,105,116,105,118,101,115,
+   46, 10, 10,108,111, 99, 97,108, 32,115,116,111,114,101, 32, 61, 32,123,
+  125, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,
+  115, 97,118,101, 40, 41, 10, 32, 32, 32,116, 97, 98,108,101, 46,105,110,
+  115,101,114,116, 40,115,116,111,114,101, 44, 32,115,110, 97,112,115,104,
+  111,116, 40, 41, 41, 10,101,110,100, 10, 10,108,111, 99, 97,108, 32,102,
+  117,110, 99,116,105,111,110, 32,114,101,115,116,111,114,101, 40, 41, 10,
+   32, 32, 32,108,111, 99, 97,108, 32,115,110, 97,112, 32, 61, 32,116, 97,
+   98,108,101, 46,114,101,109,111,118,101, 40,115,116,111,114,101, 41, 10,
+   32, 32, 32,105,102, 32,115,110, 97,112, 32,116,104,101,110, 10, 32, 32,
+   32, 32, 32, 32,114,101,118,101,114,116, 40,115,110, 97,112, 41, 10, 32,
+   32, 32,101,108,115,101, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108,
+   32,115,116, 97,116,101,115, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32,
+   32,102,111,114, 32,105,100, 44,112,114,101,100, 32,105,110, 32,112, 97,
+  105,114,115, 40,100, 98, 41, 32,100,111, 10,  9, 32,105,102, 32,110,111,
+  116, 32,112,114,101,100, 46,112,114,105,109, 32,116,104,101,110, 10,  9,
+   32, 32, 32, 32,115,116, 97,116,101,115, 91,112,114,101,100, 93, 32, 61,
+   32,123,100, 98, 32, 61, 32,123,125, 44, 32,112,114,101,115,101,110,116,
+   32, 61, 32,102, 97,108,115,101,125, 10,  9, 32,101,110,100, 10, 32, 32,
+   32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,115,101,116, 95,
+  115,116, 97,116,101,115, 40,115,116, 97,116,101,115, 41, 10, 32, 32, 32,
+  101,110,100, 10,101,110,100, 10, 10, 45, 45, 32, 80, 82, 79, 86, 69, 82,
+   10, 10, 45, 45, 91, 91, 10, 10, 84,104,101, 32,114,101,109, 97,105,110,
+  105,110,103, 32,102,117,110, 99,116,105,111,110,115, 32,105,110, 32,116,
+  104,105,115, 32,102,105,108,101, 32,105,109,112,108,101,109,101,110,116,
+   32,116,104,101, 32,116, 97, 98,108,101,100, 32,108,111,103,105, 99, 10,
+  112,114,111,103,114, 97,109,109,105,110,103, 32, 97,108,103,111,114,105,
+  116,104,109, 32,100,101,115, 99,114,105, 98,101,100, 32,105,110, 32, 34,
+   69,102,102,105, 99,105,101,110,116, 32, 84,111,112, 45, 68,111,119,110,
+   32, 67,111,109,112,117,116, 97,116,105,111,110, 32,111,102, 10, 81,117,
+  101,114,105,101,115, 32,117,110,100,101,114, 32,116,104,101, 32, 87,101,
+  108,108, 45, 70,111,117,110,100,101,100, 32, 83,101,109, 97,110,116,105,
+   99,115, 34, 44, 32, 67,104,101,110, 44, 32, 87, 46, 44, 32, 83,119,105,
+  102,116, 44, 32, 84, 46, 44, 32, 97,110,100, 10, 87, 97,114,114,101,110,
+   44, 32, 68, 46, 32, 83, 46, 44, 32, 74, 46, 32, 76,111,103,105, 99, 32,
+   80,114,111,103, 46, 32, 86,111,108, 46, 32, 50, 52, 44, 32, 78,111, 46,
+   32, 51, 44, 32, 83,101,112, 46, 32, 49, 57, 57, 53, 44, 32,112,112, 46,
+   32, 49, 54, 49, 45, 49, 57, 57, 46, 10, 65,110,111,116,104,101,114, 32,
+  105,109,112,111,114,116, 97,110,116, 32,114,101,102,101,114,101,110, 99,
+  101, 32,105,115, 32, 34, 84, 97, 98,108,101,100, 32, 69,118, 97,108,117,
+   97,116,105,111,110, 32,119,105,116,104, 32, 68,101,108, 97,121,105,110,
+  103, 32,102,111,114, 10, 71,101,110,101,114, 97,108, 32, 76,111,103,105,
+   99, 32, 80,114,111,103,114, 97,109,115, 34, 44, 32, 67,104,101,110, 44,
+   32, 87, 46, 44, 32, 97,110,100, 32, 87, 97,114,114,101,110, 44, 32, 68,
+   46, 32, 83, 46, 44, 32, 74, 46, 32, 65, 67, 77, 44, 32, 86,111,108, 46,
+   32, 52, 51, 44, 10, 78,111, 46, 32, 49, 44, 32, 74, 97,110, 46, 32, 49,
+   57, 57, 54, 44, 32,112,112, 46, 32, 50, 48, 45, 55, 52, 46, 10, 10, 93,
+   93, 10, 10, 45, 45, 32, 84,104,101, 32,115,117, 98,103,111, 97,108, 32,
+  116, 97, 98,108,101, 10, 10, 45, 45, 32, 84,104,101, 32,116, 97, 98,108,
+  101, 32,111,102, 32, 97, 32,112,114,101,100,105, 99, 97,116,101, 32,105,
+  115, 32, 97, 32,109, 97,112, 32,102,114,111,109, 32,116,104,101, 32,118,
+   97,114,105, 97,110,116, 32,116, 97,103, 32,111,102, 32, 97, 10, 45, 45,
+   32,115,117, 98,103,111, 97,108, 39,115, 32,108,105,116,101,114, 97,108,
+   32,116,111, 32, 97, 32,115,117, 98,103,111, 97,108, 46, 32, 32, 84,104,
+  101, 32,115,117, 98,103,111, 97,108,115, 32, 97,100,100,101,100, 32, 98,
+  121, 32,116,104,101, 32,113,117,101,114,121, 10, 45, 45, 32, 98,101,105,
+  110,103, 32, 97,110,115,119,101,114,101,100, 32, 97,114,101, 32, 97,108,
+  115,111, 32,108,105,115,116,101,100, 32,105,110, 32,102,114,101,115,104,
+   44, 32,115,111, 32,116,104,101,121, 32, 99, 97,110, 32, 98,101, 32,109,
+   97,114,107,101,100, 10, 45, 45, 32, 99,111,109,112,108,101,116,101, 32,
+  119,104,101,110, 32,105,116, 32,102,105,110,105,115,104,101,115, 46, 32,
+   32, 87,104,101,110, 32, 97, 32,113,117,101,114,121, 32,105,115, 32, 97,
+   98,111,114,116,101,100, 32, 98,121, 32, 97,110, 32,101,114,114,111,114,
+   44, 10, 45, 45, 32,102,114,101,115,104, 32,105,115, 32,108,101,102,116,
+   32,115,101,116, 44, 32, 97,110,100, 32,101,118,101,114,121, 32,116, 97,
+   98,108,101, 32,105,115, 32,100,105,115, 99, 97,114,100,101,100, 32, 98,
+  121, 32,116,104,101, 32,110,101,120,116, 32,113,117,101,114,121, 46, 10,
+   10,108,111, 99, 97,108, 32,102,114,101,115,104, 10, 10,108,111, 99, 97,
+  108, 32,102,117,110, 99,116,105,111,110, 32,102,105,110,100, 40,108,105,
+  116,101,114, 97,108, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,116, 98,
+  108, 32, 61, 32,116, 97, 98,108,101,115, 91,108,105,116,101,114, 97,108,
+   46,112,114,101,100, 93, 10, 32, 32, 32,114,101,116,117,114,110, 32,116,
+   98,108, 32, 97,110,100, 32,116, 98,108, 91,103,101,116, 95,116, 97,103,
+   40,108,105,116,101,114, 97,108, 41, 93, 10,101,110,100, 10, 10,108,111,
+   99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,109,101,114,103,101,
+   40,115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32,108,111, 99, 97,108,
+   32,112,114,101,100, 32, 61, 32,115,117, 98,103,111, 97,108, 46,108,105,
+  116,101,114, 97,108, 46,112,114,101,100, 10, 32, 32, 32,108,111, 99, 97,
+  108, 32,116, 98,108, 32, 61, 32,116, 97, 98,108,101,115, 91,112,114,101,
+  100, 93, 10, 32, 32, 32,105,102, 32,110,111,116, 32,116, 98,108, 32,116,
+  104,101,110, 10, 32, 32, 32, 32, 32, 32,116, 98,108, 32, 61, 32,123,125,
+   10, 32, 32, 32, 32, 32, 32,116, 97, 98,108,101,115, 91,112,114,101,100,
+   93, 32, 61, 32,116, 98,108, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  116, 98,108, 91,103,101,116, 95,116, 97,103, 40,115,117, 98,103,111, 97,
+  108, 46,108,105,116,101,114, 97,108, 41, 93, 32, 61, 32,115,117, 98,103,
+  111, 97,108, 10, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,
+  116, 40,102,114,101,115,104, 44, 32,115,117, 98,103,111, 97,108, 41, 10,
+  101,110,100, 10, 10, 45, 45, 32, 65, 32,115,117, 98,103,111, 97,108, 32,
+  105,115, 32,116,104,101, 32,105,116,101,109, 32,116,104, 97,116, 32,105,
+  115, 32,116, 97, 98,108,101,100, 32, 98,121, 32,116,104,105,115, 32, 97,
+  108,103,111,114,105,116,104,109, 46, 10, 10, 45, 45, 32, 65, 32,115,117,
+   98,103,111, 97,108, 32,104, 97,115, 32, 97, 32,108,105,116,101,114, 97,
+  108, 44, 32, 97, 32,115,101,116, 32,111,102, 32,102, 97, 99,116,115, 44,
+   32, 97,110,100, 32, 97,110, 32, 97,114,114, 97,121, 32,111,102, 32,119,
+   97,105,116,101,114,115, 46, 10, 45, 45, 32, 65, 32,119, 97,105,116,101,
+  114, 32,105,115, 32, 97, 32,112, 97,105,114, 32, 99,111,110,116, 97,105,
+  110,105,110,103, 32, 97, 32,115,117, 98,103,111, 97,108, 32, 97,110,100,
+   32, 97, 32, 99,108, 97,117,115,101, 46, 32, 32, 65, 32, 99,111,109,112,
+  108,101,116,101, 10, 45, 45, 32,115,117, 98,103,111, 97,108, 32,104, 97,
+  115, 32, 97,108,108, 32,105,116,115, 32,102, 97, 99,116,115, 44, 32,115,
+  111, 32,105,116, 32,104, 97,115, 32,110,111, 32,110,101,101,100, 32,102,
+  111,114, 32,119, 97,105,116,101,114,115, 46, 10, 10,108,111, 99, 97,108,
+   32,102,117,110, 99,116,105,111,110, 32,109, 97,107,101, 95,115,117, 98,
+  103,111, 97,108, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,114,
+  101,116,117,114,110, 32,123,108,105,116,101,114, 97,108, 32, 61, 32,108,
+  105,116,101,114, 97,108, 44, 32,102, 97, 99,116,115, 32, 61, 32,123,125,
+   44, 32,119, 97,105,116,101,114,115, 32, 61, 32,123,125,125, 10,101,110,
+  100, 10, 10, 45, 45, 32, 82,101,115,111,108,118,101, 32,116,104,101, 32,
+  115,101,108,101, 99,116,101,100, 32,108,105,116,101,114, 97,108, 32,111,
+  102, 32, 97, 32, 99,108, 97,117,115,101, 32,119,105,116,104, 32, 97, 32,
+  108,105,116,101,114, 97,108, 46, 32, 32, 84,104,101, 10, 45, 45, 32,115,
+  101,108,101, 99,116,101,100, 32,108,105,116,101,114, 97,108, 32,105,115,
+   32,116,104,101, 32,102,105,114,115,116, 32,108,105,116,101,114, 97,108,
+   32,105,110, 32, 98,111,100,121, 32,111,102, 32, 97, 32,114,117,108,101,
+   46, 32, 32, 73,102, 32,116,104,101, 10, 45, 45, 32,116,119,111, 32,108,
+  105,116,101,114, 97,108,115, 32,117,110,105,102,121, 44, 32, 97, 32,110,
+  101,119, 32, 99,108, 97,117,115,101, 32,105,115, 32,103,101,110,101,114,
+   97,116,101,100, 32,116,104, 97,116, 32,104, 97,115, 32, 97, 32, 98,111,
+  100,121, 32,119,105,116,104, 10, 45, 45, 32,111,110,101, 32,108,101,115,
+  115, 32,108,105,116,101,114, 97,108, 46, 10, 10,108,111, 99, 97,108, 32,
+  102,117,110, 99,116,105,111,110, 32,114,101,115,111,108,118,101, 40, 99,
+  108, 97,117,115,101, 44, 32,108,105,116,101,114, 97,108, 41, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,110, 32, 61, 32, 35, 99,108, 97,117,115,101,
+   10, 32, 32, 32,105,102, 32,110, 32, 61, 61, 32, 48, 32,116,104,101,110,
+   10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108, 10,
+   32, 32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,101,110,
+  118, 32, 61, 32,117,110,105,102,121, 40, 99,108, 97,117,115,101, 91, 49,
+   93, 44, 32,114,101,110, 97,109,101, 40,108,105,116,101,114, 97,108, 41,
+   41, 10, 32, 32, 32,105,102, 32,110,111,116, 32,101,110,118, 32,116,104,
+  101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,105,
+  108, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,110, 32, 61, 32,110, 32,
+   45, 32, 49, 10, 32, 32, 32,108,111, 99, 97,108, 32,110,101,119, 32, 61,
+   32,123,104,101, 97,100, 32, 61, 32,115,117, 98,115,116, 40, 99,108, 97,
+  117,115,101, 46,104,101, 97,100, 44, 32,101,110,118, 41,125, 10, 32, 32,
+   32,102,111,114, 32,105, 61, 49, 44,110, 32,100,111, 10, 32, 32, 32, 32,
+   32, 32,110,101,119, 91,105, 93, 32, 61, 32,115,117, 98,115,116, 40, 99,
+  108, 97,117,115,101, 91,105, 32, 43, 32, 49, 93, 44, 32,101,110,118, 41,
+   10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,
+  110,101,119, 10,101,110,100, 10, 10, 45, 45, 32, 83,116,111,114,101, 32,
+   97, 32,102, 97, 99,116, 44, 32, 97,110,100, 32,105,110,102,111,114,109,
+   32, 97,108,108, 32,119, 97,105,116,101,114,115, 32,111,102, 32,116,104,
+  101, 32,102, 97, 99,116, 32,116,111,111, 46, 10, 10,108,111, 99, 97,108,
+   32,102, 97, 99,116, 44, 32,114,117,108,101, 44, 32, 97,100,100, 95, 99,
+  108, 97,117,115,101, 44, 32,115,101, 97,114, 99,104, 10, 10,102,117,110,
+   99,116,105,111,110, 32,102, 97, 99,116, 40,115,117, 98,103,111, 97,108,
+   44, 32,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,105,102, 32,110,
+  111,116, 32,105,115, 95,109,101,109, 98,101,114, 40,108,105,116,101,114,
+   97,108, 44, 32,115,117, 98,103,111, 97,108, 46,102, 97, 99,116,115, 41,
+   32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32, 97,100,106,111,105,110,
+   40,108,105,116,101,114, 97,108, 44, 32,115,117, 98,103,111, 97,108, 46,
+  102, 97, 99,116,115, 41, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,
+   61, 49, 44, 35,115,117, 98,103,111, 97,108, 46,119, 97,105,116,101,114,
+  115, 32,100,111, 10,  9, 32,108,111, 99, 97,108, 32,119, 97,105,116,101,
+  114, 32, 61, 32,115,117, 98,103,111, 97,108, 46,119, 97,105,116,101,114,
+  115, 91,105, 93, 10,  9, 32,108,111, 99, 97,108, 32,114,101,115,111,108,
+  118,101,110,116, 32, 61, 32,114,101,115,111,108,118,101, 40,119, 97,105,
+  116,101,114, 46, 99,108, 97,117,115,101, 44, 32,108,105,116,101,114, 97,
+  108, 41, 10,  9, 32,105,102, 32,114,101,115,111,108,118,101,110,116, 32,
   116,104,101,110, 10,  9, 32, 32, 32, 32, 97,100,100, 95, 99,108, 97,117,
-  115,101, 40,115,117, 98,103,111, 97,108, 44, 32,115,117, 98,115,116, 95,
-  105,110, 95, 99,108, 97,117,115,101, 40,114,101,110, 97,109,101,100, 44,
-   32,101,110,118, 41, 41, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32,
-   32,101,110,100, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10, 45,
-   45, 32, 83,101,116,115, 32,117,112, 32, 97,110,100, 32, 99, 97,108,108,
-  115, 32,116,104,101, 32,115,117, 98,103,111, 97,108, 32,115,101, 97,114,
-   99,104, 32,112,114,111, 99,101,100,117,114,101, 44, 32, 97,110,100, 32,
-  116,104,101,110, 32,101,120,116,114, 97, 99,116,115, 10, 45, 45, 32,116,
-  104,101, 32, 97,110,115,119,101,114,115, 32,105,110,116,111, 32, 97,110,
-   32,101, 97,115,105,108,121, 32,117,115,101,100, 32,116, 97, 98,108,101,
-   46, 32, 32, 84,104,101, 32,116, 97, 98,108,101, 32,104, 97,115, 32,116,
-  104,101, 32,110, 97,109,101, 32,111,102, 10, 45, 45, 32,116,104,101, 32,
-  112,114,101,100,105, 99, 97,116,101, 44, 32,116,104,101, 32,112,114,101,
-  100,105, 99, 97,116,101, 39,115, 32, 97,114,105,116,121, 44, 32, 97,110,
-  100, 32, 97,110, 32, 97,114,114, 97,121, 32,111,102, 32, 99,111,110,115,
-  116, 97,110,116, 10, 45, 45, 32,116,101,114,109,115, 32,102,111,114, 32,
-  101, 97, 99,104, 32, 97,110,115,119,101,114, 46, 32, 32, 73,102, 32,116,
-  104,101,114,101, 32, 97,114,101, 32,110,111, 32, 97,110,115,119,101,114,
-  115, 44, 32,110,105,108, 32,105,115, 32,114,101,116,117,114,110,101,100,
-   46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,
-   97,115,107, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,115,117,
-   98,103,111, 97,108,115, 32, 61, 32,123,125, 10, 32, 32, 32,108,111, 99,
-   97,108, 32,115,117, 98,103,111, 97,108, 32, 61, 32,109, 97,107,101, 95,
-  115,117, 98,103,111, 97,108, 40,108,105,116,101,114, 97,108, 41, 10, 32,
-   32, 32,109,101,114,103,101, 40,115,117, 98,103,111, 97,108, 41, 10, 32,
-   32, 32,115,101, 97,114, 99,104, 40,115,117, 98,103,111, 97,108, 41, 10,
-   32, 32, 32,115,117, 98,103,111, 97,108,115, 32, 61, 32,110,105,108, 10,
-   32, 32, 32,108,111, 99, 97,108, 32, 97,110,115,119,101,114,115, 32, 61,
-   32,123,125, 10, 32, 32, 32,102,111,114, 32,105,100, 44,108,105,116,101,
-  114, 97,108, 32,105,110, 32,112, 97,105,114,115, 40,115,117, 98,103,111,
-   97,108, 46,102, 97, 99,116,115, 41, 32,100,111, 10, 32, 32, 32, 32, 32,
-   32,108,111, 99, 97,108, 32, 97,110,115,119,101,114, 32, 61, 32,123,125,
-   10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,108,105,
-  116,101,114, 97,108, 32,100,111, 32, 45, 45, 32, 69, 97, 99,104, 32,116,
-  101,114,109, 32,105,110, 32, 97,110, 32, 97,110,115,119,101,114, 32,119,
-  105,108,108, 32, 98,101, 10,  9, 32,116, 97, 98,108,101, 46,105,110,115,
-  101,114,116, 40, 97,110,115,119,101,114, 44, 32,108,105,116,101,114, 97,
-  108, 91,105, 93, 46,105,100, 41, 32, 45, 45, 32, 97, 32, 99,111,110,115,
-  116, 97,110,116, 46, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32,
-   32, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40, 97,
-  110,115,119,101,114,115, 44, 32, 97,110,115,119,101,114, 41, 10, 32, 32,
-   32,101,110,100, 10, 32, 32, 32,105,102, 32, 35, 97,110,115,119,101,114,
-  115, 32, 62, 32, 48, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32, 97,
-  110,115,119,101,114,115, 46,110, 97,109,101, 32, 61, 32,103,101,116, 95,
-  110, 97,109,101, 40,108,105,116,101,114, 97,108, 46,112,114,101,100, 41,
-   10, 32, 32, 32, 32, 32, 32, 97,110,115,119,101,114,115, 46, 97,114,105,
-  116,121, 32, 61, 32,103,101,116, 95, 97,114,105,116,121, 40,108,105,116,
-  101,114, 97,108, 46,112,114,101,100, 41, 10, 32, 32, 32, 32, 32, 32,114,
-  101,116,117,114,110, 32, 97,110,115,119,101,114,115, 10, 32, 32, 32,101,
-  108,115,101, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,
-  105,108, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10, 45, 45, 32,
-   80, 82, 73, 77, 73, 84, 73, 86, 69, 83, 10, 10, 45, 45, 91, 91, 10, 10,
-   65, 32,112,114,105,109,105,116,105,118,101, 32,112,114,101,100,105, 99,
-   97,116,101, 44, 32, 97,108,115,111, 32, 99, 97,108,108,101,100, 32, 97,
-   32, 98,117,105,108,116, 45,105,110, 32,112,114,101,100,105, 99, 97,116,
-  101, 44, 32,105,115, 10,105,109,112,108,101,109,101,110,116,101,100, 32,
-   98,121, 32, 99,111,100,101, 46, 32, 32, 65,115,115,101,114,116,105,111,
-  110,115, 32, 97, 98,111,117,116, 32, 97, 32,112,114,105,109,105,116,105,
-  118,101, 32,112,114,101,100,105, 99, 97,116,101, 32, 97,114,101, 10,105,
-  103,110,111,114,101,100, 44, 32, 97,115, 32,116,104,101, 32, 99,111,100,
-  101, 32,116, 97,107,101,115, 32,112,114,101, 99,101,100,101,110, 99,101,
-   46, 32, 32, 85,115,101, 32,116,104,101, 32,109, 97,107,101, 95,112,114,
-  101,100, 32,102,117,110, 99,116,105,111,110, 32,116,111, 10, 97, 99, 99,
-  101,115,115, 32, 97, 32,112,114,105,109,105,116,105,118,101, 32, 98,121,
-   32,110, 97,109,101, 46, 10, 10, 84,104,101, 32, 98,101,104, 97,118,105,
-  111,114, 32,111,102, 32, 97, 32,112,114,105,109,105,116,105,118,101, 32,
-  112,114,101,100,105, 99, 97,116,101, 32,105,115, 32,100,101,102,105,110,
-  101,100, 32, 98,121, 32, 97,100,100,105,110,103, 32, 97, 32,102,117,110,
-   99,116,105,111,110, 10,116,111, 32,116,104,101, 32,112,114,101,100,105,
-   99, 97,116,101, 39,115, 32,112,114,105,109, 32,102,105,101,108,100, 46,
-   32, 32, 84,104,101, 32,102,117,110, 99,116,105,111,110, 32,116, 97,107,
-  101,115, 32, 97, 32,108,105,116,101,114, 97,108, 32, 97,110,100, 32, 97,
-   10,115,117, 98,103,111, 97,108, 46, 32, 32, 84,104,101, 32,116,121,112,
-  105, 99, 97,108, 32,112,114,105,109,105,116,105,118,101, 32,100,101,114,
-  105,118,101,115, 32, 97, 32,115,101,116, 32,111,102, 32,102, 97, 99,116,
-  115, 32,102,114,111,109, 32,116,104,101, 10,108,105,116,101,114, 97,108,
-   44, 32, 97,110,100, 32,102,111,114, 32,101, 97, 99,104, 32,100,101,114,
-  105,118,101,100, 32,102, 97, 99,116, 32,102, 44, 32,114,101,112,111,114,
-  116,115, 32,116,104,101, 32,114,101,115,117,108,116, 32, 98,121, 32,105,
-  110,118,111,107,105,110,103, 10,102, 97, 99,116, 40,115,117, 98,103,111,
-   97,108, 44, 32,102, 41, 46, 10, 10, 84,104,101, 32,101,113,117, 97,108,
-  115, 32,112,114,105,109,105,116,105,118,101, 32,100,101,102,105,110,101,
-  100, 32, 98,101,108,111,119, 32,105,115, 32,112,114,111,116,101, 99,116,
-  101,100, 32,102,114,111,109, 32,103, 97,114, 97,103,101, 32, 99,111,108,
-  108,101, 99,116,105,111,110, 10, 98,101, 99, 97,117,115,101, 32,116,104,
-  101, 32,112,114,105,109,105,116,105,118,101, 32,105,115, 32, 98,111,117,
-  110,100, 32,116,111, 32, 97, 32,108,111, 99, 97,108, 32,118, 97,114,105,
-   97, 98,108,101, 46, 32, 32, 65, 32,112,114,105,109,105,116,105,118,101,
-   32,110,111,116, 10,115,116,111,114,101,100, 32,105,110, 32, 97, 32, 76,
-  117, 97, 32,100, 97,116, 97, 32,115,116,114,117, 99,116,117,114,101, 32,
-   99, 97,110, 32, 98,101, 32,112,114,111,116,101, 99,116,101,100, 32, 98,
-  121, 32,101,110,116,101,114,105,110,103, 32,105,116, 32,105,110,116,111,
-   10,116,104,101, 32,112,114,101,100,105, 99, 97,116,101, 32,100, 97,116,
-   97, 98, 97,115,101, 32,117,115,101,100, 32, 98,121, 32, 97,115,115,101,
-  114,116, 32, 97,110,100, 32,114,101,116,114, 97, 99,116, 46, 32, 32, 70,
-  111,114, 32,112,114,105,109,105,116,105,118,101,115, 10, 99,114,101, 97,
-  116,101,100, 32,102,114,111,109, 32, 67, 44, 32,112,114,111,116,101, 99,
-  116,105,111,110, 32,109, 97,121, 32, 98,101, 32,112,114,111,118,105,100,
-  101,100, 32, 98,121, 32,101,110,116,101,114,105,110,103, 32,116,104,101,
-   32,112,114,101,100,105, 99, 97,116,101, 10,105,110,116,111, 32,116,104,
-  101, 32, 76,117, 97, 32,114,101,103,105,115,116,114,121, 46, 10, 10, 85,
-  115,101, 32,116,104,101, 32, 97,100,100, 95,105,116,101,114, 95,112,114,
-  105,109, 32,102,117,110, 99,116,105,111,110, 32,116,111, 32, 97,100,100,
-   32, 97, 32,112,114,105,109,105,116,105,118,101, 32,112,114,101,100,105,
-   99, 97,116,101, 32,116,104, 97,116, 32, 99, 97,110, 10,100,101,102,105,
-  110,101,100, 32, 98,121, 32, 97,110, 32,105,116,101,114, 97,116,111,114,
-   32,119,104,105, 99,104, 32,119,104,101,110, 32,103,105,118,101,110, 32,
-   97, 32,108,105,116,101,114, 97,108, 44, 32,103,101,110,101,114, 97,116,
-  101,115, 32, 97, 10,115,101,113,117,101,110, 99,101, 32,111,102, 32, 97,
-  110,115,119,101,114,115, 44, 32,101, 97, 99,104, 32, 97,110,115,119,101,
-  114, 32, 98,101,105,110,103, 32, 97,110, 32, 97,114,114, 97,121, 32,111,
-  102, 32,115,116,114,105,110,103,115, 32,111,114, 32,110,117,109, 98,101,
-  114,115, 46, 10, 10, 93, 93, 10, 10, 45, 45, 32, 79,116,104,101,114, 32,
-  112, 97,114,116,115, 32,111,102, 32,116,104,101, 32, 68, 97,116, 97,108,
-  111,103, 32,115,121,115,116,101,109, 32,100,101,112,101,110,100, 32,111,
-  110, 32,116,104,101, 32,101,113,117, 97,108,105,116,121, 32,112,114,105,
-  109,105,116,105,118,101, 44, 10, 45, 45, 32,115,111, 32, 99, 97,114,101,
-  102,117,108,108,121, 32, 99,111,110,115,105,100,101,114, 32, 97,110,121,
-   32,109,111,100,105,102,105, 99, 97,116,105,111,110,115, 32,116,111, 32,
-  105,116, 46, 10, 10,100,111,  9,  9,  9,  9, 45, 45, 32,101,113,117, 97,
-  108,115, 32,112,114,105,109,105,116,105,118,101, 10, 32, 32, 32,108,111,
-   99, 97,108, 32, 98,105,110, 97,114,121, 95,101,113,117, 97,108,115, 95,
-  112,114,101,100, 32, 61, 32,109, 97,107,101, 95,112,114,101,100, 40, 34,
-   61, 34, 44, 32, 50, 41, 10, 10, 32, 32, 32,108,111, 99, 97,108, 32,102,
-  117,110, 99,116,105,111,110, 32,101,113,117, 97,108,115, 95,112,114,105,
-  109,105,116,105,118,101, 40,108,105,116,101,114, 97,108, 44, 32,115,117,
-   98,103,111, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108,
-   32,120, 32, 61, 32,108,105,116,101,114, 97,108, 91, 49, 93, 10, 32, 32,
-   32, 32, 32, 32,108,111, 99, 97,108, 32,121, 32, 61, 32,108,105,116,101,
-  114, 97,108, 91, 50, 93, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108,
-   32,101,110,118, 32, 61, 32,120, 58,117,110,105,102,121, 40,121, 44, 32,
-  123,125, 41, 45, 45, 32, 66,111,116,104, 32,116,101,114,109,115, 32,109,
-  117,115,116, 32,117,110,105,102,121, 44, 10, 32, 32, 32, 32, 32, 32,105,
-  102, 32,101,110,118, 32,116,104,101,110,  9,  9, 45, 45, 32, 97,110,100,
-   32, 97,116, 32,108,101, 97,115,116, 32,111,110,101, 32,111,102, 32,116,
-  104,101,109, 10,  9, 32,120, 32, 61, 32,120, 58,115,117, 98,115,116, 40,
-  101,110,118, 41,  9, 45, 45, 32,109,117,115,116, 32, 98,101, 32, 97, 32,
-   99,111,110,115,116, 97,110,116, 46, 10,  9, 32,121, 32, 61, 32,121, 58,
-  115,117, 98,115,116, 40,101,110,118, 41, 10, 32, 32, 32, 32, 32, 32,101,
-  110,100, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,120, 58,
-  101,113,117, 97,108,115, 95,112,114,105,109,105,116,105,118,101, 40,121,
-   44, 32,115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32,101,110,100, 10,
-   10, 32, 32, 32,102,117,110, 99,116,105,111,110, 32, 86, 97,114, 58,101,
-  113,117, 97,108,115, 95,112,114,105,109,105,116,105,118,101, 40,116,101,
-  114,109, 44, 32,115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32,101,110,
-  100, 10, 10, 32, 32, 32,102,117,110, 99,116,105,111,110, 32, 67,111,110,
-  115,116, 58,101,113,117, 97,108,115, 95,112,114,105,109,105,116,105,118,
-  101, 40,116,101,114,109, 44, 32,115,117, 98,103,111, 97,108, 41, 10, 32,
-   32, 32, 32, 32, 32,105,102, 32,115,101,108,102, 32, 61, 61, 32,116,101,
-  114,109, 32,116,104,101,110,  9, 45, 45, 32, 66,111,116,104, 32,116,101,
-  114,109,115, 32, 97,114,101, 32, 99,111,110,115,116, 97,110,116, 32, 97,
-  110,100, 32,101,113,117, 97,108, 46, 10,  9, 32,108,111, 99, 97,108, 32,
-  108,105,116,101,114, 97,108, 32, 61, 32,123,112,114,101,100, 32, 61, 32,
-   98,105,110, 97,114,121, 95,101,113,117, 97,108,115, 95,112,114,101,100,
-   44, 32,115,101,108,102, 44, 32,115,101,108,102,125, 10,  9, 32,114,101,
-  116,117,114,110, 32,102, 97, 99,116, 40,115,117, 98,103,111, 97,108, 44,
-   32,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,101,110,
-  100, 10, 32, 32, 32,101,110,100, 10, 10, 32, 32, 32, 98,105,110, 97,114,
-  121, 95,101,113,117, 97,108,115, 95,112,114,101,100, 46,112,114,105,109,
-   32, 61, 32,101,113,117, 97,108,115, 95,112,114,105,109,105,116,105,118,
-  101, 10,101,110,100, 10, 10, 45, 45, 32, 68,111,101,115, 32, 97, 32,108,
-  105,116,101,114, 97,108, 32,117,110,105,102,121, 32,119,105,116,104, 32,
-   97,110, 32,102, 97, 99,116, 32,107,110,111,119,110, 32,116,111, 32, 99,
-  111,110,116, 97,105,110, 32,111,110,108,121, 32, 99,111,110,115,116, 97,
-  110,116, 10, 45, 45, 32,116,101,114,109,115, 63, 10, 10,108,111, 99, 97,
-  108, 32,102,117,110, 99,116,105,111,110, 32,109, 97,116, 99,104, 40,108,
-  105,116,101,114, 97,108, 44, 32,102, 97, 99,116, 41, 10, 32, 32, 32,108,
-  111, 99, 97,108, 32,101,110,118, 32, 61, 32,123,125, 10, 32, 32, 32,102,
+  115,101, 40,119, 97,105,116,101,114, 46,115,117, 98,103,111, 97,108, 44,
+   32,114,101,115,111,108,118,101,110,116, 41, 10,  9, 32,101,110,100, 10,
+   32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10,101,
+  110,100, 10, 10, 45, 45, 32, 85,115,101, 32, 97, 32,110,101,119,108,121,
+   32,100,101,114,105,118,101,100, 32,114,117,108,101, 46, 10, 10,102,117,
+  110, 99,116,105,111,110, 32,114,117,108,101, 40,115,117, 98,103,111, 97,
+  108, 44, 32, 99,108, 97,117,115,101, 44, 32,115,101,108,101, 99,116,101,
+  100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,115,103, 32, 61, 32,102,
+  105,110,100, 40,115,101,108,101, 99,116,101,100, 41, 10, 32, 32, 32,105,
+  102, 32,115,103, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,105,102,
+   32,110,111,116, 32,115,103, 46, 99,111,109,112,108,101,116,101, 32,116,
+  104,101,110, 10,  9, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116,
+   40,115,103, 46,119, 97,105,116,101,114,115, 44, 32,123,115,117, 98,103,
+  111, 97,108, 32, 61, 32,115,117, 98,103,111, 97,108, 44, 32, 99,108, 97,
+  117,115,101, 32, 61, 32, 99,108, 97,117,115,101,125, 41, 10, 32, 32, 32,
+   32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108,
+   32,116,111,100,111, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32, 32,102,
+  111,114, 32,105,100, 44,102, 97, 99,116, 32,105,110, 32,112, 97,105,114,
+  115, 40,115,103, 46,102, 97, 99,116,115, 41, 32,100,111, 10,  9, 32,108,
+  111, 99, 97,108, 32,114,101,115,111,108,118,101,110,116, 32, 61, 32,114,
+  101,115,111,108,118,101, 40, 99,108, 97,117,115,101, 44, 32,102, 97, 99,
+  116, 41, 10,  9, 32,105,102, 32,114,101,115,111,108,118,101,110,116, 32,
+  116,104,101,110, 10,  9, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,110,
+  115,101,114,116, 40,116,111,100,111, 44, 32,114,101,115,111,108,118,101,
+  110,116, 41, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,116,
+  111,100,111, 32,100,111, 10,  9, 32, 97,100,100, 95, 99,108, 97,117,115,
+  101, 40,115,117, 98,103,111, 97,108, 44, 32,116,111,100,111, 91,105, 93,
+   41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,108,115,
+  101, 10, 32, 32, 32, 32, 32, 32,115,103, 32, 61, 32,109, 97,107,101, 95,
+  115,117, 98,103,111, 97,108, 40,115,101,108,101, 99,116,101,100, 41, 10,
+   32, 32, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116,
+   40,115,103, 46,119, 97,105,116,101,114,115, 44, 32,123,115,117, 98,103,
+  111, 97,108, 32, 61, 32,115,117, 98,103,111, 97,108, 44, 32, 99,108, 97,
+  117,115,101, 32, 61, 32, 99,108, 97,117,115,101,125, 41, 10, 32, 32, 32,
+   32, 32, 32,109,101,114,103,101, 40,115,103, 41, 10, 32, 32, 32, 32, 32,
+   32,114,101,116,117,114,110, 32,115,101, 97,114, 99,104, 40,115,103, 41,
+   10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,102,117,110, 99,116,
+  105,111,110, 32, 97,100,100, 95, 99,108, 97,117,115,101, 40,115,117, 98,
+  103,111, 97,108, 44, 32, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,105,
+  102, 32, 35, 99,108, 97,117,115,101, 32, 61, 61, 32, 48, 32,116,104,101,
+  110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,102, 97, 99,
+  116, 40,115,117, 98,103,111, 97,108, 44, 32, 99,108, 97,117,115,101, 46,
+  104,101, 97,100, 41, 10, 32, 32, 32,101,108,115,101, 10, 32, 32, 32, 32,
+   32, 32,114,101,116,117,114,110, 32,114,117,108,101, 40,115,117, 98,103,
+  111, 97,108, 44, 32, 99,108, 97,117,115,101, 44, 32, 99,108, 97,117,115,
+  101, 91, 49, 93, 41, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,
+   45, 45, 32, 83,101, 97,114, 99,104, 32,102,111,114, 32,100,101,114,105,
+  118, 97,116,105,111,110,115, 32,111,102, 32,116,104,101, 32,108,105,116,
+  101,114, 97,108, 32, 97,115,115,111, 99,105, 97,116,101,100, 32,119,105,
+  116,104, 32,116,104,105,115, 32,115,117, 98,103,111, 97,108, 46, 10, 10,
+   45, 45, 32, 70, 97, 99,116,115, 32, 97,114,101, 32,103,114,111,117,110,
+  100, 44, 32,115,111, 32,116,104,101,121, 32,110,101,101,100, 32,110,111,
+  116, 32, 98,101, 32,114,101,110, 97,109,101,100, 44, 32, 97,110,100, 32,
+   97, 32,102, 97, 99,116, 32,102,111,117,110,100, 10, 45, 45, 32, 98,121,
+   32,116,104,101, 32,102, 97, 99,116, 32,115,116,111,114,101, 32,105,115,
+   32,105,116,115,101,108,102, 32, 97,110, 32, 97,110,115,119,101,114, 46,
+   10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,115,
+  101, 97,114, 99,104, 95, 99,108, 97,117,115,101,115, 40,115,117, 98,103,
+  111, 97,108, 44, 32, 99,108, 97,117,115,101,115, 41, 10, 32, 32, 32,108,
+  111, 99, 97,108, 32,108,105,116,101,114, 97,108, 32, 61, 32,115,117, 98,
+  103,111, 97,108, 46,108,105,116,101,114, 97,108, 10, 32, 32, 32,102,111,
+  114, 32,105,100, 44, 99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,
+  114,115, 40, 99,108, 97,117,115,101,115, 41, 32,100,111, 10, 32, 32, 32,
+   32, 32, 32,108,111, 99, 97,108, 32,114,101,110, 97,109,101,100, 32, 61,
+   32,114,101,110, 97,109,101, 95, 99,108, 97,117,115,101, 40, 99,108, 97,
+  117,115,101, 41, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,101,
+  110,118, 32, 61, 32,117,110,105,102,121, 40,108,105,116,101,114, 97,108,
+   44, 32,114,101,110, 97,109,101,100, 46,104,101, 97,100, 41, 10, 32, 32,
+   32, 32, 32, 32,105,102, 32,101,110,118, 32,116,104,101,110, 10,  9, 32,
+   97,100,100, 95, 99,108, 97,117,115,101, 40,115,117, 98,103,111, 97,108,
+   44, 32,114,101,111,114,100,101,114, 40,115,117, 98,115,116, 95,105,110,
+   95, 99,108, 97,117,115,101, 40,114,101,110, 97,109,101,100, 44, 32,101,
+  110,118, 41, 41, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,101,110,100, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110,
+   32,115,101, 97,114, 99,104, 40,115,117, 98,103,111, 97,108, 41, 10, 32,
+   32, 32,108,111, 99, 97,108, 32,108,105,116,101,114, 97,108, 32, 61, 32,
+  115,117, 98,103,111, 97,108, 46,108,105,116,101,114, 97,108, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,112,114,101,100, 32, 61, 32,108,105,116,101,
+  114, 97,108, 46,112,114,101,100, 10, 32, 32, 32,105,102, 32,112,114,101,
+  100, 46,112,114,105,109, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,
+  114,101,116,117,114,110, 32,112,114,101,100, 46,112,114,105,109, 40,108,
+  105,116,101,114, 97,108, 44, 32,115,117, 98,103,111, 97,108, 41, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,102, 97, 99,
+  116,115, 32, 61, 32,112,114,101,100, 46,118,105,101,119, 32, 97,110,100,
+   32,112,114,101,100, 46,118,105,101,119, 46,102, 97, 99,116,115, 32,111,
+  114, 32,112,114,101,100, 46,102, 97, 99,116,115, 10, 32, 32, 32,105,102,
+   32,102, 97, 99,116,115, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,
+  108,111, 99, 97,108, 32,102,111,117,110,100, 32, 61, 32,102, 97, 99,116,
+  115, 58,115,101, 97,114, 99,104, 40,108,105,116,101,114, 97,108, 44, 32,
+   99,111,110,115,116, 95,111,102, 95,115,121,109, 41, 10, 32, 32, 32, 32,
+   32, 32,102,111,114, 32,105, 61, 49, 44, 35,102,111,117,110,100, 32,100,
+  111, 10,  9, 32,102, 97, 99,116, 40,115,117, 98,103,111, 97,108, 44, 32,
+  102,111,117,110,100, 91,105, 93, 41, 10, 32, 32, 32, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,105,102, 32,112,114,101,
+  100, 46,118,105,101,119, 32,116,104,101,110,  9,  9, 45, 45, 32, 84,104,
+  101, 32,114,117,108,101,115, 32, 97,114,101, 32,110,111,116, 32,117,115,
+  101,100, 46, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32, 99,111,110,
+  115,116,115, 44, 32,118, 97,114,115, 32, 61, 32, 99, 97,110,100,105,100,
+   97,116,101,115, 40,108,105,116,101,114, 97,108, 44, 32,112,114,101,100,
+   41, 10, 32, 32, 32,105,102, 32,110,111,116, 32, 99,111,110,115,116,115,
+   32,116,104,101,110,  9,  9, 45, 45, 32, 78,111, 32, 99,111,110,115,116,
+   97,110,116, 32,116,111, 32,108,111,111,107, 32,117,112, 46, 10, 32, 32,
+   32, 32, 32, 32,114,101,116,117,114,110, 32,115,101, 97,114, 99,104, 95,
+   99,108, 97,117,115,101,115, 40,115,117, 98,103,111, 97,108, 44, 32,112,
+  114,101,100, 46,100, 98, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  115,101, 97,114, 99,104, 95, 99,108, 97,117,115,101,115, 40,115,117, 98,
+  103,111, 97,108, 44, 32, 99,111,110,115,116,115, 46, 99,108, 97,117,115,
+  101,115, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,115,101, 97,114,
+   99,104, 95, 99,108, 97,117,115,101,115, 40,115,117, 98,103,111, 97,108,
+   44, 32,118, 97,114,115, 46, 99,108, 97,117,115,101,115, 41, 10,101,110,
+  100, 10, 10, 45, 45, 32, 83,101,116,115, 32,117,112, 32, 97,110,100, 32,
+   99, 97,108,108,115, 32,116,104,101, 32,115,117, 98,103,111, 97,108, 32,
+  115,101, 97,114, 99,104, 32,112,114,111, 99,101,100,117,114,101, 44, 32,
+   97,110,100, 32,116,104,101,110, 32,101,120,116,114, 97, 99,116,115, 10,
+   45, 45, 32,116,104,101, 32, 97,110,115,119,101,114,115, 32,105,110,116,
+  111, 32, 97,110, 32,101, 97,115,105,108,121, 32,117,115,101,100, 32,116,
+   97, 98,108,101, 46, 32, 32, 84,104,101, 32,116, 97, 98,108,101, 32,104,
+   97,115, 32,116,104,101, 32,110, 97,109,101, 32,111,102, 10, 45, 45, 32,
+  116,104,101, 32,112,114,101,100,105, 99, 97,116,101, 44, 32,116,104,101,
+   32,112,114,101,100,105, 99, 97,116,101, 39,115, 32, 97,114,105,116,121,
+   44, 32, 97,110,100, 32, 97,110, 32, 97,114,114, 97,121, 32,111,102, 32,
+   99,111,110,115,116, 97,110,116, 10, 45, 45, 32,116,101,114,109,115, 32,
+  102,111,114, 32,101, 97, 99,104, 32, 97,110,115,119,101,114, 46, 32, 32,
+   73,102, 32,116,104,101,114,101, 32, 97,114,101, 32,110,111, 32, 97,110,
+  115,119,101,114,115, 44, 32,110,105,108, 32,105,115, 32,114,101,116,117,
+  114,110,101,100, 46, 10, 10, 45, 45, 32, 79,110, 99,101, 32,116,104,101,
+   32,115,101, 97,114, 99,104, 32,114,101,116,117,114,110,115, 44, 32,101,
+  118,101,114,121, 32,115,117, 98,103,111, 97,108, 32,105,116, 32, 97,100,
+  100,101,100, 32,104, 97,115, 32, 98,101,101,110, 32, 99,111,109,112,108,
+  101,116,101,108,121, 10, 45, 45, 32,101,118, 97,108,117, 97,116,101,100,
+   44, 32, 97,110,100, 32,114,101,109, 97,105,110,115, 32,105,110, 32,105,
+  116,115, 32,116, 97, 98,108,101, 32,117,110,116,105,108, 32,105,110,118,
+   97,108,105,100, 97,116,101,100, 46, 10, 10,108,111, 99, 97,108, 32,102,
+  117,110, 99,116,105,111,110, 32,115,111,108,118,101, 40,108,105,116,101,
+  114, 97,108, 41, 10, 32, 32, 32,105,102, 32,102,114,101,115,104, 32,116,
+  104,101,110,  9,  9, 45, 45, 32, 84,104,101, 32,108, 97,115,116, 32,113,
+  117,101,114,121, 32,102, 97,105,108,101,100, 46, 10, 32, 32, 32, 32, 32,
+   32,105,110,118, 97,108,105,100, 97,116,101, 95, 97,108,108, 40, 41, 10,
+   32, 32, 32,101,110,100, 10, 32, 32, 32,102,114,101,115,104, 32, 61, 32,
+  123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32,115,117, 98,103,111, 97,
+  108, 32, 61, 32,102,105,110,100, 40,108,105,116,101,114, 97,108, 41, 10,
+   32, 32, 32,105,102, 32,110,111,116, 32,115,117, 98,103,111, 97,108, 32,
+  116,104,101,110, 10, 32, 32, 32, 32, 32, 32,115,117, 98,103,111, 97,108,
+   32, 61, 32,109, 97,107,101, 95,115,117, 98,103,111, 97,108, 40,108,105,
+  116,101,114, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,109,101,114,103,101,
+   40,115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,115,101,
+   97,114, 99,104, 40,115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32,101,
+  110,100, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,102,114,101,
+  115,104, 32,100,111, 10, 32, 32, 32, 32, 32, 32,102,114,101,115,104, 91,
+  105, 93, 46, 99,111,109,112,108,101,116,101, 32, 61, 32,116,114,117,101,
+   10, 32, 32, 32, 32, 32, 32,102,114,101,115,104, 91,105, 93, 46,119, 97,
+  105,116,101,114,115, 32, 61, 32,123,125, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,102,114,101,115,104, 32, 61, 32,110,105,108, 10, 32, 32, 32,
+  114,101,116,117,114,110, 32,115,117, 98,103,111, 97,108, 10,101,110,100,
+   10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32, 97,
+  115,107, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,108,111, 99,
+   97,108, 32,115,117, 98,103,111, 97,108, 32, 61, 32,115,111,108,118,101,
+   40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,108,111, 99, 97,108,
+   32, 97,110,115,119,101,114,115, 32, 61, 32,123,125, 10, 32, 32, 32,102,
+  111,114, 32,105,100, 44,108,105,116,101,114, 97,108, 32,105,110, 32,112,
+   97,105,114,115, 40,115,117, 98,103,111, 97,108, 46,102, 97, 99,116,115,
+   41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32, 97,
+  110,115,119,101,114, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32, 32,102,
   111,114, 32,105, 61, 49, 44, 35,108,105,116,101,114, 97,108, 32,100,111,
-   10, 32, 32, 32, 32, 32, 32,105,102, 32,108,105,116,101,114, 97,108, 91,
-  105, 93, 32,126, 61, 32,102, 97, 99,116, 91,105, 93, 32,116,104,101,110,
-   10,  9, 32,101,110,118, 32, 61, 32,108,105,116,101,114, 97,108, 91,105,
-   93, 58,109, 97,116, 99,104, 40,102, 97, 99,116, 91,105, 93, 44, 32,101,
-  110,118, 41, 10,  9, 32,105,102, 32,110,111,116, 32,101,110,118, 32,116,
-  104,101,110, 10,  9, 32, 32, 32, 32,114,101,116,117,114,110, 32,101,110,
-  118, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10,
-   32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,101,
-  110,118, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 67,
-  111,110,115,116, 58,109, 97,116, 99,104, 40, 99,111,110,115,116, 44, 32,
-  101,110,118, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108,
-   10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 86, 97,114,
-   58,109, 97,116, 99,104, 40, 99,111,110,115,116, 44, 32,101,110,118, 41,
-   10, 32, 32, 32,108,111, 99, 97,108, 32,116,101,114,109, 32, 61, 32,101,
-  110,118, 91,115,101,108,102, 93, 10, 32, 32, 32,105,102, 32,110,111,116,
-   32,116,101,114,109, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,101,
-  110,118, 91,115,101,108,102, 93, 32, 61, 32, 99,111,110,115,116, 10, 32,
-   32, 32, 32, 32, 32,114,101,116,117,114,110, 32,101,110,118, 10, 32, 32,
-   32,101,108,115,101,105,102, 32,116,101,114,109, 32, 61, 61, 32, 99,111,
-  110,115,116, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,
-  117,114,110, 32,101,110,118, 10, 32, 32, 32,101,108,115,101, 10, 32, 32,
-   32, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108, 10, 32, 32, 32,
-  101,110,100, 10,101,110,100, 10, 10, 45, 45, 32, 65,100,100, 32, 97, 32,
-  112,114,105,109,105,116,105,118,101, 32,116,104, 97,116, 32,105,115, 32,
-  100,101,102,105,110,101,100, 32, 98,121, 32, 97,110, 32,105,116,101,114,
-   97,116,111,114, 46, 32, 32, 87,104,101,110, 32,103,105,118,101,110, 32,
-   97, 10, 45, 45, 32,108,105,116,101,114, 97,108, 44, 32,116,104,101, 32,
-  105,116,101,114, 97,116,111,114, 32,103,101,110,101,114, 97,116,101,115,
-   32, 97, 32,115,101,113,117,101,110, 99,101,115, 32,111,102, 32, 97,110,
-  115,119,101,114,115, 46, 32, 32, 69, 97, 99,104, 10, 45, 45, 32, 97,110,
-  115,119,101,114, 32,105,115, 32, 97,110, 32, 97,114,114, 97,121, 46, 32,
-   32, 69, 97, 99,104, 32,101,108,101,109,101,110,116, 32,105,110, 32,116,
-  104,101, 32, 97,114,114, 97,121, 32,105,115, 32,101,105,116,104,101,114,
-   32, 97, 32,110,117,109, 98,101,114, 10, 45, 45, 32,111,114, 32, 97, 32,
-  115,116,114,105,110,103, 46, 32, 32, 84,104,101, 32,108,101,110,103,116,
-  104, 32,111,102, 32,116,104,101, 32, 97,114,114, 97,121, 32,105,115, 32,
-  101,113,117, 97,108, 32,116,111, 32,116,104,101, 32, 97,114,105,116,121,
-   32,111,102, 32,116,104,101, 10, 45, 45, 32,112,114,101,100,105, 99, 97,
-  116,101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,
-  110, 32, 97,100,100, 95,105,116,101,114, 95,112,114,105,109, 40,110, 97,
-  109,101, 44, 32, 97,114,105,116,121, 44, 32,105,116,101,114, 41, 10, 32,
-   32, 32,108,111, 99, 97,108, 32,112,114,101,100, 32, 61, 32,109, 97,107,
-  101, 95,112,114,101,100, 40,110, 97,109,101, 44, 32, 97,114,105,116,121,
-   41, 10, 32, 32, 32,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,
-  110, 32,112,114,105,109, 40,108,105,116,101,114, 97,108, 44, 32,115,117,
-   98,103,111, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,116,
-  101,114,109,115, 32,105,110, 32,105,116,101,114, 40,108,105,116,101,114,
-   97,108, 41, 32,100,111, 10,  9, 32,108,111, 99, 97,108, 32,110, 32, 61,
-   32, 35,116,101,114,109,115, 10,  9, 32,105,102, 32,110, 32, 61, 61, 32,
-   97,114,105,116,121, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,108,111,
-   99, 97,108, 32,110,101,119, 32, 61, 32,123,112,114,101,100, 32, 61, 32,
-  112,114,101,100,125, 10,  9, 32, 32, 32, 32,102,111,114, 32,105, 61, 49,
-   44,110, 32,100,111, 10,  9, 32, 32, 32, 32, 32, 32, 32,110,101,119, 91,
-  105, 93, 32, 61, 32,109, 97,107,101, 95, 99,111,110,115,116, 40,116,101,
-  114,109,115, 91,105, 93, 41, 10,  9, 32, 32, 32, 32,101,110,100, 10,  9,
-   32, 32, 32, 32,105,102, 32,109, 97,116, 99,104, 40,108,105,116,101,114,
-   97,108, 44, 32,110,101,119, 41, 32,116,104,101,110, 10,  9, 32, 32, 32,
-   32, 32, 32, 32,102, 97, 99,116, 40,115,117, 98,103,111, 97,108, 44, 32,
-  110,101,119, 41, 10,  9, 32, 32, 32, 32,101,110,100, 10,  9, 32,101,110,
+   32, 45, 45, 32, 69, 97, 99,104, 32,116,101,114,109, 32,105,110, 32, 97,
+  110, 32, 97,110,115,119,101,114, 32,119,105,108,108, 32, 98,101, 10,  9,
+   32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40, 97,110,115,119,
+  101,114, 44, 32,108,105,116,101,114, 97,108, 91,105, 93, 46,105,100, 41,
+   32, 45, 45, 32, 97, 32, 99,111,110,115,116, 97,110,116, 46, 10, 32, 32,
+   32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,116, 97, 98,108,
+  101, 46,105,110,115,101,114,116, 40, 97,110,115,119,101,114,115, 44, 32,
+   97,110,115,119,101,114, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  105,102, 32, 35, 97,110,115,119,101,114,115, 32, 62, 32, 48, 32,116,104,
+  101,110, 10, 32, 32, 32, 32, 32, 32, 97,110,115,119,101,114,115, 46,110,
+   97,109,101, 32, 61, 32,103,101,116, 95,110, 97,109,101, 40,108,105,116,
+  101,114, 97,108, 46,112,114,101,100, 41, 10, 32, 32, 32, 32, 32, 32, 97,
+  110,115,119,101,114,115, 46, 97,114,105,116,121, 32, 61, 32,103,101,116,
+   95, 97,114,105,116,121, 40,108,105,116,101,114, 97,108, 46,112,114,101,
+  100, 41, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32, 97,110,
+  115,119,101,114,115, 10, 32, 32, 32,101,108,115,101, 10, 32, 32, 32, 32,
+   32, 32,114,101,116,117,114,110, 32,110,105,108, 10, 32, 32, 32,101,110,
+  100, 10,101,110,100, 10, 10, 45, 45, 32, 65,103,103,114,101,103, 97,116,
+  101,115, 10, 10, 45, 45, 32, 65,110, 32, 97,103,103,114,101,103, 97,116,
+  101, 32,113,117,101,114,121, 32,103,114,111,117,112,115, 32,116,104,101,
+   32, 97,110,115,119,101,114,115, 32,116,111, 32, 97, 32,108,105,116,101,
+  114, 97,108, 32, 98,121, 32,116,104,101, 32,116,101,114,109,115, 32, 97,
+  116, 10, 45, 45, 32,116,104,101, 32,112,111,115,105,116,105,111,110,115,
+   32,108,105,115,116,101,100, 32,105,110, 32,103,114,111,117,112, 44, 32,
+   97,110,100, 32,103,105,118,101,115, 32,111,110,101, 32, 97,110,115,119,
+  101,114, 32,112,101,114, 32,103,114,111,117,112, 46, 32, 32, 73,116, 10,
+   45, 45, 32,104, 97,115, 32,116,104,101, 32, 99,111,110,115,116, 97,110,
+  116,115, 32,111,102, 32,116,104,101, 32,103,114,111,117,112, 44, 32,102,
+  111,108,108,111,119,101,100, 32, 98,121, 32,116,104,101, 32,114,101,115,
+  117,108,116, 32,111,102, 32, 97,110, 10, 45, 45, 32,111,112,101,114, 97,
+  116,105,111,110, 32,111,110, 32,116,104,101, 32, 97,110,115,119,101,114,
+  115, 32,105,110, 32,116,104,101, 32,103,114,111,117,112, 46, 32, 32, 84,
+  104,101, 32, 99,111,117,110,116, 32,111,112,101,114, 97,116,105,111,110,
+   32, 99,111,117,110,116,115, 10, 45, 45, 32,116,104,101,109, 46, 32, 32,
+   84,104,101, 32,115,117,109, 44, 32,109,105,110, 32, 97,110,100, 32,109,
+   97,120, 32,111,112,101,114, 97,116,105,111,110,115, 32, 97,112,112,108,
+  121, 32,116,111, 32,116,104,101, 32, 99,111,110,115,116, 97,110,116,115,
+   32, 97,116, 10, 45, 45, 32,112,111,115,105,116,105,111,110, 32, 99,111,
+  108,117,109,110, 32,116,104, 97,116, 32, 97,114,101, 32,110,117,109, 98,
+  101,114,115, 44, 32, 97,110,100, 32,111,116,104,101,114, 32, 97,110,115,
+  119,101,114,115, 32, 97,114,101, 32,105,103,110,111,114,101,100, 44, 10,
+   45, 45, 32, 97,108,111,110,103, 32,119,105,116,104, 32,103,114,111,117,
+  112,115, 32,116,104, 97,116, 32,104, 97,118,101, 32,110,111,110,101, 46,
+   32, 32, 82,101,115,117,108,116,115, 32, 97,114,101, 32,102,111,114,109,
+   97,116,116,101,100, 32,108,105,107,101, 32, 76,117, 97, 10, 45, 45, 32,
+  110,117,109, 98,101,114,115, 46, 32, 32, 84,104,101, 32, 97,110,115,119,
+  101,114,115, 32, 97,114,101, 32, 99,111,109, 98,105,110,101,100, 32, 97,
+  115, 32,116,104,101,121, 32, 97,114,101, 32,102,111,117,110,100, 32,105,
+  110, 32,116,104,101, 32,116, 97, 98,108,101, 10, 45, 45, 32,111,102, 32,
+  116,104,101, 32,108,105,116,101,114, 97,108, 44, 32,119,105,116,104,111,
+  117,116, 32,109, 97,107,105,110,103, 32, 97, 32, 99,111,112,121, 32,111,
+  102, 32,116,104,101,109, 46, 10, 10,108,111, 99, 97,108, 32, 97,103,103,
+  114,101,103, 97,116,101, 95,111,112,115, 32, 61, 32,123, 10, 32, 32, 32,
+   99,111,117,110,116, 32, 61, 32,102,117,110, 99,116,105,111,110, 40, 97,
+   99, 99, 44, 32,120, 41, 32,114,101,116,117,114,110, 32, 97, 99, 99, 32,
+   43, 32,120, 32,101,110,100, 44, 10, 32, 32, 32,115,117,109, 32, 61, 32,
+  102,117,110, 99,116,105,111,110, 40, 97, 99, 99, 44, 32,120, 41, 32,114,
+  101,116,117,114,110, 32, 97, 99, 99, 32, 43, 32,120, 32,101,110,100, 44,
+   10, 32, 32, 32,109,105,110, 32, 61, 32,102,117,110, 99,116,105,111,110,
+   40, 97, 99, 99, 44, 32,120, 41, 32,114,101,116,117,114,110, 32,120, 32,
+   60, 32, 97, 99, 99, 32, 97,110,100, 32,120, 32,111,114, 32, 97, 99, 99,
+   32,101,110,100, 44, 10, 32, 32, 32,109, 97,120, 32, 61, 32,102,117,110,
+   99,116,105,111,110, 40, 97, 99, 99, 44, 32,120, 41, 32,114,101,116,117,
+  114,110, 32,120, 32, 62, 32, 97, 99, 99, 32, 97,110,100, 32,120, 32,111,
+  114, 32, 97, 99, 99, 32,101,110,100, 44, 10,125, 10, 10,108,111, 99, 97,
+  108, 32,102,117,110, 99,116,105,111,110, 32, 97,103,103,114,101,103, 97,
+  116,101, 40,108,105,116,101,114, 97,108, 44, 32,111,112, 44, 32, 99,111,
+  108,117,109,110, 44, 32,103,114,111,117,112, 41, 10, 32, 32, 32,108,111,
+   99, 97,108, 32, 99,111,109, 98,105,110,101, 32, 61, 32, 97,103,103,114,
+  101,103, 97,116,101, 95,111,112,115, 91,111,112, 93, 10, 32, 32, 32,105,
+  102, 32,110,111,116, 32, 99,111,109, 98,105,110,101, 32,116,104,101,110,
+   10, 32, 32, 32, 32, 32, 32,101,114,114,111,114, 40, 34,117,110,107,110,
+  111,119,110, 32, 97,103,103,114,101,103, 97,116,101, 32,111,112,101,114,
+   97,116,105,111,110, 32, 34, 32, 46, 46, 32,116,111,115,116,114,105,110,
+  103, 40,111,112, 41, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108,
+  111, 99, 97,108, 32, 97,114,105,116,121, 32, 61, 32, 35,108,105,116,101,
+  114, 97,108, 10, 32, 32, 32,105,102, 32,111,112, 32,126, 61, 32, 34, 99,
+  111,117,110,116, 34, 32, 97,110,100, 32,110,111,116, 32, 40, 99,111,108,
+  117,109,110, 32, 62, 61, 32, 49, 32, 97,110,100, 32, 99,111,108,117,109,
+  110, 32, 60, 61, 32, 97,114,105,116,121, 41, 32,116,104,101,110, 10, 32,
+   32, 32, 32, 32, 32,101,114,114,111,114, 40, 34, 98, 97,100, 32, 97,103,
+  103,114,101,103, 97,116,101, 32, 99,111,108,117,109,110, 32, 34, 32, 46,
+   46, 32,116,111,115,116,114,105,110,103, 40, 99,111,108,117,109,110, 41,
+   41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,102,111,114, 32,105, 61,
+   49, 44, 35,103,114,111,117,112, 32,100,111, 10, 32, 32, 32, 32, 32, 32,
+  105,102, 32,110,111,116, 32, 40,103,114,111,117,112, 91,105, 93, 32, 62,
+   61, 32, 49, 32, 97,110,100, 32,103,114,111,117,112, 91,105, 93, 32, 60,
+   61, 32, 97,114,105,116,121, 41, 32,116,104,101,110, 10,  9, 32,101,114,
+  114,111,114, 40, 34, 98, 97,100, 32, 97,103,103,114,101,103, 97,116,101,
+   32,103,114,111,117,112, 32, 34, 32, 46, 46, 32,116,111,115,116,114,105,
+  110,103, 40,103,114,111,117,112, 91,105, 93, 41, 41, 10, 32, 32, 32, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108,111,
+   99, 97,108, 32,115,117, 98,103,111, 97,108, 32, 61, 32,115,111,108,118,
+  101, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,108,111, 99, 97,
+  108, 32,103,114,111,117,112,115, 32, 61, 32,123,125, 10, 32, 32, 32,108,
+  111, 99, 97,108, 32, 97,110,115,119,101,114,115, 32, 61, 32,123,125, 10,
+   32, 32, 32,102,111,114, 32,105,100, 44,102, 97, 99,116, 32,105,110, 32,
+  112, 97,105,114,115, 40,115,117, 98,103,111, 97,108, 46,102, 97, 99,116,
+  115, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,
+  118, 97,108,117,101, 32, 61, 32, 49, 10, 32, 32, 32, 32, 32, 32,105,102,
+   32,111,112, 32,126, 61, 32, 34, 99,111,117,110,116, 34, 32,116,104,101,
+  110, 10,  9, 32,118, 97,108,117,101, 32, 61, 32,116,111,110,117,109, 98,
+  101,114, 40,102, 97, 99,116, 91, 99,111,108,117,109,110, 93, 46,105,100,
+   41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,
+  105,102, 32,118, 97,108,117,101, 32,116,104,101,110, 10,  9, 32,102,111,
+  114, 32,105, 61, 49, 44, 35,103,114,111,117,112, 32,100,111, 10,  9, 32,
+   32, 32, 32,107,101,121, 95, 98,117,102, 91,105, 93, 32, 61, 32,102, 97,
+   99,116, 91,103,114,111,117,112, 91,105, 93, 93, 46,115,121,109, 10,  9,
+   32,101,110,100, 10,  9, 32,108,111, 99, 97,108, 32,107,101,121, 32, 61,
+   32,109, 97,107,101, 95,107,101,121, 40, 35,103,114,111,117,112, 41, 10,
+    9, 32,108,111, 99, 97,108, 32, 97,110,115,119,101,114, 32, 61, 32,103,
+  114,111,117,112,115, 91,107,101,121, 93, 10,  9, 32,105,102, 32, 97,110,
+  115,119,101,114, 32,116,104,101,110, 10,  9, 32, 32, 32, 32, 97,110,115,
+  119,101,114, 46,118, 97,108,117,101, 32, 61, 32, 99,111,109, 98,105,110,
+  101, 40, 97,110,115,119,101,114, 46,118, 97,108,117,101, 44, 32,118, 97,
+  108,117,101, 41, 10,  9, 32,101,108,115,101, 10,  9, 32, 32, 32, 32, 97,
+  110,115,119,101,114, 32, 61, 32,123,118, 97,108,117,101, 32, 61, 32,118,
+   97,108,117,101,125, 10,  9, 32, 32, 32, 32,102,111,114, 32,105, 61, 49,
+   44, 35,103,114,111,117,112, 32,100,111, 10,  9, 32, 32, 32, 32, 32, 32,
+   32, 97,110,115,119,101,114, 91,105, 93, 32, 61, 32,102, 97, 99,116, 91,
+  103,114,111,117,112, 91,105, 93, 93, 46,105,100, 10,  9, 32, 32, 32, 32,
+  101,110,100, 10,  9, 32, 32, 32, 32,103,114,111,117,112,115, 91,107,101,
+  121, 93, 32, 61, 32, 97,110,115,119,101,114, 10,  9, 32, 32, 32, 32,116,
+   97, 98,108,101, 46,105,110,115,101,114,116, 40, 97,110,115,119,101,114,
+  115, 44, 32, 97,110,115,119,101,114, 41, 10,  9, 32,101,110,100, 10, 32,
+   32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,105,102, 32, 35, 97,110,115,119,101,114,115, 32, 61, 61, 32, 48, 32,
+  116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,
+  110,105,108, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,102,111,114, 32,
+  105, 61, 49, 44, 35, 97,110,115,119,101,114,115, 32,100,111, 10, 32, 32,
+   32, 32, 32, 32,108,111, 99, 97,108, 32, 97,110,115,119,101,114, 32, 61,
+   32, 97,110,115,119,101,114,115, 91,105, 93, 10, 32, 32, 32, 32, 32, 32,
+   97,110,115,119,101,114, 91, 35,103,114,111,117,112, 32, 43, 32, 49, 93,
+   32, 61, 32,115,116,114,105,110,103, 46,102,111,114,109, 97,116, 40, 34,
+   37, 46, 49, 52,103, 34, 44, 32, 97,110,115,119,101,114, 46,118, 97,108,
+  117,101, 41, 10, 32, 32, 32, 32, 32, 32, 97,110,115,119,101,114, 46,118,
+   97,108,117,101, 32, 61, 32,110,105,108, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32, 97,110,115,119,101,114,115, 46,110, 97,109,101, 32, 61, 32,
+  103,101,116, 95,110, 97,109,101, 40,108,105,116,101,114, 97,108, 46,112,
+  114,101,100, 41, 10, 32, 32, 32, 97,110,115,119,101,114,115, 46, 97,114,
+  105,116,121, 32, 61, 32, 35,103,114,111,117,112, 32, 43, 32, 49, 10, 32,
+   32, 32,114,101,116,117,114,110, 32, 97,110,115,119,101,114,115, 10,101,
+  110,100, 10, 10, 45, 45, 32, 77, 65, 84, 69, 82, 73, 65, 76, 73, 90, 69,
+   68, 32, 86, 73, 69, 87, 83, 10, 10, 45, 45, 91, 91, 10, 10, 65, 32,100,
+  101,114,105,118,101,100, 32,112,114,101,100,105, 99, 97,116,101, 32, 99,
+   97,110, 32, 98,101, 32,109, 97,116,101,114,105, 97,108,105,122,101,100,
+   44, 32,115,111, 32,116,104, 97,116, 32,105,116,115, 32,102, 97, 99,116,
+  115, 32, 97,114,101, 32,115,116,111,114,101,100, 10, 97,110,100, 32,107,
+  101,112,116, 32,117,112, 32,116,111, 32,100, 97,116,101, 32, 97,115, 32,
+   99,108, 97,117,115,101,115, 32, 97,114,101, 32, 97,115,115,101,114,116,
+  101,100, 32, 97,110,100, 32,114,101,116,114, 97, 99,116,101,100, 44, 32,
+  114, 97,116,104,101,114, 32,116,104, 97,110, 10,100,101,114,105,118,101,
+  100, 32, 97,103, 97,105,110, 32, 98,121, 32,116,104,101, 32,110,101,120,
+  116, 32,113,117,101,114,121, 46, 32, 32, 69,118,101,114,121, 32,100,101,
+  114,105,118,101,100, 32,112,114,101,100,105, 99, 97,116,101, 32,116,104,
+  101, 32,118,105,101,119, 10,100,101,112,101,110,100,115, 32,111,110, 32,
+  105,115, 32,109, 97,116,101,114,105, 97,108,105,122,101,100, 32, 97,108,
+  111,110,103, 32,119,105,116,104, 32,105,116, 46, 32, 32, 84,104,101, 32,
+  112,114,111,118,101,114, 32,115,101, 97,114, 99,104,101,115, 32,116,104,
+  101, 10,115,116,111,114,101,100, 32,102, 97, 99,116,115, 32,111,102, 32,
+   97, 32,118,105,101,119, 32,105,110,115,116,101, 97,100, 32,111,102, 32,
+  105,116,115, 32, 99,108, 97,117,115,101,115, 46, 10, 10, 86,105,101,119,
+  115, 32, 97,114,101, 32,109, 97,105,110,116, 97,105,110,101,100, 32,119,
+  105,116,104, 32,116,104,101, 32,100,101,108,101,116,101, 32, 97,110,100,
+   32,114,101,100,101,114,105,118,101, 32, 97,108,103,111,114,105,116,104,
+  109, 46, 32, 32, 65, 32,110,101,119, 10,102, 97, 99,116, 32,105,115, 32,
+  106,111,105,110,101,100, 32,119,105,116,104, 32,116,104,101, 32,114,101,
+  115,116, 32,111,102, 32,116,104,101, 32, 98,111,100,121, 32,111,102, 32,
+  101, 97, 99,104, 32,118,105,101,119, 32,114,117,108,101, 32,116,104, 97,
+  116, 32,117,115,101,115, 10,105,116,115, 32,112,114,101,100,105, 99, 97,
+  116,101, 44, 32, 97,110,100, 32,116,104,101, 32,102, 97, 99,116,115, 32,
+  100,101,114,105,118,101,100, 32, 97,114,101, 32, 97,100,100,101,100, 32,
+   97,110,100, 32,116,114,101, 97,116,101,100, 32,116,104,101, 32,115, 97,
+  109,101, 10,119, 97,121, 32,105,110, 32,116,117,114,110, 46, 32, 32, 66,
+  101,102,111,114,101, 32, 97, 32,102, 97, 99,116, 32,105,115, 32,114,101,
+  109,111,118,101,100, 44, 32,116,104,101, 32,102, 97, 99,116,115, 32,116,
+  104, 97,116, 32,109, 97,121, 32,100,101,112,101,110,100, 32,111,110, 10,
+  105,116, 32, 97,114,101, 32,102,111,117,110,100, 32,116,104,101, 32,115,
+   97,109,101, 32,119, 97,121, 44, 32, 97,110,100, 32, 97,114,101, 32,114,
+  101,109,111,118,101,100, 32, 97,108,111,110,103, 32,119,105,116,104, 32,
+  105,116, 46, 32, 32, 84,104,111,115,101, 32,116,104, 97,116, 10, 99, 97,
+  110, 32,115,116,105,108,108, 32, 98,101, 32,100,101,114,105,118,101,100,
+   32,105,110, 32,111,110,101, 32,115,116,101,112, 32, 97,114,101, 32,116,
+  104,101,110, 32,112,117,116, 32, 98, 97, 99,107, 44, 32, 97,110,100, 32,
+  116,114,101, 97,116,101,100, 32, 97,115, 10,110,101,119, 32,102, 97, 99,
+  116,115, 46, 32, 32, 84,104,101, 32,119,111,114,107, 32,100,111,110,101,
+   32,105,115, 32,112,114,111,112,111,114,116,105,111,110, 97,108, 32,116,
+  111, 32,116,104,101, 32,102, 97, 99,116,115, 32, 97,102,102,101, 99,116,
+  101,100, 32, 98,121, 32, 97, 10, 99,104, 97,110,103,101, 46, 32, 32, 65,
+  115,115,101,114,116,105,110,103, 32,111,114, 32,114,101,116,114, 97, 99,
+  116,105,110,103, 32, 97, 32,114,117,108,101, 32,116,104, 97,116, 32, 97,
+   32,118,105,101,119, 32,100,101,112,101,110,100,115, 32,111,110, 10, 99,
+  111,109,112,117,116,101,115, 32,101,118,101,114,121, 32,118,105,101,119,
+   32, 97,103, 97,105,110, 46, 10, 10, 93, 93, 10, 10,108,111, 99, 97,108,
+   32,118,105,101,119,115,  9,  9,  9, 45, 45, 32, 83,101,116, 32,111,102,
+   32,118,105,101,119,115, 44, 32,111,114, 32,110,105,108, 32,119,104,101,
+  110, 32,110,111,110,101, 46, 10,108,111, 99, 97,108, 32,114,101,113,117,
+  101,115,116,101,100, 32, 61, 32,123,125,  9,  9, 45, 45, 32, 80,114,101,
+  100,105, 99, 97,116,101,115, 32,109, 97,116,101,114,105, 97,108,105,122,
+  101,100, 32, 98,121, 32,114,101,113,117,101,115,116, 46, 10, 10, 45, 45,
+   32, 84,104,101, 32,102, 97, 99,116,115, 32,111,102, 32, 97, 32,118,105,
+  101,119, 32, 97,114,101, 32,107,101,112,116, 32,105,110, 32, 97, 32,102,
+   97, 99,116, 32,115,116,111,114,101, 32,111,102, 32,116,104,101,105,114,
+   32,111,119,110, 44, 32, 97,110,100, 32,105,116,115, 10, 45, 45, 32,114,
+  117,108,101,115, 32, 97,114,101, 32,107,101,112,116, 32, 97,112, 97,114,
+  116, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110,
+   32,118,105,101,119, 95, 97,100,100, 40,112,114,101,100, 44, 32,108,105,
+  116,101,114, 97,108, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32, 97,
+  100,100, 95,102, 97, 99,116, 40,112,114,101,100, 46,118,105,101,119, 46,
+  102, 97, 99,116,115, 44, 32,108,105,116,101,114, 97,108, 41, 10,101,110,
+  100, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,
+  118,105,101,119, 95,114,101,109,111,118,101, 40,112,114,101,100, 44, 32,
+  108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,114,101,116,117,114,110,
+   32,112,114,101,100, 46,118,105,101,119, 46,102, 97, 99,116,115, 58,114,
+  101,109,111,118,101, 40,108,105,116,101,114, 97,108, 41, 10,101,110,100,
+   10, 10, 45, 45, 32, 82,101,116,117,114,110,115, 32,116,104,101, 32,102,
+   97, 99,116,115, 32,116,104, 97,116, 32,102,111,108,108,111,119, 32,102,
+  114,111,109, 32, 97, 32, 99,108, 97,117,115,101, 46, 32, 32, 84,104,101,
+   32,102, 97, 99,116,115, 32,111,102, 32,118,105,101,119,115, 10, 45, 45,
+   32, 99,104, 97,110,103,101, 32,119,104,105,108,101, 32,116,104,101,121,
+   32, 97,114,101, 32,109, 97,105,110,116, 97,105,110,101,100, 44, 32,115,
+  111, 32,116,104,101, 32,112,114,111,118,101,114, 32,105,115, 32,103,105,
+  118,101,110, 32,115,117, 98,103,111, 97,108, 10, 45, 45, 32,116, 97, 98,
+  108,101,115, 32,116,104, 97,116, 32, 97,114,101, 32,100,105,115, 99, 97,
+  114,100,101,100, 32, 97,102,116,101,114,119, 97,114,100,115, 44, 32, 97,
+  110,100, 32,116,104,101, 32,104,101, 97,100, 32,111,102, 32,116,104,101,
+   32, 99,108, 97,117,115,101, 32,105,115, 10, 45, 45, 32,110,111,116, 32,
+  116, 97, 98,108,101,100, 44, 32, 97,115, 32,116,104,101, 32, 99,108, 97,
+  117,115,101, 32,105,115, 32,110,111,116, 32,116,104,101, 32,111,110,108,
+  121, 32,119, 97,121, 32,116,111, 32,100,101,114,105,118,101, 32,105,116,
+   46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,
+  112,114,111,118,101, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,108,
+  111, 99, 97,108, 32,115, 97,118,101,100, 95,116, 97, 98,108,101,115, 44,
+   32,115, 97,118,101,100, 95,102,114,101,115,104, 32, 61, 32,116, 97, 98,
+  108,101,115, 44, 32,102,114,101,115,104, 10, 32, 32, 32,116, 97, 98,108,
+  101,115, 44, 32,102,114,101,115,104, 32, 61, 32,123,125, 44, 32,123,125,
+   10, 32, 32, 32,108,111, 99, 97,108, 32,115,117, 98,103,111, 97,108, 32,
+   61, 32,109, 97,107,101, 95,115,117, 98,103,111, 97,108, 40, 99,108, 97,
+  117,115,101, 46,104,101, 97,100, 41, 10, 32, 32, 32, 97,100,100, 95, 99,
+  108, 97,117,115,101, 40,115,117, 98,103,111, 97,108, 44, 32, 99,108, 97,
+  117,115,101, 41, 10, 32, 32, 32,116, 97, 98,108,101,115, 44, 32,102,114,
+  101,115,104, 32, 61, 32,115, 97,118,101,100, 95,116, 97, 98,108,101,115,
+   44, 32,115, 97,118,101,100, 95,102,114,101,115,104, 10, 32, 32, 32,114,
+  101,116,117,114,110, 32,115,117, 98,103,111, 97,108, 46,102, 97, 99,116,
+  115, 10,101,110,100, 10, 10, 45, 45, 32, 82,101,116,117,114,110,115, 32,
+  116,104,101, 32,102, 97, 99,116,115, 32,116,104, 97,116, 32,102,111,108,
+  108,111,119, 32,102,114,111,109, 32, 97, 32,114,117,108,101, 32,119,104,
+  101,110, 32,116,104,101, 32,102, 97, 99,116, 32,103,105,118,101,110, 32,
+  105,115, 10, 45, 45, 32,117,115,101,100, 32,102,111,114, 32,116,104,101,
+   32,105,116,104, 32,108,105,116,101,114, 97,108, 32,105,110, 32,105,116,
+  115, 32, 98,111,100,121, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110,
+   99,116,105,111,110, 32,100,101,114,105,118,101, 40, 99,108, 97,117,115,
+  101, 44, 32,105, 44, 32,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32,114,101,110, 97,109,101,100, 32, 61, 32,114,101,
+  110, 97,109,101, 95, 99,108, 97,117,115,101, 40, 99,108, 97,117,115,101,
+   41, 10, 32, 32, 32,108,111, 99, 97,108, 32,101,110,118, 32, 61, 32,117,
+  110,105,102,121, 40,114,101,110, 97,109,101,100, 91,105, 93, 44, 32,108,
+  105,116,101,114, 97,108, 41, 10, 32, 32, 32,105,102, 32,110,111,116, 32,
+  101,110,118, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,
+  117,114,110, 32,123,125, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108,
+  111, 99, 97,108, 32,110,101,119, 32, 61, 32,123,104,101, 97,100, 32, 61,
+   32,115,117, 98,115,116, 40,114,101,110, 97,109,101,100, 46,104,101, 97,
+  100, 44, 32,101,110,118, 41,125, 10, 32, 32, 32,102,111,114, 32,106, 61,
+   49, 44, 35,114,101,110, 97,109,101,100, 32,100,111, 10, 32, 32, 32, 32,
+   32, 32,105,102, 32,106, 32,126, 61, 32,105, 32,116,104,101,110, 10,  9,
+   32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40,110,101,119, 44,
+   32,115,117, 98,115,116, 40,114,101,110, 97,109,101,100, 91,106, 93, 44,
+   32,101,110,118, 41, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,112,114,
+  111,118,101, 40,110,101,119, 41, 10,101,110,100, 10, 10, 45, 45, 32, 82,
+  101,116,117,114,110,115, 32,116,104,101, 32,102, 97, 99,116,115, 32,100,
+  101,114,105,118,101,100, 32,105,110, 32,111,110,101, 32,115,116,101,112,
+   32, 98,121, 32,116,104,101, 32,118,105,101,119, 32,114,117,108,101,115,
+   32,116,104, 97,116, 32,117,115,101, 10, 45, 45, 32,116,104,101, 32,112,
+  114,101,100,105, 99, 97,116,101, 32,111,102, 32, 97, 32,102, 97, 99,116,
+   44, 32,119,104,101,110, 32,103,105,118,101,110, 32,116,104,101, 32,102,
+   97, 99,116, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
+  111,110, 32, 99,111,110,115,101,113,117,101,110, 99,101,115, 40,108,105,
+  116,101,114, 97,108, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,114,101,
+  115,117,108,116, 32, 61, 32,123,125, 10, 32, 32, 32,102,111,114, 32,117,
+  115,101,114, 32,105,110, 32,112, 97,105,114,115, 40,114,100,101,112,115,
+   91,108,105,116,101,114, 97,108, 46,112,114,101,100, 93, 32,111,114, 32,
+  123,125, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,105,102, 32,117,115,
+  101,114, 46,118,105,101,119, 32,116,104,101,110, 10,  9, 32,102,111,114,
+   32,105,100, 44, 99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,114,
+  115, 40,117,115,101,114, 46,118,105,101,119, 46,114,117,108,101,115, 41,
+   32,100,111, 10,  9, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,
+   99,108, 97,117,115,101, 32,100,111, 10,  9, 32, 32, 32, 32, 32, 32, 32,
+  105,102, 32, 99,108, 97,117,115,101, 91,105, 93, 46,112,114,101,100, 32,
+   61, 61, 32,108,105,116,101,114, 97,108, 46,112,114,101,100, 32,116,104,
+  101,110, 10,  9,  9, 32, 32,102,111,114, 32,105,100, 44,102, 97, 99,116,
+   32,105,110, 32,112, 97,105,114,115, 40,100,101,114,105,118,101, 40, 99,
+  108, 97,117,115,101, 44, 32,105, 44, 32,108,105,116,101,114, 97,108, 41,
+   41, 32,100,111, 10,  9,  9, 32, 32, 32, 32, 32,116, 97, 98,108,101, 46,
+  105,110,115,101,114,116, 40,114,101,115,117,108,116, 44, 32,102, 97, 99,
+  116, 41, 10,  9,  9, 32, 32,101,110,100, 10,  9, 32, 32, 32, 32, 32, 32,
+   32,101,110,100, 10,  9, 32, 32, 32, 32,101,110,100, 10,  9, 32,101,110,
   100, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100,
-   10, 32, 32, 32,112,114,101,100, 46,112,114,105,109, 32, 61, 32,112,114,
-  105,109, 10, 32, 32, 32,114,101,116,117,114,110, 32,105,110,115,101,114,
-  116, 40,112,114,101,100, 41, 10,101,110,100, 10, 10, 45, 45, 91, 91, 10,
-   10, 45, 45, 32, 69,120, 97,109,112,108,101, 32,111,102, 32, 97, 32,118,
-  101,114,121, 32,115,105,109,112,108,101, 32,112,114,105,109,105,116,105,
-  118,101, 32,100,101,102,105,110,101,100, 32, 98,121, 32, 97,110, 32,105,
-  116,101,114, 97,116,111,114, 46, 10, 45, 45, 32, 73,116, 32,100,101,102,
-  105,110,101,115, 32,116,104,101, 32,102, 97, 99,116, 32,116,104,114,101,
-  101, 40, 51, 41, 46, 10, 10, 97,100,100, 95,105,116,101,114, 95,112,114,
-  105,109, 40, 34,116,104,114,101,101, 34, 44, 32, 49, 44, 10,  9, 32, 32,
-   32, 32, 32, 32,102,117,110, 99,116,105,111,110, 40,108,105,116,101,114,
-   97,108, 41, 10,  9,  9, 32,114,101,116,117,114,110, 32,102,117,110, 99,
-  116,105,111,110, 40,115, 44, 32,118, 41, 10,  9,  9,  9, 32, 32, 32,105,
-  102, 32,118, 32,116,104,101,110, 10,  9,  9,  9, 32, 32, 32, 32, 32, 32,
-  114,101,116,117,114,110, 32,110,105,108, 10,  9,  9,  9, 32, 32, 32,101,
-  108,115,101, 10,  9,  9,  9, 32, 32, 32, 32, 32, 32,114,101,116,117,114,
-  110, 32,123, 51,125, 10,  9,  9,  9, 32, 32, 32,101,110,100, 10,  9,  9,
-    9,101,110,100, 10,  9, 32, 32, 32, 32, 32, 32,101,110,100, 41, 10, 10,
-   45, 45, 32, 69,120, 97,109,112,108,101, 32,111,102, 32,116,104,101, 32,
-  115,117, 99, 99,101,115,115,111,114, 32,112,114,105,109,105,116,105,118,
+   10, 32, 32, 32,114,101,116,117,114,110, 32,114,101,115,117,108,116, 10,
+  101,110,100, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,
+  110, 32,112,114,111,112, 97,103, 97,116,101, 95,105,110,115,101,114,116,
+   40,116,111,100,111, 41, 10, 32, 32, 32,119,104,105,108,101, 32, 35,116,
+  111,100,111, 32, 62, 32, 48, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,
+  111, 99, 97,108, 32,102, 97, 99,116,115, 32, 61, 32, 99,111,110,115,101,
+  113,117,101,110, 99,101,115, 40,116, 97, 98,108,101, 46,114,101,109,111,
+  118,101, 40,116,111,100,111, 41, 41, 10, 32, 32, 32, 32, 32, 32,102,111,
+  114, 32,105, 61, 49, 44, 35,102, 97, 99,116,115, 32,100,111, 10,  9, 32,
+  105,102, 32,118,105,101,119, 95, 97,100,100, 40,102, 97, 99,116,115, 91,
+  105, 93, 46,112,114,101,100, 44, 32,102, 97, 99,116,115, 91,105, 93, 41,
+   32,116,104,101,110, 10,  9, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,
+  110,115,101,114,116, 40,116,111,100,111, 44, 32,102, 97, 99,116,115, 91,
+  105, 93, 41, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10, 45, 45, 32, 67,
+   97,110, 32, 97, 32,102, 97, 99,116, 32,114,101,109,111,118,101,100, 32,
+  102,114,111,109, 32, 97, 32,118,105,101,119, 32, 98,101, 32,100,101,114,
+  105,118,101,100, 32,105,110, 32,111,110,101, 32,115,116,101,112, 32,102,
+  114,111,109, 32,119,104, 97,116, 10, 45, 45, 32,114,101,109, 97,105,110,
+  115, 63, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110,
+   32,100,101,114,105,118, 97, 98,108,101, 40,108,105,116,101,114, 97,108,
+   41, 10, 32, 32, 32,108,111, 99, 97,108, 32,112,114,101,100, 32, 61, 32,
+  108,105,116,101,114, 97,108, 46,112,114,101,100, 10, 32, 32, 32,105,102,
+   32,112,114,101,100, 46,102, 97, 99,116,115, 32, 97,110,100, 32,112,114,
+  101,100, 46,102, 97, 99,116,115, 58,104, 97,115, 40,108,105,116,101,114,
+   97,108, 41, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,
+  117,114,110, 32,116,114,117,101, 10, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,102,111,114, 32,105,100, 44, 99,108, 97,117,115,101, 32,105,110, 32,
+  112, 97,105,114,115, 40,112,114,101,100, 46,118,105,101,119, 46,114,117,
+  108,101,115, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,
+  108, 32,114,101,110, 97,109,101,100, 32, 61, 32,114,101,110, 97,109,101,
+   95, 99,108, 97,117,115,101, 40, 99,108, 97,117,115,101, 41, 10, 32, 32,
+   32, 32, 32, 32,108,111, 99, 97,108, 32,101,110,118, 32, 61, 32,117,110,
+  105,102,121, 40,114,101,110, 97,109,101,100, 46,104,101, 97,100, 44, 32,
+  108,105,116,101,114, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,105,102, 32,
+  101,110,118, 32, 97,110,100, 32,110,101,120,116, 40,112,114,111,118,101,
+   40,115,117, 98,115,116, 95,105,110, 95, 99,108, 97,117,115,101, 40,114,
+  101,110, 97,109,101,100, 44, 32,101,110,118, 41, 41, 41, 32,116,104,101,
+  110, 10,  9, 32,114,101,116,117,114,110, 32,116,114,117,101, 10, 32, 32,
+   32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  114,101,116,117,114,110, 32,102, 97,108,115,101, 10,101,110,100, 10, 10,
+   45, 45, 32, 67,111,109,112,117,116,101,115, 32,116,104,101, 32,102, 97,
+   99,116,115, 32,111,102, 32,116,104,101, 32,118,105,101,119,115, 32,100,
+  101,114,105,118,101,100, 32,102,114,111,109, 32,115, 99,114, 97,116, 99,
+  104, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110,
+   32,102,105,108,108, 40,112,114,101,100,115, 41, 10, 32, 32, 32,108,111,
+   99, 97,108, 32,115, 97,118,101,100, 95,116, 97, 98,108,101,115, 44, 32,
+  115, 97,118,101,100, 95,102,114,101,115,104, 32, 61, 32,116, 97, 98,108,
+  101,115, 44, 32,102,114,101,115,104, 10, 32, 32, 32,116, 97, 98,108,101,
+  115, 44, 32,102,114,101,115,104, 32, 61, 32,123,125, 44, 32,123,125, 10,
+   32, 32, 32,108,111, 99, 97,108, 32,102, 97, 99,116,115, 32, 61, 32,123,
+  125, 10, 32, 32, 32,102,111,114, 32,112,114,101,100, 32,105,110, 32,112,
+   97,105,114,115, 40,112,114,101,100,115, 41, 32,100,111, 10, 32, 32, 32,
+   32, 32, 32,108,111, 99, 97,108, 32,108,105,116,101,114, 97,108, 32, 61,
+   32,123,112,114,101,100, 32, 61, 32,112,114,101,100,125, 10, 32, 32, 32,
+   32, 32, 32,102,111,114, 32,105, 61, 49, 44,103,101,116, 95, 97,114,105,
+  116,121, 40,112,114,101,100, 41, 32,100,111, 10,  9, 32,108,105,116,101,
+  114, 97,108, 91,105, 93, 32, 61, 32,109,107, 95,102,114,101,115,104, 95,
+  118, 97,114, 40, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32,
+   32, 32, 32, 32,108,111, 99, 97,108, 32,115,117, 98,103,111, 97,108, 32,
+   61, 32,109, 97,107,101, 95,115,117, 98,103,111, 97,108, 40,108,105,116,
+  101,114, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,109,101,114,103,101, 40,
+  115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,115,101, 97,
+  114, 99,104, 40,115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32, 32, 32,
+   32,102, 97, 99,116,115, 91,112,114,101,100, 93, 32, 61, 32,115,117, 98,
+  103,111, 97,108, 46,102, 97, 99,116,115, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,116, 97, 98,108,101,115, 44, 32,102,114,101,115,104, 32, 61,
+   32,115, 97,118,101,100, 95,116, 97, 98,108,101,115, 44, 32,115, 97,118,
+  101,100, 95,102,114,101,115,104, 10, 32, 32, 32,102,111,114, 32,112,114,
+  101,100, 32,105,110, 32,112, 97,105,114,115, 40,112,114,101,100,115, 41,
+   32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,114,117,
+  108,101,115, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32, 32,102,111,114,
+   32,105,100, 44, 99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,114,
+  115, 40,112,114,101,100, 46,100, 98, 41, 32,100,111, 10,  9, 32,105,102,
+   32, 35, 99,108, 97,117,115,101, 32, 62, 32, 48, 32,116,104,101,110, 10,
+    9, 32, 32, 32, 32,114,117,108,101,115, 91,105,100, 93, 32, 61, 32, 99,
+  108, 97,117,115,101, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32, 32, 32, 32,112,114,101,100, 46,118,105,101,
+  119, 32, 61, 32,123,102, 97, 99,116,115, 32, 61, 32,109, 97,107,101, 95,
+  102, 97, 99,116,115, 40,103,101,116, 95, 97,114,105,116,121, 40,112,114,
+  101,100, 41, 41, 44, 32,114,117,108,101,115, 32, 61, 32,114,117,108,101,
+  115,125, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,100, 44,108,105,
+  116,101,114, 97,108, 32,105,110, 32,112, 97,105,114,115, 40,102, 97, 99,
+  116,115, 91,112,114,101,100, 93, 41, 32,100,111, 10,  9, 32,118,105,101,
+  119, 95, 97,100,100, 40,112,114,101,100, 44, 32,108,105,116,101,114, 97,
+  108, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,
+  100, 10,101,110,100, 10, 10, 45, 45, 32, 77, 97,116,101,114,105, 97,108,
+  105,122,101,115, 32, 97, 32,112,114,101,100,105, 99, 97,116,101, 32, 97,
+  110,100, 32,116,104,101, 32,100,101,114,105,118,101,100, 32,112,114,101,
+  100,105, 99, 97,116,101,115, 32,105,116, 32,100,101,112,101,110,100,115,
+   32,111,110, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
+  111,110, 32,109, 97,116,101,114,105, 97,108,105,122,101, 40,112,114,101,
+  100, 41, 10, 32, 32, 32,105,102, 32,112,114,101,100, 46,112,114,105,109,
+   32,111,114, 32,112,114,101,100, 46,118,105,101,119, 32,116,104,101,110,
+   10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,112,114,101,100,
+   10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,113,117,101,115,116,
+  101,100, 91,112,114,101,100, 93, 32, 61, 32,116,114,117,101, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,112,114,101,100,115, 32, 61, 32,123,125, 10,
+   32, 32, 32,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,
+  118,105,115,105,116, 40,112, 41, 10, 32, 32, 32, 32, 32, 32,105,102, 32,
+  112,114,101,100,115, 91,112, 93, 32,111,114, 32,112, 46,112,114,105,109,
+   32,111,114, 32,112, 46,118,105,101,119, 32,116,104,101,110, 10,  9, 32,
+  114,101,116,117,114,110, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+   32, 32, 32, 32, 32,102,111,114, 32,105,100, 44, 99,108, 97,117,115,101,
+   32,105,110, 32,112, 97,105,114,115, 40,112, 46,100, 98, 41, 32,100,111,
+   10,  9, 32,105,102, 32, 35, 99,108, 97,117,115,101, 32, 62, 32, 48, 32,
+  116,104,101,110, 10,  9, 32, 32, 32, 32,112,114,101,100,115, 91,112, 93,
+   32, 61, 32,116,114,117,101, 10,  9, 32, 32, 32, 32,102,111,114, 32,105,
+   61, 49, 44, 35, 99,108, 97,117,115,101, 32,100,111, 10,  9, 32, 32, 32,
+   32, 32, 32, 32,118,105,115,105,116, 40, 99,108, 97,117,115,101, 91,105,
+   93, 46,112,114,101,100, 41, 10,  9, 32, 32, 32, 32,101,110,100, 10,  9,
+   32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,118,105,115,105,116, 40,112,114,101,100, 41,
+   10, 32, 32, 32,112,114,101,100,115, 91,112,114,101,100, 93, 32, 61, 32,
+  116,114,117,101, 10, 32, 32, 32,102,105,108,108, 40,112,114,101,100,115,
+   41, 10, 32, 32, 32,118,105,101,119,115, 32, 61, 32,118,105,101,119,115,
+   32,111,114, 32,123,125, 10, 32, 32, 32,102,111,114, 32,112, 32,105,110,
+   32,112, 97,105,114,115, 40,112,114,101,100,115, 41, 32,100,111, 10, 32,
+   32, 32, 32, 32, 32,118,105,101,119,115, 91,112, 93, 32, 61, 32,116,114,
+  117,101, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,
+  110, 32,112,114,101,100, 10,101,110,100, 10, 10, 45, 45, 32, 73,115, 32,
+   97, 32,118,105,101,119, 32, 97,102,102,101, 99,116,101,100, 32, 98,121,
+   32, 97, 32, 99,104, 97,110,103,101, 32,116,111, 32,116,104,101, 32, 99,
+  108, 97,117,115,101,115, 32,111,102, 32, 97, 32,112,114,101,100,105, 99,
+   97,116,101, 63, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
+  111,110, 32, 97,102,102,101, 99,116,115, 95,118,105,101,119,115, 40,112,
+  114,101,100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,115,101,101,110,
+   32, 61, 32,123, 91,112,114,101,100, 93, 32, 61, 32,116,114,117,101,125,
+   10, 32, 32, 32,108,111, 99, 97,108, 32,116,111,100,111, 32, 61, 32,123,
+  112,114,101,100,125, 10, 32, 32, 32,119,104,105,108,101, 32, 35,116,111,
+  100,111, 32, 62, 32, 48, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111,
+   99, 97,108, 32,112, 32, 61, 32,116, 97, 98,108,101, 46,114,101,109,111,
+  118,101, 40,116,111,100,111, 41, 10, 32, 32, 32, 32, 32, 32,105,102, 32,
+  112, 46,118,105,101,119, 32,116,104,101,110, 10,  9, 32,114,101,116,117,
+  114,110, 32,116,114,117,101, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10,
+   32, 32, 32, 32, 32, 32,102,111,114, 32,117,115,101,114, 32,105,110, 32,
+  112, 97,105,114,115, 40,114,100,101,112,115, 91,112, 93, 32,111,114, 32,
+  123,125, 41, 32,100,111, 10,  9, 32,105,102, 32,110,111,116, 32,115,101,
+  101,110, 91,117,115,101,114, 93, 32,116,104,101,110, 10,  9, 32, 32, 32,
+   32,115,101,101,110, 91,117,115,101,114, 93, 32, 61, 32,116,114,117,101,
+   10,  9, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116,
+   40,116,111,100,111, 44, 32,117,115,101,114, 41, 10,  9, 32,101,110,100,
+   10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,114,101,116,117,114,110, 32,102, 97,108,115,101, 10,101,110,
+  100, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,
+  114,101,109, 97,116,101,114,105, 97,108,105,122,101, 40, 41, 10, 32, 32,
+   32,102,111,114, 32,112,114,101,100, 32,105,110, 32,112, 97,105,114,115,
+   40,118,105,101,119,115, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,112,
+  114,101,100, 46,118,105,101,119, 32, 61, 32,110,105,108, 10, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,118,105,101,119,115, 32, 61, 32,110,105,108,
+   10, 32, 32, 32,102,111,114, 32,112,114,101,100, 32,105,110, 32,112, 97,
+  105,114,115, 40,114,101,113,117,101,115,116,101,100, 41, 32,100,111, 10,
+   32, 32, 32, 32, 32, 32,109, 97,116,101,114,105, 97,108,105,122,101, 40,
+  112,114,101,100, 41, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10,
+  102,117,110, 99,116,105,111,110, 32,118,105,101,119, 95, 97,115,115,101,
+  114,116, 40, 99,108, 97,117,115,101, 41, 10, 32, 32, 32,105,102, 32,110,
+  111,116, 32,118,105,101,119,115, 32,116,104,101,110, 10, 32, 32, 32, 32,
+   32, 32,114,101,116,117,114,110, 10, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,108,105,116,101,114, 97,108, 32, 61, 32, 99,
+  108, 97,117,115,101, 46,104,101, 97,100, 10, 32, 32, 32,105,102, 32, 35,
+   99,108, 97,117,115,101, 32, 62, 32, 48, 32,116,104,101,110, 10, 32, 32,
+   32, 32, 32, 32,105,102, 32, 97,102,102,101, 99,116,115, 95,118,105,101,
+  119,115, 40,108,105,116,101,114, 97,108, 46,112,114,101,100, 41, 32,116,
+  104,101,110, 10,  9, 32,114,101,109, 97,116,101,114,105, 97,108,105,122,
+  101, 40, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,
+  108,115,101,105,102, 32,110,111,116, 32,108,105,116,101,114, 97,108, 46,
+  112,114,101,100, 46,118,105,101,119, 32,111,114, 32,118,105,101,119, 95,
+   97,100,100, 40,108,105,116,101,114, 97,108, 46,112,114,101,100, 44, 32,
+  108,105,116,101,114, 97,108, 41, 32,116,104,101,110, 10, 32, 32, 32, 32,
+   32, 32,112,114,111,112, 97,103, 97,116,101, 95,105,110,115,101,114,116,
+   40,123,108,105,116,101,114, 97,108,125, 41, 10, 32, 32, 32,101,110,100,
+   10,101,110,100, 10, 10, 45, 45, 32, 67, 97,108,108,101,100, 32, 98,101,
+  102,111,114,101, 32, 97, 32, 99,108, 97,117,115,101, 32,105,115, 32,114,
+  101,109,111,118,101,100, 32,102,114,111,109, 32,116,104,101, 32,100, 97,
+  116, 97, 98, 97,115,101, 46, 32, 32, 82,101,116,117,114,110,115, 32,116,
+  104,101, 10, 45, 45, 32,102, 97, 99,116,115, 32,114,101,109,111,118,101,
+  100, 32,102,114,111,109, 32,118,105,101,119,115, 44, 32,119,104,105, 99,
+  104, 32, 97,114,101, 32,116,104,101,110, 32,114,101,109,111,118,101,100,
+   32, 98,121, 32,118,105,101,119, 95,114,101,100,101,114,105,118,101, 46,
+   10, 10,102,117,110, 99,116,105,111,110, 32,118,105,101,119, 95,111,118,
+  101,114,100,101,108,101,116,101, 40, 99,108, 97,117,115,101, 41, 10, 32,
+   32, 32,105,102, 32,110,111,116, 32,118,105,101,119,115, 32,111,114, 32,
+   35, 99,108, 97,117,115,101, 32, 62, 32, 48, 32,116,104,101,110, 10, 32,
+   32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108, 10, 32, 32,
+   32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,100,101,108,101,
+  116,101,100, 32, 61, 32,123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32,
+  115,101,101,110, 32, 61, 32,123,125, 10, 32, 32, 32,108,111, 99, 97,108,
+   32,116,111,100,111, 32, 61, 32,123,125, 10, 32, 32, 32,108,111, 99, 97,
+  108, 32,102,117,110, 99,116,105,111,110, 32,111,118,101,114, 40,108,105,
+  116,101,114, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108,
+   32,105,100, 32, 61, 32,103,101,116, 95,105,100, 40,108,105,116,101,114,
+   97,108, 41, 10, 32, 32, 32, 32, 32, 32,105,102, 32,110,111,116, 32,115,
+  101,101,110, 91,105,100, 93, 32,116,104,101,110, 10,  9, 32,115,101,101,
+  110, 91,105,100, 93, 32, 61, 32,116,114,117,101, 10,  9, 32,116, 97, 98,
+  108,101, 46,105,110,115,101,114,116, 40,100,101,108,101,116,101,100, 44,
+   32,108,105,116,101,114, 97,108, 41, 10,  9, 32,116, 97, 98,108,101, 46,
+  105,110,115,101,114,116, 40,116,111,100,111, 44, 32,108,105,116,101,114,
+   97,108, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,
+  110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,108,105,116,101,114, 97,
+  108, 32, 61, 32, 99,108, 97,117,115,101, 46,104,101, 97,100, 10, 32, 32,
+   32,105,102, 32,108,105,116,101,114, 97,108, 46,112,114,101,100, 46,118,
+  105,101,119, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,111,118,101,
+  114, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,101,108,115,101,
+   10, 32, 32, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,
+  116, 40,116,111,100,111, 44, 32,108,105,116,101,114, 97,108, 41, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,119,104,105,108,101, 32, 35,116,111,
+  100,111, 32, 62, 32, 48, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111,
+   99, 97,108, 32,102, 97, 99,116,115, 32, 61, 32, 99,111,110,115,101,113,
+  117,101,110, 99,101,115, 40,116, 97, 98,108,101, 46,114,101,109,111,118,
+  101, 40,116,111,100,111, 41, 41, 10, 32, 32, 32, 32, 32, 32,102,111,114,
+   32,105, 61, 49, 44, 35,102, 97, 99,116,115, 32,100,111, 10,  9, 32,111,
+  118,101,114, 40,102, 97, 99,116,115, 91,105, 93, 41, 10, 32, 32, 32, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,
+  116,117,114,110, 32,100,101,108,101,116,101,100, 10,101,110,100, 10, 10,
+   45, 45, 32, 67, 97,108,108,101,100, 32, 97,102,116,101,114, 32, 97, 32,
+   99,108, 97,117,115,101, 32,105,115, 32,114,101,109,111,118,101,100, 32,
+  102,114,111,109, 32,116,104,101, 32,100, 97,116, 97, 98, 97,115,101, 46,
+   10, 10,102,117,110, 99,116,105,111,110, 32,118,105,101,119, 95,114,101,
+  100,101,114,105,118,101, 40, 99,108, 97,117,115,101, 44, 32,100,101,108,
+  101,116,101,100, 41, 10, 32, 32, 32,105,102, 32,110,111,116, 32,118,105,
+  101,119,115, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,
+  117,114,110, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,105,102, 32, 35,
+   99,108, 97,117,115,101, 32, 62, 32, 48, 32,116,104,101,110, 10, 32, 32,
+   32, 32, 32, 32,105,102, 32, 97,102,102,101, 99,116,115, 95,118,105,101,
+  119,115, 40, 99,108, 97,117,115,101, 46,104,101, 97,100, 46,112,114,101,
+  100, 41, 32,116,104,101,110, 10,  9, 32,114,101,109, 97,116,101,114,105,
+   97,108,105,122,101, 40, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10,
+   32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 10, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,100,101,108,101,
+  116,101,100, 32,100,111, 10, 32, 32, 32, 32, 32, 32,118,105,101,119, 95,
+  114,101,109,111,118,101, 40,100,101,108,101,116,101,100, 91,105, 93, 46,
+  112,114,101,100, 44, 32,100,101,108,101,116,101,100, 91,105, 93, 41, 10,
+   32, 32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32, 98, 97,
+   99,107, 32, 61, 32,123,125, 10, 32, 32, 32,102,111,114, 32,105, 61, 49,
+   44, 35,100,101,108,101,116,101,100, 32,100,111, 10, 32, 32, 32, 32, 32,
+   32,105,102, 32,100,101,114,105,118, 97, 98,108,101, 40,100,101,108,101,
+  116,101,100, 91,105, 93, 41, 32,116,104,101,110, 10,  9, 32,118,105,101,
+  119, 95, 97,100,100, 40,100,101,108,101,116,101,100, 91,105, 93, 46,112,
+  114,101,100, 44, 32,100,101,108,101,116,101,100, 91,105, 93, 41, 10,  9,
+   32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40, 98, 97, 99,107,
+   44, 32,100,101,108,101,116,101,100, 91,105, 93, 41, 10, 32, 32, 32, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,112,114,
+  111,112, 97,103, 97,116,101, 95,105,110,115,101,114,116, 40, 98, 97, 99,
+  107, 41, 10,101,110,100, 10, 10, 45, 45, 32, 67, 97,108,108,101,100, 32,
+   97,102,116,101,114, 32,114,101,118,101,114,116,105,110,103, 32,116,111,
+   32, 97, 32,115,110, 97,112,115,104,111,116, 46, 10, 10,102,117,110, 99,
+  116,105,111,110, 32,118,105,101,119, 95,114,101,118,101,114,116, 40, 41,
+   10, 32, 32, 32,105,102, 32,118,105,101,119,115, 32,116,104,101,110, 10,
+   32, 32, 32, 32, 32, 32,114,101,109, 97,116,101,114,105, 97,108,105,122,
+  101, 40, 41, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10, 45, 45,
+   32, 80, 82, 73, 77, 73, 84, 73, 86, 69, 83, 10, 10, 45, 45, 91, 91, 10,
+   10, 65, 32,112,114,105,109,105,116,105,118,101, 32,112,114,101,100,105,
+   99, 97,116,101, 44, 32, 97,108,115,111, 32, 99, 97,108,108,101,100, 32,
+   97, 32, 98,117,105,108,116, 45,105,110, 32,112,114,101,100,105, 99, 97,
+  116,101, 44, 32,105,115, 10,105,109,112,108,101,109,101,110,116,101,100,
+   32, 98,121, 32, 99,111,100,101, 46, 32, 32, 65,115,115,101,114,116,105,
+  111,110,115, 32, 97, 98,111,117,116, 32, 97, 32,112,114,105,109,105,116,
+  105,118,101, 32,112,114,101,100,105, 99, 97,116,101, 32, 97,114,101, 10,
+  105,103,110,111,114,101,100, 44, 32, 97,115, 32,116,104,101, 32, 99,111,
+  100,101, 32,116, 97,107,101,115, 32,112,114,101, 99,101,100,101,110, 99,
+  101, 46, 32, 32, 85,115,101, 32,116,104,101, 32,109, 97,107,101, 95,112,
+  114,101,100, 32,102,117,110, 99,116,105,111,110, 32,116,111, 10, 97, 99,
+   99,101,115,115, 32, 97, 32,112,114,105,109,105,116,105,118,101, 32, 98,
+  121, 32,110, 97,109,101, 46, 10, 10, 84,104,101, 32, 98,101,104, 97,118,
+  105,111,114, 32,111,102, 32, 97, 32,112,114,105,109,105,116,105,118,101,
+   32,112,114,101,100,105, 99, 97,116,101, 32,105,115, 32,100,101,102,105,
+  110,101,100, 32, 98,121, 32, 97,100,100,105,110,103, 32, 97, 32,102,117,
+  110, 99,116,105,111,110, 10,116,111, 32,116,104,101, 32,112,114,101,100,
+  105, 99, 97,116,101, 39,115, 32,112,114,105,109, 32,102,105,101,108,100,
+   46, 32, 32, 84,104,101, 32,102,117,110, 99,116,105,111,110, 32,116, 97,
+  107,101,115, 32, 97, 32,108,105,116,101,114, 97,108, 32, 97,110,100, 32,
+   97, 10,115,117, 98,103,111, 97,108, 46, 32, 32, 84,104,101, 32,116,121,
+  112,105, 99, 97,108, 32,112,114,105,109,105,116,105,118,101, 32,100,101,
+  114,105,118,101,115, 32, 97, 32,115,101,116, 32,111,102, 32,102, 97, 99,
+  116,115, 32,102,114,111,109, 32,116,104,101, 10,108,105,116,101,114, 97,
+  108, 44, 32, 97,110,100, 32,102,111,114, 32,101, 97, 99,104, 32,100,101,
+  114,105,118,101,100, 32,102, 97, 99,116, 32,102, 44, 32,114,101,112,111,
+  114,116,115, 32,116,104,101, 32,114,101,115,117,108,116, 32, 98,121, 32,
+  105,110,118,111,107,105,110,103, 10,102, 97, 99,116, 40,115,117, 98,103,
+  111, 97,108, 44, 32,102, 41, 46, 10, 10, 84,104,101, 32,101,113,117, 97,
+  108,115, 32,112,114,105,109,105,116,105,118,101, 32,100,101,102,105,110,
+  101,100, 32, 98,101,108,111,119, 32,105,115, 32,112,114,111,116,101, 99,
+  116,101,100, 32,102,114,111,109, 32,103, 97,114, 97,103,101, 32, 99,111,
+  108,108,101, 99,116,105,111,110, 10, 98,101, 99, 97,117,115,101, 32,116,
+  104,101, 32,112,114,105,109,105,116,105,118,101, 32,105,115, 32, 98,111,
+  117,110,100, 32,116,111, 32, 97, 32,108,111, 99, 97,108, 32,118, 97,114,
+  105, 97, 98,108,101, 46, 32, 32, 65, 32,112,114,105,109,105,116,105,118,
+  101, 32,110,111,116, 10,115,116,111,114,101,100, 32,105,110, 32, 97, 32,
+   76,117, 97, 32,100, 97,116, 97, 32,115,116,114,117, 99,116,117,114,101,
+   32, 99, 97,110, 32, 98,101, 32,112,114,111,116,101, 99,116,101,100, 32,
+   98,121, 32,101,110,116,101,114,105,110,103, 32,105,116, 32,105,110,116,
+  111, 10,116,104,101, 32,112,114,101,100,105, 99, 97,116,101, 32,100, 97,
+  116, 97, 98, 97,115,101, 32,117,115,101,100, 32, 98,121, 32, 97,115,115,
+  101,114,116, 32, 97,110,100, 32,114,101,116,114, 97, 99,116, 46, 32, 32,
+   70,111,114, 32,112,114,105,109,105,116,105,118,101,115, 10, 99,114,101,
+   97,116,101,100, 32,102,114,111,109, 32, 67, 44, 32,112,114,111,116,101,
+   99,116,105,111,110, 32,109, 97,121, 32, 98,101, 32,112,114,111,118,105,
+  100,101,100, 32, 98,121, 32,101,110,116,101,114,105,110,103, 32,116,104,
+  101, 32,112,114,101,100,105, 99, 97,116,101, 10,105,110,116,111, 32,116,
+  104,101, 32, 76,117, 97, 32,114,101,103,105,115,116,114,121, 46, 10, 10,
+   85,115,101, 32,116,104,101, 32, 97,100,100, 95,105,116,101,114, 95,112,
+  114,105,109, 32,102,117,110, 99,116,105,111,110, 32,116,111, 32, 97,100,
+  100, 32, 97, 32,112,114,105,109,105,116,105,118,101, 32,112,114,101,100,
+  105, 99, 97,116,101, 32,116,104, 97,116, 32, 99, 97,110, 10,100,101,102,
+  105,110,101,100, 32, 98,121, 32, 97,110, 32,105,116,101,114, 97,116,111,
+  114, 32,119,104,105, 99,104, 32,119,104,101,110, 32,103,105,118,101,110,
+   32, 97, 32,108,105,116,101,114, 97,108, 44, 32,103,101,110,101,114, 97,
+  116,101,115, 32, 97, 10,115,101,113,117,101,110, 99,101, 32,111,102, 32,
+   97,110,115,119,101,114,115, 44, 32,101, 97, 99,104, 32, 97,110,115,119,
+  101,114, 32, 98,101,105,110,103, 32, 97,110, 32, 97,114,114, 97,121, 32,
+  111,102, 32,115,116,114,105,110,103,115, 32,111,114, 32,110,117,109, 98,
+  101,114,115, 46, 10, 10, 93, 93, 10, 10, 45, 45, 32, 79,116,104,101,114,
+   32,112, 97,114,116,115, 32,111,102, 32,116,104,101, 32, 68, 97,116, 97,
+  108,111,103, 32,115,121,115,116,101,109, 32,100,101,112,101,110,100, 32,
+  111,110, 32,116,104,101, 32,101,113,117, 97,108,105,116,121, 32,112,114,
+  105,109,105,116,105,118,101, 44, 10, 45, 45, 32,115,111, 32, 99, 97,114,
+  101,102,117,108,108,121, 32, 99,111,110,115,105,100,101,114, 32, 97,110,
+  121, 32,109,111,100,105,102,105, 99, 97,116,105,111,110,115, 32,116,111,
+   32,105,116, 46, 10, 10,108,111, 99, 97,108, 32, 98,105,110, 97,114,121,
+   95,101,113,117, 97,108,115, 95,112,114,101,100, 32, 61, 32,109, 97,107,
+  101, 95,112,114,101,100, 40, 34, 61, 34, 44, 32, 50, 41, 10, 10,100,111,
+    9,  9,  9,  9, 45, 45, 32,101,113,117, 97,108,115, 32,112,114,105,109,
+  105,116,105,118,101, 10, 10, 32, 32, 32,108,111, 99, 97,108, 32,102,117,
+  110, 99,116,105,111,110, 32,101,113,117, 97,108,115, 95,112,114,105,109,
+  105,116,105,118,101, 40,108,105,116,101,114, 97,108, 44, 32,115,117, 98,
+  103,111, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,
+  120, 32, 61, 32,108,105,116,101,114, 97,108, 91, 49, 93, 10, 32, 32, 32,
+   32, 32, 32,108,111, 99, 97,108, 32,121, 32, 61, 32,108,105,116,101,114,
+   97,108, 91, 50, 93, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,
+  101,110,118, 32, 61, 32,120, 58,117,110,105,102,121, 40,121, 44, 32,123,
+  125, 41, 45, 45, 32, 66,111,116,104, 32,116,101,114,109,115, 32,109,117,
+  115,116, 32,117,110,105,102,121, 44, 10, 32, 32, 32, 32, 32, 32,105,102,
+   32,101,110,118, 32,116,104,101,110,  9,  9, 45, 45, 32, 97,110,100, 32,
+   97,116, 32,108,101, 97,115,116, 32,111,110,101, 32,111,102, 32,116,104,
+  101,109, 10,  9, 32,120, 32, 61, 32,120, 58,115,117, 98,115,116, 40,101,
+  110,118, 41,  9, 45, 45, 32,109,117,115,116, 32, 98,101, 32, 97, 32, 99,
+  111,110,115,116, 97,110,116, 46, 10,  9, 32,121, 32, 61, 32,121, 58,115,
+  117, 98,115,116, 40,101,110,118, 41, 10, 32, 32, 32, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,120, 58,101,
+  113,117, 97,108,115, 95,112,114,105,109,105,116,105,118,101, 40,121, 44,
+   32,115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32,101,110,100, 10, 10,
+   32, 32, 32,102,117,110, 99,116,105,111,110, 32, 86, 97,114, 58,101,113,
+  117, 97,108,115, 95,112,114,105,109,105,116,105,118,101, 40,116,101,114,
+  109, 44, 32,115,117, 98,103,111, 97,108, 41, 10, 32, 32, 32,101,110,100,
+   10, 10, 32, 32, 32,102,117,110, 99,116,105,111,110, 32, 67,111,110,115,
+  116, 58,101,113,117, 97,108,115, 95,112,114,105,109,105,116,105,118,101,
+   40,116,101,114,109, 44, 32,115,117, 98,103,111, 97,108, 41, 10, 32, 32,
+   32, 32, 32, 32,105,102, 32,115,101,108,102, 32, 61, 61, 32,116,101,114,
+  109, 32,116,104,101,110,  9, 45, 45, 32, 66,111,116,104, 32,116,101,114,
+  109,115, 32, 97,114,101, 32, 99,111,110,115,116, 97,110,116, 32, 97,110,
+  100, 32,101,113,117, 97,108, 46, 10,  9, 32,108,111, 99, 97,108, 32,108,
+  105,116,101,114, 97,108, 32, 61, 32,123,112,114,101,100, 32, 61, 32, 98,
+  105,110, 97,114,121, 95,101,113,117, 97,108,115, 95,112,114,101,100, 44,
+   32,115,101,108,102, 44, 32,115,101,108,102,125, 10,  9, 32,114,101,116,
+  117,114,110, 32,102, 97, 99,116, 40,115,117, 98,103,111, 97,108, 44, 32,
+  108,105,116,101,114, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100,
+   10, 32, 32, 32,101,110,100, 10, 10, 32, 32, 32, 98,105,110, 97,114,121,
+   95,101,113,117, 97,108,115, 95,112,114,101,100, 46,112,114,105,109, 32,
+   61, 32,101,113,117, 97,108,115, 95,112,114,105,109,105,116,105,118,101,
+   10,101,110,100, 10, 10, 45, 45, 32, 68,111,101,115, 32, 97, 32,108,105,
+  116,101,114, 97,108, 32,117,110,105,102,121, 32,119,105,116,104, 32, 97,
+  110, 32,102, 97, 99,116, 32,107,110,111,119,110, 32,116,111, 32, 99,111,
+  110,116, 97,105,110, 32,111,110,108,121, 32, 99,111,110,115,116, 97,110,
+  116, 10, 45, 45, 32,116,101,114,109,115, 63, 10, 10,108,111, 99, 97,108,
+   32,102,117,110, 99,116,105,111,110, 32,109, 97,116, 99,104, 40,108,105,
+  116,101,114, 97,108, 44, 32,102, 97, 99,116, 41, 10, 32, 32, 32,108,111,
+   99, 97,108, 32,101,110,118, 32, 61, 32,123,125, 10, 32, 32, 32,102,111,
+  114, 32,105, 61, 49, 44, 35,108,105,116,101,114, 97,108, 32,100,111, 10,
+   32, 32, 32, 32, 32, 32,105,102, 32,108,105,116,101,114, 97,108, 91,105,
+   93, 32,126, 61, 32,102, 97, 99,116, 91,105, 93, 32,116,104,101,110, 10,
+    9, 32,101,110,118, 32, 61, 32,108,105,116,101,114, 97,108, 91,105, 93,
+   58,109, 97,116, 99,104, 40,102, 97, 99,116, 91,105, 93, 44, 32,101,110,
+  118, 41, 10,  9, 32,105,102, 32,110,111,116, 32,101,110,118, 32,116,104,
+  101,110, 10,  9, 32, 32, 32, 32,114,101,116,117,114,110, 32,101,110,118,
+   10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,101,110,
+  118, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 67,111,
+  110,115,116, 58,109, 97,116, 99,104, 40, 99,111,110,115,116, 44, 32,101,
+  110,118, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108, 10,
+  101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32, 86, 97,114, 58,
+  109, 97,116, 99,104, 40, 99,111,110,115,116, 44, 32,101,110,118, 41, 10,
+   32, 32, 32,108,111, 99, 97,108, 32,116,101,114,109, 32, 61, 32,101,110,
+  118, 91,115,101,108,102, 93, 10, 32, 32, 32,105,102, 32,110,111,116, 32,
+  116,101,114,109, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,101,110,
+  118, 91,115,101,108,102, 93, 32, 61, 32, 99,111,110,115,116, 10, 32, 32,
+   32, 32, 32, 32,114,101,116,117,114,110, 32,101,110,118, 10, 32, 32, 32,
+  101,108,115,101,105,102, 32,116,101,114,109, 32, 61, 61, 32, 99,111,110,
+  115,116, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,
+  114,110, 32,101,110,118, 10, 32, 32, 32,101,108,115,101, 10, 32, 32, 32,
+   32, 32, 32,114,101,116,117,114,110, 32,110,105,108, 10, 32, 32, 32,101,
+  110,100, 10,101,110,100, 10, 10, 45, 45, 32, 65,100,100, 32, 97, 32,112,
+  114,105,109,105,116,105,118,101, 32,116,104, 97,116, 32,105,115, 32,100,
+  101,102,105,110,101,100, 32, 98,121, 32, 97,110, 32,105,116,101,114, 97,
+  116,111,114, 46, 32, 32, 87,104,101,110, 32,103,105,118,101,110, 32, 97,
+   10, 45, 45, 32,108,105,116,101,114, 97,108, 44, 32,116,104,101, 32,105,
+  116,101,114, 97,116,111,114, 32,103,101,110,101,114, 97,116,101,115, 32,
+   97, 32,115,101,113,117,101,110, 99,101,115, 32,111,102, 32, 97,110,115,
+  119,101,114,115, 46, 32, 32, 69, 97, 99,104, 10, 45, 45, 32, 97,110,115,
+  119,101,114, 32,105,115, 32, 97,110, 32, 97,114,114, 97,121, 46, 32, 32,
+   69, 97, 99,104, 32,101,108,101,109,101,110,116, 32,105,110, 32,116,104,
+  101, 32, 97,114,114, 97,121, 32,105,115, 32,101,105,116,104,101,114, 32,
+   97, 32,110,117,109, 98,101,114, 10, 45, 45, 32,111,114, 32, 97, 32,115,
+  116,114,105,110,103, 46, 32, 32, 84,104,101, 32,108,101,110,103,116,104,
+   32,111,102, 32,116,104,101, 32, 97,114,114, 97,121, 32,105,115, 32,101,
+  113,117, 97,108, 32,116,111, 32,116,104,101, 32, 97,114,105,116,121, 32,
+  111,102, 32,116,104,101, 10, 45, 45, 32,112,114,101,100,105, 99, 97,116,
   101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110,
-   32,115,117, 99, 99, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,
-  114,101,116,117,114,110, 32,102,117,110, 99,116,105,111,110, 40,115, 44,
-   32,118, 41, 10,  9, 32, 32, 32, 32, 32,105,102, 32,118, 32,116,104,101,
-  110, 10,  9,  9,114,101,116,117,114,110, 32,110,105,108, 10,  9, 32, 32,
-   32, 32, 32,101,108,115,101, 10,  9,  9,108,111, 99, 97,108, 32,120, 32,
-   61, 32,108,105,116,101,114, 97,108, 91, 49, 93, 10,  9,  9,108,111, 99,
-   97,108, 32,121, 32, 61, 32,108,105,116,101,114, 97,108, 91, 50, 93, 10,
-    9,  9,105,102, 32,121, 58,105,115, 95, 99,111,110,115,116, 40, 41, 32,
-  116,104,101,110, 10,  9,  9, 32, 32, 32,108,111, 99, 97,108, 32,106, 32,
-   61, 32,116,111,110,117,109, 98,101,114, 40,121, 46,105,100, 41, 10,  9,
-    9, 32, 32, 32,105,102, 32,106, 32, 97,110,100, 32,106, 32, 62, 61, 32,
-   48, 32,116,104,101,110, 10,  9,  9, 32, 32, 32, 32, 32, 32,114,101,116,
-  117,114,110, 32,123,106, 32, 43, 32, 49, 44, 32,106,125, 10,  9,  9, 32,
-   32, 32,101,108,115,101, 10,  9,  9, 32, 32, 32, 32, 32, 32,114,101,116,
-  117,114,110, 32,110,105,108, 10,  9,  9, 32, 32, 32,101,110,100, 10,  9,
-    9,101,108,115,101,105,102, 32,120, 58,105,115, 95, 99,111,110,115,116,
-   40, 41, 32,116,104,101,110, 10,  9,  9, 32, 32, 32,108,111, 99, 97,108,
-   32,105, 32, 61, 32,116,111,110,117,109, 98,101,114, 40,120, 46,105,100,
-   41, 10,  9,  9, 32, 32, 32,105,102, 32,105, 32, 97,110,100, 32,105, 32,
-   62, 32, 48, 32,116,104,101,110, 10,  9,  9, 32, 32, 32, 32, 32, 32,114,
-  101,116,117,114,110, 32,123,105, 44, 32,105, 32, 45, 32, 49,125, 10,  9,
-    9, 32, 32, 32,101,108,115,101, 10,  9,  9, 32, 32, 32, 32, 32, 32,114,
-  101,116,117,114,110, 32,110,105,108, 10,  9,  9, 32, 32, 32,101,110,100,
-   10,  9,  9,101,108,115,101, 10,  9,  9, 32, 32, 32,114,101,116,117,114,
-  110, 32,110,105,108, 10,  9,  9,101,110,100, 10,  9, 32, 32, 32, 32, 32,
-  101,110,100, 10,  9, 32, 32,101,110,100, 10,101,110,100, 10,100, 97,116,
-   97,108,111,103, 46, 97,100,100, 95,105,116,101,114, 95,112,114,105,109,
-   40, 34,115,117, 99, 99, 34, 44, 32, 50, 44, 32,115,117, 99, 99, 41, 10,
-   10, 45, 45, 93, 93, 10, 10, 45, 45, 32, 69, 88, 80, 79, 82, 84, 69, 68,
-   32, 70, 85, 78, 67, 84, 73, 79, 78, 83, 10, 10, 45, 45, 32, 84,104,101,
-   32, 67, 32, 65, 80, 73, 10, 10,102,117,110, 99,116,105,111,110, 32,100,
-  108, 95,112,117,115,104,108,105,116,101,114, 97,108, 40, 41, 10, 32, 32,
-   32,114,101,116,117,114,110, 32,123,125, 10,101,110,100, 10, 10,102,117,
-  110, 99,116,105,111,110, 32,100,108, 95, 97,100,100,112,114,101,100, 40,
-  116, 98,108, 44, 32,115,116,114, 41, 10, 32, 32, 32,116, 98,108, 46,110,
-   97,109,101, 32, 61, 32,115,116,114, 59, 10, 32, 32, 32,114,101,116,117,
-  114,110, 32,116, 98,108, 10,101,110,100, 10, 10,102,117,110, 99,116,105,
-  111,110, 32,100,108, 95, 97,100,100,118, 97,114, 40,116, 98,108, 44, 32,
+   32, 97,100,100, 95,105,116,101,114, 95,112,114,105,109, 40,110, 97,109,
+  101, 44, 32, 97,114,105,116,121, 44, 32,105,116,101,114, 41, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,112,114,101,100, 32, 61, 32,109, 97,107,101,
+   95,112,114,101,100, 40,110, 97,109,101, 44, 32, 97,114,105,116,121, 41,
+   10, 32, 32, 32,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110,
+   32,112,114,105,109, 40,108,105,116,101,114, 97,108, 44, 32,115,117, 98,
+  103,111, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,116,101,
+  114,109,115, 32,105,110, 32,105,116,101,114, 40,108,105,116,101,114, 97,
+  108, 41, 32,100,111, 10,  9, 32,108,111, 99, 97,108, 32,110, 32, 61, 32,
+   35,116,101,114,109,115, 10,  9, 32,105,102, 32,110, 32, 61, 61, 32, 97,
+  114,105,116,121, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,108,111, 99,
+   97,108, 32,110,101,119, 32, 61, 32,123,112,114,101,100, 32, 61, 32,112,
+  114,101,100,125, 10,  9, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44,
+  110, 32,100,111, 10,  9, 32, 32, 32, 32, 32, 32, 32,110,101,119, 91,105,
+   93, 32, 61, 32,109, 97,107,101, 95, 99,111,110,115,116, 40,116,101,114,
+  109,115, 91,105, 93, 41, 10,  9, 32, 32, 32, 32,101,110,100, 10,  9, 32,
+   32, 32, 32,105,102, 32,109, 97,116, 99,104, 40,108,105,116,101,114, 97,
+  108, 44, 32,110,101,119, 41, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,
+   32, 32, 32,102, 97, 99,116, 40,115,117, 98,103,111, 97,108, 44, 32,110,
+  101,119, 41, 10,  9, 32, 32, 32, 32,101,110,100, 10,  9, 32,101,110,100,
+   10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,112,114,101,100, 46,112,114,105,109, 32, 61, 32,112,114,105,
+  109, 10, 32, 32, 32,105,110,118, 97,108,105,100, 97,116,101, 40,112,114,
+  101,100, 41, 10, 32, 32, 32,109, 97,103,105, 99, 95,112,114,111,103,114,
+   97,109,115, 32, 61, 32,123,125, 10, 32, 32, 32,114,101,116,117,114,110,
+   32,105,110,115,101,114,116, 40,112,114,101,100, 41, 10,101,110,100, 10,
+   10, 45, 45, 91, 91, 10, 10, 45, 45, 32, 69,120, 97,109,112,108,101, 32,
+  111,102, 32, 97, 32,118,101,114,121, 32,115,105,109,112,108,101, 32,112,
+  114,105,109,105,116,105,118,101, 32,100,101,102,105,110,101,100, 32, 98,
+  121, 32, 97,110, 32,105,116,101,114, 97,116,111,114, 46, 10, 45, 45, 32,
+   73,116, 32,100,101,102,105,110,101,115, 32,116,104,101, 32,102, 97, 99,
+  116, 32,116,104,114,101,101, 40, 51, 41, 46, 10, 10, 97,100,100, 95,105,
+  116,101,114, 95,112,114,105,109, 40, 34,116,104,114,101,101, 34, 44, 32,
+   49, 44, 10,  9, 32, 32, 32, 32, 32, 32,102,117,110, 99,116,105,111,110,
+   40,108,105,116,101,114, 97,108, 41, 10,  9,  9, 32,114,101,116,117,114,
+  110, 32,102,117,110, 99,116,105,111,110, 40,115, 44, 32,118, 41, 10,  9,
+    9,  9, 32, 32, 32,105,102, 32,118, 32,116,104,101,110, 10,  9,  9,  9,
+   32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108, 10,  9,
+    9,  9, 32, 32, 32,101,108,115,101, 10,  9,  9,  9, 32, 32, 32, 32, 32,
+   32,114,101,116,117,114,110, 32,123, 51,125, 10,  9,  9,  9, 32, 32, 32,
+  101,110,100, 10,  9,  9,  9,101,110,100, 10,  9, 32, 32, 32, 32, 32, 32,
+  101,110,100, 41, 10, 10, 45, 45, 32, 69,120, 97,109,112,108,101, 32,111,
+  102, 32,116,104,101, 32,115,117, 99, 99,101,115,115,111,114, 32,112,114,
+  105,109,105,116,105,118,101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,
+  110, 99,116,105,111,110, 32,115,117, 99, 99, 40,108,105,116,101,114, 97,
+  108, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,102,117,110, 99,116,
+  105,111,110, 40,115, 44, 32,118, 41, 10,  9, 32, 32, 32, 32, 32,105,102,
+   32,118, 32,116,104,101,110, 10,  9,  9,114,101,116,117,114,110, 32,110,
+  105,108, 10,  9, 32, 32, 32, 32, 32,101,108,115,101, 10,  9,  9,108,111,
+   99, 97,108, 32,120, 32, 61, 32,108,105,116,101,114, 97,108, 91, 49, 93,
+   10,  9,  9,108,111, 99, 97,108, 32,121, 32, 61, 32,108,105,116,101,114,
+   97,108, 91, 50, 93, 10,  9,  9,105,102, 32,121, 58,105,115, 95, 99,111,
+  110,115,116, 40, 41, 32,116,104,101,110, 10,  9,  9, 32, 32, 32,108,111,
+   99, 97,108, 32,106, 32, 61, 32,116,111,110,117,109, 98,101,114, 40,121,
+   46,105,100, 41, 10,  9,  9, 32, 32, 32,105,102, 32,106, 32, 97,110,100,
+   32,106, 32, 62, 61, 32, 48, 32,116,104,101,110, 10,  9,  9, 32, 32, 32,
+   32, 32, 32,114,101,116,117,114,110, 32,123,106, 32, 43, 32, 49, 44, 32,
+  106,125, 10,  9,  9, 32, 32, 32,101,108,115,101, 10,  9,  9, 32, 32, 32,
+   32, 32, 32,114,101,116,117,114,110, 32,110,105,108, 10,  9,  9, 32, 32,
+   32,101,110,100, 10,  9,  9,101,108,115,101,105,102, 32,120, 58,105,115,
+   95, 99,111,110,115,116, 40, 41, 32,116,104,101,110, 10,  9,  9, 32, 32,
+   32,108,111, 99, 97,108, 32,105, 32, 61, 32,116,111,110,117,109, 98,101,
+  114, 40,120, 46,105,100, 41, 10,  9,  9, 32, 32, 32,105,102, 32,105, 32,
+   97,110,100, 32,105, 32, 62, 32, 48, 32,116,104,101,110, 10,  9,  9, 32,
+   32, 32, 32, 32, 32,114,101,116,117,114,110, 32,123,105, 44, 32,105, 32,
+   45, 32, 49,125, 10,  9,  9, 32, 32, 32,101,108,115,101, 10,  9,  9, 32,
+   32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108, 10,  9,  9,
+   32, 32, 32,101,110,100, 10,  9,  9,101,108,115,101, 10,  9,  9, 32, 32,
+   32,114,101,116,117,114,110, 32,110,105,108, 10,  9,  9,101,110,100, 10,
+    9, 32, 32, 32, 32, 32,101,110,100, 10,  9, 32, 32,101,110,100, 10,101,
+  110,100, 10,100, 97,116, 97,108,111,103, 46, 97,100,100, 95,105,116,101,
+  114, 95,112,114,105,109, 40, 34,115,117, 99, 99, 34, 44, 32, 50, 44, 32,
+  115,117, 99, 99, 41, 10, 10, 45, 45, 93, 93, 10, 10, 45, 45, 32, 77, 65,
+   71, 73, 67, 32, 83, 69, 84, 83, 10, 10, 45, 45, 91, 91, 10, 10, 65, 32,
+   98,111,116,116,111,109, 45,117,112, 32,101,118, 97,108,117, 97,116,105,
+  111,110, 32, 99,111,109,112,117,116,101,115, 32,101,118,101,114,121, 32,
+  102, 97, 99,116, 32,111,102, 32,101,118,101,114,121, 32,112,114,101,100,
+  105, 99, 97,116,101, 32, 97, 32,113,117,101,114,121, 10,100,101,112,101,
+  110,100,115, 32,111,110, 44, 32,101,118,101,110, 32,119,104,101,110, 32,
+  116,104,101, 32,113,117,101,114,121, 32,104, 97,115, 32, 99,111,110,115,
+  116, 97,110,116, 32, 97,114,103,117,109,101,110,116,115, 32, 97,110,100,
+   32,110,101,101,100,115, 32,102,101,119, 10,111,102, 32,116,104,101,109,
+   46, 32, 32, 84,104,101, 32,109, 97,103,105, 99, 32,115,101,116,115, 32,
+  116,114, 97,110,115,102,111,114,109, 97,116,105,111,110, 32,114,101,119,
+  114,105,116,101,115, 32,116,104,101, 32,114,117,108,101,115, 32,115,111,
+   32,116,104, 97,116, 10,116,104,101,121, 32,111,110,108,121, 32,100,101,
+  114,105,118,101, 32,102, 97, 99,116,115, 32,114,101,108,101,118, 97,110,
+  116, 32,116,111, 32,116,104,101, 32,113,117,101,114,121, 46, 32, 32, 83,
+  101,101, 32, 34, 77, 97,103,105, 99, 32, 83,101,116,115, 32, 97,110,100,
+   10, 79,116,104,101,114, 32, 83,116,114, 97,110,103,101, 32, 87, 97,121,
+  115, 32,116,111, 32, 73,109,112,108,101,109,101,110,116, 32, 76,111,103,
+  105, 99, 32, 80,114,111,103,114, 97,109,115, 34, 44, 32, 66, 97,110, 99,
+  105,108,104,111,110, 44, 32, 70, 46, 44, 10, 77, 97,105,101,114, 44, 32,
+   68, 46, 44, 32, 83, 97,103,105,118, 44, 32, 89, 46, 44, 32, 97,110,100,
+   32, 85,108,108,109, 97,110, 44, 32, 74, 46, 32, 68, 46, 44, 32, 80, 79,
+   68, 83, 32, 49, 57, 56, 54, 44, 32,112,112, 46, 32, 49, 45, 49, 53, 46,
+   10, 10, 65, 32,112,114,101,100,105, 99, 97,116,101, 32,119,105,116,104,
+   32,114,117,108,101,115, 32,105,115, 32, 97,100,111,114,110,101,100, 32,
+  119,105,116,104, 32, 97, 32,115,116,114,105,110,103, 32,116,104, 97,116,
+   32,104, 97,115, 32, 97, 32, 34, 98, 34, 32,102,111,114, 10,101, 97, 99,
+  104, 32, 97,114,103,117,109,101,110,116, 32,116,104, 97,116, 32,105,115,
+   32, 98,111,117,110,100, 32,119,104,101,110, 32,105,116, 32,105,115, 32,
+   99, 97,108,108,101,100, 44, 32, 97,110,100, 32, 97,110, 32, 34,102, 34,
+   32,102,111,114, 32,101, 97, 99,104, 10,102,114,101,101, 32,111,110,101,
+   46, 32, 32, 69, 97, 99,104, 32, 97,100,111,114,110,101,100, 32,112,114,
+  101,100,105, 99, 97,116,101, 32,105,115, 32,103,105,118,101,110, 32, 97,
+   32,109, 97,103,105, 99, 32,112,114,101,100,105, 99, 97,116,101, 44, 32,
+  119,104,111,115,101, 10,102, 97, 99,116,115, 32, 97,114,101, 32,116,104,
+  101, 32, 98,111,117,110,100, 32, 97,114,103,117,109,101,110,116,115, 32,
+  111,102, 32,116,104,101, 32, 99, 97,108,108,115, 32,109, 97,100,101, 32,
+  116,111, 32,105,116, 46, 32, 32, 65, 32,114,117,108,101, 32,102,111,114,
+   10,116,104,101, 32, 97,100,111,114,110,101,100, 32,112,114,101,100,105,
+   99, 97,116,101, 32,102,105,114,115,116, 32,108,111,111,107,115, 32,117,
+  112, 32,105,116,115, 32, 98,111,117,110,100, 32, 97,114,103,117,109,101,
+  110,116,115, 32,105,110, 32,116,104,101, 32,109, 97,103,105, 99, 10,112,
+  114,101,100,105, 99, 97,116,101, 46, 32, 32, 66,111,100,121, 32,108,105,
+  116,101,114, 97,108,115, 32, 97,114,101, 32, 99, 97,108,108,101,100, 32,
+  102,114,111,109, 32,108,101,102,116, 32,116,111, 32,114,105,103,104,116,
+   44, 32,115,111, 32, 97,110, 10, 97,114,103,117,109,101,110,116, 32,105,
+  115, 32, 98,111,117,110,100, 32,105,102, 32,105,116, 32,105,115, 32, 97,
+   32, 99,111,110,115,116, 97,110,116, 44, 32, 97, 32, 98,111,117,110,100,
+   32,118, 97,114,105, 97, 98,108,101, 32,111,102, 32,116,104,101, 32,104,
+  101, 97,100, 44, 10,111,114, 32, 97, 32,118, 97,114,105, 97, 98,108,101,
+   32,111,102, 32, 97,110, 32,101, 97,114,108,105,101,114, 32,108,105,116,
+  101,114, 97,108, 46, 32, 32, 69, 97, 99,104, 32, 99, 97,108,108, 32,116,
+  111, 32, 97, 32,112,114,101,100,105, 99, 97,116,101, 32,119,105,116,104,
+   10,114,117,108,101,115, 32, 97,100,100,115, 32, 97, 32,109, 97,103,105,
+   99, 32,114,117,108,101, 32,116,104, 97,116, 32,100,101,114,105,118,101,
+  115, 32,105,116,115, 32, 98,111,117,110,100, 32, 97,114,103,117,109,101,
+  110,116,115, 32,102,114,111,109, 32,116,104,111,115,101, 10,111,102, 32,
+  116,104,101, 32,104,101, 97,100, 32, 97,110,100, 32,116,104,101, 32,101,
+   97,114,108,105,101,114, 32,108,105,116,101,114, 97,108,115, 46, 32, 32,
+   70, 97, 99,116,115, 32,111,102, 32, 97, 32,112,114,101,100,105, 99, 97,
+  116,101, 32,119,105,116,104, 10,114,117,108,101,115, 32, 97,114,101, 32,
+  114,101, 97, 99,104,101,100, 32,116,104,114,111,117,103,104, 32, 97, 32,
+  114,117,108,101, 32,116,104, 97,116, 32,114,101, 97,100,115, 32,116,104,
+  101, 32,117,110, 99,104, 97,110,103,101,100, 32,112,114,101,100,105, 99,
+   97,116,101, 44, 10,119,104,105, 99,104, 32,116,104,101, 32,101,118, 97,
+  108,117, 97,116,111,114, 32,108,111, 97,100,115, 32,119,105,116,104,111,
+  117,116, 32,105,116,115, 32,114,117,108,101,115, 46, 10, 10, 84,104,101,
+   32,113,117,101,114,121, 32,115,117,112,112,108,105,101,115, 32,116,104,
+  101, 32,115,105,110,103,108,101, 32,115,101,101,100, 32,102, 97, 99,116,
+   32,111,102, 32,105,116,115, 32,109, 97,103,105, 99, 32,112,114,101,100,
+  105, 99, 97,116,101, 46, 32, 32, 84,104,101, 10,114,101,119,114,105,116,
+  116,101,110, 32,112,114,111,103,114, 97,109, 32,100,101,112,101,110,100,
+  115, 32,111,110,108,121, 32,111,110, 32,116,104,101, 32,112,114,101,100,
+  105, 99, 97,116,101, 32, 97,110,100, 32, 97,100,111,114,110,109,101,110,
+  116, 32,111,102, 32,116,104,101, 10,113,117,101,114,121, 44, 32, 97,110,
+  100, 32,105,115, 32,114,101,117,115,101,100, 32, 98,121, 32,108, 97,116,
+  101,114, 32,113,117,101,114,105,101,115, 32,119,105,116,104, 32,116,104,
+  101, 32,115, 97,109,101, 32, 98,105,110,100,105,110,103, 32,112, 97,116,
+  116,101,114,110, 46, 10, 10, 93, 93, 10, 10,108,111, 99, 97,108, 32,102,
+  117,110, 99,116,105,111,110, 32,104, 97,115, 95,114,117,108,101,115, 40,
+  112,114,101,100, 41, 10, 32, 32, 32,102,111,114, 32,105,100, 44, 99,108,
+   97,117,115,101, 32,105,110, 32,112, 97,105,114,115, 40,112,114,101,100,
+   46,100, 98, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,105,102, 32, 35,
+   99,108, 97,117,115,101, 32, 62, 32, 48, 32,116,104,101,110, 10,  9, 32,
+  114,101,116,117,114,110, 32,116,114,117,101, 10, 32, 32, 32, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,
+  114,110, 32,102, 97,108,115,101, 10,101,110,100, 10, 10, 45, 45, 32, 82,
+  101,116,117,114,110,115, 32,116,104,101, 32, 97,100,111,114,110,109,101,
+  110,116, 32,111,102, 32, 97, 32,108,105,116,101,114, 97,108, 44, 32,103,
+  105,118,101,110, 32,116,104,101, 32,115,101,116, 32,111,102, 32, 98,111,
+  117,110,100, 10, 45, 45, 32,118, 97,114,105, 97, 98,108,101,115, 46, 10,
+   10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32, 97,100,
+  111,114,110,109,101,110,116, 40,108,105,116,101,114, 97,108, 44, 32, 98,
+  111,117,110,100, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32, 97, 32, 61,
+   32,123,125, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,108,105,
+  116,101,114, 97,108, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99,
+   97,108, 32,116,101,114,109, 32, 61, 32,108,105,116,101,114, 97,108, 91,
+  105, 93, 10, 32, 32, 32, 32, 32, 32,105,102, 32,116,101,114,109, 58,105,
+  115, 95, 99,111,110,115,116, 40, 41, 32,111,114, 32, 98,111,117,110,100,
+   91,116,101,114,109, 93, 32,116,104,101,110, 10,  9, 32, 97, 91,105, 93,
+   32, 61, 32, 34, 98, 34, 10, 32, 32, 32, 32, 32, 32,101,108,115,101, 10,
+    9, 32, 97, 91,105, 93, 32, 61, 32, 34,102, 34, 10, 32, 32, 32, 32, 32,
+   32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,
+  117,114,110, 32,116, 97, 98,108,101, 46, 99,111,110, 99, 97,116, 40, 97,
+   41, 10,101,110,100, 10, 10, 45, 45, 32, 82,101,116,117,114,110,115, 32,
+   97, 32,108,105,116,101,114, 97,108, 32,119,105,116,104, 32,116,104,101,
+   32,116,101,114,109,115, 32,111,102, 32, 97, 32,108,105,116,101,114, 97,
+  108, 32, 97,116, 32,116,104,101, 32, 98,111,117,110,100, 10, 45, 45, 32,
+  112,111,115,105,116,105,111,110,115, 32,111,102, 32, 97,110, 32, 97,100,
+  111,114,110,109,101,110,116, 46, 10, 10,108,111, 99, 97,108, 32,102,117,
+  110, 99,116,105,111,110, 32, 98,111,117,110,100, 95, 97,114,103,115, 40,
+  112,114,101,100, 44, 32,108,105,116,101,114, 97,108, 44, 32, 97, 41, 10,
+   32, 32, 32,108,111, 99, 97,108, 32,110,101,119, 32, 61, 32,123,112,114,
+  101,100, 32, 61, 32,112,114,101,100,125, 10, 32, 32, 32,102,111,114, 32,
+  105, 61, 49, 44, 35,108,105,116,101,114, 97,108, 32,100,111, 10, 32, 32,
+   32, 32, 32, 32,105,102, 32,115,116,114,105,110,103, 46,115,117, 98, 40,
+   97, 44, 32,105, 44, 32,105, 41, 32, 61, 61, 32, 34, 98, 34, 32,116,104,
+  101,110, 10,  9, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40,
+  110,101,119, 44, 32,108,105,116,101,114, 97,108, 91,105, 93, 41, 10, 32,
+   32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,114,101,116,117,114,110, 32,110,101,119, 10,101,110,100, 10, 10, 45,
+   45, 32, 82,101,119,114,105,116,101,115, 32,116,104,101, 32,112,114,111,
+  103,114, 97,109, 32,102,111,114, 32, 97, 32,112,114,101,100,105, 99, 97,
+  116,101, 32, 97,110,100, 32, 97,100,111,114,110,109,101,110,116, 46, 32,
+   32, 84,104,101, 32,114,101,115,117,108,116, 10, 45, 45, 32,108,105,115,
+  116,115, 32,116,104,101, 32,112,114,101,100,105, 99, 97,116,101,115, 32,
+  114,101, 97,100, 32, 98,121, 32,116,104,101, 32,101,118, 97,108,117, 97,
+  116,111,114, 44, 32,105,110, 32,116,104,101, 32,102,111,114,109, 97,116,
+   32,114,101,116,117,114,110,101,100, 10, 45, 45, 32, 98,121, 32,100,108,
+   95,112,114,111,103,114, 97,109, 44, 32, 97,110,100, 32,104, 97,115, 32,
+  116,104,101, 32, 97,100,111,114,110,101,100, 32, 97,110,100, 32,109, 97,
+  103,105, 99, 32,112,114,101,100,105, 99, 97,116,101,115, 32,111,102, 32,
+  116,104,101, 10, 45, 45, 32,113,117,101,114,121, 46, 32, 32, 78,105,108,
+   32,105,115, 32,114,101,116,117,114,110,101,100, 32,119,104,101,110, 32,
+  116,104,101, 32,112,114,111,103,114, 97,109, 32,117,115,101,115, 32, 97,
+   32,112,114,105,109,105,116,105,118,101, 32,111,116,104,101,114, 10, 45,
+   45, 32,116,104, 97,110, 32,101,113,117, 97,108,105,116,121, 46, 10, 10,
+  108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,109, 97,103,
+  105, 99, 95,114,101,119,114,105,116,101, 40,112,114,101,100, 44, 32, 97,
+   41, 10, 32, 32, 32,108,111, 99, 97,108, 32,112,114,101,100,115, 32, 61,
+   32,123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32,111,114,105,103,105,
+  110, 97,108,115, 32, 61, 32,123,125, 10, 32, 32, 32,108,111, 99, 97,108,
+   32, 97,100,111,114,110,101,100, 32, 61, 32,123,125, 10, 32, 32, 32,108,
+  111, 99, 97,108, 32,116,111,100,111, 32, 61, 32,123,125, 10, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32, 97,100,
+  100, 95,112,114,101,100, 40,112, 44, 32,110, 97,109,101, 44, 32, 97,114,
+  105,116,121, 44, 32,102, 97, 99,116,115, 41, 10, 32, 32, 32, 32, 32, 32,
+  116, 97, 98,108,101, 46,105,110,115,101,114,116, 40,112,114,101,100,115,
+   44, 32,123,112,114,101,100, 32, 61, 32,112, 44, 32,110, 97,109,101, 32,
+   61, 32,110, 97,109,101, 44, 32, 97,114,105,116,121, 32, 61, 32, 97,114,
+  105,116,121, 44, 10,  9,  9,  9, 32, 32, 32,101,113,117, 97,108,115, 32,
+   61, 32,112, 32, 61, 61, 32, 98,105,110, 97,114,121, 95,101,113,117, 97,
+  108,115, 95,112,114,101,100, 44, 10,  9,  9,  9, 32, 32, 32,102, 97, 99,
+  116,115, 32, 61, 32,102, 97, 99,116,115,125, 41, 10, 32, 32, 32,101,110,
+  100, 10, 10, 32, 32, 32,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
+  111,110, 32,111,114,105,103,105,110, 97,108, 40,112, 41, 10, 32, 32, 32,
+   32, 32, 32,105,102, 32,110,111,116, 32,111,114,105,103,105,110, 97,108,
+  115, 91,112, 93, 32,116,104,101,110, 10,  9, 32,111,114,105,103,105,110,
+   97,108,115, 91,112, 93, 32, 61, 32,116,114,117,101, 10,  9, 32, 97,100,
+  100, 95,112,114,101,100, 40,112, 44, 32,112, 46,110, 97,109,101, 44, 32,
+  112, 46, 97,114,105,116,121, 44, 32,116,114,117,101, 41, 10, 32, 32, 32,
+   32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32, 97,100,111,
+  114,110, 40,112, 44, 32, 97, 41, 10, 32, 32, 32, 32, 32, 32,108,111, 99,
+   97,108, 32,107,101,121, 32, 61, 32,112, 46,105,100, 32, 46, 46, 32, 34,
+   47, 34, 32, 46, 46, 32, 97, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,
+  108, 32,101,110,116,114,121, 32, 61, 32, 97,100,111,114,110,101,100, 91,
+  107,101,121, 93, 10, 32, 32, 32, 32, 32, 32,105,102, 32,110,111,116, 32,
+  101,110,116,114,121, 32,116,104,101,110, 10,  9, 32,108,111, 99, 97,108,
+   32, 95, 44, 32,110, 32, 61, 32,115,116,114,105,110,103, 46,103,115,117,
+   98, 40, 97, 44, 32, 34, 98, 34, 44, 32, 34, 34, 41, 10,  9, 32,101,110,
+  116,114,121, 32, 61, 32,123,112,114,101,100, 32, 61, 32,112, 44, 32, 97,
+  100,111,114,110,109,101,110,116, 32, 61, 32, 97, 44, 10,  9,  9, 32, 32,
+   97,110,115,119,101,114, 32, 61, 32,123,110, 97,109,101, 32, 61, 32,112,
+   46,110, 97,109,101, 44, 32, 97,114,105,116,121, 32, 61, 32,112, 46, 97,
+  114,105,116,121, 44, 32,100, 98, 32, 61, 32,123,125,125, 44, 10,  9,  9,
+   32, 32,109, 97,103,105, 99, 32, 61, 32,123,110, 97,109,101, 32, 61, 32,
+   34,109, 97,103,105, 99, 32, 34, 32, 46, 46, 32,107,101,121, 44, 32, 97,
+  114,105,116,121, 32, 61, 32,110, 44, 32,100, 98, 32, 61, 32,123,125,125,
+  125, 10,  9, 32, 97,100,111,114,110,101,100, 91,107,101,121, 93, 32, 61,
+   32,101,110,116,114,121, 10,  9, 32, 97,100,100, 95,112,114,101,100, 40,
+  101,110,116,114,121, 46, 97,110,115,119,101,114, 44, 32,112, 46,110, 97,
+  109,101, 44, 32,112, 46, 97,114,105,116,121, 41, 10,  9, 32, 97,100,100,
+   95,112,114,101,100, 40,101,110,116,114,121, 46,109, 97,103,105, 99, 44,
+   32,101,110,116,114,121, 46,109, 97,103,105, 99, 46,110, 97,109,101, 44,
+   32,110, 41, 10,  9, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116,
+   40,116,111,100,111, 44, 32,101,110,116,114,121, 41, 10, 32, 32, 32, 32,
+   32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110,
+   32,101,110,116,114,121, 10, 32, 32, 32,101,110,100, 10, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,114,101,119,
+  114,105,116,101, 40,101,110,116,114,121, 44, 32, 99,108, 97,117,115,101,
+   41, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,104,101, 97,100,
+   32, 61, 32, 99,108, 97,117,115,101, 46,104,101, 97,100, 10, 32, 32, 32,
+   32, 32, 32,108,111, 99, 97,108, 32, 97, 32, 61, 32,101,110,116,114,121,
+   46, 97,100,111,114,110,109,101,110,116, 10, 32, 32, 32, 32, 32, 32,108,
+  111, 99, 97,108, 32, 98,111,117,110,100, 32, 61, 32,123,125, 10, 32, 32,
+   32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,104,101, 97,100, 32,
+  100,111, 10,  9, 32,105,102, 32,115,116,114,105,110,103, 46,115,117, 98,
+   40, 97, 44, 32,105, 44, 32,105, 41, 32, 61, 61, 32, 34, 98, 34, 32, 97,
+  110,100, 32,110,111,116, 32,104,101, 97,100, 91,105, 93, 58,105,115, 95,
+   99,111,110,115,116, 40, 41, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,
+   98,111,117,110,100, 91,104,101, 97,100, 91,105, 93, 93, 32, 61, 32,116,
+  114,117,101, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32, 98,111,100,121,
+   32, 61, 32,123, 98,111,117,110,100, 95, 97,114,103,115, 40,101,110,116,
+  114,121, 46,109, 97,103,105, 99, 44, 32,104,101, 97,100, 44, 32, 97, 41,
+  125, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,106, 61, 49, 44, 35, 99,
+  108, 97,117,115,101, 32,100,111, 10,  9, 32,108,111, 99, 97,108, 32,108,
+  105,116,101,114, 97,108, 32, 61, 32, 99,108, 97,117,115,101, 91,106, 93,
+   10,  9, 32,108,111, 99, 97,108, 32,112, 32, 61, 32,108,105,116,101,114,
+   97,108, 46,112,114,101,100, 10,  9, 32,105,102, 32,112, 32, 61, 61, 32,
+   98,105,110, 97,114,121, 95,101,113,117, 97,108,115, 95,112,114,101,100,
+   32,116,104,101,110, 10,  9, 32, 32, 32, 32,111,114,105,103,105,110, 97,
+  108, 40,112, 41, 10,  9, 32, 32, 32, 32,108,111, 99, 97,108, 32,120, 44,
+   32,121, 32, 61, 32,108,105,116,101,114, 97,108, 91, 49, 93, 44, 32,108,
+  105,116,101,114, 97,108, 91, 50, 93, 10,  9, 32, 32, 32, 32,105,102, 32,
+  120, 58,105,115, 95, 99,111,110,115,116, 40, 41, 32,111,114, 32, 98,111,
+  117,110,100, 91,120, 93, 32,116,104,101,110, 10,  9, 32, 32, 32, 32, 32,
+   32, 32, 98,111,117,110,100, 91,121, 93, 32, 61, 32,116,114,117,101, 10,
+    9, 32, 32, 32, 32,101,108,115,101,105,102, 32,121, 58,105,115, 95, 99,
+  111,110,115,116, 40, 41, 32,111,114, 32, 98,111,117,110,100, 91,121, 93,
+   32,116,104,101,110, 10,  9, 32, 32, 32, 32, 32, 32, 32, 98,111,117,110,
+  100, 91,120, 93, 32, 61, 32,116,114,117,101, 10,  9, 32, 32, 32, 32,101,
+  110,100, 10,  9, 32,101,108,115,101, 10,  9, 32, 32, 32, 32,105,102, 32,
+  112, 46,112,114,105,109, 32,116,104,101,110, 10,  9, 32, 32, 32, 32, 32,
+   32, 32,114,101,116,117,114,110, 32,102, 97,108,115,101, 10,  9, 32, 32,
+   32, 32,101,108,115,101,105,102, 32,104, 97,115, 95,114,117,108,101,115,
+   40,112, 41, 32,116,104,101,110, 10,  9, 32, 32, 32, 32, 32, 32, 32,108,
+  111, 99, 97,108, 32, 99, 97,108,108,101,101, 32, 61, 32, 97,100,111,114,
+  110, 40,112, 44, 32, 97,100,111,114,110,109,101,110,116, 40,108,105,116,
+  101,114, 97,108, 44, 32, 98,111,117,110,100, 41, 41, 10,  9, 32, 32, 32,
+   32, 32, 32, 32,108,111, 99, 97,108, 32,109, 97,103,105, 99, 32, 61, 32,
+  123,125, 10,  9, 32, 32, 32, 32, 32, 32, 32,102,111,114, 32,107, 61, 49,
+   44, 35, 98,111,100,121, 32,100,111, 10,  9,  9, 32, 32,109, 97,103,105,
+   99, 91,107, 93, 32, 61, 32, 98,111,100,121, 91,107, 93, 10,  9, 32, 32,
+   32, 32, 32, 32, 32,101,110,100, 10,  9, 32, 32, 32, 32, 32, 32, 32,109,
+   97,103,105, 99, 46,104,101, 97,100, 32, 61, 32, 98,111,117,110,100, 95,
+   97,114,103,115, 40, 99, 97,108,108,101,101, 46,109, 97,103,105, 99, 44,
+   32,108,105,116,101,114, 97,108, 44, 10,  9,  9,  9,  9, 32, 32, 32, 32,
+   32, 32, 32, 99, 97,108,108,101,101, 46, 97,100,111,114,110,109,101,110,
+  116, 41, 10,  9, 32, 32, 32, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,
+  110,115,101,114,116, 40, 99, 97,108,108,101,101, 46,109, 97,103,105, 99,
+   46,100, 98, 44, 32,109, 97,103,105, 99, 41, 10,  9, 32, 32, 32, 32, 32,
+   32, 32,108,111, 99, 97,108, 32,110,101,119, 32, 61, 32,123,112,114,101,
+  100, 32, 61, 32, 99, 97,108,108,101,101, 46, 97,110,115,119,101,114,125,
+   10,  9, 32, 32, 32, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,
+  108,105,116,101,114, 97,108, 32,100,111, 10,  9,  9, 32, 32,110,101,119,
+   91,105, 93, 32, 61, 32,108,105,116,101,114, 97,108, 91,105, 93, 10,  9,
+   32, 32, 32, 32, 32, 32, 32,101,110,100, 10,  9, 32, 32, 32, 32, 32, 32,
+   32,108,105,116,101,114, 97,108, 32, 61, 32,110,101,119, 10,  9, 32, 32,
+   32, 32,101,108,115,101, 10,  9, 32, 32, 32, 32, 32, 32, 32,111,114,105,
+  103,105,110, 97,108, 40,112, 41, 10,  9, 32, 32, 32, 32,101,110,100, 10,
+    9, 32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,108,105,116,101,
+  114, 97,108, 32,100,111, 10,  9, 32, 32, 32, 32, 32, 32, 32, 98,111,117,
+  110,100, 91,108,105,116,101,114, 97,108, 91,105, 93, 93, 32, 61, 32,116,
+  114,117,101, 10,  9, 32, 32, 32, 32,101,110,100, 10,  9, 32,101,110,100,
+   10,  9, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40, 98,111,
+  100,121, 44, 32,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32, 32, 32,
+   32,101,110,100, 10, 32, 32, 32, 32, 32, 32, 98,111,100,121, 46,104,101,
+   97,100, 32, 61, 32,123,112,114,101,100, 32, 61, 32,101,110,116,114,121,
+   46, 97,110,115,119,101,114,125, 10, 32, 32, 32, 32, 32, 32,102,111,114,
+   32,105, 61, 49, 44, 35,104,101, 97,100, 32,100,111, 10,  9, 32, 98,111,
+  100,121, 46,104,101, 97,100, 91,105, 93, 32, 61, 32,104,101, 97,100, 91,
+  105, 93, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32,
+   32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40,101,110,116,114,
+  121, 46, 97,110,115,119,101,114, 46,100, 98, 44, 32, 98,111,100,121, 41,
+   10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,116,114,117,101,
+   10, 32, 32, 32,101,110,100, 10, 10, 32, 32, 32,108,111, 99, 97,108, 32,
+  113,117,101,114,121, 32, 61, 32, 97,100,111,114,110, 40,112,114,101,100,
+   44, 32, 97, 41, 10, 32, 32, 32,119,104,105,108,101, 32, 35,116,111,100,
+  111, 32, 62, 32, 48, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99,
+   97,108, 32,101,110,116,114,121, 32, 61, 32,116, 97, 98,108,101, 46,114,
+  101,109,111,118,101, 40,116,111,100,111, 41, 10, 32, 32, 32, 32, 32, 32,
+  108,111, 99, 97,108, 32,112, 32, 61, 32,101,110,116,114,121, 46,112,114,
+  101,100, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,102, 97, 99,
+  116,115, 32, 61, 32,123,112,114,101,100, 32, 61, 32,112,125, 10, 32, 32,
+   32, 32, 32, 32,102,111,114, 32,105, 61, 49, 44,112, 46, 97,114,105,116,
+  121, 32,100,111, 10,  9, 32,102, 97, 99,116,115, 91,105, 93, 32, 61, 32,
+  109, 97,107,101, 95,118, 97,114, 40,105, 41, 10, 32, 32, 32, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32, 32, 32, 32,111,114,105,103,105,110, 97,108,
+   40,112, 41, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32,114,117,
+  108,101, 32, 61, 32,123, 98,111,117,110,100, 95, 97,114,103,115, 40,101,
+  110,116,114,121, 46,109, 97,103,105, 99, 44, 32,102, 97, 99,116,115, 44,
+   32,101,110,116,114,121, 46, 97,100,111,114,110,109,101,110,116, 41, 44,
+   32,102, 97, 99,116,115,125, 10, 32, 32, 32, 32, 32, 32,114,117,108,101,
+   46,104,101, 97,100, 32, 61, 32,123,112,114,101,100, 32, 61, 32,101,110,
+  116,114,121, 46, 97,110,115,119,101,114,125, 10, 32, 32, 32, 32, 32, 32,
+  102,111,114, 32,105, 61, 49, 44,112, 46, 97,114,105,116,121, 32,100,111,
+   10,  9, 32,114,117,108,101, 46,104,101, 97,100, 91,105, 93, 32, 61, 32,
+  102, 97, 99,116,115, 91,105, 93, 10, 32, 32, 32, 32, 32, 32,101,110,100,
+   10, 32, 32, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,
+  116, 40,101,110,116,114,121, 46, 97,110,115,119,101,114, 46,100, 98, 44,
+   32,114,117,108,101, 41, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,
+  100, 44, 99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,114,115, 40,
+  112, 46,100, 98, 41, 32,100,111, 10,  9, 32,105,102, 32, 35, 99,108, 97,
+  117,115,101, 32, 62, 32, 48, 32, 97,110,100, 32,110,111,116, 32,114,101,
+  119,114,105,116,101, 40,101,110,116,114,121, 44, 32, 99,108, 97,117,115,
+  101, 41, 32,116,104,101,110, 10,  9, 32, 32, 32, 32,114,101,116,117,114,
+  110, 32,110,105,108, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,
+  114,110, 32,123,112,114,101,100,115, 32, 61, 32,112,114,101,100,115, 44,
+   32, 97,110,115,119,101,114, 32, 61, 32,113,117,101,114,121, 46, 97,110,
+  115,119,101,114, 44, 32,109, 97,103,105, 99, 32, 61, 32,113,117,101,114,
+  121, 46,109, 97,103,105, 99,125, 10,101,110,100, 10, 10, 45, 45, 32, 82,
+   69, 80, 76, 73, 67, 65, 83, 10, 10, 45, 45, 32, 65, 32,100, 97,116, 97,
+   98, 97,115,101, 32, 99, 97,110, 32,112,117, 98,108,105,115,104, 32, 97,
+   32,118,101,114,115,105,111,110, 32,111,102, 32,105,116,115, 32,102, 97,
+   99,116,115, 32, 97,110,100, 32,114,117,108,101,115, 44, 32,119,104,105,
+   99,104, 10, 45, 45, 32,114,101,112,108,105, 99, 97,115, 32,105,110,115,
+  116, 97,108,108, 46, 32, 32, 65, 32,114,101,112,108,105, 99, 97, 32,105,
+  115, 32, 97, 32,100, 97,116, 97, 98, 97,115,101, 32,105,110, 32, 97,110,
+  111,116,104,101,114, 32, 76,117, 97, 32,115,116, 97,116,101, 44, 10, 45,
+   45, 32,112,111,115,115,105, 98,108,121, 32,117,115,101,100, 32, 98,121,
+   32, 97,110,111,116,104,101,114, 32,116,104,114,101, 97,100, 46, 32, 32,
+   84,104,101, 32, 67, 32,108,105, 98,114, 97,114,121, 32,107,101,101,112,
+  115, 32,118,101,114,115,105,111,110,115, 10, 45, 45, 32,111,117,116,115,
+  105,100,101, 32,111,102, 32, 97,110,121, 32, 76,117, 97, 32,115,116, 97,
+  116,101, 44, 32, 97,110,100, 32, 97, 32,114,101,112,108,105, 99, 97, 32,
+  105,110,115,116, 97,108,108,115, 32,116,104,101, 32,102, 97, 99,116,115,
+   32,111,102, 32, 97, 10, 45, 45, 32,118,101,114,115,105,111,110, 32, 97,
+  115, 32,102, 97, 99,116, 32,115,116,111,114,101,115, 32,116,104, 97,116,
+   32,115,104, 97,114,101, 32,116,104,101,105,114, 32,114,111,119,115, 32,
+  119,105,116,104, 32,116,104,101, 32,115,116,111,114,101,115, 32,111,102,
+   32,116,104,101, 10, 45, 45, 32,100, 97,116, 97, 98, 97,115,101, 44, 32,
+  115,111, 32,116,104,101,121, 32, 97,114,101, 32,110,111,116, 32, 99,111,
+  112,105,101,100, 46, 32, 32, 84,104,101, 32,114,117,108,101,115, 32, 97,
+  114,101, 32, 99,111,112,105,101,100, 44, 32, 97,115, 32,116,104,101,121,
+   32, 97,114,101, 10, 45, 45, 32,102,101,119, 46, 32, 32, 70,111,114, 32,
+  116,104,101, 32,114,111,119,115, 32,116,111, 32,109,101, 97,110, 32,116,
+  104,101, 32,115, 97,109,101, 32,116,104,105,110,103, 32,101,118,101,114,
+  121,119,104,101,114,101, 44, 32, 97, 32,100, 97,116, 97, 98, 97,115,101,
+   10, 45, 45, 32, 97,110,100, 32,105,116,115, 32,114,101,112,108,105, 99,
+   97,115, 32,110,117,109, 98,101,114, 32,116,104,101,105,114, 32, 99,111,
+  110,115,116, 97,110,116,115, 32,119,105,116,104, 32,111,110,101, 32,115,
+  121,109, 98,111,108, 32,116, 97, 98,108,101, 44, 32,107,101,112,116, 10,
+   45, 45, 32, 98,121, 32,116,104,101, 32, 67, 32,108,105, 98,114, 97,114,
+  121, 46, 10, 10, 45, 45, 32, 78,117,109, 98,101,114,115, 32, 99,111,110,
+  115,116, 97,110,116,115, 32,119,105,116,104, 32,116,104,101, 32,115,104,
+   97,114,101,100, 32,115,121,109, 98,111,108, 32,116, 97, 98,108,101, 46,
+   32, 32, 84,104,101, 32,102,117,110, 99,116,105,111,110, 10, 45, 45, 32,
+  115,121,109, 98,111,108, 32,114,101,116,117,114,110,115, 32,116,104,101,
+   32,115,121,109, 98,111,108, 32,111,102, 32, 97,110, 32,105,100, 44, 32,
+   97,100,100,105,110,103, 32,105,116, 32,116,111, 32,116,104,101, 32,116,
+   97, 98,108,101, 32,105,102, 32,110,101,101,100, 10, 45, 45, 32, 98,101,
+   44, 32,117,115,105,110,103, 32,116,104,101, 32,115,121,109, 98,111,108,
+   32,103,105,118,101,110, 32, 97,115, 32,105,116,115, 32,115,101, 99,111,
+  110,100, 32, 97,114,103,117,109,101,110,116, 32,119,104,101,110, 32,116,
+  104,101,114,101, 32,105,115, 10, 45, 45, 32,111,110,101, 44, 32, 97,110,
+  100, 32,116,104,101, 32,102,117,110, 99,116,105,111,110, 32,110, 97,109,
+  101, 32,114,101,116,117,114,110,115, 32,116,104,101, 32,105,100, 32,111,
+  102, 32, 97, 32,115,121,109, 98,111,108, 46, 32, 32, 84,104,101, 10, 45,
+   45, 32, 99,111,110,115,116, 97,110,116,115, 32,109, 97,100,101, 32,115,
+  111, 32,102, 97,114, 32,107,101,101,112, 32,116,104,101,105,114, 32,115,
+  121,109, 98,111,108,115, 44, 32,119,104,105, 99,104, 32, 97,114,101, 32,
+   97,100,100,101,100, 32,116,111, 32,116,104,101, 10, 45, 45, 32,116, 97,
+   98,108,101, 44, 32,111,114, 32,103,105,118,101,110, 32,110,101,119, 32,
+  111,110,101,115, 32,119,104,101,110, 32,116,104,101,105,114,115, 32, 97,
+  114,101, 32,116, 97,107,101,110, 46, 32, 32, 84,104,101, 32, 99,111,110,
+  115,116, 97,110,116,115, 32,111,102, 10, 45, 45, 32,116,104,101, 32,115,
+  121,109, 98,111,108,115, 32,105,110, 32,116,104,101, 32,114,111,119,115,
+   32,111,102, 32,116,104,101, 32,115,116,111,114,101,115, 32, 97,114,101,
+   32,109, 97,100,101, 32,102,105,114,115,116, 44, 32, 97,110,100, 32,104,
+  101,108,100, 10, 45, 45, 32,117,110,116,105,108, 32,116,104,101,110, 44,
+   32, 97,115, 32,116,104,101, 32,116, 97, 98,108,101, 32,111,102, 32, 99,
+  111,110,115,116, 97,110,116,115, 32,109, 97,121, 32,104,111,108,100, 32,
+  116,104,101,109, 32,119,101, 97,107,108,121, 46, 10, 45, 45, 32, 67,111,
+  110,115,116, 97,110,116,115, 32,111,102, 32,115,121,109, 98,111,108,115,
+   32,102,105,114,115,116, 32,115,101,101,110, 32,105,110, 32,116,104,101,
+   32,114,111,119,115, 32,111,102, 32, 97, 32,114,101,112,108,105, 99, 97,
+   39,115, 32,115,116,111,114,101,115, 10, 45, 45, 32, 97,114,101, 32,109,
+   97,100,101, 32,119,104,101,110, 32,108,111,111,107,101,100, 32,117,112,
+   46, 32, 32, 87,104,101,110, 32,119,101, 97,107, 32,105,115, 32,116,114,
+  117,101, 44, 32,110, 97,109,101, 32,107,110,111,119,115, 32,101,118,101,
+  114,121, 10, 45, 45, 32,115,121,109, 98,111,108, 44, 32,115,111, 32,116,
+  104,101, 32,116, 97, 98,108,101, 32,111,102, 32, 99,111,110,115,116, 97,
+  110,116,115, 32,104,111,108,100,115, 32,116,104,101,109, 32,119,101, 97,
+  107,108,121, 44, 32, 97,115, 32,116,104,101,121, 32, 99, 97,110, 32, 98,
+  101, 10, 45, 45, 32,109, 97,100,101, 32, 97,103, 97,105,110, 46, 32, 32,
+   84,104,101, 32, 67, 32,108,105, 98,114, 97,114,121, 32,114,101, 99,108,
+   97,105,109,115, 32,116,104,101, 32,115,121,109, 98,111,108,115, 32,110,
+  111, 32,100, 97,116, 97, 98, 97,115,101, 32,111,102, 32,116,104,101, 10,
+   45, 45, 32,102, 97,109,105,108,121, 32,117,115,101,115, 44, 32, 97,115,
+  107,105,110,103, 32,101, 97, 99,104, 32,102,111,114, 32,105,116,115, 32,
+  111,119,110, 32,119,105,116,104, 32,100,108, 95,115,121,109, 98,111,108,
+  115, 46, 10, 10,108,111, 99, 97,108, 32,115,104, 97,114,105,110,103, 32,
+   61, 32,102, 97,108,115,101,  9,  9, 45, 45, 32, 65,114,101, 32,115,121,
+  109, 98,111,108,115, 32,115,104, 97,114,101,100, 63, 10, 10,102,117,110,
+   99,116,105,111,110, 32,100,108, 95,115,104, 97,114,101, 95,115,121,109,
+   98,111,108,115, 40,115,121,109, 98,111,108, 44, 32,110, 97,109,101, 44,
+   32,119,101, 97,107, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,109, 97,
+  114,107,115, 32, 61, 32,123,125, 10, 32, 32, 32,109, 97,114,107, 95,115,
+  116,111,114,101,115, 40,109, 97,114,107,115, 41, 10, 32, 32, 32,108,111,
+   99, 97,108, 32,115,116,111,114,101,100, 32, 61, 32,123,125, 10, 32, 32,
+   32,102,111,114, 32,115,121,109, 32,105,110, 32,112, 97,105,114,115, 40,
+  109, 97,114,107,115, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111,
+   99, 97,108, 32, 99,111,110,115,116, 32, 61, 32, 99,111,110,115,116, 95,
+  111,102, 95,115,121,109, 91,115,121,109, 93, 10, 32, 32, 32, 32, 32, 32,
+  105,102, 32, 99,111,110,115,116, 32,116,104,101,110, 10,  9, 32,115,116,
+  111,114,101,100, 91, 99,111,110,115,116, 93, 32, 61, 32,116,114,117,101,
+   10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,102,111,114, 32,115,121,109, 44, 99,111,110,115,116, 32,105,
+  110, 32,112, 97,105,114,115, 40, 99,111,110,115,116, 95,111,102, 95,115,
+  121,109, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,115,116,111,114,101,
+  100, 91, 99,111,110,115,116, 93, 32, 61, 32,116,114,117,101, 10, 32, 32,
+   32, 32, 32, 32, 99,111,110,115,116, 95,111,102, 95,115,121,109, 91,115,
+  121,109, 93, 32, 61, 32,110,105,108, 10, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,115,104, 97,114,105,110,103, 32, 61, 32,116,114,117,101, 10, 32,
+   32, 32,102,111,114, 32,105,100, 44, 99,111,110,115,116, 32,105,110, 32,
+  112, 97,105,114,115, 40, 99,111,110,115,116, 95,105,100,115, 41, 32,100,
+  111, 10, 32, 32, 32, 32, 32, 32, 99,111,110,115,116, 46,115,121,109, 32,
+   61, 32,115,121,109, 98,111,108, 40,105,100, 44, 32, 99,111,110,115,116,
+   46,115,121,109, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,102,111,
+  114, 32, 99,111,110,115,116, 32,105,110, 32,112, 97,105,114,115, 40,115,
+  116,111,114,101,100, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32, 99,111,
+  110,115,116, 95,111,102, 95,115,121,109, 91, 99,111,110,115,116, 46,115,
+  121,109, 93, 32, 61, 32, 99,111,110,115,116, 10, 32, 32, 32,101,110,100,
+   10, 32, 32, 32, 99,111,110,115,116, 95,115,121,109, 32, 61, 32,115,121,
+  109, 98,111,108, 10, 32, 32, 32,115,101,116,109,101,116, 97,116, 97, 98,
+  108,101, 40, 99,111,110,115,116, 95,111,102, 95,115,121,109, 44, 32,123,
+   10,  9,  9, 32, 32, 32, 95, 95,109,111,100,101, 32, 61, 32,119,101, 97,
+  107, 32, 97,110,100, 32, 34,118, 34, 32,111,114, 32,110,105,108, 44, 10,
+    9,  9, 32, 32, 32, 95, 95,105,110,100,101,120, 32, 61, 32,102,117,110,
+   99,116,105,111,110, 40,116, 98,108, 44, 32,115,121,109, 41, 10,  9,  9,
+   32, 32, 32, 32, 32, 32,108,111, 99, 97,108, 32, 99,111,110,115,116, 32,
+   61, 32,109, 97,107,101, 95, 99,111,110,115,116, 40,110, 97,109,101, 40,
+  115,121,109, 41, 41, 10,  9,  9, 32, 32, 32, 32, 32, 32,116, 98,108, 91,
+  115,121,109, 93, 32, 61, 32, 99,111,110,115,116, 10,  9,  9, 32, 32, 32,
+   32, 32, 32,114,101,116,117,114,110, 32, 99,111,110,115,116, 10,  9,  9,
+   32, 32, 32,101,110,100, 10,  9,  9,125, 41, 10, 32, 32, 32,105,110,118,
+   97,108,105,100, 97,116,101, 95, 97,108,108, 40, 41, 10,101,110,100, 10,
+   10, 45, 45, 32, 82,101,116,117,114,110,115, 32, 97, 32,116, 97, 98,108,
+  101, 32,119,104,111,115,101, 32,107,101,121,115, 32, 97,114,101, 32,116,
+  104,101, 32,115,121,109, 98,111,108,115, 32,117,115,101,100, 32, 98,121,
+   32,116,104,101, 32,100, 97,116, 97, 98, 97,115,101, 44, 10, 45, 45, 32,
+  116,104,111,115,101, 32,105,110, 32,116,104,101, 32,114,111,119,115, 32,
+  111,102, 32,105,116,115, 32,115,116,111,114,101,115, 32, 97,110,100, 32,
+  116,104,111,115,101, 32,111,102, 32,105,116,115, 32, 99,111,110,115,116,
+   97,110,116,115, 46, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108,
+   95,115,121,109, 98,111,108,115, 40, 41, 10, 32, 32, 32,108,111, 99, 97,
+  108, 32,109, 97,114,107,115, 32, 61, 32,123,125, 10, 32, 32, 32,109, 97,
+  114,107, 95,115,116,111,114,101,115, 40,109, 97,114,107,115, 41, 10, 32,
+   32, 32,102,111,114, 32,105,100, 44, 99,111,110,115,116, 32,105,110, 32,
+  112, 97,105,114,115, 40, 99,111,110,115,116, 95,105,100,115, 41, 32,100,
+  111, 10, 32, 32, 32, 32, 32, 32,109, 97,114,107,115, 91, 99,111,110,115,
+  116, 46,115,121,109, 93, 32, 61, 32,116,114,117,101, 10, 32, 32, 32,101,
+  110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,109, 97,114,107,115,
+   10,101,110,100, 10, 10, 45, 45, 32, 82,101,116,117,114,110,115, 32,116,
+  104,101, 32,112,114,101,100,105, 99, 97,116,101,115, 32,119,105,116,104,
+   32,102, 97, 99,116,115, 44, 32, 97,110,100, 32,119,104,101,110, 32,116,
+  104,101, 32,114,117,108,101,115, 32,104, 97,118,101, 32, 99,104, 97,110,
+  103,101,100, 10, 45, 45, 32,115,105,110, 99,101, 32,116,104,101, 32, 99,
+  111,117,110,116, 32,103,105,118,101,110, 44, 32, 97,110, 32, 97,114,114,
+   97,121, 32,119,105,116,104, 32,101,118,101,114,121, 32,114,117,108,101,
+   44, 32,102,111,108,108,111,119,101,100, 32, 98,121, 32,116,104,101, 10,
+   45, 45, 32, 99,117,114,114,101,110,116, 32, 99,111,117,110,116, 46, 10,
+   10,102,117,110, 99,116,105,111,110, 32,100,108, 95,112,117, 98,108,105,
+  115,104, 40, 99,104, 97,110,103,101,100, 41, 10, 32, 32, 32,108,111, 99,
+   97,108, 32,112,114,101,100,115, 32, 61, 32,123,125, 10, 32, 32, 32,102,
+  111,114, 32,105,100, 44,112,114,101,100, 32,105,110, 32,112, 97,105,114,
+  115, 40,100, 98, 41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,105,102, 32,
+  110,111,116, 32,112,114,101,100, 46,112,114,105,109, 32, 97,110,100, 32,
+  112,114,101,100, 46,102, 97, 99,116,115, 32, 97,110,100, 32,112,114,101,
+  100, 46,102, 97, 99,116,115, 58, 99,111,117,110,116, 40, 41, 32, 62, 32,
+   48, 32,116,104,101,110, 10,  9, 32,116, 97, 98,108,101, 46,105,110,115,
+  101,114,116, 40,112,114,101,100,115, 44, 32,112,114,101,100, 41, 10, 32,
+   32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,105,102, 32, 99,104, 97,110,103,101,100, 32, 61, 61, 32,114,117,108,
+  101,115, 95, 99,104, 97,110,103,101,100, 32,116,104,101,110, 10, 32, 32,
+   32, 32, 32, 32,114,101,116,117,114,110, 32,112,114,101,100,115, 44, 32,
+  110,105,108, 44, 32,114,117,108,101,115, 95, 99,104, 97,110,103,101,100,
+   10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,114,
+  117,108,101,115, 32, 61, 32,123,125, 10, 32, 32, 32,102,111,114, 32,105,
+  100, 44,112,114,101,100, 32,105,110, 32,112, 97,105,114,115, 40,100, 98,
+   41, 32,100,111, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,100, 44,
+   99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,114,115, 40,112,114,
+  101,100, 46,100, 98, 41, 32,100,111, 10,  9, 32,116, 97, 98,108,101, 46,
+  105,110,115,101,114,116, 40,114,117,108,101,115, 44, 32, 99,108, 97,117,
+  115,101, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,
+  110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,112,114,101,100,115,
+   44, 32,114,117,108,101,115, 44, 32,114,117,108,101,115, 95, 99,104, 97,
+  110,103,101,100, 10,101,110,100, 10, 10, 45, 45, 32, 84,104,101, 32,112,
+  114,101,100,105, 99, 97,116,101,115, 32,103,105,118,101,110, 32,102, 97,
+   99,116,115, 32, 98,121, 32,116,104,101, 32,108, 97,115,116, 32,118,101,
+  114,115,105,111,110, 32,105,110,115,116, 97,108,108,101,100, 44, 32, 97,
+  110,100, 32,116,104,101, 10, 45, 45, 32,114,117,108,101,115, 32,105,116,
+   32, 97,100,100,101,100, 46, 10, 10,108,111, 99, 97,108, 32,105,110,115,
+  116, 97,108,108,101,100, 95,112,114,101,100,115, 32, 61, 32,123,125, 10,
+  108,111, 99, 97,108, 32,105,110,115,116, 97,108,108,101,100, 95,114,117,
+  108,101,115, 32, 61, 32,123,125, 10, 10, 45, 45, 32, 73,110,115,116, 97,
+  108,108,115, 32, 97, 32,118,101,114,115,105,111,110, 32,105,110, 32, 97,
+   32,114,101,112,108,105, 99, 97, 46, 32, 32, 69, 97, 99,104, 32,101,110,
+  116,114,121, 32,111,102, 32,112,114,101,100,115, 32,104, 97,115, 32,116,
+  104,101, 32,110, 97,109,101, 44, 10, 45, 45, 32,116,104,101, 32, 97,114,
+  105,116,121, 44, 32, 97,110,100, 32,116,104,101, 32,102, 97, 99,116, 32,
+  115,116,111,114,101, 32,111,102, 32, 97, 32,112,114,101,100,105, 99, 97,
+  116,101, 46, 32, 32, 84,104,101, 32,114,117,108,101,115, 44, 32,119,104,
+  101,110, 10, 45, 45, 32,103,105,118,101,110, 44, 32,114,101,112,108, 97,
+   99,101, 32,116,104,101, 32,111,110,101,115, 32,105,110,115,116, 97,108,
+  108,101,100, 32, 98,101,102,111,114,101, 46, 32, 32, 65, 32,114,117,108,
+  101, 32,105,115, 32, 97,110, 32, 97,114,114, 97,121, 32,111,102, 10, 45,
+   45, 32,108,105,116,101,114, 97,108,115, 44, 32,104,101, 97,100, 32,102,
+  105,114,115,116, 44, 32, 97,110,100, 32, 97, 32,108,105,116,101,114, 97,
+  108, 32,104, 97,115, 32,116,104,101, 32,110, 97,109,101, 32,111,102, 32,
+  105,116,115, 32,112,114,101,100,105, 99, 97,116,101, 44, 10, 45, 45, 32,
+   97,110,100, 32, 97,110, 32, 97,114,114, 97,121, 32,111,102, 32,116,101,
+  114,109,115, 44, 32,119,104,105, 99,104, 32, 97,114,101, 32,116,104,101,
+   32,115,121,109, 98,111,108,115, 32,111,102, 32, 99,111,110,115,116, 97,
+  110,116,115, 44, 32,111,114, 32,116,104,101, 10, 45, 45, 32,110,101,103,
+   97,116,105,118,101, 32,115,121,109, 98,111,108,115, 32,111,102, 32,118,
+   97,114,105, 97, 98,108,101,115, 44, 32, 97,115, 32,110,117,109, 98,101,
+  114,101,100, 32, 98,121, 32,116,104,101, 32,112,117, 98,108,105,115,104,
+  101,114, 46, 10, 10,108,111, 99, 97,108, 32,102,117,110, 99,116,105,111,
+  110, 32,105,110,115,116, 97,108,108, 95,114,117,108,101, 40, 99,111,100,
+  101, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,118, 97,114,115, 32, 61,
+   32,123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32,108,105,116,101,114,
+   97,108,115, 32, 61, 32,123,125, 10, 32, 32, 32,102,111,114, 32,105, 61,
+   49, 44, 35, 99,111,100,101, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,
+  111, 99, 97,108, 32,116,101,114,109,115, 32, 61, 32,123,125, 10, 32, 32,
+   32, 32, 32, 32,102,111,114, 32,106, 61, 49, 44, 35, 99,111,100,101, 91,
+  105, 93, 32,100,111, 10,  9, 32,108,111, 99, 97,108, 32,116,101,114,109,
+   32, 61, 32, 99,111,100,101, 91,105, 93, 91,106, 93, 10,  9, 32,105,102,
+   32,116,101,114,109, 32, 62, 32, 48, 32,116,104,101,110, 10,  9, 32, 32,
+   32, 32,116,101,114,109,115, 91,106, 93, 32, 61, 32, 99,111,110,115,116,
+   95,111,102, 95,115,121,109, 91,116,101,114,109, 93, 10,  9, 32,101,108,
+  115,101, 10,  9, 32, 32, 32, 32,108,111, 99, 97,108, 32,118, 97,114, 32,
+   61, 32,118, 97,114,115, 91,116,101,114,109, 93, 10,  9, 32, 32, 32, 32,
+  105,102, 32,110,111,116, 32,118, 97,114, 32,116,104,101,110, 10,  9, 32,
+   32, 32, 32, 32, 32, 32,118, 97,114, 32, 61, 32,109, 97,107,101, 95,118,
+   97,114, 40, 45,116,101,114,109, 41, 10,  9, 32, 32, 32, 32, 32, 32, 32,
+  118, 97,114,115, 91,116,101,114,109, 93, 32, 61, 32,118, 97,114, 10,  9,
+   32, 32, 32, 32,101,110,100, 10,  9, 32, 32, 32, 32,116,101,114,109,115,
+   91,106, 93, 32, 61, 32,118, 97,114, 10,  9, 32,101,110,100, 10, 32, 32,
+   32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,108,105,116,101,
+  114, 97,108,115, 91,105, 93, 32, 61, 32,109, 97,107,101, 95,108,105,116,
+  101,114, 97,108, 40, 99,111,100,101, 91,105, 93, 46,110, 97,109,101, 44,
+   32,116,101,114,109,115, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32, 99,108, 97,117,115,101, 32, 61, 32,123,104,101,
+   97,100, 32, 61, 32,108,105,116,101,114, 97,108,115, 91, 49, 93,125, 10,
+   32, 32, 32,102,111,114, 32,105, 61, 50, 44, 35,108,105,116,101,114, 97,
+  108,115, 32,100,111, 10, 32, 32, 32, 32, 32, 32, 99,108, 97,117,115,101,
+   91,105, 32, 45, 32, 49, 93, 32, 61, 32,108,105,116,101,114, 97,108,115,
+   91,105, 93, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,101,116,117,
+  114,110, 32, 97,115,115,101,114,116, 40, 99,108, 97,117,115,101, 41, 10,
+  101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95,114,
+  101,102,114,101,115,104, 40,112,114,101,100,115, 44, 32,114,117,108,101,
+  115, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,102,114,101,115,104, 32,
+   61, 32,123,125, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,112,
+  114,101,100,115, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,
+  108, 32,112,114,101,100, 32, 61, 32,109, 97,107,101, 95,112,114,101,100,
+   40,112,114,101,100,115, 91,105, 93, 46,110, 97,109,101, 44, 32,112,114,
+  101,100,115, 91,105, 93, 46, 97,114,105,116,121, 41, 10, 32, 32, 32, 32,
+   32, 32,112,114,101,100, 46,102, 97, 99,116,115, 32, 61, 32,112,114,101,
+  100,115, 91,105, 93, 46,102, 97, 99,116,115, 10, 32, 32, 32, 32, 32, 32,
+  102,114,101,115,104, 91,112,114,101,100, 93, 32, 61, 32,116,114,117,101,
+   10, 32, 32, 32, 32, 32, 32,105,110,115,101,114,116, 40,112,114,101,100,
+   41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,102,111,114, 32,112,114,
+  101,100, 32,105,110, 32,112, 97,105,114,115, 40,105,110,115,116, 97,108,
+  108,101,100, 95,112,114,101,100,115, 41, 32,100,111, 10, 32, 32, 32, 32,
+   32, 32,105,102, 32,110,111,116, 32,102,114,101,115,104, 91,112,114,101,
+  100, 93, 32,116,104,101,110, 10,  9, 32,112,114,101,100, 46,102, 97, 99,
+  116,115, 32, 61, 32,110,105,108, 10,  9, 32,105,102, 32,110,111,116, 32,
+  110,101,120,116, 40,112,114,101,100, 46,100, 98, 41, 32, 97,110,100, 32,
+  110,111,116, 32,112,114,101,100, 46,112,114,105,109, 32,116,104,101,110,
+   10,  9, 32, 32, 32, 32,114,101,109,111,118,101, 40,112,114,101,100, 41,
+   10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,105,110,115,116, 97,108,108,101,100,
+   95,112,114,101,100,115, 32, 61, 32,102,114,101,115,104, 10, 32, 32, 32,
+  105,102, 32,114,117,108,101,115, 32,116,104,101,110, 10, 32, 32, 32, 32,
+   32, 32,102,111,114, 32,105, 61, 49, 44, 35,105,110,115,116, 97,108,108,
+  101,100, 95,114,117,108,101,115, 32,100,111, 10,  9, 32,114,101,116,114,
+   97, 99,116, 40,105,110,115,116, 97,108,108,101,100, 95,114,117,108,101,
+  115, 91,105, 93, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32,
+   32, 32, 32, 32,105,110,115,116, 97,108,108,101,100, 95,114,117,108,101,
+  115, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,
+   61, 49, 44, 35,114,117,108,101,115, 32,100,111, 10,  9, 32,108,111, 99,
+   97,108, 32, 99,108, 97,117,115,101, 32, 61, 32,105,110,115,116, 97,108,
+  108, 95,114,117,108,101, 40,114,117,108,101,115, 91,105, 93, 41, 10,  9,
+   32,105,102, 32, 99,108, 97,117,115,101, 32,116,104,101,110, 10,  9, 32,
+   32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40,105,110,
+  115,116, 97,108,108,101,100, 95,114,117,108,101,115, 44, 32, 99,108, 97,
+  117,115,101, 41, 10,  9, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,101,
+  110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,105,110,118, 97,108,
+  105,100, 97,116,101, 95, 97,108,108, 40, 41, 10,101,110,100, 10, 10, 45,
+   45, 32, 73, 77, 65, 71, 69, 83, 10, 10, 45, 45, 32, 65,110, 32,105,109,
+   97,103,101, 32,105,115, 32, 97, 32,102,105,108,101, 32,104,111,108,100,
+  105,110,103, 32,116,104,101, 32,102, 97, 99,116,115, 32, 97,110,100, 32,
+  114,117,108,101,115, 32,111,102, 32, 97, 32,100, 97,116, 97, 98, 97,115,
+  101, 44, 32, 97,110,100, 10, 45, 45, 32,116,104,101, 32,105,100,115, 32,
+  111,102, 32,116,104,101, 32,115,121,109, 98,111,108,115, 32,116,104,101,
+  121, 32,117,115,101, 44, 32,119,114,105,116,116,101,110, 32,115,111, 32,
+  116,104, 97,116, 32,105,116,115, 32,102, 97, 99,116, 32,115,116,111,114,
+  101,115, 10, 45, 45, 32, 99, 97,110, 32,117,115,101, 32,116,104,101, 32,
+  114,111,119,115, 32,105,110, 32,116,104,101, 32,102,105,108,101, 32, 97,
+  115, 32,105,116, 32,105,115, 32,109, 97,112,112,101,100, 32,105,110,116,
+  111, 32,109,101,109,111,114,121, 46, 32, 32, 65, 10, 45, 45, 32,100, 97,
+  116, 97, 98, 97,115,101, 32,108,111, 97,100,105,110,103, 32, 97,110, 32,
+  105,109, 97,103,101, 32,110,117,109, 98,101,114,115, 32,105,116,115, 32,
+   99,111,110,115,116, 97,110,116,115, 32, 97,115, 32,116,104,101, 32,100,
+   97,116, 97, 98, 97,115,101, 10, 45, 45, 32,116,104, 97,116, 32,115, 97,
+  118,101,100, 32,105,116, 32,100,105,100, 44, 32,117,115,105,110,103, 32,
+  116,104,101, 32,115,121,109, 98,111,108, 32,116, 97, 98,108,101, 32,111,
+  102, 32,116,104,101, 32,105,109, 97,103,101, 44, 32,115,111, 32,116,104,
+  101, 32,114,111,119,115, 10, 45, 45, 32,110,101,101,100, 32,110,111, 32,
+   99,104, 97,110,103,101, 44, 32, 97,110,100, 32,116,104,101, 32, 99,111,
+  110,115,116, 97,110,116,115, 32,111,102, 32,116,104,101,105,114, 32,115,
+  121,109, 98,111,108,115, 32, 97,114,101, 32,109, 97,100,101, 32,119,104,
+  101,110, 10, 45, 45, 32,108,111,111,107,101,100, 32,117,112, 44, 32, 97,
+  115, 32,105,110, 32, 97, 32,114,101,112,108,105, 99, 97, 46, 10, 10, 45,
+   45, 32, 82,101,116,117,114,110,115, 32,116,104,101, 32,112,114,101,100,
+  105, 99, 97,116,101,115, 32,119,105,116,104, 32,102, 97, 99,116,115, 32,
+   97,110,100, 32,101,118,101,114,121, 32,114,117,108,101, 44, 32, 97,115,
+   32,100,108, 95,112,117, 98,108,105,115,104, 10, 45, 45, 32,100,111,101,
+  115, 44, 32, 97,110,100, 32,116,104,101, 32,116, 97, 98,108,101, 32,109,
+   97,112,112,105,110,103, 32,115,121,109, 98,111,108,115, 32,116,111, 32,
+   99,111,110,115,116, 97,110,116,115, 44, 32,104,111,108,100,105,110,103,
+   32,116,104,101, 10, 45, 45, 32, 99,111,110,115,116, 97,110,116,115, 32,
+  111,102, 32,116,104,101, 32,114,117,108,101,115, 32,116,111,111, 46, 10,
+   10,102,117,110, 99,116,105,111,110, 32,100,108, 95,105,109, 97,103,101,
+   40, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,112,114,101,100,115, 44,
+   32,114,117,108,101,115, 32, 61, 32,100,108, 95,112,117, 98,108,105,115,
+  104, 40, 41, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,114,117,
+  108,101,115, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108,
+   32, 99,108, 97,117,115,101, 32, 61, 32,114,117,108,101,115, 91,105, 93,
+   10, 32, 32, 32, 32, 32, 32,102,111,114, 32,106, 61, 48, 44, 35, 99,108,
+   97,117,115,101, 32,100,111, 10,  9, 32,108,111, 99, 97,108, 32,108,105,
+  116,101,114, 97,108, 32, 61, 32,106, 32, 61, 61, 32, 48, 32, 97,110,100,
+   32, 99,108, 97,117,115,101, 46,104,101, 97,100, 32,111,114, 32, 99,108,
+   97,117,115,101, 91,106, 93, 10,  9, 32,102,111,114, 32,107, 61, 49, 44,
+   35,108,105,116,101,114, 97,108, 32,100,111, 10,  9, 32, 32, 32, 32,108,
+  111, 99, 97,108, 32,116,101,114,109, 32, 61, 32,108,105,116,101,114, 97,
+  108, 91,107, 93, 10,  9, 32, 32, 32, 32,105,102, 32,116,101,114,109, 58,
+  105,115, 95, 99,111,110,115,116, 40, 41, 32,116,104,101,110, 10,  9, 32,
+   32, 32, 32, 32, 32, 32, 99,111,110,115,116, 95,111,102, 95,115,121,109,
+   91,116,101,114,109, 46,115,121,109, 93, 32, 61, 32,116,101,114,109, 10,
+    9, 32, 32, 32, 32,101,110,100, 10,  9, 32,101,110,100, 10, 32, 32, 32,
+   32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,114,
+  101,116,117,114,110, 32,112,114,101,100,115, 44, 32,114,117,108,101,115,
+   44, 32, 99,111,110,115,116, 95,111,102, 95,115,121,109, 10,101,110,100,
+   10, 10, 45, 45, 32, 76,111, 97,100,115, 32, 97,110, 32,105,109, 97,103,
+  101, 32,105,110,116,111, 32, 97, 32,100, 97,116, 97, 98, 97,115,101, 32,
+  119,105,116,104,111,117,116, 32, 99,108, 97,117,115,101,115, 46, 32, 32,
+   84,104,101, 32,102,117,110, 99,116,105,111,110,115, 10, 45, 45, 32,115,
+  121,109, 98,111,108, 32, 97,110,100, 32,110, 97,109,101, 32, 97,114,101,
+   32,116,104,111,115,101, 32,111,102, 32,116,104,101, 32,115,121,109, 98,
+  111,108, 32,116, 97, 98,108,101, 32,111,102, 32,116,104,101, 32,105,109,
+   97,103,101, 44, 32, 97,110,100, 32,116,104,101, 10, 45, 45, 32,112,114,
+  101,100,105, 99, 97,116,101,115, 32, 97,110,100, 32,114,117,108,101,115,
+   32, 97,114,101, 32,103,105,118,101,110, 32, 97,115, 32,102,111,114, 32,
+  100,108, 95,114,101,102,114,101,115,104, 46, 32, 32, 84,104,101, 32,110,
+   97,109,101, 32,111,102, 32, 97, 10, 45, 45, 32,115,121,109, 98,111,108,
+   32,103,105,118,101,110, 32,116,111, 32, 97,110, 32,105,100, 32,110,111,
+  116, 32,105,110, 32,116,104,101, 32,105,109, 97,103,101, 32,105,115, 32,
+  110,111,116, 32,107,110,111,119,110, 44, 32,115,111, 32,116,104,101, 32,
+  116, 97, 98,108,101, 32,111,102, 10, 45, 45, 32, 99,111,110,115,116, 97,
+  110,116,115, 32,104,111,108,100,115, 32,116,104,101,109, 46, 10, 10,102,
+  117,110, 99,116,105,111,110, 32,100,108, 95,108,111, 97,100, 95,105,109,
+   97,103,101, 40,115,121,109, 98,111,108, 44, 32,110, 97,109,101, 44, 32,
+  112,114,101,100,115, 44, 32,114,117,108,101,115, 41, 10, 32, 32, 32,105,
+  102, 32,115,104, 97,114,105,110,103, 32,116,104,101,110, 10, 32, 32, 32,
+   32, 32, 32,101,114,114,111,114, 40, 34, 99, 97,110,110,111,116, 32,108,
+  111, 97,100, 32, 97,110, 32,105,109, 97,103,101, 32,105,110,116,111, 32,
+   97, 32,100, 97,116, 97, 98, 97,115,101, 32,115,104, 97,114,105,110,103,
+   32,105,116,115, 32,115,121,109, 98,111,108,115, 34, 41, 10, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,102,111,114, 32,105,100, 44,112,114,101,100,
+   32,105,110, 32,112, 97,105,114,115, 40,100, 98, 41, 32,100,111, 10, 32,
+   32, 32, 32, 32, 32,105,102, 32,110,111,116, 32,112,114,101,100, 46,112,
+  114,105,109, 32, 97,110,100, 10,  9, 32, 40,110,101,120,116, 40,112,114,
+  101,100, 46,100, 98, 41, 32,111,114, 32,112,114,101,100, 46,102, 97, 99,
+  116,115, 32, 97,110,100, 32,112,114,101,100, 46,102, 97, 99,116,115, 58,
+   99,111,117,110,116, 40, 41, 32, 62, 32, 48, 41, 32,116,104,101,110, 10,
+    9, 32,101,114,114,111,114, 40, 34, 99, 97,110,110,111,116, 32,108,111,
+   97,100, 32, 97,110, 32,105,109, 97,103,101, 32,105,110,116,111, 32, 97,
+   32,100, 97,116, 97, 98, 97,115,101, 32,119,105,116,104, 32, 99,108, 97,
+  117,115,101,115, 34, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,101,110,100, 10, 32, 32, 32,100,108, 95,115,104, 97,114,101, 95,
+  115,121,109, 98,111,108,115, 40,115,121,109, 98,111,108, 44, 32,110, 97,
+  109,101, 41, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,112,114,
+  101,100,115, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,108,
+   32,112,114,101,100, 32, 61, 32,109, 97,107,101, 95,112,114,101,100, 40,
+  112,114,101,100,115, 91,105, 93, 46,110, 97,109,101, 44, 32,112,114,101,
+  100,115, 91,105, 93, 46, 97,114,105,116,121, 41, 10, 32, 32, 32, 32, 32,
+   32,112,114,101,100, 46,102, 97, 99,116,115, 32, 61, 32,112,114,101,100,
+  115, 91,105, 93, 46,102, 97, 99,116,115, 10, 32, 32, 32, 32, 32, 32,105,
+  110,115,101,114,116, 40,112,114,101,100, 41, 10, 32, 32, 32,101,110,100,
+   10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,114,117,108,101,115,
+   32,100,111, 10, 32, 32, 32, 32, 32, 32,105,110,115,116, 97,108,108, 95,
+  114,117,108,101, 40,114,117,108,101,115, 91,105, 93, 41, 10, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,105,110,118, 97,108,105,100, 97,116,101, 95,
+   97,108,108, 40, 41, 10,101,110,100, 10, 10, 45, 45, 32, 69, 88, 80, 79,
+   82, 84, 69, 68, 32, 70, 85, 78, 67, 84, 73, 79, 78, 83, 10, 10, 45, 45,
+   32, 84,104,101, 32, 67, 32, 65, 80, 73, 10, 10,102,117,110, 99,116,105,
+  111,110, 32,100,108, 95,112,117,115,104,108,105,116,101,114, 97,108, 40,
+   41, 10, 32, 32, 32,114,101,116,117,114,110, 32,123,125, 10,101,110,100,
+   10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95, 97,100,100,112,
+  114,101,100, 40,116, 98,108, 44, 32,115,116,114, 41, 10, 32, 32, 32,116,
+   98,108, 46,110, 97,109,101, 32, 61, 32,115,116,114, 59, 10, 32, 32, 32,
+  114,101,116,117,114,110, 32,116, 98,108, 10,101,110,100, 10, 10,102,117,
+  110, 99,116,105,111,110, 32,100,108, 95, 97,100,100,118, 97,114, 40,116,
+   98,108, 44, 32,115,116,114, 41, 10, 32, 32, 32,116, 97, 98,108,101, 46,
+  105,110,115,101,114,116, 40,116, 98,108, 44, 32,109, 97,107,101, 95,118,
+   97,114, 40,115,116,114, 41, 41, 10, 32, 32, 32,114,101,116,117,114,110,
+   32,116, 98,108, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110,
+   32,100,108, 95, 97,100,100, 99,111,110,115,116, 40,116, 98,108, 44, 32,
   115,116,114, 41, 10, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,
-  114,116, 40,116, 98,108, 44, 32,109, 97,107,101, 95,118, 97,114, 40,115,
-  116,114, 41, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,116, 98,108,
-   10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95,
-   97,100,100, 99,111,110,115,116, 40,116, 98,108, 44, 32,115,116,114, 41,
-   10, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40,116,
-   98,108, 44, 32,109, 97,107,101, 95, 99,111,110,115,116, 40,115,116,114,
-   41, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,116, 98,108, 10,101,
-  110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95,109, 97,
-  107,101,108,105,116,101,114, 97,108, 40,116, 98,108, 41, 10, 32, 32, 32,
-  116, 98,108, 46,112,114,101,100, 32, 61, 32,109, 97,107,101, 95,112,114,
-  101,100, 40,116, 98,108, 46,110, 97,109,101, 44, 32, 35,116, 98,108, 41,
-   10, 32, 32, 32,116, 98,108, 46,110, 97,109,101, 32, 61, 32,110,105,108,
-   10, 32, 32, 32,114,101,116,117,114,110, 32,116, 98,108, 10,101,110,100,
-   10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95,112,117,115,104,
-  104,101, 97,100, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,114,
-  101,116,117,114,110, 32,123,104,101, 97,100, 32, 61, 32,108,105,116,101,
-  114, 97,108,125, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110,
-   32,100,108, 95, 97,100,100,108,105,116,101,114, 97,108, 40,116, 98,108,
-   44, 32,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,116, 97, 98,108,
-  101, 46,105,110,115,101,114,116, 40,116, 98,108, 44, 32,108,105,116,101,
-  114, 97,108, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,116, 98,108,
-   10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95,
-  109, 97,107,101, 99,108, 97,117,115,101, 40,116, 98,108, 41, 10, 32, 32,
-   32,114,101,116,117,114,110, 32,116, 98,108, 10,101,110,100, 10, 10,100,
-  108, 95, 97,115,115,101,114,116, 32, 61, 32, 97,115,115,101,114,116, 10,
-   10,100,108, 95,114,101,116,114, 97, 99,116, 32, 61, 32,114,101,116,114,
-   97, 99,116, 10, 10, 45, 45, 32, 84,104,105,115, 32, 67, 32, 65, 80, 73,
-   32,102,117,110, 99,116,105,111,110, 32,105,115, 32,109,111,114,101, 32,
-   99,111,109,112,108,105, 99, 97,116,101,100, 32,116,104, 97,110, 32,116,
-  104,101, 32,111,116,104,101,114,115, 32, 98,101, 99, 97,117,115,101, 32,
-  105,116, 10, 45, 45, 32,105,115, 32, 99,111,109,112,117,116,105,110,103,
-   32,116,104,101, 32,116,111,116, 97,108, 32,115,105,122,101, 32,111,102,
-   32,116,104,101, 32, 99,104, 97,114, 97, 99,116,101,114, 32, 97,114,114,
-   97,121, 32,116,104, 97,116, 32,119,105,108,108, 32, 98,101, 10, 45, 45,
-   32, 97,108,108,111, 99, 97,116,101,100, 32, 98,121, 32,116,104,101, 32,
-   67, 32,114,111,117,116,105,110,101, 32,117,115,105,110,103, 32,116,104,
-  105,115, 32,102,117,110, 99,116,105,111,110, 46, 32, 32, 84,104,101, 32,
-   99,104, 97,114, 97, 99,116,101,114, 10, 45, 45, 32, 97,114,114, 97,121,
-   32,109,117,115,116, 32,104, 97,118,101, 32,114,111,111,109, 32,102,111,
-  114, 32,116,104,101, 32,112,114,101,100,105, 99, 97,116,101, 32, 97,110,
-  100, 32, 97,108,108, 32,111,102, 32,116,104,101, 32, 99,111,110,115,116,
-   97,110,116, 10, 45, 45, 32,116,101,114,109,115, 32,105,110, 32,116,104,
-  101, 32, 97,110,115,119,101,114, 46, 32, 32, 69, 97, 99,104, 32,105,116,
-  101,109, 32, 97,108,115,111, 32,110,101,101,100,115, 32,114,111,111,109,
-   32,102,111,114, 32,116,104,101, 32,122,101,114,111, 10, 45, 45, 32, 99,
-  104, 97,114, 97, 99,116,101,114, 32,117,115,101,100, 32,116,111, 32,116,
-  101,114,109,105,110, 97,116,101, 32,101, 97, 99,104, 32,115,116,114,105,
-  110,103, 46, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95, 97,
-  115,107, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,108,111, 99,
-   97,108, 32, 97,110,115,119,101,114,115, 32, 61, 32, 97,115,107, 40,108,
-  105,116,101,114, 97,108, 41, 10, 32, 32, 32,105,102, 32,110,111,116, 32,
-   97,110,115,119,101,114,115, 32,116,104,101,110, 10, 32, 32, 32, 32, 32,
-   32,114,101,116,117,114,110, 32, 97,110,115,119,101,114,115, 10, 32, 32,
-   32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,110, 32, 61, 32,
-   35, 97,110,115,119,101,114,115, 10, 32, 32, 32,108,111, 99, 97,108, 32,
-   97,114,105,116,121, 32, 61, 32, 97,110,115,119,101,114,115, 46, 97,114,
-  105,116,121, 10, 32, 32, 32,108,111, 99, 97,108, 32,115,105,122,101, 32,
-   61, 32,115,116,114,105,110,103, 46,108,101,110, 40, 97,110,115,119,101,
-  114,115, 46,110, 97,109,101, 41, 32, 43, 32, 49, 10, 32, 32, 32,102,111,
-  114, 32,105, 61, 49, 44,110, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,
-  111, 99, 97,108, 32, 97,110,115,119,101,114, 32, 61, 32, 97,110,115,119,
-  101,114,115, 91,105, 93, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,106,
-   61, 49, 44, 97,114,105,116,121, 32,100,111, 10,  9, 32,115,105,122,101,
-   32, 61, 32,115,105,122,101, 32, 43, 32,115,116,114,105,110,103, 46,108,
-  101,110, 40, 97,110,115,119,101,114, 91,106, 93, 41, 32, 43, 32, 49, 10,
-   32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32,
-   32, 32, 97,110,115,119,101,114,115, 46,115,105,122,101, 32, 61, 32,115,
-  105,122,101, 10, 32, 32, 32, 97,110,115,119,101,114,115, 46,110, 32, 61,
-   32,110,  9,  9, 45, 45, 32, 72, 97, 99,107, 32,116,111, 32,104, 97,110,
-  100, 32, 98, 97, 99,107, 32,116,104,101, 32,115,105,122,101, 10, 32, 32,
-   32,114,101,116,117,114,110, 32, 97,110,115,119,101,114,115, 10,101,110,
-  100, 10, 10, 45, 45, 32, 84,104,101, 32, 76,117, 97, 32, 65, 80, 73, 10,
-   10,100, 97,116, 97,108,111,103, 32, 61, 32,123, 10, 32, 32, 32,109, 97,
-  107,101, 95,118, 97,114, 32, 61, 32,109, 97,107,101, 95,118, 97,114, 44,
-   10, 32, 32, 32,109, 97,107,101, 95, 99,111,110,115,116, 32, 61, 32,109,
-   97,107,101, 95, 99,111,110,115,116, 44, 10, 32, 32, 32,109, 97,107,101,
-   95,112,114,101,100, 32, 61, 32,109, 97,107,101, 95,112,114,101,100, 44,
-   10, 32, 32, 32,103,101,116, 95,110, 97,109,101, 32, 61, 32,103,101,116,
-   95,110, 97,109,101, 44, 10, 32, 32, 32,103,101,116, 95, 97,114,105,116,
-  121, 32, 61, 32,103,101,116, 95, 97,114,105,116,121, 44, 10, 32, 32, 32,
-  109, 97,107,101, 95,108,105,116,101,114, 97,108, 32, 61, 32,109, 97,107,
-  101, 95,108,105,116,101,114, 97,108, 44, 10, 32, 32, 32,109, 97,107,101,
-   95, 99,108, 97,117,115,101, 32, 61, 32,109, 97,107,101, 95, 99,108, 97,
-  117,115,101, 44, 10, 32, 32, 32,105,110,115,101,114,116, 32, 61, 32,105,
-  110,115,101,114,116, 44, 10, 32, 32, 32,114,101,109,111,118,101, 32, 61,
-   32,114,101,109,111,118,101, 44, 10, 32, 32, 32, 97,115,115,101,114,116,
-   32, 61, 32, 97,115,115,101,114,116, 44, 10, 32, 32, 32,114,101,116,114,
-   97, 99,116, 32, 61, 32,114,101,116,114, 97, 99,116, 44, 10, 32, 32, 32,
-  115, 97,118,101, 32, 61, 32,115, 97,118,101, 44, 10, 32, 32, 32,114,101,
-  115,116,111,114,101, 32, 61, 32,114,101,115,116,111,114,101, 44, 10, 32,
-   32, 32, 99,111,112,121, 32, 61, 32, 99,111,112,121, 44, 10, 32, 32, 32,
-  114,101,118,101,114,116, 32, 61, 32,114,101,118,101,114,116, 44, 10, 32,
-   32, 32, 97,115,107, 32, 61, 32, 97,115,107, 44, 10, 32, 32, 32, 97,100,
-  100, 95,105,116,101,114, 95,112,114,105,109, 32, 61, 32, 97,100,100, 95,
-  105,116,101,114, 95,112,114,105,109, 44, 10,125, 10, 10,114,101,116,117,
-  114,110, 32,100, 97,116, 97,108,111,103, 10,
+  114,116, 40,116, 98,108, 44, 32,109, 97,107,101, 95, 99,111,110,115,116,
+   40,115,116,114, 41, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,116,
+   98,108, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,100,
+  108, 95,109, 97,107,101,108,105,116,101,114, 97,108, 40,116, 98,108, 41,
+   10, 32, 32, 32,116, 98,108, 46,112,114,101,100, 32, 61, 32,109, 97,107,
+  101, 95,112,114,101,100, 40,116, 98,108, 46,110, 97,109,101, 44, 32, 35,
+  116, 98,108, 41, 10, 32, 32, 32,116, 98,108, 46,110, 97,109,101, 32, 61,
+   32,110,105,108, 10, 32, 32, 32,114,101,116,117,114,110, 32,116, 98,108,
+   10,101,110,100, 10, 10, 45, 45, 32, 65, 32,112, 97,114, 97,109,101,116,
+  101,114, 32,105,115, 32,104,101,108,100, 32, 98,121, 32, 97, 32,102,114,
+  101,115,104, 32,118, 97,114,105, 97, 98,108,101, 32,117,110,116,105,108,
+   32,116,104,101, 32,108,105,116,101,114, 97,108, 32,105,115, 10, 45, 45,
+   32,112,114,101,112, 97,114,101,100, 44, 32, 97,110,100, 32,105,116,115,
+   32,112,111,115,105,116,105,111,110, 32,105,115, 32,114,101, 99,111,114,
+  100,101,100, 32,105,110, 32,116,104,101, 32,108,105,116,101,114, 97,108,
+   46, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95, 97,100,100,
+  112, 97,114, 97,109, 40,116, 98,108, 41, 10, 32, 32, 32,116, 97, 98,108,
+  101, 46,105,110,115,101,114,116, 40,116, 98,108, 44, 32,109,107, 95,102,
+  114,101,115,104, 95,118, 97,114, 40, 41, 41, 10, 32, 32, 32,108,111, 99,
+   97,108, 32,112, 97,114, 97,109,115, 32, 61, 32,116, 98,108, 46,112, 97,
+  114, 97,109,115, 32,111,114, 32,123,125, 10, 32, 32, 32,112, 97,114, 97,
+  109,115, 91, 35,112, 97,114, 97,109,115, 32, 43, 32, 49, 93, 32, 61, 32,
+   35,116, 98,108, 10, 32, 32, 32,116, 98,108, 46,112, 97,114, 97,109,115,
+   32, 61, 32,112, 97,114, 97,109,115, 10, 32, 32, 32,114,101,116,117,114,
+  110, 32,116, 98,108, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,
+  110, 32,100,108, 95,112,117,115,104,104,101, 97,100, 40,108,105,116,101,
+  114, 97,108, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,123,104,101,
+   97,100, 32, 61, 32,108,105,116,101,114, 97,108,125, 10,101,110,100, 10,
+   10,102,117,110, 99,116,105,111,110, 32,100,108, 95, 97,100,100,108,105,
+  116,101,114, 97,108, 40,116, 98,108, 44, 32,108,105,116,101,114, 97,108,
+   41, 10, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,114,116, 40,
+  116, 98,108, 44, 32,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,114,
+  101,116,117,114,110, 32,116, 98,108, 10,101,110,100, 10, 10,102,117,110,
+   99,116,105,111,110, 32,100,108, 95,109, 97,107,101, 99,108, 97,117,115,
+  101, 40,116, 98,108, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,116,
+   98,108, 10,101,110,100, 10, 10,100,108, 95, 97,115,115,101,114,116, 32,
+   61, 32, 97,115,115,101,114,116, 10, 10,100,108, 95,114,101,116,114, 97,
+   99,116, 32, 61, 32,114,101,116,114, 97, 99,116, 10, 10, 45, 45, 32, 65,
+  115,115,101,114,116,115, 32, 97, 32, 98, 97,116, 99,104, 32,111,102, 32,
+  110, 32,102, 97, 99,116,115, 32,102,111,114, 32,116,104,101, 32, 67, 32,
+  102,117,110, 99,116,105,111,110, 32,100,108, 95, 97,115,115,101,114,116,
+   95,102, 97, 99,116,115, 46, 32, 32, 84,104,101, 10, 45, 45, 32,105,100,
+  115, 32,111,102, 32,116,104,101, 32, 99,111,110,115,116, 97,110,116,115,
+   32,111,102, 32,116,104,101, 32,102, 97, 99,116,115, 32, 97,114,101, 32,
+  108,105,115,116,101,100, 32,105,110, 32,111,114,100,101,114, 32,105,110,
+   32,116,101,114,109,115, 46, 10, 45, 45, 32, 85,110,108,101,115,115, 32,
+  118,105,101,119,115, 32,104, 97,118,101, 32,116,111, 32, 98,101, 32,109,
+   97,105,110,116, 97,105,110,101,100, 44, 32,116,104,101, 32,102, 97, 99,
+  116,115, 32,103,111, 32,115,116,114, 97,105,103,104,116, 32,105,110,116,
+  111, 32,116,104,101, 10, 45, 45, 32,102, 97, 99,116, 32,115,116,111,114,
+  101, 32,111,102, 32,116,104,101, 32,112,114,101,100,105, 99, 97,116,101,
+   44, 32,119,104,111,115,101, 32,116, 97, 98,108,101,115, 32, 97,114,101,
+   32,105,110,118, 97,108,105,100, 97,116,101,100, 32,111,110, 99,101, 46,
+   10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95, 97,115,115,101,
+  114,116, 95,102, 97, 99,116,115, 40,110, 97,109,101, 44, 32, 97,114,105,
+  116,121, 44, 32,110, 44, 32,116,101,114,109,115, 41, 10, 32, 32, 32,108,
+  111, 99, 97,108, 32,112,114,101,100, 32, 61, 32,109, 97,107,101, 95,112,
+  114,101,100, 40,110, 97,109,101, 44, 32, 97,114,105,116,121, 41, 10, 32,
+   32, 32,105,102, 32,112,114,101,100, 46,112,114,105,109, 32,111,114, 32,
+  110, 32, 61, 61, 32, 48, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,
+  114,101,116,117,114,110, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,105,
+  102, 32,118,105,101,119,115, 32,116,104,101,110, 10, 32, 32, 32, 32, 32,
+   32,102,111,114, 32,105, 61, 48, 44,110, 45, 49, 32,100,111, 10,  9, 32,
+  108,111, 99, 97,108, 32,108,105,116,101,114, 97,108, 32, 61, 32,123,112,
+  114,101,100, 32, 61, 32,112,114,101,100,125, 10,  9, 32,102,111,114, 32,
+  106, 61, 49, 44, 97,114,105,116,121, 32,100,111, 10,  9, 32, 32, 32, 32,
+  108,105,116,101,114, 97,108, 91,106, 93, 32, 61, 32,109, 97,107,101, 95,
+   99,111,110,115,116, 40,116,101,114,109,115, 91,105, 32, 42, 32, 97,114,
+  105,116,121, 32, 43, 32,106, 93, 41, 10,  9, 32,101,110,100, 10,  9, 32,
+   97,115,115,101,114,116, 40,123,104,101, 97,100, 32, 61, 32,108,105,116,
+  101,114, 97,108,125, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+   32, 32, 32, 32, 32,114,101,116,117,114,110, 10, 32, 32, 32,101,110,100,
+   10, 32, 32, 32,116,111,117, 99,104, 40,112,114,101,100, 41, 10, 32, 32,
+   32,108,111, 99, 97,108, 32,102, 97, 99,116,115, 32, 61, 32,112,114,101,
+  100, 46,102, 97, 99,116,115, 10, 32, 32, 32,105,102, 32,110,111,116, 32,
+  102, 97, 99,116,115, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,102,
+   97, 99,116,115, 32, 61, 32,109, 97,107,101, 95,102, 97, 99,116,115, 40,
+   97,114,105,116,121, 41, 10, 32, 32, 32, 32, 32, 32,112,114,101,100, 46,
+  102, 97, 99,116,115, 32, 61, 32,102, 97, 99,116,115, 10, 32, 32, 32,101,
+  110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32, 97,100,100,101,100, 32,
+   61, 32,102, 97,108,115,101, 10, 32, 32, 32,102,111,114, 32,105, 61, 48,
+   44,110, 45, 49, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111, 99, 97,
+  108, 32,108,105,116,101,114, 97,108, 32, 61, 32,123,112,114,101,100, 32,
+   61, 32,112,114,101,100,125, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,
+  106, 61, 49, 44, 97,114,105,116,121, 32,100,111, 10,  9, 32,108,105,116,
+  101,114, 97,108, 91,106, 93, 32, 61, 32,109, 97,107,101, 95, 99,111,110,
+  115,116, 40,116,101,114,109,115, 91,105, 32, 42, 32, 97,114,105,116,121,
+   32, 43, 32,106, 93, 41, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32,
+   32, 32, 32, 32, 32,105,102, 32, 97,100,100, 95,102, 97, 99,116, 40,102,
+   97, 99,116,115, 44, 32,108,105,116,101,114, 97,108, 41, 32,116,104,101,
+  110, 10,  9, 32, 97,100,100,101,100, 32, 61, 32,116,114,117,101, 10, 32,
+   32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,105,102, 32, 97,100,100,101,100, 32,116,104,101,110, 10, 32, 32, 32,
+   32, 32, 32,105,110,118, 97,108,105,100, 97,116,101, 40,112,114,101,100,
+   41, 10, 32, 32, 32, 32, 32, 32,115,119,101,101,112, 95, 99,111,110,115,
+  116,115, 40, 41, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,105,110,115,
+  101,114,116, 40,112,114,101,100, 41, 10,101,110,100, 10, 10,100,108, 95,
+  115, 97,118,101, 32, 61, 32,115, 97,118,101, 10, 10,100,108, 95,114,101,
+  115,116,111,114,101, 32, 61, 32,114,101,115,116,111,114,101, 10, 10, 45,
+   45, 32, 83,110, 97,112,115,104,111,116,115, 32,116, 97,107,101,110, 32,
+  102,114,111,109, 32, 67, 32, 97,114,101, 32,114,101,102,101,114,114,101,
+  100, 32,116,111, 32, 98,121, 32,110,117,109, 98,101,114, 46, 10, 10,108,
+  111, 99, 97,108, 32,110,117,109, 98,101,114,101,100, 95,115,110, 97,112,
+  115,104,111,116,115, 32, 61, 32,123,110, 32, 61, 32, 48,125, 10, 10,102,
+  117,110, 99,116,105,111,110, 32,100,108, 95,115,110, 97,112,115,104,111,
+  116, 40, 41, 10, 32, 32, 32,110,117,109, 98,101,114,101,100, 95,115,110,
+   97,112,115,104,111,116,115, 46,110, 32, 61, 32,110,117,109, 98,101,114,
+  101,100, 95,115,110, 97,112,115,104,111,116,115, 46,110, 32, 43, 32, 49,
+   10, 32, 32, 32,110,117,109, 98,101,114,101,100, 95,115,110, 97,112,115,
+  104,111,116,115, 91,110,117,109, 98,101,114,101,100, 95,115,110, 97,112,
+  115,104,111,116,115, 46,110, 93, 32, 61, 32,115,110, 97,112,115,104,111,
+  116, 40, 41, 10, 32, 32, 32,114,101,116,117,114,110, 32,110,117,109, 98,
+  101,114,101,100, 95,115,110, 97,112,115,104,111,116,115, 46,110, 10,101,
+  110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95,114,101,
+  118,101,114,116, 40,110, 41, 10, 32, 32, 32,108,111, 99, 97,108, 32,115,
+  110, 97,112, 32, 61, 32,110,117,109, 98,101,114,101,100, 95,115,110, 97,
+  112,115,104,111,116,115, 91,110, 93, 10, 32, 32, 32,105,102, 32,110,111,
+  116, 32,115,110, 97,112, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,
+  101,114,114,111,114, 40, 34,110,111, 32,115,110, 97,112,115,104,111,116,
+   32,110,117,109, 98,101,114,101,100, 32, 34, 32, 46, 46, 32,116,111,115,
+  116,114,105,110,103, 40,110, 41, 41, 10, 32, 32, 32,101,110,100, 10, 32,
+   32, 32,114,101,118,101,114,116, 40,115,110, 97,112, 41, 10,101,110,100,
+   10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95,114,101,108,101,
+   97,115,101, 40,110, 41, 10, 32, 32, 32,110,117,109, 98,101,114,101,100,
+   95,115,110, 97,112,115,104,111,116,115, 91,110, 93, 32, 61, 32,110,105,
+  108, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108,
+   95,109, 97,116,101,114,105, 97,108,105,122,101, 40,108,105,116,101,114,
+   97,108, 41, 10, 32, 32, 32,105,102, 32,110,111,116, 32,108,105,116,101,
+  114, 97,108, 46,112,114,101,100, 46,112,114,105,109, 32,116,104,101,110,
+   10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,109, 97,116,101,
+  114,105, 97,108,105,122,101, 40,108,105,116,101,114, 97,108, 46,112,114,
+  101,100, 41, 10, 32, 32, 32,101,110,100, 10,101,110,100, 10, 10, 45, 45,
+   32, 84,104,105,115, 32, 67, 32, 65, 80, 73, 32,102,117,110, 99,116,105,
+  111,110, 32,105,115, 32,109,111,114,101, 32, 99,111,109,112,108,105, 99,
+   97,116,101,100, 32,116,104, 97,110, 32,116,104,101, 32,111,116,104,101,
+  114,115, 32, 98,101, 99, 97,117,115,101, 32,105,116, 10, 45, 45, 32,105,
+  115, 32, 99,111,109,112,117,116,105,110,103, 32,116,104,101, 32,116,111,
+  116, 97,108, 32,115,105,122,101, 32,111,102, 32,116,104,101, 32, 99,104,
+   97,114, 97, 99,116,101,114, 32, 97,114,114, 97,121, 32,116,104, 97,116,
+   32,119,105,108,108, 32, 98,101, 10, 45, 45, 32, 97,108,108,111, 99, 97,
+  116,101,100, 32, 98,121, 32,116,104,101, 32, 67, 32,114,111,117,116,105,
+  110,101, 32,117,115,105,110,103, 32,116,104,105,115, 32,102,117,110, 99,
+  116,105,111,110, 46, 32, 32, 84,104,101, 32, 99,104, 97,114, 97, 99,116,
+  101,114, 10, 45, 45, 32, 97,114,114, 97,121, 32,109,117,115,116, 32,104,
+   97,118,101, 32,114,111,111,109, 32,102,111,114, 32,116,104,101, 32,112,
+  114,101,100,105, 99, 97,116,101, 32, 97,110,100, 32, 97,108,108, 32,111,
+  102, 32,116,104,101, 32, 99,111,110,115,116, 97,110,116, 10, 45, 45, 32,
+  116,101,114,109,115, 32,105,110, 32,116,104,101, 32, 97,110,115,119,101,
+  114, 46, 32, 32, 69, 97, 99,104, 32,105,116,101,109, 32, 97,108,115,111,
+   32,110,101,101,100,115, 32,114,111,111,109, 32,102,111,114, 32,116,104,
+  101, 32,122,101,114,111, 10, 45, 45, 32, 99,104, 97,114, 97, 99,116,101,
+  114, 32,117,115,101,100, 32,116,111, 32,116,101,114,109,105,110, 97,116,
+  101, 32,101, 97, 99,104, 32,115,116,114,105,110,103, 46, 10, 10,108,111,
+   99, 97,108, 32,102,117,110, 99,116,105,111,110, 32,104, 97,110,100, 95,
+   98, 97, 99,107, 40, 97,110,115,119,101,114,115, 41, 10, 32, 32, 32,105,
+  102, 32,110,111,116, 32, 97,110,115,119,101,114,115, 32,116,104,101,110,
+   10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32, 97,110,115,119,
+  101,114,115, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,
+  108, 32,110, 32, 61, 32, 35, 97,110,115,119,101,114,115, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32, 97,114,105,116,121, 32, 61, 32, 97,110,115,119,
+  101,114,115, 46, 97,114,105,116,121, 10, 32, 32, 32,108,111, 99, 97,108,
+   32,115,105,122,101, 32, 61, 32,115,116,114,105,110,103, 46,108,101,110,
+   40, 97,110,115,119,101,114,115, 46,110, 97,109,101, 41, 32, 43, 32, 49,
+   10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44,110, 32,100,111, 10, 32,
+   32, 32, 32, 32, 32,108,111, 99, 97,108, 32, 97,110,115,119,101,114, 32,
+   61, 32, 97,110,115,119,101,114,115, 91,105, 93, 10, 32, 32, 32, 32, 32,
+   32,102,111,114, 32,106, 61, 49, 44, 97,114,105,116,121, 32,100,111, 10,
+    9, 32,115,105,122,101, 32, 61, 32,115,105,122,101, 32, 43, 32,115,116,
+  114,105,110,103, 46,108,101,110, 40, 97,110,115,119,101,114, 91,106, 93,
+   41, 32, 43, 32, 49, 10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,101,110,100, 10, 32, 32, 32, 97,110,115,119,101,114,115, 46,115,105,
+  122,101, 32, 61, 32,115,105,122,101, 10, 32, 32, 32, 97,110,115,119,101,
+  114,115, 46,110, 32, 61, 32,110,  9,  9, 45, 45, 32, 72, 97, 99,107, 32,
+  116,111, 32,104, 97,110,100, 32, 98, 97, 99,107, 32,116,104,101, 32,115,
+  105,122,101, 10, 32, 32, 32,114,101,116,117,114,110, 32, 97,110,115,119,
+  101,114,115, 10,101,110,100, 10, 10,102,117,110, 99,116,105,111,110, 32,
+  100,108, 95, 97,115,107, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32,
+   32,114,101,116,117,114,110, 32,104, 97,110,100, 95, 98, 97, 99,107, 40,
+   97,115,107, 40,108,105,116,101,114, 97,108, 41, 41, 10,101,110,100, 10,
+   10, 45, 45, 32, 65,110,115,119,101,114,115, 32, 97, 32,108,105,116,101,
+  114, 97,108, 32,102,111,114, 32,116,104,101, 32, 67, 32,102,117,110, 99,
+  116,105,111,110, 32,100,108, 95, 97,115,107, 95,111,112,101,110, 44, 32,
+  119,104,105, 99,104, 32,114,101, 97,100,115, 32,116,104,101, 10, 45, 45,
+   32, 97,110,115,119,101,114,115, 32,102,114,111,109, 32,116,104,101, 32,
+  116, 97, 98,108,101, 32,111,102, 32,102, 97, 99,116,115, 32,114,101,116,
+  117,114,110,101,100, 32,105,110, 32,116,104,101, 32,102,105,114,115,116,
+   32,115,108,111,116, 32,111,102, 32, 97,110, 10, 45, 45, 32, 97,114,114,
+   97,121, 44, 32,107,101,101,112,105,110,103, 32,116,104,101, 32,107,101,
+  121, 32,111,102, 32,116,104,101, 32,110,101,120,116, 32, 97,110,115,119,
+  101,114, 32,105,110, 32,116,104,101, 32,115,101, 99,111,110,100, 46, 10,
+   10,102,117,110, 99,116,105,111,110, 32,100,108, 95, 97,115,107, 95,111,
+  112,101,110, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,108,111,
+   99, 97,108, 32,115,117, 98,103,111, 97,108, 32, 61, 32,115,111,108,118,
+  101, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,114,101,116,117,
+  114,110, 32,123,115,117, 98,103,111, 97,108, 46,102, 97, 99,116,115,125,
+   44, 32,103,101,116, 95,110, 97,109,101, 40,108,105,116,101,114, 97,108,
+   46,112,114,101,100, 41, 44, 32,103,101,116, 95, 97,114,105,116,121, 40,
+  108,105,116,101,114, 97,108, 46,112,114,101,100, 41, 10,101,110,100, 10,
+   10, 45, 45, 32, 65, 32,112,114,101,112, 97,114,101,100, 32,113,117,101,
+  114,121, 32,107,101,101,112,115, 32, 97, 32,116,101,109,112,108, 97,116,
+  101, 32,111,102, 32,105,116,115, 32,108,105,116,101,114, 97,108, 44, 32,
+  105,110, 32,119,104,105, 99,104, 32,101, 97, 99,104, 10, 45, 45, 32,112,
+   97,114, 97,109,101,116,101,114, 32,104,111,108,100,115, 32,116,104,101,
+   32, 99,111,110,115,116, 97,110,116, 32,105,116, 32,119, 97,115, 32,108,
+   97,115,116, 32, 98,111,117,110,100, 32,116,111, 46, 32, 32, 86, 97,108,
+  117,101,115, 32, 97,114,101, 32,115,101,116, 10, 45, 45, 32,102,114,111,
+  109, 32, 67, 32, 97,115, 32,115,116,114,105,110,103,115, 32,105,110, 32,
+  116,104,101, 32, 97,114,114, 97,121, 32,111,102, 32,118, 97,108,117,101,
+  115, 44, 32, 97,110,100, 32, 97, 32, 99,111,110,115,116, 97,110,116, 32,
+  105,115, 32,111,110,108,121, 10, 45, 45, 32,108,111,111,107,101,100, 32,
+  117,112, 32,119,104,101,110, 32,116,104,101, 32,118, 97,108,117,101, 32,
+  111,102, 32,105,116,115, 32,112, 97,114, 97,109,101,116,101,114, 32,104,
+   97,115, 32, 99,104, 97,110,103,101,100, 44, 32,115,111, 32,109, 97,107,
+  105,110,103, 10, 45, 45, 32,116,104,101, 32,108,105,116,101,114, 97,108,
+   32,116,111, 32, 97,115,107, 32, 99,111,112,105,101,115, 32,116,104,101,
+   32,116,101,109,112,108, 97,116,101, 32, 97,110,100, 32,108,105,116,116,
+  108,101, 32,101,108,115,101, 46, 32, 32, 84,104,101, 32,104, 97,110,100,
+  108,101, 10, 45, 45, 32,105,115, 32,116,104,101, 32,117,115,101,114,100,
+   97,116, 97, 32,117,115,101,100, 32, 98,121, 32, 67, 46, 10, 10,102,117,
+  110, 99,116,105,111,110, 32,100,108, 95,112,114,101,112, 97,114,101, 40,
+  108,105,116,101,114, 97,108, 44, 32,104, 97,110,100,108,101, 41, 10, 32,
+   32, 32,108,111, 99, 97,108, 32,112, 97,114, 97,109,115, 32, 61, 32,108,
+  105,116,101,114, 97,108, 46,112, 97,114, 97,109,115, 32,111,114, 32,123,
+  125, 10, 32, 32, 32,108,105,116,101,114, 97,108, 46,112, 97,114, 97,109,
+  115, 32, 61, 32,110,105,108, 10, 32, 32, 32,108,111, 99, 97,108, 32,118,
+   97,108,117,101,115, 32, 61, 32,123,125, 10, 32, 32, 32,102,111,114, 32,
+  105, 61, 49, 44, 35,112, 97,114, 97,109,115, 32,100,111, 10, 32, 32, 32,
+   32, 32, 32,118, 97,108,117,101,115, 91,105, 93, 32, 61, 32,102, 97,108,
+  115,101, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108,
+   32,112,114,101,112, 32, 61, 32,123,104, 97,110,100,108,101, 32, 61, 32,
+  104, 97,110,100,108,101, 44, 32,108,105,116,101,114, 97,108, 32, 61, 32,
+  108,105,116,101,114, 97,108, 44, 32,112, 97,114, 97,109,115, 32, 61, 32,
+  112, 97,114, 97,109,115, 44, 10,  9,  9, 32,118, 97,108,117,101,115, 32,
+   61, 32,118, 97,108,117,101,115, 44, 32,105,100,115, 32, 61, 32,123,125,
+  125, 10, 32, 32, 32,114,101,116,117,114,110, 32,112,114,101,112, 44, 32,
+  118, 97,108,117,101,115, 44, 32, 35,112, 97,114, 97,109,115, 10,101,110,
+  100, 10, 10,102,117,110, 99,116,105,111,110, 32,100,108, 95,105,110,115,
+  116, 97,110,116,105, 97,116,101, 40,112,114,101,112, 41, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32,116,101,109,112,108, 97,116,101, 32, 61, 32,112,
+  114,101,112, 46,108,105,116,101,114, 97,108, 10, 32, 32, 32,108,111, 99,
+   97,108, 32,112, 97,114, 97,109,115, 32, 61, 32,112,114,101,112, 46,112,
+   97,114, 97,109,115, 10, 32, 32, 32,108,111, 99, 97,108, 32,118, 97,108,
+  117,101,115, 32, 61, 32,112,114,101,112, 46,118, 97,108,117,101,115, 10,
+   32, 32, 32,108,111, 99, 97,108, 32,105,100,115, 32, 61, 32,112,114,101,
+  112, 46,105,100,115, 10, 32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,
+  112, 97,114, 97,109,115, 32,100,111, 10, 32, 32, 32, 32, 32, 32,108,111,
+   99, 97,108, 32,118, 97,108,117,101, 32, 61, 32,118, 97,108,117,101,115,
+   91,105, 93, 10, 32, 32, 32, 32, 32, 32,105,102, 32,118, 97,108,117,101,
+   32,126, 61, 32,105,100,115, 91,105, 93, 32,116,104,101,110, 10,  9, 32,
+  105,102, 32,110,111,116, 32,118, 97,108,117,101, 32,116,104,101,110, 10,
+    9, 32, 32, 32, 32,101,114,114,111,114, 40, 34,112, 97,114, 97,109,101,
+  116,101,114, 32, 34, 32, 46, 46, 32,105, 32, 45, 32, 49, 32, 46, 46, 32,
+   34, 32,105,115, 32,110,111,116, 32, 98,111,117,110,100, 34, 41, 10,  9,
+   32,101,110,100, 10,  9, 32,116,101,109,112,108, 97,116,101, 91,112, 97,
+  114, 97,109,115, 91,105, 93, 93, 32, 61, 32,109, 97,107,101, 95, 99,111,
+  110,115,116, 40,118, 97,108,117,101, 41, 10,  9, 32,105,100,115, 91,105,
+   93, 32, 61, 32,118, 97,108,117,101, 10, 32, 32, 32, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,108,111, 99, 97,108, 32,
+  108,105,116,101,114, 97,108, 32, 61, 32,123,112,114,101,100, 32, 61, 32,
+  116,101,109,112,108, 97,116,101, 46,112,114,101,100,125, 10, 32, 32, 32,
+  102,111,114, 32,105, 61, 49, 44, 35,116,101,109,112,108, 97,116,101, 32,
+  100,111, 10, 32, 32, 32, 32, 32, 32,108,105,116,101,114, 97,108, 91,105,
+   93, 32, 61, 32,116,101,109,112,108, 97,116,101, 91,105, 93, 10, 32, 32,
+   32,101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,108,105,116,
+  101,114, 97,108, 10,101,110,100, 10, 10, 45, 45, 32, 84,104,101, 32,103,
+  114,111,117,112, 32,105,115, 32, 97,110, 32, 97,114,114, 97,121, 32,111,
+  102, 32,112,111,115,105,116,105,111,110,115, 46, 10, 10,102,117,110, 99,
+  116,105,111,110, 32,100,108, 95, 97,103,103,114,101,103, 97,116,101, 40,
+  108,105,116,101,114, 97,108, 44, 32,111,112, 44, 32, 99,111,108,117,109,
+  110, 44, 32,103,114,111,117,112, 41, 10, 32, 32, 32,114,101,116,117,114,
+  110, 32,104, 97,110,100, 95, 98, 97, 99,107, 40, 97,103,103,114,101,103,
+   97,116,101, 40,108,105,116,101,114, 97,108, 44, 32,111,112, 44, 32, 99,
+  111,108,117,109,110, 44, 32,103,114,111,117,112, 41, 41, 10,101,110,100,
+   10, 10, 45, 45, 32, 85,115,101,115, 32,116,104,101, 32,109, 97,103,105,
+   99, 32,115,101,116,115, 32,116,114, 97,110,115,102,111,114,109, 97,116,
+  105,111,110, 32,116,111, 32,109, 97,107,101, 32,116,104,101, 32,112,114,
+  111,103,114, 97,109, 32,102,111,114, 32, 97, 10, 45, 45, 32,108,105,116,
+  101,114, 97,108, 32,119,105,116,104, 32, 99,111,110,115,116, 97,110,116,
+   32, 97,114,103,117,109,101,110,116,115, 46, 32, 32, 84,104,101, 32,113,
+  117,101,114,121, 32,105,115, 32, 97,110,115,119,101,114,101,100, 32, 98,
+  121, 32,116,104,101, 10, 45, 45, 32,108,105,116,101,114, 97,108, 32,114,
+  101,116,117,114,110,101,100, 44, 32,119,104,111,115,101, 32,112,114,101,
+  100,105, 99, 97,116,101, 32,105,115, 32,116,104,101, 32, 97,100,111,114,
+  110,101,100, 32,111,110,101, 46, 10, 10,108,111, 99, 97,108, 32,102,117,
+  110, 99,116,105,111,110, 32,109, 97,103,105, 99, 95,112,114,111,103,114,
+   97,109, 40,108,105,116,101,114, 97,108, 41, 10, 32, 32, 32,108,111, 99,
+   97,108, 32,112,114,101,100, 32, 61, 32,108,105,116,101,114, 97,108, 46,
+  112,114,101,100, 10, 32, 32, 32,108,111, 99, 97,108, 32, 97, 32, 61, 32,
+   97,100,111,114,110,109,101,110,116, 40,108,105,116,101,114, 97,108, 44,
+   32,123,125, 41, 10, 32, 32, 32,105,102, 32,110,111,116, 32,115,116,114,
+  105,110,103, 46,102,105,110,100, 40, 97, 44, 32, 34, 98, 34, 41, 32,111,
+  114, 32,110,111,116, 32,104, 97,115, 95,114,117,108,101,115, 40,112,114,
+  101,100, 41, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,
+  117,114,110, 32,110,105,108, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  108,111, 99, 97,108, 32,112,114,111,103,114, 97,109,115, 32, 61, 32,109,
+   97,103,105, 99, 95,112,114,111,103,114, 97,109,115, 91,112,114,101,100,
+   93, 10, 32, 32, 32,105,102, 32,110,111,116, 32,112,114,111,103,114, 97,
+  109,115, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,112,114,111,103,
+  114, 97,109,115, 32, 61, 32,123,125, 10, 32, 32, 32, 32, 32, 32,109, 97,
+  103,105, 99, 95,112,114,111,103,114, 97,109,115, 91,112,114,101,100, 93,
+   32, 61, 32,112,114,111,103,114, 97,109,115, 10, 32, 32, 32,101,110,100,
+   10, 32, 32, 32,108,111, 99, 97,108, 32,112,114,111,103,114, 97,109, 32,
+   61, 32,112,114,111,103,114, 97,109,115, 91, 97, 93, 10, 32, 32, 32,105,
+  102, 32,112,114,111,103,114, 97,109, 32, 61, 61, 32,110,105,108, 32,116,
+  104,101,110, 10, 32, 32, 32, 32, 32, 32,112,114,111,103,114, 97,109, 32,
+   61, 32,109, 97,103,105, 99, 95,114,101,119,114,105,116,101, 40,112,114,
+  101,100, 44, 32, 97, 41, 32,111,114, 32,102, 97,108,115,101, 10, 32, 32,
+   32, 32, 32, 32,112,114,111,103,114, 97,109,115, 91, 97, 93, 32, 61, 32,
+  112,114,111,103,114, 97,109, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,
+  105,102, 32,110,111,116, 32,112,114,111,103,114, 97,109, 32,116,104,101,
+  110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,110,105,108,
+   10, 32, 32, 32,101,110,100, 10, 32, 32, 32,112,114,111,103,114, 97,109,
+   46,109, 97,103,105, 99, 46,100, 98, 46,115,101,101,100, 32, 61, 32,123,
+  104,101, 97,100, 32, 61, 32, 98,111,117,110,100, 95, 97,114,103,115, 40,
+  112,114,111,103,114, 97,109, 46,109, 97,103,105, 99, 44, 32,108,105,116,
+  101,114, 97,108, 44, 32, 97, 41,125, 10, 32, 32, 32,112,114,111,103,114,
+   97,109, 46,112,114,101,100,115, 46, 99,111,110,115,116,115, 32, 61, 32,
+   99,111,110,115,116, 95,111,102, 95,115,121,109, 10, 32, 32, 32,108,111,
+   99, 97,108, 32,113,117,101,114,121, 32, 61, 32,123,112,114,101,100, 32,
+   61, 32,112,114,111,103,114, 97,109, 46, 97,110,115,119,101,114,125, 10,
+   32, 32, 32,102,111,114, 32,105, 61, 49, 44, 35,108,105,116,101,114, 97,
+  108, 32,100,111, 10, 32, 32, 32, 32, 32, 32,113,117,101,114,121, 91,105,
+   93, 32, 61, 32,108,105,116,101,114, 97,108, 91,105, 93, 10, 32, 32, 32,
+  101,110,100, 10, 32, 32, 32,114,101,116,117,114,110, 32,113,117,101,114,
+  121, 44, 32,112,114,111,103,114, 97,109, 46,112,114,101,100,115, 10,101,
+  110,100, 10, 10, 45, 45, 32, 67,111,108,108,101, 99,116,115, 32,116,104,
+  101, 32,112,114,101,100,105, 99, 97,116,101,115, 32, 97, 32,108,105,116,
+  101,114, 97,108, 32,100,101,112,101,110,100,115, 32,111,110, 32,102,111,
+  114, 32,116,104,101, 32,110, 97,116,105,118,101, 10, 45, 45, 32, 98,111,
+  116,116,111,109, 45,117,112, 32,101,118, 97,108,117, 97,116,111,114, 46,
+   32, 32, 84,104,101, 32,114,101,115,117,108,116, 32,105,115, 32,116,104,
+  101, 32,108,105,116,101,114, 97,108, 32,116,111, 32, 97,110,115,119,101,
+  114, 44, 32, 97,110, 32, 97,114,114, 97,121, 10, 45, 45, 32,119,105,116,
+  104, 32,111,110,101, 32,101,110,116,114,121, 32,102,111,114, 32,101, 97,
+   99,104, 32,112,114,101,100,105, 99, 97,116,101, 44, 32,103,105,118,105,
+  110,103, 32,116,104,101, 32,112,114,101,100,105, 99, 97,116,101, 44, 32,
+  105,116,115, 32,110, 97,109,101, 44, 10, 45, 45, 32,105,116,115, 32, 97,
+  114,105,116,121, 44, 32,119,104,101,116,104,101,114, 32,105,116, 32,105,
+  115, 32,116,104,101, 32,101,113,117, 97,108,105,116,121, 32,112,114,105,
+  109,105,116,105,118,101, 44, 32, 97,110,100, 32,119,104,101,116,104,101,
+  114, 32,111,110,108,121, 10, 45, 45, 32,105,116,115, 32,102, 97, 99,116,
+  115, 32, 97,114,101, 32,117,115,101,100, 44, 32, 97,110,100, 32,116,104,
+  101, 32,109,101,116, 97,116, 97, 98,108,101, 32,115,104, 97,114,101,100,
+   32, 98,121, 32, 99,111,110,115,116, 97,110,116,115, 46, 32, 32, 87,104,
+  101,110, 10, 45, 45, 32,109, 97,103,105, 99, 32,105,115, 32,116,114,117,
+  101, 44, 32,116,104,101, 32,112,114,111,103,114, 97,109, 32,105,115, 32,
+  114,101,119,114,105,116,116,101,110, 32,102,111,114, 32,116,104,101, 32,
+   99,111,110,115,116, 97,110,116, 32, 97,114,103,117,109,101,110,116,115,
+   10, 45, 45, 32,111,102, 32,116,104,101, 32,108,105,116,101,114, 97,108,
+   46, 32, 32, 73,102, 32,116,104,101, 32,101,118, 97,108,117, 97,116,111,
+  114, 32, 99, 97,110,110,111,116, 32,104, 97,110,100,108,101, 32,116,104,
+  101, 32,108,105,116,101,114, 97,108, 44, 10, 45, 45, 32, 98,101, 99, 97,
+  117,115,101, 32,105,116, 32,100,101,112,101,110,100,115, 32,111,110, 32,
+   97, 32,112,114,105,109,105,116,105,118,101, 32,111,116,104,101,114, 32,
+  116,104, 97,110, 32,101,113,117, 97,108,105,116,121, 44, 32,110,105,108,
+   32,105,115, 10, 45, 45, 32,114,101,116,117,114,110,101,100, 44, 32, 97,
+  110,100, 32,116,104,101, 32, 99, 97,108,108,101,114, 32,102, 97,108,108,
+  115, 32, 98, 97, 99,107, 32,116,111, 32,116,104,101, 32,116, 97, 98,108,
+  101,100, 32,112,114,111,118,101,114, 46, 10, 10,102,117,110, 99,116,105,
+  111,110, 32,100,108, 95,112,114,111,103,114, 97,109, 40,108,105,116,101,
+  114, 97,108, 44, 32,109, 97,103,105, 99, 41, 10, 32, 32, 32,105,102, 32,
+  108,105,116,101,114, 97,108, 46,112,114,101,100, 46,112,114,105,109, 32,
+  116,104,101,110, 10, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,
+  110,105,108, 10, 32, 32, 32,101,110,100, 10, 32, 32, 32,105,102, 32,109,
+   97,103,105, 99, 32,116,104,101,110, 10, 32, 32, 32, 32, 32, 32,108,111,
+   99, 97,108, 32,113,117,101,114,121, 44, 32,112,114,101,100,115, 32, 61,
+   32,109, 97,103,105, 99, 95,112,114,111,103,114, 97,109, 40,108,105,116,
+  101,114, 97,108, 41, 10, 32, 32, 32, 32, 32, 32,105,102, 32,113,117,101,
+  114,121, 32,116,104,101,110, 10,  9, 32,114,101,116,117,114,110, 32,113,
+  117,101,114,121, 44, 32,112,114,101,100,115, 44, 32, 67,111,110,115,116,
+   10, 32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32,101,110,100, 10,
+   32, 32, 32,108,111, 99, 97,108, 32,112,114,101,100,115, 32, 61, 32,123,
+  125, 10, 32, 32, 32,108,111, 99, 97,108, 32,115,101,101,110, 32, 61, 32,
+  123,125, 10, 32, 32, 32,108,111, 99, 97,108, 32,102,117,110, 99,116,105,
+  111,110, 32,118,105,115,105,116, 40,112,114,101,100, 41, 10, 32, 32, 32,
+   32, 32, 32,105,102, 32,115,101,101,110, 91,112,114,101,100, 93, 32,116,
+  104,101,110, 10,  9, 32,114,101,116,117,114,110, 32,116,114,117,101, 10,
+   32, 32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,115,101,
+  101,110, 91,112,114,101,100, 93, 32, 61, 32,116,114,117,101, 10, 32, 32,
+   32, 32, 32, 32,108,111, 99, 97,108, 32,101,113,117, 97,108,115, 32, 61,
+   32,112,114,101,100, 32, 61, 61, 32, 98,105,110, 97,114,121, 95,101,113,
+  117, 97,108,115, 95,112,114,101,100, 10, 32, 32, 32, 32, 32, 32,105,102,
+   32,112,114,101,100, 46,112,114,105,109, 32, 97,110,100, 32,110,111,116,
+   32,101,113,117, 97,108,115, 32,116,104,101,110, 10,  9, 32,114,101,116,
+  117,114,110, 32,102, 97,108,115,101, 10, 32, 32, 32, 32, 32, 32,101,110,
+  100, 10, 32, 32, 32, 32, 32, 32,116, 97, 98,108,101, 46,105,110,115,101,
+  114,116, 40,112,114,101,100,115, 44, 32,123,112,114,101,100, 32, 61, 32,
+  112,114,101,100, 44, 32,110, 97,109,101, 32, 61, 32,103,101,116, 95,110,
+   97,109,101, 40,112,114,101,100, 41, 44, 10,  9,  9,  9, 32, 32, 32, 97,
+  114,105,116,121, 32, 61, 32,103,101,116, 95, 97,114,105,116,121, 40,112,
+  114,101,100, 41, 44, 32,101,113,117, 97,108,115, 32, 61, 32,101,113,117,
+   97,108,115,125, 41, 10, 32, 32, 32, 32, 32, 32,102,111,114, 32,105,100,
+   44, 99,108, 97,117,115,101, 32,105,110, 32,112, 97,105,114,115, 40,112,
+  114,101,100, 46,100, 98, 41, 32,100,111, 10,  9, 32,102,111,114, 32,105,
+   61, 49, 44, 35, 99,108, 97,117,115,101, 32,100,111, 10,  9, 32, 32, 32,
+   32,105,102, 32,110,111,116, 32,118,105,115,105,116, 40, 99,108, 97,117,
+  115,101, 91,105, 93, 46,112,114,101,100, 41, 32,116,104,101,110, 10,  9,
+   32, 32, 32, 32, 32, 32, 32,114,101,116,117,114,110, 32,102, 97,108,115,
+  101, 10,  9, 32, 32, 32, 32,101,110,100, 10,  9, 32,101,110,100, 10, 32,
+   32, 32, 32, 32, 32,101,110,100, 10, 32, 32, 32, 32, 32, 32,114,101,116,
+  117,114,110, 32,116,114,117,101, 10, 32, 32, 32,101,110,100, 10, 32, 32,
+   32,105,102, 32,110,111,116, 32,118,105,115,105,116, 40,108,105,116,101,
+  114, 97,108, 46,112,114,101,100, 41, 32,116,104,101,110, 10, 32, 32, 32,
+   32, 32, 32,114,101,116,117,114,110, 32,110,105,108, 10, 32, 32, 32,101,
+  110,100, 10, 32, 32, 32,112,114,101,100,115, 46, 99,111,110,115,116,115,
+   32, 61, 32, 99,111,110,115,116, 95,111,102, 95,115,121,109, 10, 32, 32,
+   32,114,101,116,117,114,110, 32,108,105,116,101,114, 97,108, 44, 32,112,
+  114,101,100,115, 44, 32, 67,111,110,115,116, 10,101,110,100, 10, 10, 45,
+   45, 32, 84,104,101, 32, 76,117, 97, 32, 65, 80, 73, 10, 10,100, 97,116,
+   97,108,111,103, 32, 61, 32,123, 10, 32, 32, 32,109, 97,107,101, 95,118,
+   97,114, 32, 61, 32,109, 97,107,101, 95,118, 97,114, 44, 10, 32, 32, 32,
+  109, 97,107,101, 95, 99,111,110,115,116, 32, 61, 32,109, 97,107,101, 95,
+   99,111,110,115,116, 44, 10, 32, 32, 32,109, 97,107,101, 95,112,114,101,
+  100, 32, 61, 32,109, 97,107,101, 95,112,114,101,100, 44, 10, 32, 32, 32,
+  103,101,116, 95,110, 97,109,101, 32, 61, 32,103,101,116, 95,110, 97,109,
+  101, 44, 10, 32, 32, 32,103,101,116, 95, 97,114,105,116,121, 32, 61, 32,
+  103,101,116, 95, 97,114,105,116,121, 44, 10, 32, 32, 32,109, 97,107,101,
+   95,108,105,116,101,114, 97,108, 32, 61, 32,109, 97,107,101, 95,108,105,
+  116,101,114, 97,108, 44, 10, 32, 32, 32,109, 97,107,101, 95, 99,108, 97,
+  117,115,101, 32, 61, 32,109, 97,107,101, 95, 99,108, 97,117,115,101, 44,
+   10, 32, 32, 32,105,110,115,101,114,116, 32, 61, 32,105,110,115,101,114,
+  116, 44, 10, 32, 32, 32,114,101,109,111,118,101, 32, 61, 32,114,101,109,
+  111,118,101, 44, 10, 32, 32, 32, 97,115,115,101,114,116, 32, 61, 32, 97,
+  115,115,101,114,116, 44, 10, 32, 32, 32,114,101,116,114, 97, 99,116, 32,
+   61, 32,114,101,116,114, 97, 99,116, 44, 10, 32, 32, 32,115, 97,118,101,
+   32, 61, 32,115, 97,118,101, 44, 10, 32, 32, 32,114,101,115,116,111,114,
+  101, 32, 61, 32,114,101,115,116,111,114,101, 44, 10, 32, 32, 32, 99,111,
+  112,121, 32, 61, 32, 99,111,112,121, 44, 10, 32, 32, 32,114,101,118,101,
+  114,116, 32, 61, 32,114,101,118,101,114,116, 44, 10, 32, 32, 32, 97,115,
+  107, 32, 61, 32, 97,115,107, 44, 10, 32, 32, 32, 97,103,103,114,101,103,
+   97,116,101, 32, 61, 32, 97,103,103,114,101,103, 97,116,101, 44, 10, 32,
+   32, 32,109, 97,116,101,114,105, 97,108,105,122,101, 32, 61, 32,109, 97,
+  116,101,114,105, 97,108,105,122,101, 44, 10, 32, 32, 32, 97,100,100, 95,
+  105,116,101,114, 95,112,114,105,109, 32, 61, 32, 97,100,100, 95,105,116,
+  101,114, 95,112,114,105,109, 44, 10,125, 10, 10,114,101,116,117,114,110,
+   32,100, 97,116, 97,108,111,103, 10,
 };
@@ -0,0 +1,215 @@
+/*
+ * Declarations shared by the parts of the Datalog library that are
+ * written in C.  Nothing in this file is part of the public API.
+ *
+ * Copyright (C) Alexander Hoffman, 2017
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
+ */
+
+#if !defined DL_NATIVE_H
+#define DL_NATIVE_H
+
+#include <stddef.h>
+#include <lua.h>
+#include "datalog.h"
+
+#if LUA_VERSION_NUM < 502
+#define lua_rawlen lua_objlen
+#endif
+
+/* The list of answers returned by dl_ask.  See datalog.c for a
+   description of the three blocks of memory that make up a list. */
+
+struct dl_answers {
+  size_t arity;
+  size_t len;
+  char **pred;
+#if !defined __STDC_VERSION__ || __STDC_VERSION__ < 199901L
+  char **term[1];
+#else
+  char **term[];
+#endif
+};
+
+/* Allocates the three blocks for n answers of the given arity, where
+   size is the number of characters needed by the predicate and all
+   terms, including their terminating zeros.  The caller fills in
+   the character block starting at pred[0], and sets pred[1] and
+   term[i] as it goes.  Returns the null pointer when out of memory. */
+dl_answers_t dl_answers_alloc(size_t n, size_t arity, size_t size);
+
+/* Native semi-naive bottom-up evaluation.
+
+   Stack: ... literal preds const -> ... literal preds const
+
+   The preds table is the array returned by the Lua function
+   dl_program, and const is the metatable shared by all constants.
+   The answers to the literal are returned through a, which is set to
+   the null pointer when there are none.  When agg is not the null
+   pointer, the answers are aggregated as described for dl_aggregate.
+   Rounds with a large delta are shared by the given number of
+   threads, or by one thread per processor when it is zero.  Returns
+   zero on success. */
+
+typedef struct {
+  int op;			/* One of the DL_AGG_ operations. */
+  int column;
+  unsigned long group;
+} dl_agg_t;
+
+int dl_seminaive(lua_State *L, dl_answers_t *a, const dl_agg_t *agg,
+		 int threads);
+
+/* A query evaluated by the native evaluator, whose answers are read
+   one at a time by the cursors of dl_ask_open.  The evaluation is
+   kept until the query is closed.
+
+   dl_seminaive_open evaluates the query on the stack as dl_seminaive
+   does.  dl_seminaive_pred returns the name of the predicate of the
+   query, which is the null pointer when it has no answers.
+   dl_seminaive_next reads the next answer, setting the arity terms
+   and their lengths, which are owned by Lua, and returns zero when
+   there are no more.  dl_seminaive_open returns zero on success. */
+typedef struct dl_sn_query dl_sn_query_t;
+
+int dl_seminaive_open(lua_State *L, dl_sn_query_t **q, int threads);
+
+const char *dl_seminaive_pred(dl_sn_query_t *q, size_t *len,
+			      size_t *arity);
+
+int dl_seminaive_next(dl_sn_query_t *q, const char **terms, size_t *lens);
+
+void dl_seminaive_close(dl_sn_query_t *q);
+
+/* The columns of a fact store can be shared by several stores, made
+   by copying a store, or by installing a published version of a
+   database in a replica, which is another Lua state.  Each holder
+   sees a prefix of the rows, its own number of them.  The rows seen
+   by a holder are never changed, but the store that shared the
+   columns may append rows past them in place, while they fit.  Other
+   changes copy the rows, unless no other store or version holds
+   them.  The columns may belong to an owner instead, such as a
+   database image mapped into memory.  Such rows are never changed in
+   place, and the owner is released, not the columns, when the rows
+   are freed. */
+
+typedef struct dl_fs_rows {
+  int refs;			/* Holders, changed atomically. */
+  int arity;
+  size_t cap;
+  int **cols;
+  void *owner;			/* Holds the columns, or null. */
+  void (*release)(void *owner);
+} dl_fs_rows_t;
+
+/* A fact store holds the ground facts of a predicate, one row of
+   Lua constant symbols per fact, with column j of row i at
+   cols[j][i].  Rows 0 up to len are in use.  See factstore.c. */
+
+typedef struct {
+  int arity;
+  dl_fs_rows_t *rows;		/* The rows when shared, or null. */
+  int appends;			/* Can it append to shared rows? */
+  size_t len;			/* Number of rows. */
+  size_t cap;			/* Number of rows allocated. */
+  int **cols;
+  size_t *slots;		/* Row plus one, or zero. */
+  size_t nslots;		/* A power of two, or zero when unbuilt. */
+  struct dl_fs_index **index;	/* Column indexes, or null. */
+  int *tuple;			/* Scratch space for a row. */
+  unsigned *scans;		/* Unindexed searches on each column. */
+  const int **bound;		/* Columns compared by a scan. */
+  int *syms;			/* The constants they are compared to. */
+  int *hits;			/* Rows selected by a scan. */
+  size_t caphits;
+} dl_factstore_t;
+
+/* Returns the fact store at idx, or the null pointer when the value
+   there is not one. */
+dl_factstore_t *dl_tofactstore(lua_State *L, int idx);
+
+/* Returns the rows of a store with a new reference to them, sharing
+   them from now on, or the null pointer when out of memory.  The
+   holder sees the rows the store has now. */
+dl_fs_rows_t *dl_fs_share(dl_factstore_t *s);
+
+/* Drops a reference to shared rows, freeing them with the last one. */
+void dl_fs_release(dl_fs_rows_t *r);
+
+/* Pushes a new fact store holding the first len shared rows.  It
+   takes a new reference to them. */
+dl_factstore_t *dl_fs_push(lua_State *L, dl_fs_rows_t *r, size_t len);
+
+/* Registers the Lua function dl_factstore, which makes a fact store
+   for the arity given.  It is called before the Lua program is
+   loaded. */
+int dl_factstores(lua_State *L);
+
+/* Rules encoded as an array of integers.  Each rule is the number of
+   its literals, head first, and then for each literal, the index of
+   the name of its predicate in names, its arity, and its terms, which
+   are constant symbols, or negative variable symbols.  Versions of a
+   database and images hold their rules this way. */
+typedef struct {
+  int refs;			/* Versions holding the rules. */
+  unsigned long serial;		/* Tells rules apart. */
+  int *code;
+  size_t len, cap;
+  char **names;			/* Names may contain zeros. */
+  size_t *lens;
+  int nnames, capnames;
+} dl_rules_t;
+
+/* Encodes the array of clauses at idx, returning the null pointer
+   when out of memory.  The rules have one reference. */
+dl_rules_t *dl_rules_encode(lua_State *L, int idx);
+
+/* Pushes an array of the rules, each an array of literals, head
+   first, that have the name of their predicate, and the symbols of
+   their terms, as dl_refresh expects them.
+
+   Stack: ... -> ... rules */
+void dl_rules_push(lua_State *L, const dl_rules_t *r);
+
+void dl_rules_free(dl_rules_t *r);
+
+/* Functions run as protected Lua calls that publish versions of a
+   database to its replicas, which are databases in other Lua states.
+   See replica.c.
+
+   dl_family returns the family of the database as a light userdata,
+   making one when the database has none.  dl_join takes a family as
+   a light userdata, and makes the database one of its replicas.
+   dl_publish_version makes the facts and rules of the database the
+   current version of its family, and dl_refresh_version installs
+   that version in a replica, unless it is the version installed. */
+int dl_family(lua_State *L);
+int dl_join(lua_State *L);
+int dl_publish_version(lua_State *L);
+int dl_refresh_version(lua_State *L);
+
+/* Functions run as protected Lua calls that save a database to an
+   image file, and load one, given the name of the file.  See
+   image.c. */
+int dl_image_save(lua_State *L);
+int dl_image_load(lua_State *L);
+
+/* Makes the native versions of unify, subst, shuffle, rename and
+   friends.  It is registered as the Lua function dl_kernels before
+   the Lua program is loaded.  See kernels.c. */
+int dl_kernels(lua_State *L);
+
+#endif
@@ -0,0 +1,1071 @@
+/*
+ * A columnar store for the ground facts asserted into the database of
+ * the Datalog interpreter written in Lua.
+ *
+ * Copyright (C) Alexander Hoffman, 2017
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
+ */
+
+/* A fact store holds the facts of one predicate.  A fact is stored as
+   one row of integers, the symbols of its constants, and each argument
+   position is a column, an array of the symbols at that position in
+   every row.  An open addressing hash table of row numbers plus one
+   removes duplicates.  Rows are kept contiguous: removing a fact moves
+   the last row into its place.
+
+   A literal with constants is first answered by scanning the columns
+   at their positions, comparing several rows at once with SSE2 or
+   AVX2 instructions when the processor has them.  The kernel is
+   chosen when the store is registered.  After FS_SCANS scans of a
+   column, or when its number of distinct symbols is asked for, the
+   column is indexed, and later searches probe the index instead.  The
+   index maps a symbol to the number of rows that have it in the
+   column, and to a doubly linked chain of those rows, so a row can be
+   unlinked when it is removed or moved.  Stores searched rarely thus
+   take no memory for indexes.
+
+   The Lua program makes the facts of a search from the symbols of
+   the rows that match, using a table that maps each symbol to its
+   constant.  The store adds the constants of the facts added to it to
+   the table.
+
+   Copying a store shares its rows instead of copying them, and so
+   does publishing a version of a database for its replicas.  The
+   column arrays are then held by a reference counted dl_fs_rows_t,
+   and each holder keeps the number of rows it sees.  The store that
+   shared them goes on appending rows in place, past the rows seen by
+   the others, until the arrays are full, so a database can keep
+   adding facts while its replicas read the versions it published.
+   Removing a row moves another, so it copies shared rows first, as
+   does adding a row to them from any other store.  Rows whose
+   columns are owned by a database image are always copied before
+   they change, as the image is read only.  Hash tables and
+   indexes are not shared.  A store holding shared rows builds its
+   hash table when it first needs it, and its indexes while
+   searching, as every store does. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <lua.h>
+#include <lauxlib.h>
+#include "datalog.h"
+#include "dl_native.h"
+
+#if !defined _WIN32
+#define FS_THREADS
+#include <pthread.h>
+#endif
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+#define FS_X86
+#include <immintrin.h>
+#endif
+
+#define FS_MT "datalog factstore"
+
+#define FS_SCANS 8		/* Scans of a column before indexing it. */
+
+/* Shared rows may be held by stores in other threads. */
+#if defined __GNUC__
+#define FS_INCR(p) __atomic_add_fetch(p, 1, __ATOMIC_RELAXED)
+#define FS_DECR(p) __atomic_sub_fetch(p, 1, __ATOMIC_ACQ_REL)
+#define FS_LOAD(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#else
+#define FS_INCR(p) (++*(p))
+#define FS_DECR(p) (--*(p))
+#define FS_LOAD(p) (*(p))
+#endif
+
+static size_t
+fs_mix(size_t h, size_t v)
+{
+  h = (h ^ v) * (size_t)0x9e3779b1u;
+  return h ^ (h >> 15);
+}
+
+static size_t
+fs_hash(const int *t, int arity)
+{
+  size_t h = (size_t)arity;
+  int i;
+  for (i = 0; i < arity; i++)
+    h = fs_mix(h, (size_t)(unsigned)t[i]);
+  return h;
+}
+
+/* Column indexes */
+
+typedef struct {
+  int sym;			/* Zero when the slot is free. */
+  int head;			/* First row of the chain. */
+  int count;			/* Rows in the chain. */
+} fs_entry_t;
+
+typedef struct dl_fs_index fs_index_t;
+
+struct dl_fs_index {
+  fs_entry_t *slots;
+  size_t nslots;		/* A power of two. */
+  size_t len;			/* Number of symbols. */
+  int *next, *prev;		/* Chain links of each row, or -1. */
+};
+
+static size_t
+fs_symhash(int sym)
+{
+  return fs_mix(0, (size_t)(unsigned)sym);
+}
+
+/* Returns the slot where a symbol is or would be stored. */
+static size_t
+fs_index_slot(const fs_index_t *x, int sym)
+{
+  size_t i, mask = x->nslots - 1;
+  for (i = fs_symhash(sym) & mask; x->slots[i].sym;
+       i = (i + 1) & mask)
+    if (x->slots[i].sym == sym)
+      break;
+  return i;
+}
+
+static int
+fs_index_grow(fs_index_t *x)
+{
+  size_t i, n = x->nslots ? 2 * x->nslots : 16;
+  fs_entry_t *old = x->slots;
+  size_t nold = x->nslots;
+  x->slots = (fs_entry_t *)calloc(n, sizeof(fs_entry_t));
+  if (!x->slots) {
+    x->slots = old;
+    return -1;
+  }
+  x->nslots = n;
+  for (i = 0; i < nold; i++)
+    if (old[i].sym)
+      x->slots[fs_index_slot(x, old[i].sym)] = old[i];
+  free(old);
+  return 0;
+}
+
+/* Removes the entry in slot i, shifting back the entries that follow
+   it in its cluster. */
+static void
+fs_index_delete(fs_index_t *x, size_t i)
+{
+  size_t j = i, k, mask = x->nslots - 1;
+  for (;;) {
+    j = (j + 1) & mask;
+    if (!x->slots[j].sym)
+      break;
+    k = fs_symhash(x->slots[j].sym) & mask;
+    if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+      continue;			/* The entry is where it belongs. */
+    x->slots[i] = x->slots[j];
+    i = j;
+  }
+  x->slots[i].sym = 0;
+  x->len--;
+}
+
+static void
+fs_index_free(fs_index_t *x)
+{
+  if (x) {
+    free(x->slots);
+    free(x->next);
+    free(x->prev);
+    free(x);
+  }
+}
+
+/* Selection kernels
+
+   A kernel selects the rows below len whose column bound[k] holds
+   syms[k] for every k below n, where n is at least one, and writes
+   their numbers to hits.  It returns the number of rows selected. */
+
+typedef size_t fs_select_t(const int **bound, const int *syms, int n,
+			   size_t len, int *hits);
+
+/* Selects from the rows starting at row, after m rows were selected
+   before it. */
+static size_t
+fs_select_rest(const int **bound, const int *syms, int n, size_t row,
+	       size_t len, int *hits, size_t m)
+{
+  int k;
+  for (; row < len; row++) {
+    for (k = 0; k < n && bound[k][row] == syms[k]; k++);
+    if (k == n)
+      hits[m++] = (int)row;
+  }
+  return m;
+}
+
+static size_t
+fs_select_scalar(const int **bound, const int *syms, int n, size_t len,
+		 int *hits)
+{
+  return fs_select_rest(bound, syms, n, 0, len, hits, 0);
+}
+
+#if defined FS_X86
+
+/* The vector kernels compare a block of rows of each column, and turn
+   the lanes that matched in every column into a bit mask, the bits of
+   which are the rows selected. */
+
+__attribute__((target("sse2")))
+static size_t
+fs_select_sse2(const int **bound, const int *syms, int n, size_t len,
+	       int *hits)
+{
+  size_t row, m = 0;
+  int k;
+  for (row = 0; row + 4 <= len; row += 4) {
+    __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)
+						 (bound[0] + row)),
+				 _mm_set1_epi32(syms[0]));
+    unsigned bits;
+    for (k = 1; k < n; k++)
+      eq = _mm_and_si128(eq, _mm_cmpeq_epi32(_mm_loadu_si128
+					     ((const __m128i *)
+					      (bound[k] + row)),
+					     _mm_set1_epi32(syms[k])));
+    bits = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(eq));
+    for (; bits; bits &= bits - 1)
+      hits[m++] = (int)row + __builtin_ctz(bits);
+  }
+  return fs_select_rest(bound, syms, n, row, len, hits, m);
+}
+
+__attribute__((target("avx2")))
+static size_t
+fs_select_avx2(const int **bound, const int *syms, int n, size_t len,
+	       int *hits)
+{
+  size_t row, m = 0;
+  int k;
+  for (row = 0; row + 8 <= len; row += 8) {
+    __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)
+						       (bound[0] + row)),
+				    _mm256_set1_epi32(syms[0]));
+    unsigned bits;
+    for (k = 1; k < n; k++)
+      eq = _mm256_and_si256(eq, _mm256_cmpeq_epi32(_mm256_loadu_si256
+						   ((const __m256i *)
+						    (bound[k] + row)),
+						   _mm256_set1_epi32(syms[k])));
+    bits = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(eq));
+    for (; bits; bits &= bits - 1)
+      hits[m++] = (int)row + __builtin_ctz(bits);
+  }
+  return fs_select_rest(bound, syms, n, row, len, hits, m);
+}
+
+#endif
+
+static fs_select_t *fs_select = fs_select_scalar;
+static const char *fs_kernel = "scalar";
+
+/* Picks the fastest kernel the processor supports. */
+static void
+fs_select_init(void)
+{
+#if defined FS_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    fs_select = fs_select_avx2;
+    fs_kernel = "avx2";
+  }
+  else if (__builtin_cpu_supports("sse2")) {
+    fs_select = fs_select_sse2;
+    fs_kernel = "sse2";
+  }
+#endif
+}
+
+/* The kernel is shared by the stores of every Lua state, which may be
+   opened by several threads, so it is picked once. */
+static void
+fs_select_once(void)
+{
+#if defined FS_THREADS
+  static pthread_once_t once = PTHREAD_ONCE_INIT;
+  pthread_once(&once, fs_select_init);
+#else
+  static int picked = 0;
+  if (!picked) {
+    fs_select_init();
+    picked = 1;
+  }
+#endif
+}
+
+/* The store */
+
+static size_t
+fs_row_hash(const dl_factstore_t *s, size_t row)
+{
+  size_t h = (size_t)s->arity;
+  int j;
+  for (j = 0; j < s->arity; j++)
+    h = fs_mix(h, (size_t)(unsigned)s->cols[j][row]);
+  return h;
+}
+
+static int
+fs_row_equals(const dl_factstore_t *s, size_t row, const int *t)
+{
+  int j;
+  for (j = 0; j < s->arity; j++)
+    if (s->cols[j][row] != t[j])
+      return 0;
+  return 1;
+}
+
+/* Returns the slot where a tuple is or would be stored. */
+static size_t
+fs_slot(const dl_factstore_t *s, const int *t, size_t h)
+{
+  size_t i, r, mask = s->nslots - 1;
+  for (i = h & mask; (r = s->slots[i]) != 0; i = (i + 1) & mask)
+    if (fs_row_equals(s, r - 1, t))
+      break;
+  return i;
+}
+
+static int
+fs_rehash(dl_factstore_t *s, size_t n)
+{
+  size_t i, row, *slots = (size_t *)calloc(n, sizeof(size_t));
+  if (!slots)
+    return -1;
+  free(s->slots);
+  s->slots = slots;
+  s->nslots = n;
+  for (row = 0; row < s->len; row++) {
+    for (i = fs_row_hash(s, row) & (n - 1); s->slots[i];
+	 i = (i + 1) & (n - 1));
+    s->slots[i] = row + 1;
+  }
+  return 0;
+}
+
+/* Builds the hash table of a store that has rows but no table, as
+   stores holding shared rows start. */
+static int
+fs_hashed(dl_factstore_t *s)
+{
+  size_t n = 16;
+  if (s->nslots || !s->len)
+    return 0;
+  while (n < 2 * (s->len + 1))
+    n *= 2;
+  return fs_rehash(s, n);
+}
+
+/* Makes room for one more row. */
+static int
+fs_reserve(dl_factstore_t *s)
+{
+  int j;
+  if (2 * (s->len + 1) > s->nslots
+      && fs_rehash(s, s->nslots ? 2 * s->nslots : 16))
+    return -1;
+  if (s->len == s->cap) {
+    size_t cap = s->cap ? 2 * s->cap : 16;
+    for (j = 0; j < s->arity; j++) {
+      int *col = (int *)realloc(s->cols[j], cap * sizeof(int));
+      if (!col)
+	return -1;
+      s->cols[j] = col;
+    }
+    for (j = 0; j < s->arity; j++) {
+      fs_index_t *x = s->index[j];
+      int *next, *prev;
+      if (!x)
+	continue;
+      next = (int *)realloc(x->next, cap * sizeof(int));
+      if (next)
+	x->next = next;
+      prev = (int *)realloc(x->prev, cap * sizeof(int));
+      if (prev)
+	x->prev = prev;
+      if (!next || !prev)
+	return -1;
+    }
+    s->cap = cap;
+  }
+  return 0;
+}
+
+/* Adds row to the chain of its symbol in column j. */
+static void
+fs_link(dl_factstore_t *s, int j, int row)
+{
+  fs_index_t *x = s->index[j];
+  int sym = s->cols[j][row];
+  fs_entry_t *e = &x->slots[fs_index_slot(x, sym)];
+  if (!e->sym) {
+    e->sym = sym;
+    e->head = -1;
+    e->count = 0;
+    x->len++;
+  }
+  x->prev[row] = -1;
+  x->next[row] = e->head;
+  if (e->head >= 0)
+    x->prev[e->head] = row;
+  e->head = row;
+  e->count++;
+}
+
+static void
+fs_unlink(dl_factstore_t *s, int j, int row)
+{
+  fs_index_t *x = s->index[j];
+  size_t i = fs_index_slot(x, s->cols[j][row]);
+  fs_entry_t *e = &x->slots[i];
+  if (x->prev[row] >= 0)
+    x->next[x->prev[row]] = x->next[row];
+  else
+    e->head = x->next[row];
+  if (x->next[row] >= 0)
+    x->prev[x->next[row]] = x->prev[row];
+  if (--e->count == 0)
+    fs_index_delete(x, i);
+}
+
+/* Makes the chains that led to row from lead to row to instead. */
+static void
+fs_relink(dl_factstore_t *s, int j, int from, int to)
+{
+  fs_index_t *x = s->index[j];
+  x->next[to] = x->next[from];
+  x->prev[to] = x->prev[from];
+  if (x->prev[to] >= 0)
+    x->next[x->prev[to]] = to;
+  else
+    x->slots[fs_index_slot(x, s->cols[j][from])].head = to;
+  if (x->next[to] >= 0)
+    x->prev[x->next[to]] = to;
+}
+
+/* Returns the index of column j, building it when needed. */
+static fs_index_t *
+fs_index(dl_factstore_t *s, int j)
+{
+  fs_index_t *x = s->index[j];
+  size_t row;
+  if (x)
+    return x;
+  x = (fs_index_t *)calloc(1, sizeof(fs_index_t));
+  if (!x)
+    return NULL;
+  x->next = (int *)malloc((s->cap ? s->cap : 1) * sizeof(int));
+  x->prev = (int *)malloc((s->cap ? s->cap : 1) * sizeof(int));
+  if (!x->next || !x->prev || fs_index_grow(x)) {
+    fs_index_free(x);
+    return NULL;
+  }
+  s->index[j] = x;
+  for (row = 0; row < s->len; row++) {
+    if (2 * (x->len + 1) > x->nslots && fs_index_grow(x)) {
+      s->index[j] = NULL;
+      fs_index_free(x);
+      return NULL;
+    }
+    fs_link(s, j, (int)row);
+  }
+  return x;
+}
+
+/* Shared rows */
+
+void
+dl_fs_release(dl_fs_rows_t *r)
+{
+  int j;
+  if (r && FS_DECR(&r->refs) == 0) {
+    if (r->owner)
+      r->release(r->owner);
+    else
+      for (j = 0; j < r->arity; j++)
+	free(r->cols[j]);
+    free(r->cols);
+    free(r);
+  }
+}
+
+dl_fs_rows_t *
+dl_fs_share(dl_factstore_t *s)
+{
+  dl_fs_rows_t *r = s->rows;
+  int j;
+  if (!r) {
+    r = (dl_fs_rows_t *)malloc(sizeof(dl_fs_rows_t));
+    if (!r)
+      return NULL;
+    r->cols = (int **)malloc((s->arity + 1) * sizeof(int *));
+    if (!r->cols) {
+      free(r);
+      return NULL;
+    }
+    for (j = 0; j < s->arity; j++)
+      r->cols[j] = s->cols[j];
+    r->refs = 1;
+    r->arity = s->arity;
+    r->cap = s->cap;
+    r->owner = NULL;
+    r->release = NULL;
+    s->rows = r;
+    s->appends = 1;
+  }
+  FS_INCR(&r->refs);
+  return r;
+}
+
+/* Makes a store without rows hold the first len shared rows, taking
+   over a reference to them.  Its hash table is built when needed. */
+static void
+fs_attach(dl_factstore_t *s, dl_fs_rows_t *r, size_t len)
+{
+  int j;
+  s->rows = r;
+  for (j = 0; j < s->arity; j++)
+    s->cols[j] = r->cols[j];
+  s->len = len;
+  s->cap = r->cap;
+}
+
+/* Makes the rows of a store its own before it changes them, unless it
+   appends a row in place.  They are copied unless the store holds the
+   last reference to them. */
+static int
+fs_own(dl_factstore_t *s, int append)
+{
+  dl_fs_rows_t *r = s->rows;
+  int **cols;
+  int j, ok;
+  if (!r)
+    return 0;
+  if (FS_LOAD(&r->refs) == 1 && !r->owner) { /* Take them back. */
+    free(r->cols);
+    free(r);
+    s->rows = NULL;
+    s->appends = 0;
+    return 0;
+  }
+  if (append && s->appends && s->len < s->cap)
+    return 0;
+  cols = (int **)calloc(s->arity + 1, sizeof(int *));
+  ok = cols != NULL;
+  for (j = 0; ok && j < s->arity; j++) {
+    cols[j] = (int *)malloc((s->cap ? s->cap : 1) * sizeof(int));
+    ok = cols[j] != NULL;
+  }
+  if (!ok) {
+    if (cols)
+      for (j = 0; j < s->arity; j++)
+	free(cols[j]);
+    free(cols);
+    return -1;
+  }
+  for (j = 0; j < s->arity; j++) {
+    memcpy(cols[j], s->cols[j], s->len * sizeof(int));
+    s->cols[j] = cols[j];
+  }
+  free(cols);
+  s->rows = NULL;
+  s->appends = 0;
+  dl_fs_release(r);
+  return 0;
+}
+
+/* Adds a tuple.  Returns 1 when added, 0 when already present, and
+   -1 when out of memory. */
+static int
+fs_add(dl_factstore_t *s, const int *t)
+{
+  size_t h = fs_hash(t, s->arity), i;
+  int j;
+  if (fs_hashed(s))
+    return -1;
+  if (s->nslots && s->slots[fs_slot(s, t, h)])
+    return 0;
+  if (fs_own(s, 1) || fs_reserve(s))
+    return -1;
+  for (j = 0; j < s->arity; j++) {
+    fs_index_t *x = s->index[j];
+    if (x && 2 * (x->len + 1) > x->nslots && fs_index_grow(x))
+      return -1;
+  }
+  i = fs_slot(s, t, h);
+  for (j = 0; j < s->arity; j++)
+    s->cols[j][s->len] = t[j];
+  s->slots[i] = ++s->len;
+  for (j = 0; j < s->arity; j++)
+    if (s->index[j])
+      fs_link(s, j, (int)s->len - 1);
+  return 1;
+}
+
+/* Removes the row in slot i of the hash table. */
+static void
+fs_delete_slot(dl_factstore_t *s, size_t i)
+{
+  size_t j = i, k, mask = s->nslots - 1;
+  for (;;) {
+    j = (j + 1) & mask;
+    if (!s->slots[j])
+      break;
+    k = fs_row_hash(s, s->slots[j] - 1) & mask;
+    if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+      continue;
+    s->slots[i] = s->slots[j];
+    i = j;
+  }
+  s->slots[i] = 0;
+}
+
+/* Removes a tuple.  Returns 1 when removed, 0 when absent, and -1
+   when out of memory. */
+static int
+fs_remove(dl_factstore_t *s, const int *t)
+{
+  size_t i, row, last;
+  int j;
+  if (fs_hashed(s))
+    return -1;
+  if (!s->nslots)
+    return 0;
+  i = fs_slot(s, t, fs_hash(t, s->arity));
+  if (!s->slots[i])
+    return 0;
+  if (fs_own(s, 0))
+    return -1;
+  row = s->slots[i] - 1;
+  last = s->len - 1;
+  fs_delete_slot(s, i);
+  for (j = 0; j < s->arity; j++)
+    if (s->index[j])
+      fs_unlink(s, j, (int)row);
+  if (row != last) {		/* Move the last row into the hole. */
+    size_t k;
+    for (j = 0; j < s->arity; j++)
+      s->tuple[j] = s->cols[j][last];
+    k = fs_slot(s, s->tuple, fs_hash(s->tuple, s->arity));
+    s->slots[k] = row + 1;
+    for (j = 0; j < s->arity; j++)
+      if (s->index[j])
+	fs_relink(s, j, (int)last, (int)row);
+    for (j = 0; j < s->arity; j++)
+      s->cols[j][row] = s->tuple[j];
+  }
+  s->len--;
+  return 1;
+}
+
+static void
+fs_free(dl_factstore_t *s)
+{
+  int j;
+  for (j = 0; j < s->arity; j++) {
+    if (!s->rows)
+      free(s->cols[j]);
+    fs_index_free(s->index[j]);
+  }
+  dl_fs_release(s->rows);
+  free(s->slots);
+  free(s->cols);
+  free(s->index);
+  free(s->tuple);
+  free(s->scans);
+  free(s->bound);
+  free(s->syms);
+  free(s->hits);
+}
+
+/* Lua interface */
+
+dl_factstore_t *
+dl_tofactstore(lua_State *L, int idx)
+{
+  void *p = lua_touserdata(L, idx);
+  int is;
+  if (!p || !lua_getmetatable(L, idx))
+    return NULL;
+  luaL_getmetatable(L, FS_MT);
+  is = lua_rawequal(L, -1, -2);
+  lua_pop(L, 2);
+  return is ? (dl_factstore_t *)p : NULL;
+}
+
+static dl_factstore_t *
+fs_check(lua_State *L)
+{
+  dl_factstore_t *s = dl_tofactstore(L, 1);
+  if (!s)
+    luaL_error(L, "fact store expected");
+  return s;
+}
+
+static dl_factstore_t *
+fs_new(lua_State *L, int arity)
+{
+  dl_factstore_t *s;
+  s = (dl_factstore_t *)lua_newuserdata(L, sizeof(dl_factstore_t));
+  memset(s, 0, sizeof(dl_factstore_t));
+  luaL_getmetatable(L, FS_MT);
+  lua_setmetatable(L, -2);
+  s->cols = (int **)calloc(arity + 1, sizeof(int *));
+  s->index = (fs_index_t **)calloc(arity + 1, sizeof(fs_index_t *));
+  s->tuple = (int *)malloc((arity + 1) * sizeof(int));
+  s->scans = (unsigned *)calloc(arity + 1, sizeof(unsigned));
+  s->bound = (const int **)malloc((arity + 1) * sizeof(const int *));
+  s->syms = (int *)malloc((arity + 1) * sizeof(int));
+  if (!s->cols || !s->index || !s->tuple || !s->scans || !s->bound
+      || !s->syms)
+    luaL_error(L, "not enough memory");
+  s->arity = arity;
+  return s;
+}
+
+/* Reads the symbols of the literal at idx into the store's tuple.
+   Returns the number of variables in the literal. */
+static int
+fs_read(lua_State *L, dl_factstore_t *s, int idx)
+{
+  int j, vars = 0;
+  if ((int)lua_rawlen(L, idx) != s->arity)
+    luaL_error(L, "literal does not match the arity of the fact store");
+  for (j = 0; j < s->arity; j++) {
+    lua_rawgeti(L, idx, j + 1);
+    lua_pushliteral(L, "sym");
+    lua_rawget(L, -2);
+    s->tuple[j] = (int)lua_tointeger(L, -1);
+    if (s->tuple[j] <= 0)
+      vars++;
+    lua_pop(L, 2);
+  }
+  return vars;
+}
+
+/* store:add(literal, consts) adds a ground literal, and returns true
+   when it was not already present. */
+static int
+fs_l_add(lua_State *L)
+{
+  dl_factstore_t *s = fs_check(L);
+  int j, added;
+  if (fs_read(L, s, 2))
+    return luaL_error(L, "only ground facts can be stored");
+  added = fs_add(s, s->tuple);
+  if (added < 0)
+    return luaL_error(L, "not enough memory");
+  if (added && lua_istable(L, 3))
+    for (j = 0; j < s->arity; j++) {
+      lua_rawgeti(L, 2, j + 1);
+      lua_rawseti(L, 3, s->tuple[j]);
+    }
+  lua_pushboolean(L, added);
+  return 1;
+}
+
+/* store:remove(literal) returns true when the literal was removed. */
+static int
+fs_l_remove(lua_State *L)
+{
+  dl_factstore_t *s = fs_check(L);
+  int removed = 0;
+  if (!fs_read(L, s, 2))
+    removed = fs_remove(s, s->tuple);
+  if (removed < 0)
+    return luaL_error(L, "not enough memory");
+  lua_pushboolean(L, removed);
+  return 1;
+}
+
+/* store:has(literal) */
+static int
+fs_l_has(lua_State *L)
+{
+  dl_factstore_t *s = fs_check(L);
+  int has = 0;
+  if (fs_hashed(s))
+    return luaL_error(L, "not enough memory");
+  if (!fs_read(L, s, 2) && s->nslots)
+    has = s->slots[fs_slot(s, s->tuple, fs_hash(s->tuple, s->arity))]
+      != 0;
+  lua_pushboolean(L, has);
+  return 1;
+}
+
+/* store:count() */
+static int
+fs_l_count(lua_State *L)
+{
+  dl_factstore_t *s = fs_check(L);
+  lua_pushinteger(L, (lua_Integer)s->len);
+  return 1;
+}
+
+/* store:distinct(i) returns the number of distinct constants at
+   position i. */
+static int
+fs_l_distinct(lua_State *L)
+{
+  dl_factstore_t *s = fs_check(L);
+  int j = (int)luaL_checkinteger(L, 2) - 1;
+  fs_index_t *x;
+  if (j < 0 || j >= s->arity)
+    return luaL_error(L, "bad position");
+  x = fs_index(s, j);
+  if (!x)
+    return luaL_error(L, "not enough memory");
+  lua_pushinteger(L, (lua_Integer)x->len);
+  return 1;
+}
+
+/* Pushes the fact in a row, with the predicate of the literal at idx,
+   and the constants in the table at consts.  In a replica, the table
+   makes the constants of symbols it has not seen when they are looked
+   up, so a raw miss is retried through its metatable. */
+static void
+fs_push_fact(lua_State *L, dl_factstore_t *s, size_t row, int idx,
+	     int consts)
+{
+  int j;
+  lua_createtable(L, s->arity, 1);
+  lua_pushliteral(L, "pred");
+  lua_pushliteral(L, "pred");
+  lua_rawget(L, idx);
+  lua_rawset(L, -3);
+  for (j = 0; j < s->arity; j++) {
+    lua_rawgeti(L, consts, s->cols[j][row]);
+    if (lua_isnil(L, -1)) {
+      lua_pop(L, 1);
+      lua_pushinteger(L, s->cols[j][row]);
+      lua_gettable(L, consts);
+    }
+    lua_rawseti(L, -2, j + 1);
+  }
+}
+
+/* Does a row match the literal read into the tuple?  Constants must be
+   equal, and so must the rows at the positions of a repeated
+   variable. */
+static int
+fs_matches(const dl_factstore_t *s, size_t row)
+{
+  int i, j;
+  for (j = 0; j < s->arity; j++) {
+    int sym = s->tuple[j];
+    if (sym > 0) {
+      if (s->cols[j][row] != sym)
+	return 0;
+    }
+    else
+      for (i = 0; i < j; i++)
+	if (s->tuple[i] == sym && s->cols[i][row] != s->cols[j][row])
+	  return 0;
+  }
+  return 1;
+}
+
+/* store:search(literal, consts) returns an array of the stored facts
+   that match the literal. */
+static int
+fs_l_search(lua_State *L)
+{
+  dl_factstore_t *s = fs_check(L);
+  fs_entry_t *best = NULL;
+  int j, n = 0, nbound = 0, probe = 0;
+  lua_settop(L, 3);
+  fs_read(L, s, 2);
+  for (j = 0; j < s->arity; j++) {
+    fs_index_t *x;
+    fs_entry_t *e;
+    if (s->tuple[j] <= 0)
+      continue;
+    s->bound[nbound] = s->cols[j];
+    s->syms[nbound++] = s->tuple[j];
+    x = s->index[j];
+    if (!x && s->scans[j] >= FS_SCANS) {
+      x = fs_index(s, j);
+      if (!x)
+	return luaL_error(L, "not enough memory");
+    }
+    if (!x)
+      continue;
+    e = &x->slots[fs_index_slot(x, s->tuple[j])];
+    if (!e->sym) {		/* No row has the constant. */
+      lua_newtable(L);
+      return 1;
+    }
+    if (!best || e->count < best->count) {
+      best = e;
+      probe = j;
+    }
+  }
+  if (best) {			/* Probe. */
+    fs_index_t *x = s->index[probe];
+    int row;
+    lua_createtable(L, best->count, 0);
+    for (row = best->head; row >= 0; row = x->next[row])
+      if (fs_matches(s, row)) {
+	fs_push_fact(L, s, row, 2, 3);
+	lua_rawseti(L, -2, ++n);
+      }
+  }
+  else if (nbound) {		/* Select, and then check the rest. */
+    size_t i, m;
+    if (s->caphits < s->len) {
+      int *hits = (int *)realloc(s->hits, s->len * sizeof(int));
+      if (!hits)
+	return luaL_error(L, "not enough memory");
+      s->hits = hits;
+      s->caphits = s->len;
+    }
+    for (j = 0; j < s->arity; j++)
+      if (s->tuple[j] > 0)
+	s->scans[j]++;
+    m = fs_select(s->bound, s->syms, nbound, s->len, s->hits);
+    lua_createtable(L, (int)m, 0);
+    for (i = 0; i < m; i++)
+      if (fs_matches(s, s->hits[i])) {
+	fs_push_fact(L, s, s->hits[i], 2, 3);
+	lua_rawseti(L, -2, ++n);
+      }
+  }
+  else {			/* Scan. */
+    size_t row;
+    lua_createtable(L, (int)s->len, 0);
+    for (row = 0; row < s->len; row++)
+      if (fs_matches(s, row)) {
+	fs_push_fact(L, s, row, 2, 3);
+	lua_rawseti(L, -2, ++n);
+      }
+  }
+  return 1;
+}
+
+dl_factstore_t *
+dl_fs_push(lua_State *L, dl_fs_rows_t *r, size_t len)
+{
+  dl_factstore_t *s = fs_new(L, r->arity);
+  FS_INCR(&r->refs);
+  fs_attach(s, r, len);
+  return s;
+}
+
+/* store:copy() returns a store that shares the rows of this one until
+   either changes. */
+static int
+fs_l_copy(lua_State *L)
+{
+  dl_factstore_t *s = fs_check(L);
+  dl_factstore_t *c = fs_new(L, s->arity);
+  dl_fs_rows_t *r = dl_fs_share(s);
+  if (!r)
+    return luaL_error(L, "not enough memory");
+  fs_attach(c, r, s->len);
+  return 1;
+}
+
+/* store:mark(marks) sets the symbol of each constant in the rows to
+   true in the table marks.  Runs of a symbol in a column are marked
+   once. */
+static int
+fs_l_mark(lua_State *L)
+{
+  dl_factstore_t *s = fs_check(L);
+  size_t row;
+  int j;
+  luaL_checktype(L, 2, LUA_TTABLE);
+  for (j = 0; j < s->arity; j++)
+    for (row = 0; row < s->len; row++)
+      if (!row || s->cols[j][row] != s->cols[j][row - 1]) {
+	lua_pushboolean(L, 1);
+	lua_rawseti(L, 2, s->cols[j][row]);
+      }
+  return 0;
+}
+
+/* store:kernel() returns the name of the selection kernel in use. */
+static int
+fs_l_kernel(lua_State *L)
+{
+  fs_check(L);
+  lua_pushstring(L, fs_kernel);
+  return 1;
+}
+
+static int
+fs_l_gc(lua_State *L)
+{
+  dl_factstore_t *s = dl_tofactstore(L, 1);
+  if (s)
+    fs_free(s);
+  return 0;
+}
+
+static const luaL_Reg fs_methods[] = {
+  {"add", fs_l_add},
+  {"remove", fs_l_remove},
+  {"has", fs_l_has},
+  {"count", fs_l_count},
+  {"distinct", fs_l_distinct},
+  {"search", fs_l_search},
+  {"copy", fs_l_copy},
+  {"mark", fs_l_mark},
+  {"kernel", fs_l_kernel},
+  {NULL, NULL}
+};
+
+/* dl_factstore(arity) returns a new, empty fact store. */
+static int
+fs_l_new(lua_State *L)
+{
+  int arity = (int)luaL_checkinteger(L, 1);
+  if (arity < 0)
+    return luaL_error(L, "bad arity");
+  fs_new(L, arity);
+  return 1;
+}
+
+int
+dl_factstores(lua_State *L)
+{
+  const luaL_Reg *m;
+  if (luaL_newmetatable(L, FS_MT)) {
+    fs_select_once();
+    lua_pushliteral(L, "__gc");
+    lua_pushcfunction(L, fs_l_gc);
+    lua_rawset(L, -3);
+    lua_pushliteral(L, "__index");
+    lua_newtable(L);
+    for (m = fs_methods; m->func; m++) {
+      lua_pushcfunction(L, m->func);
+      lua_setfield(L, -2, m->name);
+    }
+    lua_rawset(L, -3);
+  }
+  lua_pop(L, 1);
+  lua_register(L, "dl_factstore", fs_l_new);
+  return 0;
+}
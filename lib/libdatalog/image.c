@@ -0,0 +1,750 @@
+/*
+ * Saves databases to image files, and loads them by mapping the files
+ * into memory.
+ *
+ * Copyright (C) Alexander Hoffman, 2017
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
+ */
+
+/* An image holds the facts and rules of a database, and the ids of
+   the constants they use, laid out so that a database loading it
+   uses the file as it is mapped into memory.  The file starts with a
+   header giving the place of each part.  Every part starts at an
+   offset that is a multiple of the size of a size_t:
+
+     the id of each symbol, as the offset and length of a string;
+     the symbol table, an open addressing hash table of symbols
+       keyed by their ids, zero being empty;
+     each predicate with facts, with its name, arity, number of rows,
+       and the offset of its columns;
+     the names of the predicates used by the rules;
+     the rules, encoded as described for dl_rules_t;
+     the strings;
+     the columns of each predicate, one after the other.
+
+   An image is written with the symbols the database gave its
+   constants, and a database loading it numbers its constants with
+   the symbol table of the image, so the rows need no fix-up.  The
+   fact store of each predicate holds the columns of the file as
+   shared rows owned by the image, and copies them before changing
+   them, as it does any shared rows.  The constants of the symbols in
+   the rows are made when looked up.  Loading an image thus costs
+   time in the number of its predicates and rules, plus the time to
+   page in the parts of the file used, but not in the number of its
+   facts or constants.
+
+   An image is a cache for the kind of machine that wrote it.  The
+   header records the byte order and the sizes of the integers used,
+   and an image written by another kind of machine is refused. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <lua.h>
+#include <lauxlib.h>
+#include "datalog.h"
+#include "dl_native.h"
+
+#if !defined _WIN32
+#define IMG_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define IMG_MAGIC "DLIMAGE"	/* Eight characters with its zero. */
+#define IMG_VERSION 1
+#define IMG_ORDER 0x01020304
+#define IMG_MT "datalog image"
+#define IMG_SAVE_MT "datalog image writer"
+
+/* The image is held by the rows of stores in other threads. */
+#if defined __GNUC__
+#define IMG_INCR(p) __atomic_add_fetch(p, 1, __ATOMIC_RELAXED)
+#define IMG_DECR(p) __atomic_sub_fetch(p, 1, __ATOMIC_ACQ_REL)
+#else
+#define IMG_INCR(p) (++*(p))
+#define IMG_DECR(p) (--*(p))
+#endif
+
+#define IMG_ALIGN(n) (((n) + sizeof(size_t) - 1) & ~(sizeof(size_t) - 1))
+
+typedef struct {
+  char magic[8];
+  int version;
+  int order;			/* IMG_ORDER, telling the byte order. */
+  int intsize;			/* sizeof(int) */
+  int sizesize;			/* sizeof(size_t) */
+  size_t size;			/* Of the file. */
+  size_t nsyms;			/* Symbols are below nsyms. */
+  size_t ids;
+  size_t nslots;		/* A power of two. */
+  size_t slots;
+  size_t npreds;
+  size_t preds;
+  size_t nnames;
+  size_t names;
+  size_t ncode;
+  size_t code;
+} img_header_t;
+
+/* A string of the file.  The id of a symbol without one has an
+   offset of IMG_NONE. */
+typedef struct {
+  size_t off, len;
+} img_string_t;
+
+#define IMG_NONE ((size_t)-1)
+
+typedef struct {
+  img_string_t name;
+  size_t arity;
+  size_t nrows;
+  size_t cols;			/* Column j starts at cols + j * nrows ints. */
+} img_pred_t;
+
+/* A loaded image, held by the Lua state that loaded it through a
+   userdata, until the state stops using its symbol table, and by the
+   rows of the stores holding its columns. */
+typedef struct {
+  int refs;			/* Changed atomically. */
+  char *base;
+  size_t size;
+  int next;			/* Symbol of the next id not in the image. */
+} img_t;
+
+/* Loading */
+
+static void
+img_release(void *p)
+{
+  img_t *m = (img_t *)p;
+  if (IMG_DECR(&m->refs) == 0) {
+#if defined IMG_MMAP
+    munmap(m->base, m->size);
+#else
+    free(m->base);
+#endif
+    free(m);
+  }
+}
+
+static const img_header_t *
+img_header(const img_t *m)
+{
+  return (const img_header_t *)m->base;
+}
+
+/* Is there room for n items of the given size at off? */
+static int
+img_fits(const img_t *m, size_t off, size_t n, size_t size)
+{
+  return off % sizeof(size_t) == 0 && off <= m->size
+    && (size == 0 || n <= (m->size - off) / size);
+}
+
+/* Returns a string of the image, or the null pointer when it has
+   none or the string is not in the file. */
+static const char *
+img_string(const img_t *m, const img_string_t *s, size_t *n)
+{
+  if (s->off == IMG_NONE || s->off > m->size || s->len > m->size - s->off)
+    return NULL;
+  *n = s->len;
+  return m->base + s->off;
+}
+
+/* Returns the id of a symbol, or the null pointer when it has none. */
+static const char *
+img_name(const img_t *m, size_t sym, size_t *n)
+{
+  const img_header_t *h = img_header(m);
+  const img_string_t *ids = (const img_string_t *)(m->base + h->ids);
+  if (sym == 0 || sym >= h->nsyms)
+    return NULL;
+  return img_string(m, &ids[sym], n);
+}
+
+static size_t
+img_hash(const char *s, size_t n)
+{
+  size_t h = 5381;
+  while (n--)
+    h = h * 33 + (unsigned char)*s++;
+  return h;
+}
+
+/* Returns the symbol of an id, or zero when it is not in the image. */
+static int
+img_lookup(const img_t *m, const char *id, size_t n)
+{
+  const img_header_t *h = img_header(m);
+  const int *slots = (const int *)(m->base + h->slots);
+  size_t k, mask = h->nslots - 1;
+  size_t i = img_hash(id, n) & mask;
+  for (k = 0; k < h->nslots && slots[i]; k++, i = (i + 1) & mask) {
+    size_t len;
+    const char *s = img_name(m, (size_t)slots[i], &len);
+    if (s && len == n && !memcmp(s, id, n))
+      return slots[i];
+  }
+  return 0;
+}
+
+/* Is sym a symbol of the image with an id? */
+static int
+img_has(const img_t *m, int sym)
+{
+  size_t n;
+  return sym > 0 && img_name(m, (size_t)sym, &n) != NULL;
+}
+
+/* Checks that the parts of an image are in the file, and that its
+   columns and rules refer to symbols and names it has. */
+static const char *
+img_check(const img_t *m)
+{
+  const img_header_t *h = img_header(m);
+  const img_pred_t *preds;
+  const int *code;
+  size_t i, k, n;
+  if (m->size < sizeof(img_header_t) || memcmp(h->magic, IMG_MAGIC, 8))
+    return "not a database image";
+  if (h->version != IMG_VERSION)
+    return "unknown image version";
+  if (h->order != IMG_ORDER || h->intsize != (int)sizeof(int)
+      || h->sizesize != (int)sizeof(size_t))
+    return "image written by another kind of machine";
+  if (h->size != m->size || h->nsyms == 0 || h->nsyms > INT_MAX
+      || h->nslots == 0 || (h->nslots & (h->nslots - 1))
+      || !img_fits(m, h->ids, h->nsyms, sizeof(img_string_t))
+      || !img_fits(m, h->slots, h->nslots, sizeof(int))
+      || !img_fits(m, h->preds, h->npreds, sizeof(img_pred_t))
+      || !img_fits(m, h->names, h->nnames, sizeof(img_string_t))
+      || !img_fits(m, h->code, h->ncode, sizeof(int)))
+    return "bad image";
+  preds = (const img_pred_t *)(m->base + h->preds);
+  for (i = 0; i < h->npreds; i++)
+    if (!img_string(m, &preds[i].name, &n) || preds[i].arity > INT_MAX
+	|| (preds[i].arity
+	    && !img_fits(m, preds[i].cols, preds[i].nrows,
+			 preds[i].arity * sizeof(int))))
+      return "bad image";
+  for (i = 0; i < h->npreds; i++) {
+    const int *cols = (const int *)(m->base + preds[i].cols);
+    for (k = 0; k < preds[i].arity * preds[i].nrows; k++)
+      if (!img_has(m, cols[k]))
+	return "bad image";
+  }
+  for (i = 0; i < h->nnames; i++)
+    if (!img_string(m, (const img_string_t *)(m->base + h->names) + i, &n))
+      return "bad image";
+  code = (const int *)(m->base + h->code);
+  for (i = 0; i < h->ncode;) {	/* Each rule must fit. */
+    int j, nlits = code[i++];
+    if (nlits < 1)
+      return "bad image";
+    for (j = 0; j < nlits; j++) {
+      if (h->ncode - i < 2 || code[i] < 0 || (size_t)code[i] >= h->nnames
+	  || code[i + 1] < 0 || (size_t)code[i + 1] > h->ncode - i - 2)
+	return "bad image";
+      for (k = i + 2; k < i + 2 + (size_t)code[i + 1]; k++)
+	if (code[k] >= 0 && !img_has(m, code[k]))
+	  return "bad image";	/* Variables are negative. */
+      i += 2 + code[i + 1];
+    }
+  }
+  return NULL;
+}
+
+/* Reads a file into memory, by mapping it when possible.  Returns
+   the null pointer, setting *err, when it cannot. */
+static img_t *
+img_open(const char *path, const char **err)
+{
+  img_t *m = (img_t *)calloc(1, sizeof(img_t));
+#if defined IMG_MMAP
+  struct stat st;
+  int fd;
+  void *p = MAP_FAILED;
+  *err = "not enough memory";
+  if (!m)
+    return NULL;
+  *err = "cannot read the image";
+  fd = open(path, O_RDONLY);
+  if (fd >= 0) {
+    if (!fstat(fd, &st) && st.st_size >= (off_t)sizeof(img_header_t)) {
+      m->size = (size_t)st.st_size;
+      p = mmap(NULL, m->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    else if (!fstat(fd, &st))
+      *err = "not a database image";
+    close(fd);
+  }
+  if (p == MAP_FAILED) {
+    free(m);
+    return NULL;
+  }
+  m->base = (char *)p;
+#else
+  FILE *f;
+  long size;
+  *err = "not enough memory";
+  if (!m)
+    return NULL;
+  *err = "cannot read the image";
+  f = fopen(path, "rb");
+  if (!f || fseek(f, 0, SEEK_END) || (size = ftell(f)) < 0
+      || fseek(f, 0, SEEK_SET)
+      || !(m->base = (char *)malloc(size ? (size_t)size : 1))
+      || fread(m->base, 1, (size_t)size, f) != (size_t)size) {
+    if (f)
+      fclose(f);
+    free(m->base);
+    free(m);
+    return NULL;
+  }
+  fclose(f);
+  m->size = (size_t)size;
+#endif
+  m->refs = 1;
+  *err = img_check(m);
+  if (*err) {
+    img_release(m);
+    return NULL;
+  }
+  m->next = (int)img_header(m)->nsyms;
+  return m;
+}
+
+static int
+img_l_gc(lua_State *L)
+{
+  img_t **u = (img_t **)luaL_checkudata(L, 1, IMG_MT);
+  if (*u)
+    img_release(*u);
+  *u = NULL;
+  return 0;
+}
+
+/* symbol(id[, sym]) returns the symbol of an id in the image, or the
+   next free symbol past the image when the id is not in it. */
+static int
+img_l_symbol(lua_State *L)
+{
+  img_t *m = *(img_t **)lua_touserdata(L, lua_upvalueindex(1));
+  size_t n;
+  const char *id = luaL_checklstring(L, 1, &n);
+  int sym = img_lookup(m, id, n);
+  if (!sym) {
+    if (m->next == INT_MAX)
+      return luaL_error(L, "too many constants");
+    sym = m->next++;
+  }
+  lua_pushinteger(L, sym);
+  return 1;
+}
+
+/* name(sym) returns the id of a symbol of the image, or nil. */
+static int
+img_l_name(lua_State *L)
+{
+  img_t *m = *(img_t **)lua_touserdata(L, lua_upvalueindex(1));
+  lua_Integer sym = luaL_checkinteger(L, 1);
+  size_t n;
+  const char *id = sym > 0 ? img_name(m, (size_t)sym, &n) : NULL;
+  if (id)
+    lua_pushlstring(L, id, n);
+  else
+    lua_pushnil(L);
+  return 1;
+}
+
+/* Stack: ... image -> ... image preds
+
+   Makes a fact store over the columns of each predicate. */
+static void
+img_push_preds(lua_State *L, img_t *m)
+{
+  const img_header_t *h = img_header(m);
+  const img_pred_t *preds = (const img_pred_t *)(m->base + h->preds);
+  size_t i, n = 0;
+  int j;
+  lua_createtable(L, (int)h->npreds, 0);
+  for (i = 0; i < h->npreds; i++) {
+    const img_pred_t *p = &preds[i];
+    const char *name = img_string(m, &p->name, &n);
+    dl_fs_rows_t *r;
+    lua_createtable(L, 0, 3);
+    lua_pushlstring(L, name, n);
+    lua_setfield(L, -2, "name");
+    lua_pushinteger(L, (lua_Integer)p->arity);
+    lua_setfield(L, -2, "arity");
+    r = (dl_fs_rows_t *)malloc(sizeof(dl_fs_rows_t));
+    if (r)
+      r->cols = (int **)malloc((p->arity + 1) * sizeof(int *));
+    if (!r || !r->cols) {
+      free(r);
+      luaL_error(L, "not enough memory");
+    }
+    r->refs = 0;
+    r->arity = (int)p->arity;
+    r->cap = p->nrows;
+    for (j = 0; j < r->arity; j++)
+      r->cols[j] = (int *)(m->base + p->cols) + j * p->nrows;
+    IMG_INCR(&m->refs);
+    r->owner = m;
+    r->release = img_release;
+    dl_fs_push(L, r, p->nrows);
+    lua_setfield(L, -2, "facts");
+    lua_rawseti(L, -2, (int)i + 1);
+  }
+}
+
+/* Stack: ... image -> ... image rules */
+static void
+img_push_rules(lua_State *L, img_t *m)
+{
+  const img_header_t *h = img_header(m);
+  const img_string_t *names = (const img_string_t *)(m->base + h->names);
+  dl_rules_t r;
+  size_t i;
+  memset(&r, 0, sizeof(dl_rules_t));
+  r.code = (int *)(m->base + h->code);
+  r.len = h->ncode;
+  r.nnames = (int)h->nnames;
+  r.names = (char **)lua_newuserdata(L, (h->nnames + 1) * sizeof(char *));
+  r.lens = (size_t *)lua_newuserdata(L, (h->nnames + 1) * sizeof(size_t));
+  for (i = 0; i < h->nnames; i++)
+    r.names[i] = (char *)img_string(m, &names[i], &r.lens[i]);
+  dl_rules_push(L, &r);
+  lua_replace(L, -3);
+  lua_pop(L, 1);
+}
+
+int
+dl_image_load(lua_State *L)
+{
+  const char *path = luaL_checkstring(L, 1);
+  const char *err;
+  img_t **u = (img_t **)lua_newuserdata(L, sizeof(img_t *));
+  *u = NULL;
+  if (luaL_newmetatable(L, IMG_MT)) {
+    lua_pushcfunction(L, img_l_gc);
+    lua_setfield(L, -2, "__gc");
+  }
+  lua_setmetatable(L, -2);
+  *u = img_open(path, &err);
+  if (!*u)
+    return luaL_error(L, "%s: %s", path, err);
+  lua_getglobal(L, "dl_load_image");
+  lua_insert(L, -2);
+  lua_pushvalue(L, -1);
+  lua_pushcclosure(L, img_l_symbol, 1);
+  lua_insert(L, -2);
+  lua_pushvalue(L, -1);
+  lua_pushcclosure(L, img_l_name, 1);
+  lua_insert(L, -2);
+  img_push_preds(L, *u);
+  lua_insert(L, -2);
+  img_push_rules(L, *u);
+  lua_remove(L, -2);
+  lua_call(L, 4, 0);
+  return 0;
+}
+
+/* Saving */
+
+/* What is being written, kept in a userdata so that it is freed, and
+   the partly written file removed, when an error is raised. */
+typedef struct {
+  FILE *f;
+  char *tmp;			/* The file written, renamed when done. */
+  size_t pos;			/* Bytes written. */
+  int err;
+  dl_rules_t *rules;
+  img_string_t *ids;
+  const char **strs;		/* The id of each symbol used. */
+  int *slots;
+  img_pred_t *preds;
+  img_string_t *names;
+} img_save_t;
+
+static int
+img_save_gc(lua_State *L)
+{
+  img_save_t *w = (img_save_t *)luaL_checkudata(L, 1, IMG_SAVE_MT);
+  if (w->f) {
+    fclose(w->f);
+    remove(w->tmp);
+  }
+  w->f = NULL;
+  free(w->tmp);
+  dl_rules_free(w->rules);
+  free(w->ids);
+  free(w->strs);
+  free(w->slots);
+  free(w->preds);
+  free(w->names);
+  memset(w, 0, sizeof(img_save_t));
+  return 0;
+}
+
+static void
+img_write(img_save_t *w, const void *p, size_t n)
+{
+  if (n && !w->err && fwrite(p, 1, n, w->f) != n)
+    w->err = 1;
+  w->pos += n;
+}
+
+/* Pads the file to offset off. */
+static void
+img_pad(img_save_t *w, size_t off)
+{
+  static const char zeros[sizeof(size_t)];
+  while (w->pos < off)
+    img_write(w, zeros, off - w->pos < sizeof(zeros)
+	      ? off - w->pos : sizeof(zeros));
+}
+
+/* Stack: path writer preds rules consts -> same */
+static void
+img_save(lua_State *L, img_save_t *w)
+{
+  img_header_t h;
+  size_t i, off, nused = 0, n;
+  int j, maxsym = 0;
+  unsigned char *used;
+  size_t npreds = lua_rawlen(L, 3);
+  memset(&h, 0, sizeof(img_header_t));
+  w->rules = dl_rules_encode(L, 4);
+  w->preds = (img_pred_t *)calloc(npreds + 1, sizeof(img_pred_t));
+  if (!w->rules || !w->preds)
+    luaL_error(L, "not enough memory");
+  /* Find the symbols used by the rows and the rules. */
+  for (i = 0; i < npreds; i++) {
+    dl_factstore_t *s;
+    lua_rawgeti(L, 3, (int)i + 1);
+    lua_getfield(L, -1, "facts");
+    s = dl_tofactstore(L, -1);
+    lua_pop(L, 2);
+    if (!s)
+      luaL_error(L, "cannot save the database");
+    for (j = 0; j < s->arity; j++)
+      for (n = 0; n < s->len; n++)
+	if (s->cols[j][n] > maxsym)
+	  maxsym = s->cols[j][n];
+  }
+  for (i = 0; i < w->rules->len; i++)
+    if (w->rules->code[i] > maxsym)
+      maxsym = w->rules->code[i];
+  h.nsyms = (size_t)maxsym + 1;
+  used = (unsigned char *)lua_newuserdata(L, h.nsyms);
+  memset(used, 0, h.nsyms);
+  for (i = 0; i < npreds; i++) {
+    dl_factstore_t *s;
+    lua_rawgeti(L, 3, (int)i + 1);
+    lua_getfield(L, -1, "facts");
+    s = dl_tofactstore(L, -1);
+    lua_pop(L, 2);
+    for (j = 0; j < s->arity; j++)
+      for (n = 0; n < s->len; n++)
+	used[s->cols[j][n]] = 1;
+  }
+  /* The literals of a rule are its only code that is not a term, so
+     terms are found by walking the rules. */
+  for (i = 0; i < w->rules->len;) {
+    int k, nlits = w->rules->code[i++];
+    for (k = 0; k < nlits; k++) {
+      int t, arity = w->rules->code[i + 1];
+      i += 2;
+      for (t = 0; t < arity; t++, i++)
+	if (w->rules->code[i] > 0)
+	  used[w->rules->code[i]] = 1;
+    }
+  }
+  /* Look up the ids of the symbols used, anchoring them in a table. */
+  w->ids = (img_string_t *)malloc(h.nsyms * sizeof(img_string_t));
+  w->strs = (const char **)calloc(h.nsyms, sizeof(char *));
+  if (!w->ids || !w->strs)
+    luaL_error(L, "not enough memory");
+  lua_newtable(L);
+  for (i = 0; i < h.nsyms; i++) {
+    w->ids[i].off = IMG_NONE;
+    w->ids[i].len = 0;
+    if (!used[i])
+      continue;
+    lua_pushinteger(L, (lua_Integer)i);
+    lua_gettable(L, 5);
+    if (lua_istable(L, -1))
+      lua_getfield(L, -1, "id");
+    else
+      lua_pushnil(L);
+    w->strs[i] = lua_tolstring(L, -1, &w->ids[i].len);
+    if (!w->strs[i])
+      luaL_error(L, "no constant for symbol %d", (int)i);
+    lua_rawseti(L, -3, (int)i);
+    lua_pop(L, 1);
+    nused++;
+  }
+  for (h.nslots = 16; h.nslots < 2 * nused; h.nslots *= 2)
+    ;
+  w->slots = (int *)calloc(h.nslots, sizeof(int));
+  w->names = (img_string_t *)calloc(w->rules->nnames + 1,
+				    sizeof(img_string_t));
+  if (!w->slots || !w->names)
+    luaL_error(L, "not enough memory");
+  for (i = 0; i < h.nsyms; i++)
+    if (w->strs[i]) {
+      size_t k, mask = h.nslots - 1;
+      for (k = img_hash(w->strs[i], w->ids[i].len) & mask; w->slots[k];
+	   k = (k + 1) & mask)
+	;
+      w->slots[k] = (int)i;
+    }
+  /* Lay out the file. */
+  memcpy(h.magic, IMG_MAGIC, 8);
+  h.version = IMG_VERSION;
+  h.order = IMG_ORDER;
+  h.intsize = (int)sizeof(int);
+  h.sizesize = (int)sizeof(size_t);
+  h.npreds = npreds;
+  h.nnames = (size_t)w->rules->nnames;
+  h.ncode = w->rules->len;
+  off = IMG_ALIGN(sizeof(img_header_t));
+  h.ids = off;
+  off += h.nsyms * sizeof(img_string_t);
+  h.slots = off;
+  off = IMG_ALIGN(off + h.nslots * sizeof(int));
+  h.preds = off;
+  off += npreds * sizeof(img_pred_t);
+  h.names = off;
+  off += h.nnames * sizeof(img_string_t);
+  h.code = off;
+  off = IMG_ALIGN(off + h.ncode * sizeof(int));
+  for (i = 0; i < h.nsyms; i++)
+    if (w->strs[i]) {
+      w->ids[i].off = off;
+      off += w->ids[i].len;
+    }
+  for (i = 0; i < npreds; i++) {
+    lua_rawgeti(L, 3, (int)i + 1);
+    lua_getfield(L, -1, "name");
+    lua_tolstring(L, -1, &w->preds[i].name.len);
+    lua_pop(L, 2);
+    w->preds[i].name.off = off;
+    off += w->preds[i].name.len;
+  }
+  for (i = 0; i < h.nnames; i++) {
+    w->names[i].off = off;
+    w->names[i].len = w->rules->lens[i];
+    off += w->names[i].len;
+  }
+  off = IMG_ALIGN(off);
+  for (i = 0; i < npreds; i++) {
+    dl_factstore_t *s;
+    lua_rawgeti(L, 3, (int)i + 1);
+    lua_getfield(L, -1, "facts");
+    s = dl_tofactstore(L, -1);
+    lua_pop(L, 2);
+    w->preds[i].arity = (size_t)s->arity;
+    w->preds[i].nrows = s->len;
+    w->preds[i].cols = off;
+    off = IMG_ALIGN(off + (size_t)s->arity * s->len * sizeof(int));
+  }
+  h.size = off;
+  /* Write it. */
+  img_write(w, &h, sizeof(img_header_t));
+  img_pad(w, h.ids);
+  img_write(w, w->ids, h.nsyms * sizeof(img_string_t));
+  img_write(w, w->slots, h.nslots * sizeof(int));
+  img_pad(w, h.preds);
+  img_write(w, w->preds, npreds * sizeof(img_pred_t));
+  img_write(w, w->names, h.nnames * sizeof(img_string_t));
+  img_write(w, w->rules->code, h.ncode * sizeof(int));
+  img_pad(w, IMG_ALIGN(w->pos));
+  for (i = 0; i < h.nsyms; i++)
+    if (w->strs[i])
+      img_write(w, w->strs[i], w->ids[i].len);
+  for (i = 0; i < npreds; i++) {
+    const char *name;
+    lua_rawgeti(L, 3, (int)i + 1);
+    lua_getfield(L, -1, "name");
+    name = lua_tolstring(L, -1, &n);
+    img_write(w, name, n);
+    lua_pop(L, 2);
+  }
+  for (i = 0; i < h.nnames; i++)
+    img_write(w, w->rules->names[i], w->rules->lens[i]);
+  for (i = 0; i < npreds; i++) {
+    dl_factstore_t *s;
+    img_pad(w, w->preds[i].cols);
+    lua_rawgeti(L, 3, (int)i + 1);
+    lua_getfield(L, -1, "facts");
+    s = dl_tofactstore(L, -1);
+    lua_pop(L, 2);
+    for (j = 0; j < s->arity; j++)
+      img_write(w, s->cols[j], s->len * sizeof(int));
+  }
+  img_pad(w, h.size);
+  lua_pop(L, 2);
+}
+
+int
+dl_image_save(lua_State *L)
+{
+  const char *path = luaL_checkstring(L, 1);
+  size_t n = strlen(path);
+  img_save_t *w;
+  lua_settop(L, 1);
+  w = (img_save_t *)lua_newuserdata(L, sizeof(img_save_t));
+  memset(w, 0, sizeof(img_save_t));
+  if (luaL_newmetatable(L, IMG_SAVE_MT)) {
+    lua_pushcfunction(L, img_save_gc);
+    lua_setfield(L, -2, "__gc");
+  }
+  lua_setmetatable(L, -2);
+  lua_getglobal(L, "dl_image");
+  lua_call(L, 0, 3);
+  w->tmp = (char *)malloc(n + 5);
+  if (!w->tmp)
+    return luaL_error(L, "not enough memory");
+  memcpy(w->tmp, path, n);
+  memcpy(w->tmp + n, ".tmp", 5);
+  w->f = fopen(w->tmp, "wb");
+  if (!w->f)
+    return luaL_error(L, "%s: cannot write the image", path);
+  img_save(L, w);
+  /* The image must be on disk before it is renamed, or a crash may
+     leave a torn file in its place. */
+  if (fflush(w->f))
+    w->err = 1;
+#if defined IMG_MMAP
+  if (!w->err && fsync(fileno(w->f)))
+    w->err = 1;
+#endif
+  if (fclose(w->f))
+    w->err = 1;
+  w->f = NULL;
+  if (w->err || rename(w->tmp, path)) {
+    remove(w->tmp);
+    return luaL_error(L, "%s: cannot write the image", path);
+  }
+  return 0;
+}
@@ -67,6 +67,10 @@ usage(const char *prog)
 	  "  -i      -- enter interactive mode after loading file\n"
 	  "  -l file -- load extensions written in Lua\n"
 	  "  -t      -- print output as tab separated values\n"
+	  "  -b      -- answer queries bottom-up with the native evaluator\n"
+	  "  -m      -- like -b, but rewrite queries using magic sets\n"
+	  "  -j n    -- like -b, but share rounds between n threads\n"
+	  "             (0 for one per processor)\n"
 	  "  -v      -- print version information\n"
 	  "  -h      -- print this message\n"
 	  "Use - as a file name to specify standard input\n",
@@ -360,6 +364,8 @@ main(int argc, char **argv)
   char *input = NULL;
   char *output = NULL;
   char *lua = NULL;
+  int options = 0;
+  int threads;
 
   FILE *in = NULL;
 
@@ -367,7 +373,7 @@ main(int argc, char **argv)
   int rc;
 
   for (;;) {
-    int c = getopt(argc, argv, "o:il:tvh");
+    int c = getopt(argc, argv, "o:il:tbmj:vh");
     if (c == -1)
       break;
     switch (c) {
@@ -383,6 +389,21 @@ main(int argc, char **argv)
     case 't':
       print_as_tsv = 1;
       break;
+    case 'b':
+      options |= DL_OPT_BOTTOMUP;
+      break;
+    case 'm':
+      options |= DL_OPT_BOTTOMUP | DL_OPT_MAGIC;
+      break;
+    case 'j':
+      threads = atoi(optarg);
+      if (threads < 0 || threads > 0xffff) {
+	fprintf(stderr, "Bad thread count %s\n", optarg);
+	return 1;
+      }
+      options |= DL_OPT_BOTTOMUP | DL_OPT_PARALLEL
+	| DL_OPT_THREADS(threads);
+      break;
     case 'v':
       print_version(argv[0]);
       return 0;
@@ -422,7 +443,7 @@ main(int argc, char **argv)
     return 1;
   }
 
-  db = dl_open();
+  db = dl_open_with(options);
   if (!db) {
     fprintf(stderr, "Internal error\n");
     return 1;
@@ -0,0 +1,380 @@
+/*
+ * Native versions of the term manipulation functions used by the
+ * Datalog interpreter written in Lua.
+ *
+ * Copyright (C) Alexander Hoffman, 2017
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
+ */
+
+/* The prover spends most of its time unifying, substituting and
+   renaming literals, and making the keys of the literals it looks
+   up.  The Lua versions of these functions dispatch
+   on the class of each term through method calls.  The functions in
+   this file work on the same tables, but tell variables from
+   constants by comparing metatables, and build their results with
+   raw table accesses.  Each function behaves exactly like the Lua
+   function it replaces in datalog.lua.
+
+   The functions are closures created by dl_kernels, which is given
+   the metatable of variables and the function that makes fresh
+   variables.  They are kept as upvalues. */
+
+#include <lua.h>
+#include <lauxlib.h>
+#include "datalog.h"
+#include "dl_native.h"
+
+#define VAR_MT lua_upvalueindex(1)
+#define FRESH_VAR lua_upvalueindex(2)
+
+/* Is the value at idx, which must be absolute, a variable? */
+static int
+is_var(lua_State *L, int idx)
+{
+  int is;
+  if (!lua_getmetatable(L, idx))
+    return 0;
+  is = lua_rawequal(L, -1, VAR_MT);
+  lua_pop(L, 1);
+  return is;
+}
+
+/* Stack: ... term -> ... term
+   Replaces a term by what it is bound to, until reaching a constant
+   or an unbound variable. */
+static void
+chase(lua_State *L, int env)
+{
+  int top = lua_gettop(L);
+  while (is_var(L, top)) {
+    lua_pushvalue(L, top);
+    lua_rawget(L, env);
+    if (lua_isnil(L, -1)) {
+      lua_pop(L, 1);
+      return;
+    }
+    lua_replace(L, top);
+  }
+}
+
+/* Stack: ... -> ... literal
+   Pushes the result of applying the environment at env to the
+   literal at lit.  Variables are replaced by their binding, without
+   chasing it, as in the Lua version. */
+static void
+subst(lua_State *L, int lit, int env)
+{
+  int i, n = (int)lua_rawlen(L, lit);
+  lua_createtable(L, n, 1);
+  lua_pushliteral(L, "pred");
+  lua_pushliteral(L, "pred");
+  lua_rawget(L, lit);
+  lua_rawset(L, -3);
+  for (i = 1; i <= n; i++) {
+    lua_rawgeti(L, lit, i);
+    if (is_var(L, lua_gettop(L))) {
+      lua_pushvalue(L, -1);
+      lua_rawget(L, env);
+      if (lua_isnil(L, -1))
+	lua_pop(L, 1);
+      else
+	lua_remove(L, -2);
+    }
+    lua_rawseti(L, -2, i);
+  }
+}
+
+/* Is the table at idx empty? */
+static int
+is_empty(lua_State *L, int idx)
+{
+  lua_pushnil(L);
+  if (lua_next(L, idx)) {
+    lua_pop(L, 2);
+    return 0;
+  }
+  return 1;
+}
+
+/* Maps each variable in the literal at lit that is not in the
+   environment at env to a fresh variable. */
+static void
+shuffle(lua_State *L, int lit, int env)
+{
+  int i, n = (int)lua_rawlen(L, lit);
+  for (i = 1; i <= n; i++) {
+    lua_rawgeti(L, lit, i);
+    if (is_var(L, lua_gettop(L))) {
+      lua_pushvalue(L, -1);
+      lua_rawget(L, env);
+      if (lua_isnil(L, -1)) {
+	lua_pop(L, 1);
+	lua_pushvalue(L, FRESH_VAR);
+	lua_call(L, 0, 1);
+	lua_rawset(L, env);
+	continue;
+      }
+      lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+  }
+}
+
+/* Stack: ... -> ... clause
+   Pushes the result of applying the environment at env to the
+   clause at clause. */
+static void
+subst_in_clause(lua_State *L, int clause, int env)
+{
+  int i, n = (int)lua_rawlen(L, clause);
+  if (is_empty(L, env)) {
+    lua_pushvalue(L, clause);
+    return;
+  }
+  lua_createtable(L, n, 1);
+  lua_pushliteral(L, "head");
+  lua_pushliteral(L, "head");
+  lua_rawget(L, clause);
+  subst(L, lua_gettop(L), env);
+  lua_remove(L, -2);
+  lua_rawset(L, -3);
+  for (i = 1; i <= n; i++) {
+    lua_rawgeti(L, clause, i);
+    subst(L, lua_gettop(L), env);
+    lua_remove(L, -2);
+    lua_rawseti(L, -2, i);
+  }
+}
+
+/* unify(literal, other) returns an environment or nil. */
+static int
+k_unify(lua_State *L)
+{
+  int i, n;
+  lua_pushliteral(L, "pred");
+  lua_rawget(L, 1);
+  lua_pushliteral(L, "pred");
+  lua_rawget(L, 2);
+  if (!lua_rawequal(L, -1, -2)) {
+    lua_pushnil(L);
+    return 1;
+  }
+  lua_pop(L, 2);
+  lua_newtable(L);		/* The environment is at 3. */
+  n = (int)lua_rawlen(L, 1);
+  for (i = 1; i <= n; i++) {
+    lua_rawgeti(L, 1, i);
+    chase(L, 3);
+    lua_rawgeti(L, 2, i);
+    chase(L, 3);
+    if (lua_rawequal(L, 4, 5))
+      lua_pop(L, 2);
+    else if (is_var(L, 4))	/* Bind the first term. */
+      lua_rawset(L, 3);
+    else if (is_var(L, 5)) {	/* Bind the second term. */
+      lua_insert(L, 4);
+      lua_rawset(L, 3);
+    }
+    else {			/* Two different constants. */
+      lua_pushnil(L);
+      return 1;
+    }
+  }
+  return 1;
+}
+
+/* subst(literal, env) */
+static int
+k_subst(lua_State *L)
+{
+  lua_settop(L, 2);
+  if (is_empty(L, 2))
+    lua_pushvalue(L, 1);
+  else
+    subst(L, 1, 2);
+  return 1;
+}
+
+/* shuffle(literal, env) returns env, or a new environment when env
+   is nil. */
+static int
+k_shuffle(lua_State *L)
+{
+  lua_settop(L, 2);
+  if (lua_isnil(L, 2)) {
+    lua_newtable(L);
+    lua_replace(L, 2);
+  }
+  shuffle(L, 1, 2);
+  return 1;
+}
+
+/* rename(literal) */
+static int
+k_rename(lua_State *L)
+{
+  lua_settop(L, 1);
+  lua_newtable(L);
+  shuffle(L, 1, 2);
+  if (is_empty(L, 2))
+    lua_pushvalue(L, 1);
+  else
+    subst(L, 1, 2);
+  return 1;
+}
+
+/* subst_in_clause(clause, env) */
+static int
+k_subst_in_clause(lua_State *L)
+{
+  lua_settop(L, 2);
+  subst_in_clause(L, 1, 2);
+  return 1;
+}
+
+/* rename_clause(clause) renames the variables in the body of a
+   clause, which include those in its head. */
+static int
+k_rename_clause(lua_State *L)
+{
+  int i, n;
+  lua_settop(L, 1);
+  lua_newtable(L);
+  n = (int)lua_rawlen(L, 1);
+  for (i = 1; i <= n; i++) {
+    lua_rawgeti(L, 1, i);
+    shuffle(L, 3, 2);
+    lua_pop(L, 1);
+  }
+  subst_in_clause(L, 1, 2);
+  return 1;
+}
+
+/* Stack: ... term -> ...
+   Adds the symbol of the term to the key being built. */
+static void
+add_sym(lua_State *L, luaL_Buffer *b)
+{
+  lua_pushliteral(L, "sym");
+  lua_rawget(L, -2);
+  lua_remove(L, -2);
+  luaL_addvalue(b);
+}
+
+/* get_id(literal) returns the key made from the symbols of the
+   predicate and terms of the literal, and caches it in the literal. */
+static int
+k_get_id(lua_State *L)
+{
+  luaL_Buffer b;
+  int i, n;
+  lua_settop(L, 1);
+  lua_pushliteral(L, "id");
+  lua_rawget(L, 1);
+  if (!lua_isnil(L, 2))
+    return 1;
+  lua_pop(L, 1);
+  n = (int)lua_rawlen(L, 1);
+  luaL_buffinit(L, &b);
+  lua_pushliteral(L, "pred");
+  lua_rawget(L, 1);
+  add_sym(L, &b);
+  for (i = 1; i <= n; i++) {
+    luaL_addchar(&b, ' ');
+    lua_rawgeti(L, 1, i);
+    add_sym(L, &b);
+  }
+  luaL_pushresult(&b);
+  lua_pushliteral(L, "id");
+  lua_pushvalue(L, -2);
+  lua_rawset(L, 1);
+  return 1;
+}
+
+/* get_tag(literal) returns the variant tag of the literal, and caches
+   it in the literal.  A variable is replaced by minus the position of
+   its first occurrence, which is found by searching the terms before
+   it, as literals are short. */
+static int
+k_get_tag(lua_State *L)
+{
+  luaL_Buffer b;
+  int i, j, n;
+  lua_settop(L, 1);
+  lua_pushliteral(L, "tag");
+  lua_rawget(L, 1);
+  if (!lua_isnil(L, 2))
+    return 1;
+  lua_pop(L, 1);
+  n = (int)lua_rawlen(L, 1);
+  luaL_buffinit(L, &b);
+  lua_pushliteral(L, "pred");
+  lua_rawget(L, 1);
+  add_sym(L, &b);
+  for (i = 1; i <= n; i++) {
+    luaL_addchar(&b, ' ');
+    lua_rawgeti(L, 1, i);
+    if (!is_var(L, lua_gettop(L))) {
+      add_sym(L, &b);
+      continue;
+    }
+    for (j = 1; j < i; j++) {
+      int same;
+      lua_rawgeti(L, 1, j);
+      same = lua_rawequal(L, -1, -2);
+      lua_pop(L, 1);
+      if (same)
+	break;
+    }
+    lua_pop(L, 1);
+    lua_pushinteger(L, -j);
+    luaL_addvalue(&b);
+  }
+  luaL_pushresult(&b);
+  lua_pushliteral(L, "tag");
+  lua_pushvalue(L, -2);
+  lua_rawset(L, 1);
+  return 1;
+}
+
+static const luaL_Reg kernels[] = {
+  {"unify", k_unify},
+  {"subst", k_subst},
+  {"shuffle", k_shuffle},
+  {"rename", k_rename},
+  {"subst_in_clause", k_subst_in_clause},
+  {"rename_clause", k_rename_clause},
+  {"get_id", k_get_id},
+  {"get_tag", k_get_tag},
+  {NULL, NULL}
+};
+
+/* dl_kernels(Var, mk_fresh_var) returns a table of the functions
+   above. */
+int
+dl_kernels(lua_State *L)
+{
+  const luaL_Reg *k;
+  lua_settop(L, 2);
+  lua_createtable(L, 0, sizeof(kernels) / sizeof(kernels[0]) - 1);
+  for (k = kernels; k->func; k++) {
+    lua_pushvalue(L, 1);
+    lua_pushvalue(L, 2);
+    lua_pushcclosure(L, k->func, 2);
+    lua_setfield(L, -2, k->name);
+  }
+  return 1;
+}
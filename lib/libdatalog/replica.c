@@ -0,0 +1,889 @@
+/*
+ * Publishes versions of a database to replicas in other Lua states.
+ *
+ * Copyright (C) Alexander Hoffman, 2017
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
+ */
+
+/* A family is a database, the replicas made from it, and what they
+   share: a symbol table numbering the constants of all of them, and
+   the version last published by the database.  A version holds the
+   rows of the fact store of each predicate with facts, shared with
+   the stores as described in factstore.c, and the rules, encoded as
+   an array of integers.  Rules change rarely, so a version shares the
+   rules of the one before when they have not changed.
+
+   Each Lua state of a family holds it through a userdata kept in its
+   registry, whose finalizer drops its reference, so the family lives
+   until the database and all its replicas are closed.  The family
+   lock guards the symbol table, the current version, and the
+   reference counts of the family, its versions and their rules.  It is
+   never held while calling Lua, which can raise errors.
+
+   A version is never changed once published.  Replicas install the
+   current version when refreshed, by making fact stores sharing its
+   rows, so installing a version costs time in the number of its
+   predicates and rules, but not of its facts.  The database goes on
+   adding facts in place after the rows of each version, so versions
+   are snapshots: each holds the number of rows of each predicate it
+   sees, and publishing one copies no facts.  A version is freed when
+   the last replica using it moves on to a newer one.
+
+   Symbols whose constants are no longer used are reclaimed by a sweep
+   made by the database when it publishes, once the symbol table has
+   doubled since the last one.  A symbol is used by the rows and rules
+   of a version that is alive, by the stores of the database, or by a
+   constant alive in a member.  The members are asked for the symbols
+   of their constants, and answer when next refreshed, so a replica
+   that is not refreshed delays the sweep.  Each member records the
+   epoch of its answer, and each symbol the epoch in which it was last
+   handed out, so a symbol handed out to a member after it answered is
+   kept, though not in the answer.  A replica holds the version it
+   installed until it installs another, so the symbols of its rows are
+   kept while it may look them up.  Reclaimed symbols are reused for
+   new ids. */
+
+#include <stdlib.h>
+#include <string.h>
+#include <lua.h>
+#include <lauxlib.h>
+#include "datalog.h"
+#include "dl_native.h"
+
+#if !defined _WIN32
+#define RP_THREADS
+#include <pthread.h>
+#endif
+
+#if defined RP_THREADS
+#define RP_LOCK(f) pthread_mutex_lock(&(f)->lock)
+#define RP_UNLOCK(f) pthread_mutex_unlock(&(f)->lock)
+#else
+#define RP_LOCK(f) ((void)0)
+#define RP_UNLOCK(f) ((void)0)
+#endif
+
+#define RP_MT "datalog family"
+
+#define RP_SWEEP 1024		/* Symbols added before the first sweep. */
+
+typedef struct {
+  char *name;
+  size_t len;
+  int arity;
+  dl_fs_rows_t *rows;
+  size_t nrows;			/* The rows in the version. */
+} rp_pred_t;
+
+typedef struct rp_version {
+  int refs;			/* Family and replicas holding it. */
+  unsigned long serial;
+  int changed;			/* The rule count given by Lua. */
+  rp_pred_t *preds;
+  int npreds;
+  dl_rules_t *rules;
+  struct rp_version *next;	/* Versions alive in the family. */
+} rp_version_t;
+
+typedef struct rp_member rp_member_t;
+
+typedef struct {
+#if defined RP_THREADS
+  pthread_mutex_t lock;
+#endif
+  int refs;			/* Lua states of the family. */
+  /* The symbol table.  The id of symbol i is names[i], which is null
+     when the symbol is free, and slots is an open addressing hash
+     table of symbols keyed by their ids, zero being empty. */
+  char **names;
+  size_t *lens;
+  int nnames;			/* Symbols are below nnames. */
+  int next;			/* The least symbol that may be free. */
+  int *slots;
+  size_t nslots, nsyms;
+  unsigned long *seen;		/* Epoch each symbol was handed out. */
+  unsigned long epoch;		/* Of the last answer of a member. */
+  unsigned long asked;		/* Epoch a sweep was asked, or zero. */
+  size_t kept;			/* Symbols kept by the last sweep. */
+  rp_member_t *members;
+  rp_version_t *current;	/* The version last published. */
+  rp_version_t *versions;	/* Every version alive. */
+  unsigned long serial;		/* Of versions and rules. */
+} rp_family_t;
+
+/* The userdata of a Lua state of a family. */
+struct rp_member {
+  rp_family_t *family;
+  int replica;
+  unsigned long serial;		/* Of the version installed. */
+  unsigned long rules;		/* Of the rules installed. */
+  rp_version_t *pending;	/* Being installed. */
+  rp_version_t *installed;	/* Held until another is installed. */
+  int *used;			/* The symbols of its constants, */
+  size_t nused;
+  unsigned long answered;	/* as of this epoch. */
+  rp_member_t *next;
+};
+
+/* The member userdata of a Lua state is stored in its registry using
+   the address of this variable as the key. */
+static const char rp_member_key = 'f';
+
+/* Symbol table */
+
+static size_t
+rp_hash(const char *s, size_t n)
+{
+  size_t h = 5381;
+  while (n--)
+    h = h * 33 + (unsigned char)*s++;
+  return h;
+}
+
+static int
+rp_lookup(const rp_family_t *f, const char *id, size_t n)
+{
+  size_t mask = f->nslots - 1;
+  size_t i;
+  if (!f->nslots)
+    return 0;
+  for (i = rp_hash(id, n) & mask; f->slots[i]; i = (i + 1) & mask) {
+    int sym = f->slots[i];
+    if (f->lens[sym] == n && !memcmp(f->names[sym], id, n))
+      return sym;
+  }
+  return 0;
+}
+
+static void
+rp_slot(rp_family_t *f, int sym)
+{
+  size_t mask = f->nslots - 1;
+  size_t i = rp_hash(f->names[sym], f->lens[sym]) & mask;
+  while (f->slots[i])
+    i = (i + 1) & mask;
+  f->slots[i] = sym;
+}
+
+/* Makes room for symbol sym and one more entry in the hash table. */
+static int
+rp_reserve(rp_family_t *f, int sym)
+{
+  if (sym >= f->nnames) {
+    int i, cap = f->nnames ? 2 * f->nnames : 256;
+    char **names;
+    size_t *lens;
+    unsigned long *seen;
+    while (cap <= sym)
+      cap *= 2;
+    names = (char **)realloc(f->names, cap * sizeof(char *));
+    if (!names)
+      return -1;
+    f->names = names;
+    lens = (size_t *)realloc(f->lens, cap * sizeof(size_t));
+    if (!lens)
+      return -1;
+    f->lens = lens;
+    seen = (unsigned long *)realloc(f->seen, cap * sizeof(unsigned long));
+    if (!seen)
+      return -1;
+    f->seen = seen;
+    for (i = f->nnames; i < cap; i++)
+      f->names[i] = NULL;
+    f->nnames = cap;
+  }
+  if (2 * (f->nsyms + 1) > f->nslots) {
+    size_t i, n = f->nslots ? 2 * f->nslots : 512;
+    int *slots = (int *)calloc(n, sizeof(int));
+    if (!slots)
+      return -1;
+    free(f->slots);
+    f->slots = slots;
+    f->nslots = n;
+    for (i = 1; i < (size_t)f->nnames; i++)
+      if (f->names[i])
+	rp_slot(f, (int)i);
+  }
+  return 0;
+}
+
+/* Returns the symbol of an id, adding it with symbol sym when sym is
+   free, or with the least free symbol otherwise.  Returns -1 when out
+   of memory. */
+static int
+rp_symbol(rp_family_t *f, const char *id, size_t n, int sym)
+{
+  char *s;
+  int found = rp_lookup(f, id, n);
+  if (found) {
+    f->seen[found] = f->epoch;
+    return found;
+  }
+  if (sym <= 0 || (sym < f->nnames && f->names[sym])) {
+    while (f->next < f->nnames && f->names[f->next])
+      f->next++;
+    sym = f->next;
+  }
+  if (rp_reserve(f, sym))
+    return -1;
+  s = (char *)malloc(n + 1);
+  if (!s)
+    return -1;
+  memcpy(s, id, n);
+  s[n] = '\0';
+  f->names[sym] = s;
+  f->lens[sym] = n;
+  f->seen[sym] = f->epoch;
+  f->nsyms++;
+  rp_slot(f, sym);
+  return sym;
+}
+
+/* Frees the symbols not kept, nor handed out in an epoch from since,
+   and rehashes the others. */
+static void
+rp_reclaim(rp_family_t *f, const unsigned char *keep, int n,
+	   unsigned long since)
+{
+  size_t i;
+  int sym;
+  for (sym = 1; sym < n; sym++)
+    if (f->names[sym] && !keep[sym] && f->seen[sym] < since) {
+      free(f->names[sym]);
+      f->names[sym] = NULL;
+      f->nsyms--;
+      if (sym < f->next)
+	f->next = sym;
+    }
+  for (i = 0; i < f->nslots; i++)
+    f->slots[i] = 0;
+  for (sym = 1; sym < f->nnames; sym++)
+    if (f->names[sym])
+      rp_slot(f, sym);
+}
+
+/* Versions */
+
+void
+dl_rules_free(dl_rules_t *r)
+{
+  int i;
+  if (!r)
+    return;
+  for (i = 0; i < r->nnames; i++)
+    free(r->names[i]);
+  free(r->names);
+  free(r->lens);
+  free(r->code);
+  free(r);
+}
+
+static void
+rp_version_free(rp_version_t *v, int rules)
+{
+  int i;
+  for (i = 0; v->preds && i < v->npreds; i++) {
+    free(v->preds[i].name);
+    dl_fs_release(v->preds[i].rows);
+  }
+  free(v->preds);
+  if (rules)
+    dl_rules_free(v->rules);
+  free(v);
+}
+
+/* Drops a reference to a version. */
+static void
+rp_version_release(rp_family_t *f, rp_version_t *v)
+{
+  rp_version_t **p;
+  int last, rules = 0;
+  if (!v)
+    return;
+  RP_LOCK(f);
+  last = --v->refs == 0;
+  if (last && v->rules)
+    rules = --v->rules->refs == 0;
+  if (last)
+    for (p = &f->versions; *p; p = &(*p)->next)
+      if (*p == v) {
+	*p = v->next;
+	break;
+      }
+  RP_UNLOCK(f);
+  if (last)
+    rp_version_free(v, rules);
+}
+
+static int
+rp_emit(dl_rules_t *r, int x)
+{
+  if (r->len == r->cap) {
+    size_t cap = r->cap ? 2 * r->cap : 256;
+    int *code = (int *)realloc(r->code, cap * sizeof(int));
+    if (!code)
+      return -1;
+    r->code = code;
+    r->cap = cap;
+  }
+  r->code[r->len++] = x;
+  return 0;
+}
+
+/* Emits the name of a predicate, shared by the literals of the rules
+   that use it.  Rules are few, so the names are searched in turn. */
+static int
+rp_emit_name(dl_rules_t *r, const char *name, size_t n)
+{
+  int i;
+  char *s;
+  for (i = 0; i < r->nnames; i++)
+    if (r->lens[i] == n && !memcmp(r->names[i], name, n))
+      return rp_emit(r, i);
+  if (r->nnames == r->capnames) {
+    int cap = r->capnames ? 2 * r->capnames : 16;
+    char **names = (char **)realloc(r->names, cap * sizeof(char *));
+    size_t *lens;
+    if (!names)
+      return -1;
+    r->names = names;
+    lens = (size_t *)realloc(r->lens, cap * sizeof(size_t));
+    if (!lens)
+      return -1;
+    r->lens = lens;
+    r->capnames = cap;
+  }
+  s = (char *)malloc(n + 1);
+  if (!s)
+    return -1;
+  memcpy(s, name, n);
+  s[n] = '\0';
+  r->names[r->nnames] = s;
+  r->lens[r->nnames] = n;
+  return rp_emit(r, r->nnames++);
+}
+
+/* Stack: ... literal -> ... literal */
+static int
+rp_emit_literal(lua_State *L, dl_rules_t *r)
+{
+  const char *name;
+  size_t n;
+  int j, err, arity = (int)lua_rawlen(L, -1);
+  lua_getfield(L, -1, "pred");
+  lua_getfield(L, -1, "name");
+  name = lua_tolstring(L, -1, &n);
+  err = !name || rp_emit_name(r, name, n) || rp_emit(r, arity);
+  lua_pop(L, 2);
+  for (j = 1; !err && j <= arity; j++) {
+    lua_rawgeti(L, -1, j);
+    lua_getfield(L, -1, "sym");
+    err = rp_emit(r, (int)lua_tointeger(L, -1));
+    lua_pop(L, 2);
+  }
+  return err;
+}
+
+dl_rules_t *
+dl_rules_encode(lua_State *L, int idx)
+{
+  dl_rules_t *r = (dl_rules_t *)calloc(1, sizeof(dl_rules_t));
+  int i, j, n, err = r == NULL;
+  n = r ? (int)lua_rawlen(L, idx) : 0;
+  for (i = 1; !err && i <= n; i++) {
+    int body;
+    lua_rawgeti(L, idx, i);
+    body = (int)lua_rawlen(L, -1);
+    err = rp_emit(r, body + 1);
+    lua_getfield(L, -1, "head");
+    err = err || rp_emit_literal(L, r);
+    lua_pop(L, 1);
+    for (j = 1; !err && j <= body; j++) {
+      lua_rawgeti(L, -1, j);
+      err = rp_emit_literal(L, r);
+      lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+  }
+  if (err) {
+    dl_rules_free(r);
+    return NULL;
+  }
+  r->refs = 1;
+  return r;
+}
+
+void
+dl_rules_push(lua_State *L, const dl_rules_t *r)
+{
+  size_t k = 0;
+  int i = 0;
+  lua_newtable(L);
+  while (k < r->len) {
+    int j, nlits = r->code[k++];
+    lua_createtable(L, nlits, 0);
+    for (j = 1; j <= nlits; j++) {
+      int t, name = r->code[k++], arity = r->code[k++];
+      lua_createtable(L, arity, 1);
+      lua_pushlstring(L, r->names[name], r->lens[name]);
+      lua_setfield(L, -2, "name");
+      for (t = 1; t <= arity; t++) {
+	lua_pushinteger(L, r->code[k++]);
+	lua_rawseti(L, -2, t);
+      }
+      lua_rawseti(L, -2, j);
+    }
+    lua_rawseti(L, -2, ++i);
+  }
+}
+
+/* Sweeps */
+
+/* Calls dl_symbols, and returns an array of the symbols used by the
+   Lua state, with their number at n, or the null pointer when out of
+   memory. */
+static int *
+rp_symbols(lua_State *L, size_t *n)
+{
+  int *syms;
+  size_t i = 0;
+  lua_getglobal(L, "dl_symbols");
+  lua_call(L, 0, 1);
+  *n = 0;
+  lua_pushnil(L);
+  while (lua_next(L, -2)) {
+    (*n)++;
+    lua_pop(L, 1);
+  }
+  syms = (int *)malloc((*n + 1) * sizeof(int));
+  if (syms) {
+    lua_pushnil(L);
+    while (lua_next(L, -2)) {
+      syms[i++] = (int)lua_tointeger(L, -2);
+      lua_pop(L, 1);
+    }
+  }
+  lua_pop(L, 1);
+  return syms;
+}
+
+static void
+rp_keep(unsigned char *keep, int n, int sym)
+{
+  if (sym > 0 && sym < n)
+    keep[sym] = 1;
+}
+
+/* Keeps the symbols in the rows and rules of a version. */
+static void
+rp_keep_version(const rp_version_t *v, unsigned char *keep, int n)
+{
+  size_t k, row;
+  int i, j;
+  for (i = 0; i < v->npreds; i++) {
+    const rp_pred_t *p = &v->preds[i];
+    for (j = 0; p->rows && j < p->arity; j++)
+      for (row = 0; row < p->nrows; row++)
+	rp_keep(keep, n, p->rows->cols[j][row]);
+  }
+  for (k = 0; v->rules && k < v->rules->len;) {
+    int nlits = v->rules->code[k++];
+    for (i = 0; i < nlits; i++) {
+      int arity = v->rules->code[k + 1];
+      k += 2;
+      for (j = 0; j < arity; j++)
+	rp_keep(keep, n, v->rules->code[k++]);
+    }
+  }
+}
+
+/* Answers a sweep asked for since a member last answered, with the
+   symbols it uses.  When out of memory, it answers when next
+   refreshed. */
+static void
+rp_answer(lua_State *L, rp_member_t *m)
+{
+  rp_family_t *f = m->family;
+  unsigned long epoch = 0;
+  int *used, *old;
+  size_t n;
+  RP_LOCK(f);
+  if (f->asked > m->answered)
+    epoch = ++f->epoch;
+  RP_UNLOCK(f);
+  if (!epoch)
+    return;
+  used = rp_symbols(L, &n);
+  if (!used)
+    return;
+  RP_LOCK(f);
+  old = m->used;
+  m->used = used;
+  m->nused = n;
+  m->answered = epoch;
+  RP_UNLOCK(f);
+  free(old);
+}
+
+/* Asks for a sweep when the symbol table has doubled since the last,
+   and makes it once every replica has answered. */
+static void
+rp_sweep(lua_State *L, rp_member_t *m)
+{
+  rp_family_t *f = m->family;
+  rp_member_t *r;
+  rp_version_t *v;
+  unsigned char *keep;
+  unsigned long since;
+  int *syms, n, ready;
+  size_t i, nsyms;
+  RP_LOCK(f);
+  if (!f->asked && f->nsyms >= 2 * f->kept + RP_SWEEP)
+    f->asked = ++f->epoch;
+  ready = f->asked != 0;
+  since = f->epoch + 1;
+  for (r = f->members; r; r = r->next)
+    if (r->replica) {
+      if (r->answered < f->asked)
+	ready = 0;
+      else if (r->answered < since)
+	since = r->answered;
+    }
+  n = f->nnames;
+  RP_UNLOCK(f);
+  if (!ready)
+    return;
+  syms = rp_symbols(L, &nsyms);
+  keep = (unsigned char *)calloc(n + 1, 1);
+  if (!syms || !keep) {
+    free(syms);
+    free(keep);
+    return;
+  }
+  for (i = 0; i < nsyms; i++)
+    rp_keep(keep, n, syms[i]);
+  free(syms);
+  RP_LOCK(f);
+  for (r = f->members; r; r = r->next)
+    for (i = 0; i < r->nused; i++)
+      rp_keep(keep, n, r->used[i]);
+  for (v = f->versions; v; v = v->next)
+    rp_keep_version(v, keep, n);
+  rp_reclaim(f, keep, n, since);
+  f->kept = f->nsyms;
+  f->asked = 0;
+  RP_UNLOCK(f);
+  free(keep);
+}
+
+/* Families */
+
+static rp_member_t *
+rp_member(lua_State *L)
+{
+  rp_member_t *m;
+  lua_pushlightuserdata(L, (void *)&rp_member_key);
+  lua_rawget(L, LUA_REGISTRYINDEX);
+  m = (rp_member_t *)lua_touserdata(L, -1);
+  lua_pop(L, 1);
+  return m;
+}
+
+static int
+rp_l_gc(lua_State *L)
+{
+  rp_member_t *m = (rp_member_t *)luaL_checkudata(L, 1, RP_MT);
+  rp_family_t *f = m->family;
+  rp_member_t **p;
+  int i, last;
+  if (!f)
+    return 0;
+  rp_version_release(f, m->pending);
+  rp_version_release(f, m->installed);
+  m->pending = NULL;
+  m->installed = NULL;
+  m->family = NULL;
+  RP_LOCK(f);
+  for (p = &f->members; *p; p = &(*p)->next)
+    if (*p == m) {
+      *p = m->next;
+      break;
+    }
+  last = --f->refs == 0;
+  RP_UNLOCK(f);
+  free(m->used);
+  m->used = NULL;
+  if (last) {
+    rp_version_release(f, f->current);
+    for (i = 0; i < f->nnames; i++)
+      free(f->names[i]);
+    free(f->names);
+    free(f->lens);
+    free(f->seen);
+    free(f->slots);
+#if defined RP_THREADS
+    pthread_mutex_destroy(&f->lock);
+#endif
+    free(f);
+  }
+  return 0;
+}
+
+/* symbol(id[, sym]) returns the symbol of an id, adding it when new. */
+static int
+rp_l_symbol(lua_State *L)
+{
+  rp_member_t *m = (rp_member_t *)lua_touserdata(L, lua_upvalueindex(1));
+  size_t n;
+  const char *id = luaL_checklstring(L, 1, &n);
+  int sym = (int)luaL_optinteger(L, 2, 0);
+  RP_LOCK(m->family);
+  sym = rp_symbol(m->family, id, n, sym);
+  RP_UNLOCK(m->family);
+  if (sym < 0)
+    return luaL_error(L, "not enough memory");
+  lua_pushinteger(L, sym);
+  return 1;
+}
+
+/* name(sym) returns the id of a symbol.  A sweep keeps the symbols
+   handed out to a member until it answers again, so the id can be
+   pushed unlocked. */
+static int
+rp_l_name(lua_State *L)
+{
+  rp_member_t *m = (rp_member_t *)lua_touserdata(L, lua_upvalueindex(1));
+  rp_family_t *f = m->family;
+  lua_Integer sym = luaL_checkinteger(L, 1);
+  const char *id = NULL;
+  size_t n = 0;
+  RP_LOCK(f);
+  if (sym > 0 && sym < f->nnames && f->names[sym]) {
+    id = f->names[sym];
+    n = f->lens[sym];
+    f->seen[sym] = f->epoch;
+  }
+  RP_UNLOCK(f);
+  if (!id)
+    return luaL_error(L, "unknown symbol %d", (int)sym);
+  lua_pushlstring(L, id, n);
+  return 1;
+}
+
+/* Makes the Lua state a member of a family, and has the Lua program
+   number its constants with the symbol table of the family. */
+static void
+rp_join(lua_State *L, rp_family_t *f, int replica)
+{
+  rp_member_t *m;
+  if (rp_member(L))
+    luaL_error(L, "the database already belongs to a family");
+  m = (rp_member_t *)lua_newuserdata(L, sizeof(rp_member_t));
+  memset(m, 0, sizeof(rp_member_t));
+  if (luaL_newmetatable(L, RP_MT)) {
+    lua_pushcfunction(L, rp_l_gc);
+    lua_setfield(L, -2, "__gc");
+  }
+  lua_setmetatable(L, -2);
+  m->family = f;
+  m->replica = replica;
+  RP_LOCK(f);
+  f->refs++;
+  m->answered = ++f->epoch;
+  m->next = f->members;
+  f->members = m;
+  RP_UNLOCK(f);
+  lua_pushlightuserdata(L, (void *)&rp_member_key);
+  lua_pushvalue(L, -2);
+  lua_rawset(L, LUA_REGISTRYINDEX);
+  lua_getglobal(L, "dl_share_symbols");
+  lua_pushvalue(L, -2);
+  lua_pushcclosure(L, rp_l_symbol, 1);
+  lua_pushvalue(L, -3);
+  lua_pushcclosure(L, rp_l_name, 1);
+  lua_pushboolean(L, 1);
+  lua_call(L, 3, 0);
+  lua_pop(L, 1);
+}
+
+/* Returns the member userdata of a database, making a family for it
+   when it has none. */
+static rp_member_t *
+rp_family_of(lua_State *L)
+{
+  rp_member_t *m = rp_member(L);
+  rp_family_t *f;
+  if (!m) {
+    f = (rp_family_t *)calloc(1, sizeof(rp_family_t));
+    if (!f)
+      luaL_error(L, "not enough memory");
+#if defined RP_THREADS
+    if (pthread_mutex_init(&f->lock, NULL)) {
+      free(f);
+      luaL_error(L, "cannot make a lock");
+    }
+#endif
+    f->next = 1;
+    rp_join(L, f, 0);
+    m = rp_member(L);
+  }
+  return m;
+}
+
+int
+dl_family(lua_State *L)
+{
+  rp_member_t *m = rp_family_of(L);
+  if (!m->replica && !m->family->current)
+    dl_publish_version(L);
+  lua_pushlightuserdata(L, m->family);
+  return 1;
+}
+
+int
+dl_join(lua_State *L)
+{
+  luaL_checktype(L, 1, LUA_TLIGHTUSERDATA);
+  rp_join(L, (rp_family_t *)lua_touserdata(L, 1), 1);
+  return 0;
+}
+
+int
+dl_publish_version(lua_State *L)
+{
+  rp_member_t *m;
+  rp_family_t *f;
+  rp_version_t *v, *old;
+  int i, err = 0;
+  m = rp_family_of(L);
+  if (m->replica)
+    return luaL_error(L, "a replica cannot publish");
+  f = m->family;
+  old = f->current;		/* Only changed by this state. */
+  lua_getglobal(L, "dl_publish");
+  lua_pushinteger(L, old ? old->changed : -1);
+  lua_call(L, 1, 3);
+  v = (rp_version_t *)calloc(1, sizeof(rp_version_t));
+  if (!v)
+    return luaL_error(L, "not enough memory");
+  v->refs = 1;
+  v->changed = (int)lua_tointeger(L, -1);
+  v->npreds = (int)lua_rawlen(L, -3);
+  v->preds = (rp_pred_t *)calloc(v->npreds + 1, sizeof(rp_pred_t));
+  err = v->preds == NULL;
+  for (i = 0; !err && i < v->npreds; i++) {
+    rp_pred_t *p = &v->preds[i];
+    const char *name;
+    size_t n;
+    dl_factstore_t *s;
+    lua_rawgeti(L, -3, i + 1);
+    lua_getfield(L, -1, "name");
+    name = lua_tolstring(L, -1, &n);
+    lua_getfield(L, -2, "facts");
+    s = dl_tofactstore(L, -1);
+    if (name && s) {
+      p->name = (char *)malloc(n + 1);
+      if (p->name)
+	memcpy(p->name, name, n + 1);
+      p->len = n;
+      p->arity = s->arity;
+      p->nrows = s->len;
+      p->rows = dl_fs_share(s);
+      err = !p->name || !p->rows;
+    }
+    else
+      err = 1;
+    lua_pop(L, 3);
+  }
+  if (!err) {
+    if (lua_isnil(L, -2)) {
+      v->rules = old->rules;
+      RP_LOCK(f);
+      v->rules->refs++;
+      RP_UNLOCK(f);
+    }
+    else {
+      v->rules = dl_rules_encode(L, lua_gettop(L) - 1);
+      err = v->rules == NULL;
+      if (v->rules)
+	v->rules->serial = ++f->serial;
+    }
+  }
+  lua_pop(L, 3);
+  if (err) {
+    rp_version_release(f, v);
+    return luaL_error(L, "cannot publish the database");
+  }
+  RP_LOCK(f);
+  v->serial = ++f->serial;
+  f->current = v;
+  v->next = f->versions;
+  f->versions = v;
+  RP_UNLOCK(f);
+  rp_version_release(f, old);
+  rp_sweep(L, m);
+  return 0;
+}
+
+int
+dl_refresh_version(lua_State *L)
+{
+  rp_member_t *m = rp_member(L);
+  rp_family_t *f;
+  rp_version_t *v;
+  int i;
+  if (!m || !m->replica)
+    return luaL_error(L, "the database is not a replica");
+  f = m->family;
+  rp_version_release(f, m->pending); /* Left by an error. */
+  m->pending = NULL;
+  RP_LOCK(f);
+  v = f->current;
+  if (v && v->serial != m->serial)
+    v->refs++;
+  else
+    v = NULL;
+  RP_UNLOCK(f);
+  if (!v) {
+    rp_answer(L, m);
+    return 0;
+  }
+  m->pending = v;
+  lua_getglobal(L, "dl_refresh");
+  lua_createtable(L, v->npreds, 0);
+  for (i = 0; i < v->npreds; i++) {
+    lua_createtable(L, 0, 3);
+    lua_pushlstring(L, v->preds[i].name, v->preds[i].len);
+    lua_setfield(L, -2, "name");
+    lua_pushinteger(L, v->preds[i].arity);
+    lua_setfield(L, -2, "arity");
+    dl_fs_push(L, v->preds[i].rows, v->preds[i].nrows);
+    lua_setfield(L, -2, "facts");
+    lua_rawseti(L, -2, i + 1);
+  }
+  if (v->rules->serial != m->rules)
+    dl_rules_push(L, v->rules);
+  else
+    lua_pushnil(L);
+  lua_call(L, 2, 0);
+  m->serial = v->serial;
+  m->rules = v->rules->serial;
+  m->pending = NULL;
+  rp_version_release(f, m->installed);
+  m->installed = v;
+  rp_answer(L, m);
+  return 0;
+}
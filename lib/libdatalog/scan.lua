@@ -0,0 +1,105 @@
+--[[
+
+A benchmark of the searches made by the fact stores of the C library,
+which compare the constants of a literal with the columns of a store
+several rows at a time, against the loop that unified the literal with
+each fact clause in turn, which is how facts were searched before the
+stores were added.  Run it with
+
+$ make scanbench && ./scanbench
+
+Each literal is searched in a fresh copy of the store, fewer times
+than it takes for a store to index a column, so every search scans.
+
+]]
+
+if not dl_factstore then
+   error("scan.lua needs the fact stores of the C library")
+end
+
+local n = 1000000		-- Facts per store
+local width = 4			-- Arity of the facts
+local range = 1000		-- Distinct constants per position
+local rounds = 5
+
+local mc = datalog.make_const
+local mv = datalog.make_var
+local ml = datalog.make_literal
+
+local consts = {}
+for i=1,range do
+   consts[i] = mc("c" .. i)
+end
+
+math.randomseed(1)
+local store = dl_factstore(width)
+local clauses = {}
+local syms = {}
+for i=1,n do
+   local terms = {}
+   for j=1,width do
+      terms[j] = consts[math.random(range)]
+   end
+   local literal = ml("scan", terms)
+   store:add(literal, syms)
+   clauses[i] = {head = literal}
+end
+
+-- The unify loop, specialized to a literal without repeated
+-- variables and ground facts.
+
+local function unify_loop(literal)
+   local found = {}
+   for i=1,#clauses do
+      local head = clauses[i].head
+      local j = 1
+      while j <= #literal do
+	 local term = literal[j]
+	 if term:is_const() and term ~= head[j] then
+	    break
+	 end
+	 j = j + 1
+      end
+      if j > #literal then
+	 table.insert(found, head)
+      end
+   end
+   return found
+end
+
+local function time(search, literal)
+   local best
+   local found
+   for i=1,rounds do
+      local start = os.clock()
+      found = search(literal)
+      local t = os.clock() - start
+      if not best or t < best then
+	 best = t
+      end
+   end
+   return best, #found
+end
+
+print(string.format("%d facts of arity %d, %s kernel", n, width,
+		    store:kernel()))
+print("bound      unify loop  store scan  matches")
+local X, Y, Z = mv("X"), mv("Y"), mv("Z")
+local patterns = {
+   {consts[1], X, Y, Z},
+   {X, consts[2], consts[3], Y},
+   {consts[4], consts[5], consts[6], X},
+}
+for i=1,#patterns do
+   local literal = ml("scan", patterns[i])
+   local slow, m = time(unify_loop, literal)
+   local copy = store:copy()
+   local fast, k = time(function(literal)
+			   return copy:search(literal, syms)
+			end, literal)
+   if m ~= k then
+      error("the searches disagree")
+   end
+   print(string.format("%-10d %8.2f ms %8.2f ms  %d", i, slow * 1000,
+		       fast * 1000, m))
+end
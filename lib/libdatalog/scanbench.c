@@ -0,0 +1,65 @@
+/*
+ * Runs the fact store benchmark in scan.lua.
+ *
+ * Copyright (C) Alexander Hoffman, 2017
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
+ */
+
+/* The library only opens the base, table and string Lua libraries,
+   and the benchmark needs math and os too, so it is run by this
+   program instead of by the interpreter.  Build it with "make
+   scanbench", and run it from the source directory, or give it the
+   path to scan.lua. */
+
+#include <stdio.h>
+#include <lua.h>
+#include <lualib.h>
+#include <lauxlib.h>
+#include "datalog.h"
+
+static void
+open_lib(lua_State *L, const char *name, lua_CFunction f)
+{
+#if LUA_VERSION_NUM < 502
+  lua_pushcfunction(L, f);
+  lua_pushstring(L, name);
+  lua_call(L, 1, 0);
+#else
+  luaL_requiref(L, name, f, 1);
+  lua_pop(L, 1);
+#endif
+}
+
+int
+main(int argc, char *argv[])
+{
+  const char *file = argc > 1 ? argv[1] : "scan.lua";
+  dl_db_t db = dl_open();
+  if (!db) {
+    fprintf(stderr, "Internal error\n");
+    return 1;
+  }
+  open_lib(db, LUA_MATHLIBNAME, luaopen_math);
+  open_lib(db, LUA_OSLIBNAME, luaopen_os);
+  if (luaL_dofile(db, file)) {
+    const char *s = lua_tostring(db, -1);
+    fprintf(stderr, "%s\n", s ? s : "no error message available");
+    dl_close(db);
+    return 1;
+  }
+  dl_close(db);
+  return 0;
+}
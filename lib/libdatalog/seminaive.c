@@ -0,0 +1,1775 @@
+/*
+ * A native semi-naive bottom-up evaluator for the clauses stored by
+ * the Datalog interpreter written in Lua.
+ *
+ * Copyright (C) Alexander Hoffman, 2017
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307  USA
+ */
+
+/* The evaluator copies the clauses of every predicate a query
+   depends on out of the Lua database, and the rows of their fact
+   stores, replacing constants by small integers, and then computes the least fixed point of the program
+   one round at a time.  In each round, a rule is only applied to
+   combinations of tuples that include at least one tuple derived in
+   the previous round, the delta.  The tuples of a relation are kept
+   in an append-only array, so the tuples known before the last round,
+   the delta, and the tuples derived in the current round always
+   occupy three consecutive ranges of rows.
+
+   Body literals are joined by probing hash indexes built on demand
+   for the set of columns that are bound when the literal is reached.
+   The built-in equality predicate is evaluated directly. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <lua.h>
+#if !defined _WIN32
+#define SN_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#include "datalog.h"
+#include "dl_native.h"
+
+#define SN_MAXCOLS (8 * sizeof(unsigned long)) /* Indexable columns. */
+
+static size_t
+sn_mix(size_t h, size_t v)
+{
+  h = (h ^ v) * (size_t)0x9e3779b1u;
+  return h ^ (h >> 15);
+}
+
+static size_t
+sn_ptrhash(const void *p)
+{
+  return sn_mix(0, (size_t)p >> 3);
+}
+
+/* Pointer maps.  Keys are the addresses of Lua objects, which are
+   stable while the objects are referenced by the database. */
+
+typedef struct {
+  const void **keys;
+  int *vals;
+  size_t cap;			/* A power of two, or zero. */
+  size_t len;
+} sn_ptrmap_t;
+
+static int
+sn_ptrmap_get(sn_ptrmap_t *m, const void *key)
+{
+  size_t i;
+  if (!m->cap)
+    return -1;
+  for (i = sn_ptrhash(key) & (m->cap - 1); m->keys[i];
+       i = (i + 1) & (m->cap - 1))
+    if (m->keys[i] == key)
+      return m->vals[i];
+  return -1;
+}
+
+static int
+sn_ptrmap_put(sn_ptrmap_t *m, const void *key, int val)
+{
+  size_t i;
+  if (2 * (m->len + 1) > m->cap) {
+    sn_ptrmap_t n;
+    n.cap = m->cap ? 2 * m->cap : 64;
+    n.len = 0;
+    n.keys = (const void **)calloc(n.cap, sizeof(const void *));
+    n.vals = (int *)malloc(n.cap * sizeof(int));
+    if (!n.keys || !n.vals) {
+      free(n.keys);
+      free(n.vals);
+      return -1;
+    }
+    for (i = 0; i < m->cap; i++)
+      if (m->keys[i])
+	sn_ptrmap_put(&n, m->keys[i], m->vals[i]);
+    free(m->keys);
+    free(m->vals);
+    *m = n;
+  }
+  for (i = sn_ptrhash(key) & (m->cap - 1); m->keys[i];
+       i = (i + 1) & (m->cap - 1))
+    if (m->keys[i] == key) {
+      m->vals[i] = val;
+      return 0;
+    }
+  m->keys[i] = key;
+  m->vals[i] = val;
+  m->len++;
+  return 0;
+}
+
+static void
+sn_ptrmap_free(sn_ptrmap_t *m)
+{
+  free(m->keys);
+  free(m->vals);
+}
+
+/* Tuple sets.  Tuples are stored row after row in an append-only
+   array, and an open addressing hash table of row numbers plus one
+   removes duplicates. */
+
+typedef struct {
+  int *rows;
+  size_t len;			/* Number of tuples. */
+  size_t cap;			/* Number of tuples allocated. */
+  size_t *slots;
+  size_t nslots;		/* A power of two, or zero. */
+} sn_set_t;
+
+static size_t
+sn_hash(const int *t, int arity)
+{
+  size_t h = (size_t)arity;
+  int i;
+  for (i = 0; i < arity; i++)
+    h = sn_mix(h, (size_t)(unsigned)t[i]);
+  return h;
+}
+
+/* Returns the slot where the tuple is or would be stored. */
+static size_t
+sn_set_slot(const sn_set_t *s, int arity, const int *t, size_t h)
+{
+  size_t i, r;
+  for (i = h & (s->nslots - 1); (r = s->slots[i]) != 0;
+       i = (i + 1) & (s->nslots - 1))
+    if (!memcmp(s->rows + (r - 1) * arity, t, arity * sizeof(int)))
+      break;
+  return i;
+}
+
+static int
+sn_set_has(const sn_set_t *s, int arity, const int *t, size_t h)
+{
+  return s->nslots && s->slots[sn_set_slot(s, arity, t, h)];
+}
+
+static int
+sn_set_grow(sn_set_t *s, int arity)
+{
+  size_t i, n = s->nslots ? 2 * s->nslots : 16;
+  size_t *slots = (size_t *)calloc(n, sizeof(size_t));
+  if (!slots)
+    return -1;
+  free(s->slots);
+  s->slots = slots;
+  s->nslots = n;
+  for (i = 0; i < s->len; i++) {
+    const int *t = s->rows + i * arity;
+    s->slots[sn_set_slot(s, arity, t, sn_hash(t, arity))] = i + 1;
+  }
+  return 0;
+}
+
+/* Adds a tuple.  Returns 1 when added, 0 when already present, and
+   -1 when out of memory. */
+static int
+sn_set_add(sn_set_t *s, int arity, const int *t, size_t h)
+{
+  size_t i;
+  if (2 * (s->len + 1) > s->nslots && sn_set_grow(s, arity))
+    return -1;
+  i = sn_set_slot(s, arity, t, h);
+  if (s->slots[i])
+    return 0;
+  if (s->len == s->cap) {
+    size_t cap = s->cap ? 2 * s->cap : 16;
+    int *rows = (int *)realloc(s->rows, cap * (arity ? arity : 1)
+			       * sizeof(int));
+    if (!rows)
+      return -1;
+    s->rows = rows;
+    s->cap = cap;
+  }
+  memcpy(s->rows + s->len * arity, t, arity * sizeof(int));
+  s->slots[i] = ++s->len;
+  return 1;
+}
+
+static void
+sn_set_clear(sn_set_t *s)
+{
+  s->len = 0;
+  if (s->slots)
+    memset(s->slots, 0, s->nslots * sizeof(size_t));
+}
+
+static void
+sn_set_free(sn_set_t *s)
+{
+  free(s->rows);
+  free(s->slots);
+}
+
+/* Indexes map the values of a set of bound columns to a chain of
+   rows.  Rows are pushed on the front of their chain, so chains list
+   rows in decreasing order, which lets a probe restricted to a range
+   of rows stop early. */
+
+typedef struct sn_index {
+  unsigned long mask;		/* The indexed columns. */
+  size_t *heads;		/* Row plus one, or zero. */
+  size_t nheads;		/* A power of two. */
+  size_t *next;			/* Row plus one, or zero. */
+  size_t cap;
+  size_t len;			/* Number of rows indexed. */
+  struct sn_index *link;
+} sn_index_t;
+
+static size_t
+sn_keyhash(const int *t, int arity, unsigned long mask)
+{
+  size_t h = (size_t)mask;
+  int i;
+  for (i = 0; i < arity && i < (int)SN_MAXCOLS; i++)
+    if (mask & (1UL << i))
+      h = sn_mix(h, (size_t)(unsigned)t[i]);
+  return h;
+}
+
+/* Relations */
+
+typedef struct {
+  const char *name;		/* Owned by Lua. */
+  size_t namelen;
+  int arity;
+  int equals;			/* Is this the equality primitive? */
+  sn_set_t all;			/* Every tuple derived so far. */
+  sn_set_t next;		/* Tuples derived in this round. */
+  size_t lo, hi;		/* The delta is rows lo up to hi. */
+  sn_index_t *indexes;
+} sn_rel_t;
+
+static int
+sn_index_add(sn_index_t *x, const sn_rel_t *r, size_t row)
+{
+  size_t h;
+  if (row >= x->cap) {
+    size_t cap = r->all.cap;
+    size_t *next = (size_t *)realloc(x->next, cap * sizeof(size_t));
+    if (!next)
+      return -1;
+    x->next = next;
+    x->cap = cap;
+  }
+  h = sn_keyhash(r->all.rows + row * r->arity, r->arity, x->mask);
+  h &= x->nheads - 1;
+  x->next[row] = x->heads[h];
+  x->heads[h] = row + 1;
+  x->len = row + 1;
+  return 0;
+}
+
+/* Brings an index up to date with the rows of its relation. */
+static int
+sn_index_sync(sn_index_t *x, const sn_rel_t *r)
+{
+  size_t row = x->len;
+  if (r->all.len > x->nheads) {	/* Rehash. */
+    size_t n = x->nheads;
+    size_t *heads;
+    while (n < r->all.len)
+      n *= 2;
+    heads = (size_t *)calloc(n, sizeof(size_t));
+    if (!heads)
+      return -1;
+    free(x->heads);
+    x->heads = heads;
+    x->nheads = n;
+    row = 0;
+  }
+  for (; row < r->all.len; row++)
+    if (sn_index_add(x, r, row))
+      return -1;
+  return 0;
+}
+
+static sn_index_t *
+sn_index_find(sn_rel_t *r, unsigned long mask)
+{
+  sn_index_t *x;
+  for (x = r->indexes; x; x = x->link)
+    if (x->mask == mask)
+      return x;
+  return NULL;
+}
+
+/* Returns the index on the columns in mask, making it if need be. */
+static sn_index_t *
+sn_index_get(sn_rel_t *r, unsigned long mask)
+{
+  sn_index_t *x = sn_index_find(r, mask);
+  if (x)
+    return x;
+  x = (sn_index_t *)calloc(1, sizeof(sn_index_t));
+  if (!x)
+    return NULL;
+  x->mask = mask;
+  x->nheads = 16;
+  x->heads = (size_t *)calloc(x->nheads, sizeof(size_t));
+  if (!x->heads || sn_index_sync(x, r)) {
+    free(x->heads);
+    free(x->next);
+    free(x);
+    return NULL;
+  }
+  x->link = r->indexes;
+  r->indexes = x;
+  return x;
+}
+
+/* Moves the tuples derived in a round into the relation, and makes
+   them the delta of the next round. */
+static int
+sn_rel_advance(sn_rel_t *r)
+{
+  size_t i;
+  sn_index_t *x;
+  r->lo = r->all.len;
+  for (i = 0; i < r->next.len; i++) {
+    const int *t = r->next.rows + i * r->arity;
+    if (sn_set_add(&r->all, r->arity, t, sn_hash(t, r->arity)) < 0)
+      return -1;
+  }
+  r->hi = r->all.len;
+  sn_set_clear(&r->next);
+  for (x = r->indexes; x; x = x->link)
+    if (sn_index_sync(x, r))
+      return -1;
+  return 0;
+}
+
+/* Rules */
+
+/* An argument is either a constant, represented by a symbol number,
+   or a variable, represented by minus one minus its number. */
+
+typedef struct {
+  sn_rel_t *rel;
+  int *args;
+} sn_lit_t;
+
+typedef struct {
+  sn_lit_t head;
+  int nbody;
+  sn_lit_t *body;
+  int nvars;
+} sn_rule_t;
+
+/* The state of an evaluation. */
+
+typedef struct {
+  lua_State *L;
+  int cnst;			/* Stack index of the const metatable. */
+  int *bysym;			/* Lua symbol to symbol number, or -1. */
+  int nbysym;
+  const char **symstr;		/* Symbol names, owned by Lua. */
+  size_t *symlen;
+  int nsyms, capsyms;
+  sn_ptrmap_t relmap;		/* Lua predicate to relation number. */
+  sn_rel_t *rels;
+  int nrels;
+  sn_rule_t *rules;
+  int nrules, caprules;
+  int *bind;			/* Bindings of the query's variables. */
+  int *tuple;			/* Scratch space for a fact. */
+  int maxvars, maxbody, maxarity;
+  int first;			/* Is this the first round? */
+  int threads;			/* Threads that share a round. */
+} sn_eval_t;
+
+/* Returns the symbol number of the Lua constant at idx, whose Lua
+   symbol is sym, or -1 when out of memory. */
+static int
+sn_intern_sym(sn_eval_t *e, int sym, int idx)
+{
+  lua_State *L = e->L;
+  if (sym <= 0)
+    return -1;
+  if (sym < e->nbysym && e->bysym[sym] >= 0)
+    return e->bysym[sym];
+  if (sym >= e->nbysym) {
+    int i, cap = e->nbysym ? 2 * e->nbysym : 256;
+    int *b;
+    while (cap <= sym)
+      cap *= 2;
+    b = (int *)realloc(e->bysym, cap * sizeof(int));
+    if (!b)
+      return -1;
+    for (i = e->nbysym; i < cap; i++)
+      b[i] = -1;
+    e->bysym = b;
+    e->nbysym = cap;
+  }
+  if (e->nsyms == e->capsyms) {
+    int cap = e->capsyms ? 2 * e->capsyms : 256;
+    const char **s = (const char **)realloc(e->symstr,
+					    cap * sizeof(const char *));
+    size_t *n;
+    if (!s)
+      return -1;
+    e->symstr = s;
+    n = (size_t *)realloc(e->symlen, cap * sizeof(size_t));
+    if (!n)
+      return -1;
+    e->symlen = n;
+    e->capsyms = cap;
+  }
+  lua_pushstring(L, "id");
+  lua_rawget(L, idx < 0 ? idx - 1 : idx);
+  e->symstr[e->nsyms] = lua_tolstring(L, -1, &e->symlen[e->nsyms]);
+  lua_pop(L, 1);		/* The constant keeps its id alive. */
+  if (!e->symstr[e->nsyms])
+    return -1;
+  e->bysym[sym] = e->nsyms;
+  return e->nsyms++;
+}
+
+static int
+sn_intern(sn_eval_t *e, int idx)
+{
+  int sym;
+  lua_pushstring(e->L, "sym");
+  lua_rawget(e->L, idx < 0 ? idx - 1 : idx);
+  sym = (int)lua_tointeger(e->L, -1);
+  lua_pop(e->L, 1);
+  return sn_intern_sym(e, sym, idx);
+}
+
+static int
+sn_isconst(sn_eval_t *e, int idx)
+{
+  int is;
+  if (!lua_getmetatable(e->L, idx))
+    return 0;
+  is = lua_rawequal(e->L, -1, e->cnst);
+  lua_pop(e->L, 1);
+  return is;
+}
+
+/* Reads the terms of the literal on the top of the stack into args.
+   Variables are numbered using vars, an array of the Lua variables
+   seen so far in the clause, which has room for maxvars entries. */
+static int
+sn_read_args(sn_eval_t *e, int *args, int arity,
+	     const void **vars, int *nvars)
+{
+  lua_State *L = e->L;
+  int i, j;
+  for (i = 0; i < arity; i++) {
+    lua_rawgeti(L, -1, i + 1);
+    if (sn_isconst(e, -1)) {
+      args[i] = sn_intern(e, -1);
+      if (args[i] < 0) {
+	lua_pop(L, 1);
+	return -1;
+      }
+    }
+    else if (!vars) {		/* Facts are ground. */
+      lua_pop(L, 1);
+      return -1;
+    }
+    else {
+      const void *v = lua_topointer(L, -1);
+      for (j = 0; j < *nvars && vars[j] != v; j++);
+      if (j == *nvars)
+	vars[(*nvars)++] = v;
+      args[i] = -1 - j;
+    }
+    lua_pop(L, 1);
+  }
+  return 0;
+}
+
+/* Returns the relation of the literal on the top of the stack. */
+static sn_rel_t *
+sn_literal_rel(sn_eval_t *e)
+{
+  int k;
+  lua_pushstring(e->L, "pred");
+  lua_rawget(e->L, -2);
+  k = sn_ptrmap_get(&e->relmap, lua_topointer(e->L, -1));
+  lua_pop(e->L, 1);
+  return k < 0 ? NULL : &e->rels[k];
+}
+
+/* Reads the clause on the top of the stack. */
+static int
+sn_read_clause(sn_eval_t *e, sn_rel_t *head)
+{
+  lua_State *L = e->L;
+  int n = (int)lua_rawlen(L, -1);
+  int i, nvars = 0, maxvars = head->arity;
+  const void **vars;
+  sn_rule_t *r;
+
+  if (n == 0) {			/* A fact. */
+    int *t = e->tuple;
+    lua_pushstring(L, "head");
+    lua_rawget(L, -2);
+    i = sn_read_args(e, t, head->arity, NULL, &nvars);
+    lua_pop(L, 1);
+    if (i)
+      return i;
+    return sn_set_add(&head->all, head->arity, t,
+		      sn_hash(t, head->arity)) < 0 ? -1 : 0;
+  }
+
+  if (e->nrules == e->caprules) {
+    int cap = e->caprules ? 2 * e->caprules : 16;
+    sn_rule_t *rules = (sn_rule_t *)realloc(e->rules,
+					    cap * sizeof(sn_rule_t));
+    if (!rules)
+      return -1;
+    e->rules = rules;
+    e->caprules = cap;
+  }
+  r = &e->rules[e->nrules];
+  memset(r, 0, sizeof(sn_rule_t));
+  r->body = (sn_lit_t *)calloc(n, sizeof(sn_lit_t));
+  if (!r->body)
+    return -1;
+  e->nrules++;
+  r->nbody = n;
+
+  for (i = 1; i <= n; i++) {	/* Bound the number of variables. */
+    lua_rawgeti(L, -1, i);
+    maxvars += (int)lua_rawlen(L, -1);
+    lua_pop(L, 1);
+  }
+  vars = (const void **)malloc((maxvars + 1) * sizeof(const void *));
+  if (!vars)
+    return -1;
+
+  for (i = 0; i < n; i++) {
+    sn_lit_t *l = &r->body[i];
+    int arity;
+    lua_rawgeti(L, -1, i + 1);
+    l->rel = sn_literal_rel(e);
+    arity = (int)lua_rawlen(L, -1);
+    l->args = (int *)malloc((arity ? arity : 1) * sizeof(int));
+    if (!l->rel || !l->args
+	|| sn_read_args(e, l->args, arity, vars, &nvars)) {
+      lua_pop(L, 1);
+      free(vars);
+      return -1;
+    }
+    lua_pop(L, 1);
+  }
+
+  r->head.rel = head;
+  r->head.args = (int *)malloc((head->arity ? head->arity : 1)
+			       * sizeof(int));
+  lua_pushstring(L, "head");
+  lua_rawget(L, -2);
+  i = !r->head.args || sn_read_args(e, r->head.args, head->arity,
+				    vars, &nvars);
+  lua_pop(L, 1);
+  free(vars);
+  if (i)
+    return -1;
+
+  r->nvars = nvars;
+  if (nvars > e->maxvars)
+    e->maxvars = nvars;
+  if (n > e->maxbody)
+    e->maxbody = n;
+  return 0;
+}
+
+/* Reads the rows of a fact store into a relation.  The constants
+   of the Lua symbols in the rows are in the table at consts, which
+   makes them when looked up in a replica, as in factstore.c. */
+static int
+sn_read_facts(sn_eval_t *e, sn_rel_t *r, const dl_factstore_t *s,
+	      int consts)
+{
+  lua_State *L = e->L;
+  int *t = e->tuple;
+  size_t row;
+  int j;
+  if (s->arity != r->arity)
+    return -1;
+  for (row = 0; row < s->len; row++) {
+    for (j = 0; j < r->arity; j++) {
+      int sym = s->cols[j][row];
+      if (sym > 0 && sym < e->nbysym && e->bysym[sym] >= 0)
+	t[j] = e->bysym[sym];
+      else {
+	lua_rawgeti(L, consts, sym);
+	if (lua_isnil(L, -1)) {
+	  lua_pop(L, 1);
+	  lua_pushinteger(L, sym);
+	  lua_gettable(L, consts);
+	}
+	t[j] = lua_isnil(L, -1) ? -1 : sn_intern_sym(e, sym, -1);
+	lua_pop(L, 1);
+	if (t[j] < 0)
+	  return -1;
+      }
+    }
+    if (sn_set_add(&r->all, r->arity, t, sn_hash(t, r->arity)) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+/* Reads the relations named in the preds table at index p, and then
+   every clause stored in the database for them, or only the facts
+   when the entry of a relation says so, and the rows of their fact
+   stores. */
+static int
+sn_read_program(sn_eval_t *e, int p)
+{
+  lua_State *L = e->L;
+  int k, consts, n = (int)lua_rawlen(L, p);
+
+  e->rels = (sn_rel_t *)calloc(n ? n : 1, sizeof(sn_rel_t));
+  if (!e->rels)
+    return -1;
+  e->nrels = n;
+  for (k = 0; k < n; k++) {
+    sn_rel_t *r = &e->rels[k];
+    lua_rawgeti(L, p, k + 1);
+    lua_getfield(L, -1, "name");
+    r->name = lua_tolstring(L, -1, &r->namelen);
+    lua_pop(L, 1);		/* The predicate keeps its name alive. */
+    lua_getfield(L, -1, "arity");
+    r->arity = (int)lua_tointeger(L, -1);
+    lua_pop(L, 1);
+    lua_getfield(L, -1, "equals");
+    r->equals = lua_toboolean(L, -1);
+    lua_pop(L, 1);
+    lua_getfield(L, -1, "pred");
+    if (sn_ptrmap_put(&e->relmap, lua_topointer(L, -1), k)) {
+      lua_pop(L, 2);
+      return -1;
+    }
+    lua_pop(L, 2);
+    if (r->arity > e->maxarity)
+      e->maxarity = r->arity;
+  }
+
+  e->tuple = (int *)malloc((e->maxarity + 1) * sizeof(int));
+  if (!e->tuple)
+    return -1;
+
+  lua_getfield(L, p, "consts");
+  consts = lua_gettop(L);
+  for (k = 0; k < n; k++) {
+    sn_rel_t *r = &e->rels[k];
+    dl_factstore_t *s;
+    int facts;
+    if (r->equals)
+      continue;
+    lua_rawgeti(L, p, k + 1);
+    lua_getfield(L, -1, "facts");
+    facts = lua_toboolean(L, -1);
+    lua_pop(L, 1);
+    lua_getfield(L, -1, "pred");
+    lua_pushstring(L, "db");
+    lua_rawget(L, -2);
+    lua_pushnil(L);
+    while (lua_next(L, -2)) {	/* For each clause. */
+      if ((!facts || lua_rawlen(L, -1) == 0) && sn_read_clause(e, r)) {
+	lua_pop(L, 6);
+	return -1;
+      }
+      lua_pop(L, 1);
+    }
+    lua_pushstring(L, "facts");
+    lua_rawget(L, -3);
+    s = dl_tofactstore(L, -1);
+    if (s && sn_read_facts(e, r, s, consts)) {
+      lua_pop(L, 5);
+      return -1;
+    }
+    lua_pop(L, 4);
+  }
+  lua_pop(L, 1);
+  return 0;
+}
+
+/* Joins */
+
+/* The state of a join.  The main thread and each worker thread of a
+   parallel round have their own. */
+
+typedef struct {
+  sn_eval_t *e;
+  int *bind;			/* Variable bindings, or -1. */
+  int *trail;			/* Variables bound by a literal. */
+  int *order;			/* Join order of a rule body. */
+  int *tuple;			/* Scratch space for a head or a key. */
+  sn_set_t *next;		/* Tuples derived, one set per relation, */
+				/* or null to add them to the relations. */
+  size_t lo, hi;		/* Rows of the delta literal. */
+  int err;
+} sn_join_t;
+
+static void sn_join(sn_join_t *j, sn_rule_t *r, int k, int delta);
+
+static void
+sn_emit(sn_join_t *j, sn_rule_t *r)
+{
+  sn_rel_t *h = r->head.rel;
+  sn_set_t *s;
+  int *t = j->tuple;
+  size_t hash;
+  int i;
+  for (i = 0; i < h->arity; i++) {
+    int a = r->head.args[i];
+    t[i] = a >= 0 ? a : j->bind[-1 - a];
+    if (t[i] < 0)
+      return;			/* Unbound, so no fact. */
+  }
+  hash = sn_hash(t, h->arity);
+  s = j->next ? &j->next[h - j->e->rels] : &h->next;
+  if (!sn_set_has(&h->all, h->arity, t, hash)
+      && sn_set_add(s, h->arity, t, hash) < 0)
+    j->err = 1;
+}
+
+/* Evaluates a use of the equality primitive. */
+static void
+sn_equals(sn_join_t *j, sn_rule_t *r, sn_lit_t *l, int k, int delta)
+{
+  int x = l->args[0], y = l->args[1];
+  int vx = x >= 0 ? x : j->bind[-1 - x];
+  int vy = y >= 0 ? y : j->bind[-1 - y];
+  if (vx >= 0 && vy >= 0) {
+    if (vx == vy)
+      sn_join(j, r, k + 1, delta);
+  }
+  else if (vx >= 0) {
+    j->bind[-1 - y] = vx;
+    sn_join(j, r, k + 1, delta);
+    j->bind[-1 - y] = -1;
+  }
+  else if (vy >= 0) {
+    j->bind[-1 - x] = vy;
+    sn_join(j, r, k + 1, delta);
+    j->bind[-1 - x] = -1;
+  }				/* Otherwise there is no answer. */
+}
+
+/* Binds the variables of a literal to the values in a row, and if it
+   matches, continues with the rest of the body. */
+static void
+sn_match(sn_join_t *j, sn_rule_t *r, sn_lit_t *l, size_t row,
+	 int k, int delta)
+{
+  const int *t = l->rel->all.rows + row * l->rel->arity;
+  int *trail = j->trail + k * j->e->maxarity;
+  int i, n = 0;
+  for (i = 0; i < l->rel->arity; i++) {
+    int a = l->args[i];
+    if (a >= 0) {
+      if (a != t[i])
+	break;
+    }
+    else if (j->bind[-1 - a] < 0) {
+      j->bind[-1 - a] = t[i];
+      trail[n++] = -1 - a;
+    }
+    else if (j->bind[-1 - a] != t[i])
+      break;
+  }
+  if (i == l->rel->arity)
+    sn_join(j, r, k + 1, delta);
+  while (n > 0)
+    j->bind[trail[--n]] = -1;
+}
+
+/* Joins the kth literal in the evaluation order of a rule.  The
+   literal at position delta in the body only ranges over the rows
+   lo up to hi of the join, which are in the delta of its relation,
+   literals before it over the tuples known before the last round,
+   and literals after it over both.
+
+   Indexes are made when first probed, except by the worker threads
+   of a parallel round, which only use indexes made by sn_prepare. */
+static void
+sn_join(sn_join_t *j, sn_rule_t *r, int k, int delta)
+{
+  sn_lit_t *l;
+  sn_rel_t *rel;
+  size_t lo, hi, row;
+  unsigned long mask = 0;
+  int i, pos;
+
+  if (j->err)
+    return;
+  if (k == r->nbody) {
+    sn_emit(j, r);
+    return;
+  }
+  pos = j->order[k];
+  l = &r->body[pos];
+  rel = l->rel;
+  if (rel->equals) {
+    sn_equals(j, r, l, k, delta);
+    return;
+  }
+  if (pos == delta) {
+    lo = j->lo;
+    hi = j->hi;
+  }
+  else {
+    lo = 0;
+    hi = pos < delta ? rel->lo : rel->hi;
+  }
+
+  for (i = 0; i < rel->arity && i < (int)SN_MAXCOLS; i++) {
+    int a = l->args[i];
+    if (a >= 0 || j->bind[-1 - a] >= 0)
+      mask |= 1UL << i;
+  }
+
+  if (!mask) {			/* Scan. */
+    for (row = lo; row < hi && !j->err; row++)
+      sn_match(j, r, l, row, k, delta);
+  }
+  else {			/* Probe. */
+    sn_index_t *x = j->next ? sn_index_find(rel, mask)
+      : sn_index_get(rel, mask);
+    int *key = j->tuple;
+    size_t h;
+    if (!x) {
+      j->err = 1;
+      return;
+    }
+    for (i = 0; i < rel->arity; i++) {
+      int a = l->args[i];
+      key[i] = a >= 0 ? a : j->bind[-1 - a];
+    }
+    h = sn_keyhash(key, rel->arity, mask);
+    for (row = x->heads[h & (x->nheads - 1)]; row && !j->err;
+	 row = x->next[row - 1]) {
+      if (row - 1 >= hi)
+	continue;
+      if (row - 1 < lo)
+	break;
+      sn_match(j, r, l, row - 1, k, delta);
+    }
+  }
+}
+
+/* Sets the join order of a rule that starts with the delta literal
+   at position delta of its body, or keeps the order of the body when
+   delta is negative. */
+static void
+sn_order(sn_join_t *j, sn_rule_t *r, int delta)
+{
+  int i, k = 0;
+  if (delta >= 0)
+    j->order[k++] = delta;
+  for (i = 0; i < r->nbody; i++)
+    if (i != delta)
+      j->order[k++] = i;
+}
+
+/* Applies a rule to the current delta. */
+static void
+sn_apply(sn_join_t *j, sn_rule_t *r)
+{
+  int i, relational = 0;
+
+  for (i = 0; i < r->nbody; i++) {
+    sn_rel_t *rel = r->body[i].rel;
+    if (rel->equals)
+      continue;
+    relational = 1;
+    if (rel->lo == rel->hi)
+      continue;
+    sn_order(j, r, i);		/* Start with the delta literal. */
+    j->lo = rel->lo;
+    j->hi = rel->hi;
+    sn_join(j, r, 0, i);
+  }
+
+  if (!relational && j->e->first) { /* Rules without relational */
+    sn_order(j, r, -1);		    /* literals. */
+    sn_join(j, r, 0, -1);
+  }
+}
+
+/* Parallel rounds
+
+   When the delta of a round is large, the applications of the rules
+   to it are divided into tasks, each of which joins a range of rows
+   of one delta literal, and the tasks are dealt out to the main
+   thread and a pool of worker threads.  Each thread keeps its tasks
+   in a deque.  It takes tasks from the back of its own deque, and
+   when that is empty, steals tasks from the front of the deques of
+   the others, so threads that draw cheap tasks help the rest.  The
+   round ends when every deque is empty and every thread is idle.
+
+   Threads only read the relations and their indexes during a round.
+   The indexes a round probes are made before it starts, and every
+   thread adds the tuples it derives to sets of its own, which are
+   merged into the next sets of the relations after the round, so
+   the relations end up with the tuples the sequential rounds would
+   add, though maybe in a different order. */
+
+#define SN_PARMIN 4096		/* Fewest delta rows worth sharing. */
+#define SN_CHUNKS 8		/* Tasks per thread and delta literal. */
+#define SN_CHUNKMIN 256		/* Fewest rows in a task. */
+
+typedef struct {
+  sn_rule_t *rule;
+  int delta;			/* Position of the delta literal, or -1. */
+  size_t lo, hi;		/* Its rows. */
+} sn_task_t;
+
+typedef struct sn_worker {
+  sn_join_t join;
+  sn_task_t *tasks;		/* The deque is tasks head up to tail. */
+  size_t head, tail, cap;
+  struct sn_pool *pool;
+#if defined SN_THREADS
+  pthread_mutex_t lock;
+  pthread_t thread;
+#endif
+} sn_worker_t;
+
+typedef struct sn_pool {
+  sn_worker_t *workers;		/* Worker 0 is the main thread. */
+  int nworkers;
+#if defined SN_THREADS
+  int nthreads;			/* Worker threads started. */
+  pthread_mutex_t lock;
+  pthread_cond_t start;		/* Signaled when a round starts. */
+  pthread_cond_t done;		/* Signaled when the last thread idles. */
+  unsigned long round;
+  int busy;			/* Worker threads still in the round. */
+  int quit;
+#endif
+} sn_pool_t;
+
+static int
+sn_join_init(sn_join_t *j, sn_eval_t *e, int local)
+{
+  int v;
+  memset(j, 0, sizeof(sn_join_t));
+  j->e = e;
+  j->bind = (int *)malloc((e->maxvars + 1) * sizeof(int));
+  j->trail = (int *)malloc(((e->maxbody + 1) * (e->maxarity + 1))
+			   * sizeof(int));
+  j->order = (int *)malloc((e->maxbody + 1) * sizeof(int));
+  j->tuple = (int *)malloc((e->maxarity + 1) * sizeof(int));
+  if (local)
+    j->next = (sn_set_t *)calloc(e->nrels + 1, sizeof(sn_set_t));
+  if (!j->bind || !j->trail || !j->order || !j->tuple
+      || (local && !j->next))
+    return -1;
+  for (v = 0; v <= e->maxvars; v++)
+    j->bind[v] = -1;
+  return 0;
+}
+
+static void
+sn_join_free(sn_join_t *j)
+{
+  int i;
+  if (j->next)
+    for (i = 0; i < j->e->nrels; i++)
+      sn_set_free(&j->next[i]);
+  free(j->bind);
+  free(j->trail);
+  free(j->order);
+  free(j->tuple);
+  free(j->next);
+}
+
+static int
+sn_push(sn_worker_t *w, sn_rule_t *r, int delta, size_t lo, size_t hi)
+{
+  sn_task_t *t;
+  if (w->tail == w->cap) {
+    size_t cap = w->cap ? 2 * w->cap : 64;
+    t = (sn_task_t *)realloc(w->tasks, cap * sizeof(sn_task_t));
+    if (!t)
+      return -1;
+    w->tasks = t;
+    w->cap = cap;
+  }
+  t = &w->tasks[w->tail++];
+  t->rule = r;
+  t->delta = delta;
+  t->lo = lo;
+  t->hi = hi;
+  return 0;
+}
+
+/* Takes a task from the back of the deque of a worker, or from the
+   front of the deque of another.  Returns zero when there is none. */
+static int
+sn_take(sn_worker_t *w, sn_worker_t *from, sn_task_t *t)
+{
+  int found = 0;
+#if defined SN_THREADS
+  pthread_mutex_lock(&from->lock);
+#endif
+  if (from->head < from->tail) {
+    *t = from == w ? from->tasks[--from->tail] : from->tasks[from->head++];
+    found = 1;
+  }
+#if defined SN_THREADS
+  pthread_mutex_unlock(&from->lock);
+#endif
+  return found;
+}
+
+/* Runs tasks until every deque is empty. */
+static void
+sn_work(sn_worker_t *w)
+{
+  sn_pool_t *p = w->pool;
+  sn_join_t *j = &w->join;
+  int self = (int)(w - p->workers);
+  int i = 0;
+  sn_task_t t;
+  while (i < p->nworkers && !j->err) {
+    if (!sn_take(w, &p->workers[(self + i) % p->nworkers], &t)) {
+      i++;			/* Try the next deque. */
+      continue;
+    }
+    i = 0;
+    sn_order(j, t.rule, t.delta);
+    j->lo = t.lo;
+    j->hi = t.hi;
+    sn_join(j, t.rule, 0, t.delta);
+  }
+}
+
+#if defined SN_THREADS
+static void *
+sn_worker_main(void *arg)
+{
+  sn_worker_t *w = (sn_worker_t *)arg;
+  sn_pool_t *p = w->pool;
+  unsigned long round = 0;
+  for (;;) {
+    pthread_mutex_lock(&p->lock);
+    while (p->round == round && !p->quit)
+      pthread_cond_wait(&p->start, &p->lock);
+    if (p->quit) {
+      pthread_mutex_unlock(&p->lock);
+      return NULL;
+    }
+    round = p->round;
+    pthread_mutex_unlock(&p->lock);
+    sn_work(w);
+    pthread_mutex_lock(&p->lock);
+    if (--p->busy == 0)
+      pthread_cond_signal(&p->done);
+    pthread_mutex_unlock(&p->lock);
+  }
+}
+#endif
+
+static void
+sn_pool_free(sn_pool_t *p)
+{
+  int i;
+  if (!p)
+    return;
+#if defined SN_THREADS
+  pthread_mutex_lock(&p->lock);
+  p->quit = 1;
+  pthread_cond_broadcast(&p->start);
+  pthread_mutex_unlock(&p->lock);
+  for (i = 1; i <= p->nthreads; i++)
+    pthread_join(p->workers[i].thread, NULL);
+#endif
+  for (i = 0; i < p->nworkers; i++) {
+    sn_join_free(&p->workers[i].join);
+    free(p->workers[i].tasks);
+#if defined SN_THREADS
+    pthread_mutex_destroy(&p->workers[i].lock);
+#endif
+  }
+#if defined SN_THREADS
+  pthread_mutex_destroy(&p->lock);
+  pthread_cond_destroy(&p->start);
+  pthread_cond_destroy(&p->done);
+#endif
+  free(p->workers);
+  free(p);
+}
+
+/* Makes a pool of n workers, and starts a thread for each one after
+   the first, or fewer when threads cannot be started.  The deques of
+   workers without a thread are emptied by the others. */
+static sn_pool_t *
+sn_pool_make(sn_eval_t *e, int n)
+{
+  sn_pool_t *p = (sn_pool_t *)calloc(1, sizeof(sn_pool_t));
+  int i;
+  if (!p)
+    return NULL;
+  p->workers = (sn_worker_t *)calloc(n, sizeof(sn_worker_t));
+  if (!p->workers) {
+    free(p);
+    return NULL;
+  }
+#if defined SN_THREADS
+  pthread_mutex_init(&p->lock, NULL);
+  pthread_cond_init(&p->start, NULL);
+  pthread_cond_init(&p->done, NULL);
+#endif
+  for (i = 0; i < n; i++) {
+    sn_worker_t *w = &p->workers[i];
+    w->pool = p;
+#if defined SN_THREADS
+    pthread_mutex_init(&w->lock, NULL);
+#endif
+    p->nworkers++;
+    if (sn_join_init(&w->join, e, 1)) {
+      sn_pool_free(p);
+      return NULL;
+    }
+  }
+#if defined SN_THREADS
+  for (i = 1; i < n; i++) {
+    if (pthread_create(&p->workers[i].thread, NULL, sn_worker_main,
+		       &p->workers[i]))
+      break;
+    p->nthreads++;
+  }
+#endif
+  return p;
+}
+
+/* Makes the indexes probed by a join of a rule in the order given,
+   by following the variables bound at each step the way sn_join
+   does.  The bound array has room for a flag per variable. */
+static int
+sn_prepare(sn_rule_t *r, const int *order, char *bound)
+{
+  int i, k;
+  memset(bound, 0, r->nvars + 1);
+  for (k = 0; k < r->nbody; k++) {
+    sn_lit_t *l = &r->body[order[k]];
+    unsigned long mask = 0;
+    if (l->rel->equals) {
+      int x = l->args[0], y = l->args[1];
+      if ((x < 0 && !bound[-1 - x]) && (y < 0 && !bound[-1 - y]))
+	return 0;		/* No answer, so no more probes. */
+    }
+    else {
+      for (i = 0; i < l->rel->arity && i < (int)SN_MAXCOLS; i++) {
+	int a = l->args[i];
+	if (a >= 0 || bound[-1 - a])
+	  mask |= 1UL << i;
+      }
+      if (mask && !sn_index_get(l->rel, mask))
+	return -1;
+    }
+    for (i = 0; i < l->rel->arity; i++)
+      if (l->args[i] < 0)
+	bound[-1 - l->args[i]] = 1;
+  }
+  return 0;
+}
+
+/* Returns the number of delta rows read by the rules in a round, a
+   relation counting once for each body literal reading it. */
+static size_t
+sn_delta_rows(const sn_eval_t *e)
+{
+  size_t rows = 0;
+  int i, d;
+  for (i = 0; i < e->nrules; i++)
+    for (d = 0; d < e->rules[i].nbody; d++) {
+      const sn_rel_t *rel = e->rules[i].body[d].rel;
+      if (!rel->equals)
+	rows += rel->hi - rel->lo;
+    }
+  return rows;
+}
+
+/* Deals out the tasks of a round to the workers of a pool, and makes
+   the indexes they need. */
+static int
+sn_deal(sn_eval_t *e, sn_pool_t *p)
+{
+  sn_join_t *j = &p->workers[0].join;
+  char *bound = (char *)malloc(e->maxvars + 1);
+  int i, d, n = 0;
+  if (!bound)
+    return -1;
+  for (i = 0; i < e->nrules; i++) {
+    sn_rule_t *r = &e->rules[i];
+    int relational = 0;
+    for (d = 0; d < r->nbody; d++) {
+      sn_rel_t *rel = r->body[d].rel;
+      size_t lo, chunk = rel->hi - rel->lo;
+      int a, split = 1;
+      if (rel->equals)
+	continue;
+      relational = 1;
+      if (rel->lo == rel->hi)
+	continue;
+      sn_order(j, r, d);
+      if (sn_prepare(r, j->order, bound))
+	goto fail;
+      for (a = 0; a < rel->arity; a++)
+	if (r->body[d].args[a] >= 0)
+	  split = 0;		/* The delta is probed, not scanned. */
+      if (split) {
+	chunk /= p->nworkers * SN_CHUNKS;
+	if (chunk < SN_CHUNKMIN)
+	  chunk = SN_CHUNKMIN;
+      }
+      for (lo = rel->lo; lo < rel->hi; lo += chunk)
+	if (sn_push(&p->workers[n++ % p->nworkers], r, d, lo,
+		    lo + chunk < rel->hi ? lo + chunk : rel->hi))
+	  goto fail;
+    }
+    if (!relational && e->first) {
+      sn_order(j, r, -1);
+      if (sn_prepare(r, j->order, bound)
+	  || sn_push(&p->workers[n++ % p->nworkers], r, -1, 0, 0))
+	goto fail;
+    }
+  }
+  free(bound);
+  return 0;
+
+ fail:
+  free(bound);
+  return -1;
+}
+
+/* Runs the tasks dealt out by sn_deal, and merges the tuples derived
+   into the relations. */
+static int
+sn_run(sn_eval_t *e, sn_pool_t *p)
+{
+  int i, k;
+  size_t row;
+#if defined SN_THREADS
+  pthread_mutex_lock(&p->lock);
+  p->busy = p->nthreads;
+  p->round++;
+  pthread_cond_broadcast(&p->start);
+  pthread_mutex_unlock(&p->lock);
+#endif
+  sn_work(&p->workers[0]);
+#if defined SN_THREADS
+  pthread_mutex_lock(&p->lock);
+  while (p->busy > 0)
+    pthread_cond_wait(&p->done, &p->lock);
+  pthread_mutex_unlock(&p->lock);
+#endif
+  for (i = 0; i < p->nworkers; i++) {
+    sn_worker_t *w = &p->workers[i];
+    w->head = w->tail = 0;	/* Left over after an error. */
+    if (w->join.err)
+      return -1;
+    for (k = 0; k < e->nrels; k++) {
+      sn_rel_t *rel = &e->rels[k];
+      sn_set_t *s = &w->join.next[k];
+      for (row = 0; row < s->len; row++) {
+	const int *t = s->rows + row * rel->arity;
+	if (sn_set_add(&rel->next, rel->arity, t,
+		       sn_hash(t, rel->arity)) < 0)
+	  return -1;
+      }
+      sn_set_clear(s);
+    }
+  }
+  return 0;
+}
+
+static int
+sn_fixpoint(sn_eval_t *e)
+{
+  sn_join_t j;
+  sn_pool_t *p = NULL;
+  int i, more, rc = -1;
+
+  if (sn_join_init(&j, e, 0))
+    goto done;
+  e->first = 1;
+  for (i = 0; i < e->nrels; i++) {
+    e->rels[i].lo = 0;		/* Every fact is new in the */
+    e->rels[i].hi = e->rels[i].all.len;	/* first round. */
+  }
+
+  do {
+    size_t rows = 0;
+    if (e->threads > 1 && !p) {
+      p = sn_pool_make(e, e->threads);
+      if (!p)
+	goto done;
+    }
+    if (p && p->nworkers > 1)
+      rows = sn_delta_rows(e);
+    if (rows >= SN_PARMIN) {	/* Else not worth dealing out. */
+      if (sn_deal(e, p) || sn_run(e, p))
+	goto done;
+    }
+    else {
+      for (i = 0; i < e->nrules && !j.err; i++)
+	sn_apply(&j, &e->rules[i]);
+      if (j.err)
+	goto done;
+    }
+    e->first = 0;
+    more = 0;
+    for (i = 0; i < e->nrels; i++) {
+      if (sn_rel_advance(&e->rels[i]))
+	goto done;
+      if (e->rels[i].lo < e->rels[i].hi)
+	more = 1;
+    }
+  }
+  while (more);
+  rc = 0;
+
+ done:
+  sn_pool_free(p);
+  sn_join_free(&j);
+  return rc;
+}
+
+/* Answers */
+
+/* Does a tuple match the terms of the query?  The bindings of the
+   query's variables are reset before returning. */
+static int
+sn_selects(sn_eval_t *e, const sn_rel_t *rel, const int *args,
+	   const int *t)
+{
+  int i, j;
+  for (i = 0; i < rel->arity; i++) {
+    int a = args[i];
+    if (a >= 0) {
+      if (a != t[i])
+	break;
+    }
+    else if (e->bind[-1 - a] < 0)
+      e->bind[-1 - a] = t[i];
+    else if (e->bind[-1 - a] != t[i])
+      break;
+  }
+  for (j = 0; j < rel->arity; j++)
+    if (args[j] < 0)
+      e->bind[-1 - args[j]] = -1;
+  return i == rel->arity;
+}
+
+/* Counts the answers to a query, and the characters they need. */
+static size_t
+sn_count(sn_eval_t *e, const sn_rel_t *rel, const int *args,
+	 size_t *size)
+{
+  size_t row, n = 0;
+  int i;
+  *size = rel->namelen + 1;
+  for (row = 0; row < rel->all.len; row++) {
+    const int *t = rel->all.rows + row * rel->arity;
+    if (!sn_selects(e, rel, args, t))
+      continue;
+    for (i = 0; i < rel->arity; i++)
+      *size += e->symlen[t[i]] + 1;
+    n++;
+  }
+  return n;
+}
+
+/* Copies the answers to a query into a list laid out by dl_ask. */
+static dl_answers_t
+sn_answers(sn_eval_t *e, const sn_rel_t *rel, const int *args,
+	   size_t n, size_t size)
+{
+  size_t row;
+  char *s, **p;
+  dl_answers_t b;
+  int i;
+
+  b = dl_answers_alloc(n, rel->arity, size);
+  if (!b)
+    return NULL;
+  p = b->pred;
+  s = p[0];
+  memcpy(s, rel->name, rel->namelen);
+  s[rel->namelen] = 0;
+  s += rel->namelen + 1;
+  *++p = s;
+
+  n = 0;
+  for (row = 0; row < rel->all.len; row++) {
+    const int *t = rel->all.rows + row * rel->arity;
+    if (!sn_selects(e, rel, args, t))
+      continue;
+    b->term[n++] = p;
+    for (i = 0; i < rel->arity; i++) {
+      memcpy(s, e->symstr[t[i]], e->symlen[t[i]]);
+      s[e->symlen[t[i]]] = 0;
+      s += e->symlen[t[i]] + 1;
+      *++p = s;
+    }
+  }
+  return b;
+}
+
+/* Aggregates */
+
+/* Reads a constant as a number.  Returns zero when it is not one. */
+static int
+sn_number(const char *s, size_t len, double *x)
+{
+  char *end;
+  if (len == 0 || strlen(s) != len)
+    return 0;
+  *x = strtod(s, &end);
+  if (end == s || *x != *x || *x - *x != 0) /* Nan or infinity. */
+    return 0;
+  while (isspace((unsigned char)*end))
+    end++;
+  return *end == 0;
+}
+
+#define SN_NUMLEN 32		/* Room for a number formatted by %.14g. */
+
+/* Groups the answers to a query, and combines them as requested.
+   The groups are kept in a tuple set of the group columns, and the
+   value of the group in row i of the set is vals[i].  Sets err when
+   out of memory. */
+static dl_answers_t
+sn_aggregate(sn_eval_t *e, const sn_rel_t *rel, const int *args,
+	     const dl_agg_t *agg, int *err)
+{
+  sn_set_t groups;
+  double *vals = NULL;
+  int *cols, *key;
+  int i, ncols = 0;
+  size_t row, n, size, h, nvals = 0;
+  char *s, **p, num[SN_NUMLEN];
+  dl_answers_t b = NULL;
+
+  *err = 1;
+  memset(&groups, 0, sizeof(sn_set_t));
+  cols = (int *)malloc((rel->arity + 1) * sizeof(int));
+  key = (int *)malloc((rel->arity + 1) * sizeof(int));
+  if (!cols || !key)
+    goto done;
+  for (i = 0; i < rel->arity && i < (int)SN_MAXCOLS; i++)
+    if (agg->group & (1UL << i))
+      cols[ncols++] = i;
+  if ((i < (int)SN_MAXCOLS && (agg->group >> i) != 0) /* Out of range. */
+      || (agg->op != DL_AGG_COUNT
+	  && (agg->column < 0 || agg->column >= rel->arity)))
+    goto done;
+
+  for (row = 0; row < rel->all.len; row++) {
+    const int *t = rel->all.rows + row * rel->arity;
+    double x = 1;
+    int added;
+    if (!sn_selects(e, rel, args, t))
+      continue;
+    if (agg->op != DL_AGG_COUNT
+	&& !sn_number(e->symstr[t[agg->column]],
+		      e->symlen[t[agg->column]], &x))
+      continue;
+    for (i = 0; i < ncols; i++)
+      key[i] = t[cols[i]];
+    h = sn_hash(key, ncols);
+    added = sn_set_add(&groups, ncols, key, h);
+    if (added < 0)
+      goto done;
+    if (added) {
+      if (groups.len > nvals) {
+	double *v = (double *)realloc(vals, groups.cap * sizeof(double));
+	if (!v)
+	  goto done;
+	vals = v;
+	nvals = groups.cap;
+      }
+      vals[groups.len - 1] = x;
+    }
+    else {
+      double *v = &vals[groups.slots[sn_set_slot(&groups, ncols, key, h)]
+			- 1];
+      switch (agg->op) {
+      case DL_AGG_MIN:
+	if (x < *v)
+	  *v = x;
+	break;
+      case DL_AGG_MAX:
+	if (x > *v)
+	  *v = x;
+	break;
+      default:
+	*v += x;
+      }
+    }
+  }
+
+  n = groups.len;
+  *err = 0;
+  if (n == 0)
+    goto done;
+
+  size = rel->namelen + 1;
+  for (row = 0; row < n; row++) {
+    const int *t = groups.rows + row * ncols;
+    for (i = 0; i < ncols; i++)
+      size += e->symlen[t[i]] + 1;
+    size += sprintf(num, "%.14g", vals[row]) + 1;
+  }
+  b = dl_answers_alloc(n, ncols + 1, size);
+  if (!b) {
+    *err = 1;
+    goto done;
+  }
+  p = b->pred;
+  s = p[0];
+  memcpy(s, rel->name, rel->namelen);
+  s[rel->namelen] = 0;
+  s += rel->namelen + 1;
+  *++p = s;
+  for (row = 0; row < n; row++) {
+    const int *t = groups.rows + row * ncols;
+    b->term[row] = p;
+    for (i = 0; i < ncols; i++) {
+      memcpy(s, e->symstr[t[i]], e->symlen[t[i]]);
+      s[e->symlen[t[i]]] = 0;
+      s += e->symlen[t[i]] + 1;
+      *++p = s;
+    }
+    s += sprintf(s, "%.14g", vals[row]) + 1;
+    *++p = s;
+  }
+
+ done:
+  free(cols);
+  free(key);
+  free(vals);
+  sn_set_free(&groups);
+  return b;
+}
+
+/* Returns the number of processors online. */
+static int
+sn_processors(void)
+{
+#if defined SN_THREADS && defined _SC_NPROCESSORS_ONLN
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? (int)n : 1;
+#else
+  return 1;
+#endif
+}
+
+static void
+sn_free(sn_eval_t *e)
+{
+  int i, j;
+  for (i = 0; i < e->nrules; i++) {
+    for (j = 0; j < e->rules[i].nbody; j++)
+      free(e->rules[i].body[j].args);
+    free(e->rules[i].body);
+    free(e->rules[i].head.args);
+  }
+  free(e->rules);
+  for (i = 0; i < e->nrels; i++) {
+    sn_index_t *x = e->rels[i].indexes;
+    while (x) {
+      sn_index_t *link = x->link;
+      free(x->heads);
+      free(x->next);
+      free(x);
+      x = link;
+    }
+    sn_set_free(&e->rels[i].all);
+    sn_set_free(&e->rels[i].next);
+  }
+  free(e->rels);
+  sn_ptrmap_free(&e->relmap);
+  free(e->bysym);
+  free(e->symstr);
+  free(e->symlen);
+  free(e->bind);
+  free(e->tuple);
+}
+
+/* Computes the least fixed point of the program on the stack, and
+   reads the query.  Sets rel to the relation of the query, which is
+   the null pointer when the query has no answers, and args to its
+   arguments. */
+static int
+sn_evaluate(sn_eval_t *e, lua_State *L, int threads, sn_rel_t **rel,
+	    int **args)
+{
+  const void **vars = NULL;
+  int i, nvars = 0, rc = 1;
+
+  *rel = NULL;
+  *args = NULL;
+  memset(e, 0, sizeof(sn_eval_t));
+  e->L = L;
+  e->cnst = lua_gettop(L);
+  e->threads = threads > 0 ? threads : sn_processors();
+  if (sn_read_program(e, e->cnst - 1) || sn_fixpoint(e))
+    return 1;
+
+  lua_pushvalue(L, e->cnst - 2);	/* The query. */
+  *rel = sn_literal_rel(e);
+  if (*rel) {
+    *args = (int *)malloc(((*rel)->arity + 1) * sizeof(int));
+    vars = (const void **)malloc(((*rel)->arity + 1)
+				 * sizeof(const void *));
+    if (!*args || !vars
+	|| sn_read_args(e, *args, (*rel)->arity, vars, &nvars)) {
+      lua_pop(L, 1);
+      goto done;
+    }
+  }
+  lua_pop(L, 1);
+  if (*rel) {
+    free(e->bind);		/* Room for the query's variables. */
+    e->bind = (int *)malloc((nvars + 1) * sizeof(int));
+    if (!e->bind)
+      goto done;
+    for (i = 0; i < nvars; i++)
+      e->bind[i] = -1;
+  }
+  rc = 0;
+
+ done:
+  free(vars);
+  return rc;
+}
+
+/* Stack: ... literal preds const -> ... literal preds const */
+int
+dl_seminaive(lua_State *L, dl_answers_t *a, const dl_agg_t *agg,
+	     int threads)
+{
+  sn_eval_t e;
+  sn_rel_t *rel;
+  int *args;
+  int rc = 1;
+  size_t n, size;
+
+  *a = NULL;
+  if (sn_evaluate(&e, L, threads, &rel, &args))
+    goto done;
+  if (rel) {
+    if (agg) {
+      int err;
+      *a = sn_aggregate(&e, rel, args, agg, &err);
+      if (err)
+	goto done;
+    }
+    else {
+      n = sn_count(&e, rel, args, &size);
+      if (n > 0) {
+	*a = sn_answers(&e, rel, args, n, size);
+	if (!*a)
+	  goto done;		/* Out of memory. */
+      }
+    }
+  }
+  rc = 0;
+
+ done:
+  free(args);
+  sn_free(&e);
+  return rc;
+}
+
+/* Queries read one answer at a time */
+
+struct dl_sn_query {
+  sn_eval_t e;
+  sn_rel_t *rel;
+  int *args;
+  size_t row;			/* The next row to select from. */
+};
+
+/* Stack: ... literal preds const -> ... literal preds const */
+int
+dl_seminaive_open(lua_State *L, dl_sn_query_t **q, int threads)
+{
+  dl_sn_query_t *b = (dl_sn_query_t *)malloc(sizeof(dl_sn_query_t));
+  *q = NULL;
+  if (!b)
+    return 1;
+  b->row = 0;
+  if (sn_evaluate(&b->e, L, threads, &b->rel, &b->args)) {
+    dl_seminaive_close(b);
+    return 1;
+  }
+  *q = b;
+  return 0;
+}
+
+const char *
+dl_seminaive_pred(dl_sn_query_t *q, size_t *len, size_t *arity)
+{
+  if (!q->rel) {
+    *len = *arity = 0;
+    return NULL;
+  }
+  *len = q->rel->namelen;
+  *arity = q->rel->arity;
+  return q->rel->name;
+}
+
+int
+dl_seminaive_next(dl_sn_query_t *q, const char **terms, size_t *lens)
+{
+  sn_eval_t *e = &q->e;
+  const sn_rel_t *rel = q->rel;
+  int i;
+  if (!rel)
+    return 0;
+  while (q->row < rel->all.len) {
+    const int *t = rel->all.rows + q->row++ * rel->arity;
+    if (!sn_selects(e, rel, q->args, t))
+      continue;
+    for (i = 0; i < rel->arity; i++) {
+      terms[i] = e->symstr[t[i]];
+      lens[i] = e->symlen[t[i]];
+    }
+    return 1;
+  }
+  return 0;
+}
+
+void
+dl_seminaive_close(dl_sn_query_t *q)
+{
+  if (q) {
+    free(q->args);
+    sn_free(&q->e);
+    free(q);
+  }
+}
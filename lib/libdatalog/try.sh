@@ -5,4 +5,10 @@ do
   b=`basename $i .dl`
   ./datalog $i | sort > $b.out
   diff -u $b.txt $b.out
+  ./datalog -b $i | sort > $b.out
+  diff -u $b.txt $b.out
+  ./datalog -m $i | sort > $b.out
+  diff -u $b.txt $b.out
+  ./datalog -j 4 $i | sort > $b.out
+  diff -u $b.txt $b.out
 done
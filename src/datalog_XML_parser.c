@@ -28,6 +28,7 @@
 #include <string.h>
 
 #include "libxml/parser.h"
+#include "libxml/xmlreader.h"
 
 #include "datalog_XML_parser.h"
 
@@ -95,7 +96,7 @@ void dl_parser_print_rule(dl_parser_rule_t* rule)
 
 void dl_parser_print_rule_list(dl_parser_doc_t* doc)
 {
-    if(doc->rules_head == NULL){
+    if(doc->rule_count == 0){
 #ifdef PARSER_ERR
         fprintf(stderr, "[DATALOG][PARSER] Err: cannot print rule list, list doesn't"
                 "exsist\n");
@@ -103,14 +104,8 @@ void dl_parser_print_rule_list(dl_parser_doc_t* doc)
         return;
     }
     
-    dl_parser_rule_t* rule_head = doc->rules_head;
-
-    while(rule_head != NULL){
-
-        dl_parser_print_rule(rule_head);
-
-        rule_head = rule_head->next;
-    }
+    for(int i = 0; i < doc->rule_count; i++)
+        dl_parser_print_rule(&doc->rules[i]);
 }
 
 void dl_parser_print_fact(dl_parser_fact_t* fact)
@@ -122,7 +117,7 @@ void dl_parser_print_fact(dl_parser_fact_t* fact)
 
 void dl_parser_print_fact_list(dl_parser_doc_t* doc)
 {
-    if(doc->facts_head == NULL){
+    if(doc->fact_count == 0){
 #ifdef PARSER_ERR
         fprintf(stderr, "[DATALOG][PARSER] Err: cannot print fact list, list doesn't"
                 "exsist\n");
@@ -130,109 +125,186 @@ void dl_parser_print_fact_list(dl_parser_doc_t* doc)
         return;
     }
     
-    dl_parser_fact_t* fact_head = doc->facts_head;
+    for(int i = 0; i < doc->fact_count; i++)
+        dl_parser_print_fact(&doc->facts[i]);
+}
 
-    while(fact_head != NULL){
+//arena blocks start at this size and double, up to the largest
+#define DL_PARSER_ARENA_BLOCK 65536
+#define DL_PARSER_ARENA_BLOCK_MAX (16 << 20)
+#define DL_PARSER_ARENA_ALIGN 16
+//the data of a block starts after its header, padded to the alignment
+#define DL_PARSER_ARENA_HEADER ((sizeof(dl_parser_arena_block_t) + \
+            DL_PARSER_ARENA_ALIGN - 1) & ~(size_t)(DL_PARSER_ARENA_ALIGN - 1))
 
-        dl_parser_print_fact(fact_head);
+void* dl_parser_arena_alloc(dl_parser_arena_t* arena, size_t size)
+{
+    dl_parser_arena_block_t* block = arena->blocks;
+    void* ret;
 
-        fact_head = fact_head->next;
+    size = (size + DL_PARSER_ARENA_ALIGN - 1) & ~(size_t)(DL_PARSER_ARENA_ALIGN - 1);
+
+    if(block == NULL || block->size - block->used < size){
+        size_t block_size = block ? block->size * 2 : DL_PARSER_ARENA_BLOCK;
+        if(block_size > DL_PARSER_ARENA_BLOCK_MAX) block_size = DL_PARSER_ARENA_BLOCK_MAX;
+        if(block_size < size) block_size = size;
+
+        block = (dl_parser_arena_block_t*)malloc(DL_PARSER_ARENA_HEADER + block_size);
+        if(block == NULL){
+#ifdef PARSER_ERR
+            fprintf(stderr, "[DATALOG][PARSER] Err: arena block alloc failed\n");
+#endif
+            return NULL;
+        }
+        block->next = arena->blocks;
+        block->used = 0;
+        block->size = block_size;
+        arena->blocks = block;
     }
+
+    ret = (char*)block + DL_PARSER_ARENA_HEADER + block->used;
+    block->used += size;
+    memset(ret, 0, size);
+
+    return ret;
 }
 
-dl_parser_rule_t* dl_parser_get_last_rule(dl_parser_doc_t* doc)
+char* dl_parser_arena_strdup(dl_parser_arena_t* arena, const char* string)
 {
-    if(doc->rules_head == NULL) return NULL;
+    size_t len = strlen(string) + 1;
+    char* ret = (char*)dl_parser_arena_alloc(arena, len);
 
-    dl_parser_rule_t* head = doc->rules_head;
+    if(ret != NULL) memcpy(ret, string, len);
 
-    while(head->next != NULL)
-        head = head->next;
-    
-    return head;
+    return ret;
+}
+
+void dl_parser_arena_reset(dl_parser_arena_t* arena)
+{
+    dl_parser_arena_block_t* block = arena->blocks;
+
+    if(block == NULL) return;
+
+    dl_parser_arena_block_t* tmp = block->next;
+    while(tmp != NULL){
+        dl_parser_arena_block_t* to_free = tmp;
+        tmp = tmp->next;
+        free(to_free);
+    }
+    block->next = NULL;
+    block->used = 0;
+}
+
+void dl_parser_arena_free(dl_parser_arena_t* arena)
+{
+    dl_parser_arena_reset(arena);
+    free(arena->blocks);
+    arena->blocks = NULL;
+}
+
+dl_parser_rule_t* dl_parser_get_last_rule(dl_parser_doc_t* doc)
+{
+    if(doc->rule_count == 0) return NULL;
+
+    return &doc->rules[doc->rule_count - 1];
 }
 
 DL_PARSER_ERR_t dl_parser_add_rule(dl_parser_doc_t* doc, dl_parser_rule_t* rule)
 {
-    if(doc->rules_head == NULL)
-        doc->rules_head = rule;
-    else{
-        dl_parser_rule_t* tmp = dl_parser_get_last_rule(doc);
-        tmp->next = rule;
+    if(doc->rule_count == doc->rule_size){
+        int size = doc->rule_size ? doc->rule_size * 2 : 64;
+        dl_parser_rule_t* tmp = (dl_parser_rule_t*)realloc(doc->rules, 
+                sizeof(dl_parser_rule_t) * size);
+        if(tmp == NULL) return DL_PARSER_MEM;
+        doc->rules = tmp;
+        doc->rule_size = size;
     }
+    doc->rules[doc->rule_count++] = *rule;
     
     return DL_PARSER_OK;
 }
 
 dl_parser_fact_t* dl_parser_get_last_fact(dl_parser_doc_t* doc)
 {
-    if(doc->facts_head == NULL) return NULL;
+    if(doc->fact_count == 0) return NULL;
 
-    dl_parser_fact_t* head = doc->facts_head;
-
-    while(head->next != NULL)
-        head = head->next;
-    
-    return head;
+    return &doc->facts[doc->fact_count - 1];
 }
 
 DL_PARSER_ERR_t dl_parser_add_fact(dl_parser_doc_t* doc, dl_parser_fact_t* fact)
 {
-    if(doc->facts_head == NULL)
-        doc->facts_head = fact;
-    else{
-        dl_parser_fact_t* tmp = dl_parser_get_last_fact(doc);
-        tmp->next = fact;
+    if(doc->fact_count == doc->fact_size){
+        int size = doc->fact_size ? doc->fact_size * 2 : 64;
+        dl_parser_fact_t* tmp = (dl_parser_fact_t*)realloc(doc->facts, 
+                sizeof(dl_parser_fact_t) * size);
+        if(tmp == NULL) return DL_PARSER_MEM;
+        doc->facts = tmp;
+        doc->fact_size = size;
     }
+    doc->facts[doc->fact_count++] = *fact;
 
     return DL_PARSER_OK;
 }
 
+/**
+* @brief Copies the text of a node into the document's arena
+*
+* @param doc pointer to parser document stuct
+* @param node Node whose children hold the text
+* @return char* the copy, NULL if out of memory
+*/
+static char* dl_parser_node_string(dl_parser_doc_t* doc, xmlNode* node)
+{
+    xmlNode* child = node->xmlChildrenNode;
+    xmlChar* contents;
+    char* ret;
+
+    //plain text is copied straight from its node
+    if(child == NULL) return dl_parser_arena_strdup(&doc->arena, "");
+    if(child->next == NULL && child->type == XML_TEXT_NODE)
+        return dl_parser_arena_strdup(&doc->arena, (const char*)child->content);
+
+    contents = xmlNodeListGetString(doc->document, child, 1);
+    ret = dl_parser_arena_strdup(&doc->arena, 
+            contents != NULL ? (const char*)contents : "");
+    xmlFree(contents);
+
+    return ret;
+}
+
 DL_PARSER_ERR_t dl_parse_terms(dl_parser_doc_t* doc, xmlNode* terms_node, 
         dl_parser_literal_t* literal)
 {
-    xmlChar* contents;
     xmlNode* tmp; 
-    char* temp_str;
-    dl_parser_term_t *tmp_term, *new_term;
+    dl_parser_term_t *tail = NULL, *new_term;
+    DL_PARSER_TERM_t type;
     tmp = terms_node->xmlChildrenNode;
 
     while(tmp != NULL){
-        if(!xmlStrcmp(tmp->name, (const xmlChar*) "constant")){
-            new_term = (dl_parser_term_t*)calloc(1, sizeof(dl_parser_term_t));
-            if(new_term == NULL) return DL_PARSER_MEM;
-            if(literal->term_head == NULL)
-                literal->term_head = new_term;
-            else{
-                tmp_term = literal->term_head;
-                while(tmp_term->next != NULL) tmp_term = tmp_term->next;
-                tmp_term->next = new_term;
-            }
-            contents = xmlNodeListGetString(doc->document, tmp->xmlChildrenNode, 1);
-            new_term->type = DL_PARSE_TERM_C; 
-            goto parse_terms_set_contents;
-        }else if(!xmlStrcmp(tmp->name, (const xmlChar*) "variable")){
-            new_term = (dl_parser_term_t*)calloc(1, sizeof(dl_parser_term_t));
-            if(new_term == NULL) return DL_PARSER_MEM;
-            if(literal->term_head == NULL)
-                literal->term_head = new_term;
-            else{
-                tmp_term = literal->term_head;
-                while(tmp_term->next != NULL) tmp_term = tmp_term->next;
-                tmp_term->next = new_term;
-            }
-            contents = xmlNodeListGetString(doc->document, tmp->xmlChildrenNode, 1);
-            new_term->type = DL_PARSE_TERM_V; 
-parse_terms_set_contents: 
-            new_term->value = (char*)malloc(sizeof(char) * (strlen((const char*)contents) + 1));
-            if(new_term->value == NULL) return DL_PARSER_MEM;
-            strcpy(new_term->value, (const char*)contents);
-            literal->term_count++;
+        if(!xmlStrcmp(tmp->name, (const xmlChar*) "constant"))
+            type = DL_PARSE_TERM_C; 
+        else if(!xmlStrcmp(tmp->name, (const xmlChar*) "variable"))
+            type = DL_PARSE_TERM_V; 
+        else{
+            tmp = tmp->next;
+            continue;
+        }
+
+        new_term = (dl_parser_term_t*)dl_parser_arena_alloc(&doc->arena, 
+                sizeof(dl_parser_term_t));
+        if(new_term == NULL) return DL_PARSER_MEM;
+        new_term->type = type;
+        new_term->value = dl_parser_node_string(doc, tmp);
+        if(new_term->value == NULL) return DL_PARSER_MEM;
+
+        if(tail == NULL) literal->term_head = new_term;
+        else tail->next = new_term;
+        tail = new_term;
+        literal->term_count++;
 #ifdef PARSER_DEBUG_VERBOSE
-            fprintf(stderr, "[DATALOG][PARSER] Verbose: term found for literal %s"
-                    " literal, value is \"%s\"\n", literal->predicate, new_term->value);
+        fprintf(stderr, "[DATALOG][PARSER] Verbose: term found for literal %s"
+                " literal, value is \"%s\"\n", literal->predicate, new_term->value);
 #endif
-        }
         tmp = tmp->next;
     }
     return DL_PARSER_OK;
@@ -240,7 +312,8 @@ parse_terms_set_contents:
 
 dl_parser_literal_t* dl_parser_process_literal(dl_parser_doc_t* doc, xmlNode* literal_node)
 {
-    dl_parser_literal_t* ret = (dl_parser_literal_t*)calloc(1, sizeof(dl_parser_literal_t));
+    dl_parser_literal_t* ret = (dl_parser_literal_t*)dl_parser_arena_alloc(&doc->arena,
+            sizeof(dl_parser_literal_t));
 
     if(ret == NULL){
 #ifdef PARSER_ERR 
@@ -250,16 +323,14 @@ dl_parser_literal_t* dl_parser_process_literal(dl_parser_doc_t* doc, xmlNode* li
     }
 
     xmlNode *tmp;
-    xmlChar* contents;
 
     tmp = literal_node->xmlChildrenNode;
 
     while(tmp != NULL){
         
         if(!xmlStrcmp(tmp->name, (const xmlChar*) "predicate")){
-            contents = xmlNodeListGetString(doc->document, tmp->xmlChildrenNode, 1);
-            ret->predicate = (char*)malloc(sizeof(char) * (strlen((const char*)contents) + 1));
-            strcpy(ret->predicate, (const char*)contents);
+            ret->predicate = dl_parser_node_string(doc, tmp);
+            if(ret->predicate == NULL) return NULL;
 #ifdef PARSER_DEBUG_VERBOSE
             fprintf(stderr, "[DATALOG][PARSER] Verbose: predicate found in process literal "
                     "value is \"%s\"\n", ret->predicate);
@@ -268,8 +339,9 @@ dl_parser_literal_t* dl_parser_process_literal(dl_parser_doc_t* doc, xmlNode* li
 #ifdef PARSER_DEBUG_VERBOSE
             fprintf(stderr, "[DATALOG][PARSER] Verbose: terms found in process literal\n");
 #endif  
-            if(ret->predicate != NULL) dl_parse_terms(doc, tmp, ret);
-            else return NULL;
+            if(ret->predicate == NULL || 
+                    dl_parse_terms(doc, tmp, ret) != DL_PARSER_OK) 
+                return NULL;
         }
         tmp = tmp->next;
     }
@@ -295,8 +367,8 @@ xmlNode* dl_parser_get_head_literal_node(xmlNode* head_node)
 dl_parser_clause_body_t* dl_parser_body_get_literal_nodes(dl_parser_doc_t* doc,
         xmlNode* body_node)
 {
-    dl_parser_clause_body_t* ret = 
-        (dl_parser_clause_body_t*)calloc(1, sizeof(dl_parser_clause_body_t));
+    dl_parser_clause_body_t* ret = (dl_parser_clause_body_t*)dl_parser_arena_alloc(
+            &doc->arena, sizeof(dl_parser_clause_body_t));
 
     if(ret == NULL){
 #ifdef PARSER_ERR 
@@ -305,36 +377,33 @@ dl_parser_clause_body_t* dl_parser_body_get_literal_nodes(dl_parser_doc_t* doc,
         return NULL;
     }
    
-    xmlNode* node = body_node->xmlChildrenNode;
-    dl_parser_literal_t* temp_literal;
-        
-    while(node != NULL){
-        if(!xmlStrcmp(node->name, (const xmlChar*)"literal")){
-            temp_literal = (dl_parser_literal_t*)calloc(1, sizeof(dl_parser_literal_t));
-            if(temp_literal == NULL){
+    xmlNode* node;
+    int count = 0;
+
+    //the literals are counted first so that their array is allocated once
+    for(node = body_node->xmlChildrenNode; node != NULL; node = node->next)
+        if(!xmlStrcmp(node->name, (const xmlChar*)"literal")) count++;
+
+    ret->literals = (dl_parser_literal_t**)dl_parser_arena_alloc(&doc->arena,
+            sizeof(dl_parser_literal_t*) * count);
+    if(count > 0 && ret->literals == NULL){
 #ifdef PARSER_ERR
-                fprintf(stderr, "[DATALOG][PARSER] Err: temp literal alloc failed\n");
+        fprintf(stderr, "[DATALOG][PARSER] Err: alloc of literal list failed\n");
 #endif
-                return NULL;
-            }
-            //TODO checks
-            temp_literal = dl_parser_process_literal(doc, node);
-
-            ret->literals = (dl_parser_literal_t**)realloc(ret->literals,
-                    sizeof(dl_parser_literal_t*) * (ret->literal_count + 1));
+        return NULL;
+    }
         
-            if(ret->literals == NULL){
+    for(node = body_node->xmlChildrenNode; node != NULL; node = node->next){
+        if(!xmlStrcmp(node->name, (const xmlChar*)"literal")){
+            ret->literals[ret->literal_count] = dl_parser_process_literal(doc, node);
+            if(ret->literals[ret->literal_count] == NULL){
 #ifdef PARSER_ERR
-                fprintf(stderr, "[DATALOG][PARSER] Err: realloc of literal list failed\n");
+                fprintf(stderr, "[DATALOG][PARSER] Err: temp literal alloc failed\n");
 #endif
                 return NULL;
             }
-
-            ret->literals[ret->literal_count] = temp_literal;
-
             ret->literal_count++;
         }
-        node = node->next;
     }
 
     return ret;
@@ -352,7 +421,8 @@ DL_PARSER_ERR_t dl_parser_process_rule(dl_parser_doc_t* doc, dl_parser_rule_t* r
 #endif
             //function for processing head
             xmlNode* head_node = dl_parser_get_head_literal_node(node);
-            rule->head = dl_parser_process_literal(doc, head_node);
+            if(head_node != NULL) 
+                rule->head = dl_parser_process_literal(doc, head_node);
         }else if(!xmlStrcmp(node->name, (const xmlChar*)"body")){
 #ifdef PARSER_DEBUG_VERBOSE
             fprintf(stderr, "[DATALOG][PARSER] Verbose: body node found for rule\n");
@@ -380,8 +450,10 @@ DL_PARSER_ERR_t dl_parser_process_fact(dl_parser_doc_t* doc, dl_parser_fact_t* f
         }
         node = node->next;
     }
+    if(node == NULL) return DL_PARSER_NO_NODE;
 
     node = dl_parser_get_head_literal_node(node);
+    if(node == NULL) return DL_PARSER_NO_NODE;
 
     fact->literal = dl_parser_process_literal(doc, node);
 
@@ -401,23 +473,23 @@ DL_PARSER_ERR_t dl_parser_mappings(dl_parser_doc_t* doc)
     doc->mappings_node = doc->mappings_node->next;
     }
 
-    //iterate through the next tier tags and push pointers to all
-    //facts and rules into lists
+    if(doc->mappings_node == NULL) return DL_PARSER_NO_NODE;
+
+    //iterate through the next tier tags and add all facts and rules 
+    //to their arrays
     xmlNode* node = doc->mappings_node->xmlChildrenNode;
     
     while(node != NULL){
         if(!xmlStrcmp(node->name, (const xmlChar*) "fact")){
             //create fact
-            dl_parser_fact_t* tmp = (dl_parser_fact_t*)calloc(1, sizeof(dl_parser_fact_t));
-            tmp->node = node;
-            dl_parser_add_fact(doc, tmp);
+            dl_parser_fact_t tmp = { .node = node };
+            if(dl_parser_add_fact(doc, &tmp) != DL_PARSER_OK) return DL_PARSER_MEM;
 #ifdef PARSER_DEBUG_VERBOSE
             fprintf(stderr, "[DATALOG][PARSER] Verbose: fact found whilst parsing mappings\n");
 #endif
         }else if(!xmlStrcmp(node->name, (const xmlChar*) "rule")){
-            dl_parser_rule_t* tmp = (dl_parser_rule_t*)calloc(1, sizeof(dl_parser_rule_t));
-            tmp->node = node;
-            dl_parser_add_rule(doc, tmp);
+            dl_parser_rule_t tmp = { .node = node };
+            if(dl_parser_add_rule(doc, &tmp) != DL_PARSER_OK) return DL_PARSER_MEM;
 #ifdef PARSER_DEBUG_VERBOSE
             fprintf(stderr, "[DATALOG][PARSER] Verbose: rule found whilst parsing mappings\n");
 #endif
@@ -425,20 +497,12 @@ DL_PARSER_ERR_t dl_parser_mappings(dl_parser_doc_t* doc)
         node = node->next;
     }
     
-    //process lists
-    dl_parser_fact_t* fact_head = doc->facts_head;
-
-    while(fact_head != NULL){
-        dl_parser_process_fact(doc, fact_head);    
-        fact_head = fact_head->next;
-    }
+    //process arrays
+    for(int i = 0; i < doc->fact_count; i++)
+        dl_parser_process_fact(doc, &doc->facts[i]);    
     
-    dl_parser_rule_t* rule_head = doc->rules_head;
-
-    while(rule_head != NULL){
-        dl_parser_process_rule(doc, rule_head);
-        rule_head = rule_head->next;
-    }
+    for(int i = 0; i < doc->rule_count; i++)
+        dl_parser_process_rule(doc, &doc->rules[i]);
 
 #ifdef PARSER_DEBUG_VERBOSE
             fprintf(stderr, "[DATALOG][PARSER] Verbose: facts processed in parse mappings\n");
@@ -618,84 +682,13 @@ DL_PARSER_ERR_t dl_parser_metadata(dl_parser_doc_t* doc)
     return DL_PARSER_OK;
 }
 
-void datalog_parser_free_term_list(dl_parser_term_t** term_head)
-{
-    dl_parser_term_t* tmp = *term_head;
-    dl_parser_term_t* to_free;
-    while(tmp->next != NULL){
-        if(tmp->value != NULL) free(tmp->value);
-        to_free = tmp;
-        tmp = tmp->next;
-        free(to_free);
-    }
-    if(tmp->value != NULL) free(tmp->value);
-    to_free = tmp;
-    tmp = tmp->next;
-    free(to_free);
-}
-
-void datalog_parser_free_literal(dl_parser_literal_t** lit)
-{
-    if((*lit)->predicate != NULL) free((*lit)->next);
-    if((*lit)->term_head != NULL) 
-        datalog_parser_free_term_list(&(*lit)->term_head);
-    free(*lit);
-    *lit = NULL;
-}
-
-void datalog_parser_free_clause_body(dl_parser_clause_body_t** body)
-{
-    for(int i = 0; i < (*body)->literal_count; i++)
-        if((*body)->literals[i] != NULL)
-            datalog_parser_free_literal(&(*body)->literals[i]);
-   free(*body);
-   *body = NULL;
-}
-
-void datalog_parser_free_fact(dl_parser_fact_t** fact)
-{
-    if((*fact)->literal != NULL) 
-        datalog_parser_free_literal(&(*fact)->literal);
-}
-
-void datalog_parser_free_fact_list(dl_parser_fact_t** fact_head)
-{
-    dl_parser_fact_t* tmp = *fact_head;
-    dl_parser_fact_t* to_free;
-    while(tmp->next != NULL){
-        to_free = tmp;
-        datalog_parser_free_fact(&to_free);
-        tmp = tmp->next;
-    }
-    datalog_parser_free_fact(&tmp);
-}
-
-void datalog_parser_free_rule(dl_parser_rule_t** rule)
-{
-    if((*rule)->head != NULL) free((*rule)->head);
-    datalog_parser_free_clause_body(&(*rule)->body);
-}
-
-void datalog_parser_free_rule_list(dl_parser_rule_t** rule_head)
-{
-    dl_parser_rule_t* tmp = *rule_head;
-    dl_parser_rule_t* to_free;
-    while(tmp->next != NULL){
-        to_free = tmp;
-        datalog_parser_free_rule(&to_free);
-        tmp = tmp->next;
-    }
-    datalog_parser_free_rule(&tmp);
-}
-
 DL_PARSER_ERR_t dl_parser_deinit_return_doc(dl_parser_return_doc_t** doc)
 {
     if((*doc)->filename != NULL) free((*doc)->filename);
     (*doc)->filename = NULL;
-    if((*doc)->facts_head != NULL)
-        datalog_parser_free_fact_list(&(*doc)->facts_head);
-    if((*doc)->rules_head != NULL)
-        datalog_parser_free_rule_list(&(*doc)->rules_head);
+    free((*doc)->facts);
+    free((*doc)->rules);
+    dl_parser_arena_free(&(*doc)->arena);
     free(*doc);
     *doc = NULL;
     return DL_PARSER_OK;
@@ -703,6 +696,7 @@ DL_PARSER_ERR_t dl_parser_deinit_return_doc(dl_parser_return_doc_t** doc)
 
 DL_PARSER_ERR_t dl_parser_deinit_with_data(dl_parser_doc_t** doc)
 {
+    if((*doc)->document != NULL) xmlFreeDoc((*doc)->document);
     free(*doc);
     *doc = NULL;
     return DL_PARSER_OK;
@@ -831,3 +825,152 @@ dl_parser_return_doc_t* dl_parser_runtime(char* filename)
     
     return ret_doc;
 }
+
+/**
+* @brief Processes a streamed <fact> node and hands it to the callback
+*
+* @param doc Parser document of the stream
+* @param node Expanded <fact> node
+* @param fact_cb Callback receiving the fact
+* @param data User data for the callback
+* @return DL_PARSER_ERR_t error of the callback, invalid facts are skipped
+*/
+static DL_PARSER_ERR_t dl_parser_stream_fact(dl_parser_doc_t* doc, xmlNode* node,
+        dl_parser_fact_cb_t fact_cb, void* data)
+{
+    DL_PARSER_ERR_t ret = DL_PARSER_OK;
+    dl_parser_fact_t fact = { .node = node };
+
+    if(dl_parser_process_fact(doc, &fact) == DL_PARSER_OK && 
+            fact.literal != NULL && fact.literal->predicate != NULL){
+#ifdef PARSER_DEBUG_VERBOSE
+        fprintf(stderr, "[DATALOG][PARSER] Verbose: fact streamed\n");
+#endif
+        ret = fact_cb(&fact, data);
+    }else{
+#ifdef PARSER_ERR
+        fprintf(stderr, "[DATALOG][PARSER] Err: invalid fact on line %ld\n",
+                xmlGetLineNo(node));
+#endif
+    }
+    dl_parser_arena_reset(&doc->arena);
+
+    return ret;
+}
+
+/**
+* @brief Processes a streamed <rule> node and hands it to the callback
+*
+* @param doc Parser document of the stream
+* @param node Expanded <rule> node
+* @param rule_cb Callback receiving the rule
+* @param data User data for the callback
+* @return DL_PARSER_ERR_t error of the callback, invalid rules are skipped
+*/
+static DL_PARSER_ERR_t dl_parser_stream_rule(dl_parser_doc_t* doc, xmlNode* node,
+        dl_parser_rule_cb_t rule_cb, void* data)
+{
+    DL_PARSER_ERR_t ret = DL_PARSER_OK;
+    dl_parser_rule_t rule = { .node = node };
+
+    dl_parser_process_rule(doc, &rule);
+    if(rule.head != NULL && rule.head->predicate != NULL && rule.body != NULL){
+#ifdef PARSER_DEBUG_VERBOSE
+        fprintf(stderr, "[DATALOG][PARSER] Verbose: rule streamed\n");
+#endif
+        ret = rule_cb(&rule, data);
+    }else{
+#ifdef PARSER_ERR
+        fprintf(stderr, "[DATALOG][PARSER] Err: invalid rule on line %ld\n",
+                xmlGetLineNo(node));
+#endif
+    }
+    dl_parser_arena_reset(&doc->arena);
+
+    return ret;
+}
+
+DL_PARSER_ERR_t dl_parser_stream(char* filename, dl_parser_fact_cb_t fact_cb,
+        dl_parser_rule_cb_t rule_cb, void* data)
+{
+    DL_PARSER_ERR_t ret = DL_PARSER_OK;
+    dl_parser_doc_t doc;
+    xmlTextReaderPtr reader;
+    xmlNode* node;
+    int read;
+
+    if(filename == NULL){
+#ifdef PARSER_ERR
+        fprintf(stderr, "[DATALOG][PARSER] ERR: XML filename invalid\n");
+#endif
+        return DL_PARSER_FILENAME;
+    }
+
+    reader = xmlReaderForFile(filename, NULL, 0);
+    if(reader == NULL){
+#ifdef PARSER_ERR
+        fprintf(stderr, "[DATALOG][PARSER] ERR: couldn't open XML file \"%s\"\n",
+                filename);
+#endif
+        return DL_PARSER_FILENAME;
+    }
+
+    memset(&doc, 0, sizeof(dl_parser_doc_t));
+    doc.filename = filename;
+
+    //only one <fact> or <rule> subtree is expanded at a time, the reader
+    //frees it when it moves past, so the memory used does not grow with
+    //the document
+    read = xmlTextReaderRead(reader);
+    while(read == 1){
+        if(xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT){
+            read = xmlTextReaderRead(reader);
+            continue;
+        }
+
+        if(xmlTextReaderDepth(reader) == 0 && xmlStrcmp(
+                    xmlTextReaderConstName(reader), (const xmlChar*) "datalog")){
+#ifdef PARSER_ERR
+            fprintf(stderr, "XML file is of the wrong type \n");
+            fprintf(stderr, "type is of \"%s\" when type datalog is needed\n",
+                    (const char*)xmlTextReaderConstName(reader));
+#endif
+            ret = DL_PARSER_FILETYPE;
+            break;
+        }
+
+        if(xmlTextReaderDepth(reader) != 2){
+            read = xmlTextReaderRead(reader);
+            continue;
+        }
+
+        node = xmlTextReaderExpand(reader);
+        if(node == NULL){
+            ret = DL_PARSER_DOC_;
+            break;
+        }
+        doc.document = node->doc;
+
+        if(node->parent != NULL && 
+                !xmlStrcmp(node->parent->name, (const xmlChar*) "mappings")){
+            if(!xmlStrcmp(node->name, (const xmlChar*) "fact"))
+                ret = dl_parser_stream_fact(&doc, node, fact_cb, data);
+            else if(!xmlStrcmp(node->name, (const xmlChar*) "rule"))
+                ret = dl_parser_stream_rule(&doc, node, rule_cb, data);
+        }
+        if(ret != DL_PARSER_OK) break;
+
+        read = xmlTextReaderNext(reader);
+    }
+    if(read < 0) ret = DL_PARSER_DOC_;
+
+    xmlFreeTextReader(reader);
+    dl_parser_arena_free(&doc.arena);
+
+#ifdef PARSER_DEBUG
+    fprintf(stderr, "[DATALOG][PARSER] Stream of \"%s\" finished:   %s\n",
+            filename, (ret == DL_PARSER_OK)?("SUCCESS"):("FAIL"));
+#endif
+
+    return ret;
+}
@@ -24,11 +24,116 @@
 @endverbatim
  */
 
+#include <pthread.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "datalog_api.h"
+#include "datalog_wal.h"
+
+/**
+* @struct datalog_replica
+* @brief A read-only copy of the global database used to answer queries,
+* locked by the thread using it
+*/
+typedef struct datalog_replica{
+    dl_db_t db;
+    pthread_mutex_t lock;
+}datalog_replica_t;
+
+//the pool is read-locked by each query from the moment it picks a database
+//until it lets it go, cursors included, and write-locked while it is opened
+//or closed
+static pthread_rwlock_t datalog_pool = PTHREAD_RWLOCK_INITIALIZER;
+static datalog_replica_t* datalog_replicas = NULL;
+static int datalog_replica_count = 0;
+static unsigned int datalog_replica_next = 0;
+static int datalog_cursors_open = 0;
+
+//bumped when the global database or the replicas are opened or closed, as
+//prepared queries then have to be prepared again in the new databases
+static unsigned long datalog_db_epoch = 0;
+static unsigned long datalog_replica_epoch = 0;
+
+/**
+* @struct datalog_prepared
+* @brief A query prepared in each database it is asked in, slot 0 is the
+* global database and slot i + 1 is replica i, along with the values bound
+* to its parameters
+*/
+struct datalog_prepared{
+    char* predicate;
+    int term_count;
+    char** terms;               //NULL for parameters
+    uint32_t term_type_mask;
+    uint32_t param_mask;
+    int param_count;
+    char** values;              //NULL until bound
+    size_t* value_caps;
+    int slot_count;
+    dl_prepared_t* slots;       //NULL until prepared in the slot's database
+    unsigned long db_epoch;
+    unsigned long replica_epoch;
+};
+
+//the global database is only used under the writer lock, queries running
+//on replicas publish a snapshot of it when it has changed and the writer
+//is idle, otherwise they ask the writer to publish one when it is done
+static pthread_mutex_t datalog_writer = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long datalog_writes = 0;
+static unsigned long datalog_published = 0;
+static int datalog_publish_wanted = 0;
+
+//runs a library call on the global database under the writer lock,
+//counting it as a change to the database when it succeeds and changed
+//is true
+#define DATALOG_GLOBAL(changed, call) \
+    (datalog_write_lock(), datalog_write_unlock((changed), (call)))
+
+void datalog_write_lock(void)
+{
+    pthread_mutex_lock(&datalog_writer);
+}
+
+/**
+* @brief Publishes the global database if it has changed since it was
+* last published, must hold the writer lock
+*
+* @return DATALOG_ERR_t error message
+*/
+static DATALOG_ERR_t datalog_publish_locked(void)
+{
+    unsigned long writes = __atomic_load_n(&datalog_writes, __ATOMIC_RELAXED);
+
+    if(datalog_replica_count == 0 || writes == datalog_published)
+        return DATALOG_OK;
+    if(dl_publish(datalog_db)) return DATALOG_ASRT;
+    __atomic_store_n(&datalog_published, writes, __ATOMIC_RELAXED);
+
+#ifdef DATALOG_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][API] VERBOSE: database version published\n");
+#endif
+
+    return DATALOG_OK;
+}
+
+int datalog_write_unlock(bool changed, int ret)
+{
+    if(changed && ret == 0)
+        __atomic_add_fetch(&datalog_writes, 1, __ATOMIC_RELAXED);
+    if(__atomic_exchange_n(&datalog_publish_wanted, 0, __ATOMIC_RELAXED))
+        datalog_publish_locked();
+    pthread_mutex_unlock(&datalog_writer);
+    return ret;
+}
+
+int datalog_publish_now_locked(void)
+{
+    if(dl_publish(datalog_db)) return -1;
+    __atomic_store_n(&datalog_published, datalog_writes, __ATOMIC_RELAXED);
+    return 0;
+}
 
 #ifdef DATALOG_TIMING
 double datalog_time_g;
@@ -40,11 +145,17 @@ double query_time_g;
 
 DATALOG_ERR_t datalog_engine_db_init(void)
 {
-    datalog_db = dl_open();
+    return datalog_engine_db_init_with(0);
+}
+
+DATALOG_ERR_t datalog_engine_db_init_with(int options)
+{
+    datalog_db = dl_open_with(options);
+    datalog_db_epoch++;
    
 #ifdef DATALOG_ERR
     if(datalog_db == NULL){
-        fprintf(stderr, "[DATALOG][API]   ERROR: dl_open() failed\n");
+        fprintf(stderr, "[DATALOG][API]   ERROR: dl_open_with() failed\n");
         return DATALOG_MEM;
     }
 #ifdef DATALOG_DEBUG
@@ -58,7 +169,9 @@ DATALOG_ERR_t datalog_engine_db_init(void)
 
 DATALOG_ERR_t datalog_engine_db_deinit(void)
 {
+    datalog_engine_wal_close();
     dl_close(datalog_db);
+    datalog_db_epoch++;
 
 #ifdef DATALOG_DEBUG
     printf("[DATALOG][API]   DEBUG: database closed\n");
@@ -67,6 +180,233 @@ DATALOG_ERR_t datalog_engine_db_deinit(void)
     return DATALOG_OK;
 }
 
+/**
+* @brief Closes the first count replicas and frees the pool, must hold the 
+* pool's write lock and the writer lock
+*
+* @param count Number of replicas opened
+* @return void
+*/
+static void datalog_replicas_close(int count)
+{
+    for(int i = 0; i < count; i++){
+        dl_close(datalog_replicas[i].db);
+        pthread_mutex_destroy(&datalog_replicas[i].lock);
+    }
+    free(datalog_replicas);
+    datalog_replicas = NULL;
+    datalog_replica_count = 0;
+    datalog_replica_epoch++;
+}
+
+DATALOG_ERR_t datalog_engine_replicas_init(int count)
+{
+    if(count <= 0) return DATALOG_INIT;
+
+    pthread_rwlock_wrlock(&datalog_pool);
+    if(datalog_replicas != NULL){
+        pthread_rwlock_unlock(&datalog_pool);
+        return DATALOG_INIT;
+    }
+    datalog_replicas = 
+        (datalog_replica_t*)calloc(count, sizeof(datalog_replica_t));
+    if(datalog_replicas == NULL){
+        pthread_rwlock_unlock(&datalog_pool);
+        return DATALOG_MEM;
+    }
+
+    datalog_write_lock();
+    datalog_publish_now_locked();
+    for(int i = 0; i < count; i++){
+        datalog_replicas[i].db = dl_open_replica(datalog_db);
+        if(datalog_replicas[i].db == NULL){
+#ifdef DATALOG_ERR
+            fprintf(stderr, "[DATALOG][API]   ERROR: dl_open_replica() failed\n");
+#endif
+            datalog_replicas_close(i);
+            pthread_mutex_unlock(&datalog_writer);
+            pthread_rwlock_unlock(&datalog_pool);
+            return DATALOG_INIT;
+        }
+        pthread_mutex_init(&datalog_replicas[i].lock, NULL);
+    }
+    datalog_replica_count = count;
+    datalog_replica_epoch++;
+    pthread_mutex_unlock(&datalog_writer);
+    pthread_rwlock_unlock(&datalog_pool);
+
+#ifdef DATALOG_DEBUG
+    fprintf(stderr, "[DATALOG][API]   DEBUG: %d replicas opened\n", count);
+#endif
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_replicas_deinit(void)
+{
+    //an open cursor holds the pool until it is closed, which could be never
+    //if it belongs to the calling thread
+    if(__atomic_load_n(&datalog_cursors_open, __ATOMIC_RELAXED) > 0){
+#ifdef DATALOG_ERR
+        fprintf(stderr, "[DATALOG][API]   ERROR: replicas not closed, cursors"
+                " are open\n");
+#endif
+        return DATALOG_INIT;
+    }
+
+    //waits for the queries running on the replicas, then for the writer
+    pthread_rwlock_wrlock(&datalog_pool);
+    datalog_write_lock();
+    datalog_replicas_close(datalog_replica_count);
+    pthread_mutex_unlock(&datalog_writer);
+    pthread_rwlock_unlock(&datalog_pool);
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_publish(void)
+{
+    DATALOG_ERR_t ret;
+
+    datalog_write_lock();
+    ret = datalog_publish_locked();
+    pthread_mutex_unlock(&datalog_writer);
+
+    return ret;
+}
+
+DATALOG_ERR_t datalog_engine_save(void)
+{
+    if(DATALOG_GLOBAL(false, dl_save(datalog_db))) return DATALOG_MEM;
+
+#ifdef DATALOG_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][API] VERBOSE: database saved\n");
+#endif
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_restore(void)
+{
+    //restoring is not logged, so the log starts again from an image
+    if(DATALOG_GLOBAL(true, dl_restore(datalog_db) || 
+                datalog_wal_checkpoint_locked())) 
+        return DATALOG_ASRT;
+
+#ifdef DATALOG_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][API] VERBOSE: database restored\n");
+#endif
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_snapshot(int* snapshot)
+{
+    if(DATALOG_GLOBAL(false, dl_snapshot(datalog_db, snapshot))) 
+        return DATALOG_MEM;
+
+#ifdef DATALOG_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][API] VERBOSE: snapshot %d taken\n", *snapshot);
+#endif
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_revert(int snapshot)
+{
+    if(DATALOG_GLOBAL(true, dl_revert(datalog_db, snapshot) || 
+                datalog_wal_checkpoint_locked())) 
+        return DATALOG_ASRT;
+
+#ifdef DATALOG_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][API] VERBOSE: reverted to snapshot %d\n", 
+            snapshot);
+#endif
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_release(int snapshot)
+{
+    DATALOG_GLOBAL(false, dl_release(datalog_db, snapshot));
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_image_save(const char* path)
+{
+    if(DATALOG_GLOBAL(false, dl_save_image(datalog_db, path))) 
+        return DATALOG_FILE;
+
+#ifdef DATALOG_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][API] VERBOSE: image %s saved\n", path);
+#endif
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_image_load(const char* path)
+{
+    if(DATALOG_GLOBAL(true, dl_load_image(datalog_db, path) || 
+                datalog_wal_checkpoint_locked())) 
+        return DATALOG_FILE;
+
+#ifdef DATALOG_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][API] VERBOSE: image %s loaded\n", path);
+#endif
+
+    return DATALOG_OK;
+}
+
+/**
+* @brief Locks a replica for a query, preferring one that is free, and
+* brings it up to the version last published
+*
+* @return datalog_replica_t* Locked replica, NULL when there is no pool, the
+* global database is then locked instead. The pool is read-locked either way
+*/
+static datalog_replica_t* datalog_replica_acquire(void)
+{
+    pthread_rwlock_rdlock(&datalog_pool);
+    if(datalog_replica_count == 0){
+        datalog_write_lock();
+        return NULL;
+    }
+
+    //take a snapshot of the latest writes without waiting for the writer
+    if(__atomic_load_n(&datalog_writes, __ATOMIC_RELAXED) != 
+            __atomic_load_n(&datalog_published, __ATOMIC_RELAXED)){
+        if(pthread_mutex_trylock(&datalog_writer) == 0){
+            datalog_publish_locked();
+            pthread_mutex_unlock(&datalog_writer);
+        }else __atomic_store_n(&datalog_publish_wanted, 1, __ATOMIC_RELAXED);
+    }
+
+    unsigned int start = 
+        __atomic_fetch_add(&datalog_replica_next, 1, __ATOMIC_RELAXED);
+    datalog_replica_t* rep = NULL;
+
+    for(int i = 0; i < datalog_replica_count && rep == NULL; i++){
+        datalog_replica_t* tmp = 
+            &datalog_replicas[(start + i) % datalog_replica_count];
+        if(pthread_mutex_trylock(&tmp->lock) == 0) rep = tmp;
+    }
+    if(rep == NULL){
+        rep = &datalog_replicas[start % datalog_replica_count];
+        pthread_mutex_lock(&rep->lock);
+    }
+    dl_refresh(rep->db);
+
+    return rep;
+}
+
+static void datalog_replica_release(datalog_replica_t* rep)
+{
+    if(rep != NULL) pthread_mutex_unlock(&rep->lock);
+    else datalog_write_unlock(false, 0);
+    pthread_rwlock_unlock(&datalog_pool);
+}
+
 void datalog_literal_set_functions(datalog_literal_t* lit)
 {
     lit->add_term = &datalog_literal_add_term;
@@ -116,15 +456,66 @@ int datalog_literal_add_term(datalog_literal_t* lit, char* value,
     return DATALOG_OK;
 }
 
-DATALOG_ERR_t datalog_literal_create(datalog_literal_t* lit)
+DATALOG_ERR_t datalog_literal_encode(datalog_literal_t* lit, dl_cmds_t* cmds)
 {
-    int ret = 0;
+    if(lit->predicate == NULL) return DATALOG_MEM;
+
+    //strings are coded with their trailing zero, as they were pushed
+    dl_cmd(cmds, DL_OP_PUSHLITERAL);
+    dl_cmd_lstring(cmds, DL_OP_ADDPRED, lit->predicate, 
+            strlen(lit->predicate) + 1);
+
+    datalog_term_t* tmp = lit->term_head;
+    for(int i = 0; i < lit->term_count; i++){
+        if(tmp == NULL || tmp->value == NULL) return DATALOG_TERM;
+        if(tmp->type == DL_TERM_C)
+            dl_cmd_lstring(cmds, DL_OP_ADDCONST, tmp->value, 
+                    strlen(tmp->value) + 1);
+        else if(tmp->type == DL_TERM_V)
+            dl_cmd_lstring(cmds, DL_OP_ADDVAR, tmp->value, 
+                    strlen(tmp->value) + 1);
+        else return DATALOG_TERM;
+        tmp = tmp->next;
+    }
+    dl_cmd(cmds, DL_OP_MAKELITERAL);
+
+    return (cmds->err ? DATALOG_MEM : DATALOG_OK);
+}
+
+DATALOG_ERR_t datalog_clause_encode(datalog_clause_t* clause, dl_cmds_t* cmds)
+{
+    if(datalog_literal_encode(clause->head, cmds) != DATALOG_OK)
+        return DATALOG_LIT;
+    dl_cmd(cmds, DL_OP_PUSHHEAD);
+
+    for(int i = 0; i < clause->literal_count; i++){
+        if(datalog_literal_encode(clause->body_list[i], cmds) != DATALOG_OK)
+            return DATALOG_LIT;
+        dl_cmd(cmds, DL_OP_ADDLITERAL);
+    }
+    dl_cmd(cmds, DL_OP_MAKECLAUSE);
+
+    return (cmds->err ? DATALOG_MEM : DATALOG_OK);
+}
+
+/**
+* @brief Runs a command buffer on a database, with the timing and messages
+* of the API
+*
+* @param db Database the commands are run on
+* @param cmds Commands to be run
+* @return int Return value of dl_exec, -1 when an unsafe clause was asserted
+*/
+static int datalog_exec_in(dl_db_t db, dl_cmds_t* cmds)
+{
+    int ret;
+
+    if(cmds->err) return 1;
 
-    //start literal, push empty literal onto stack
 #ifdef DATALOG_TIMING
     clock_t tmp_start = clock();
 #endif
-    ret = dl_pushliteral(datalog_db);
+    ret = dl_exec(db, cmds->buf, cmds->len);
 #ifdef DATALOG_TIMING
     clock_t tmp_end = clock();
     double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
@@ -132,139 +523,173 @@ DATALOG_ERR_t datalog_literal_create(datalog_literal_t* lit)
 #endif
 
 #ifdef DATALOG_DEBUG_VERBOSE 
-    fprintf(stderr, "[DATALOG][API] VERBOSE: empty literal pushed onto stack:    %s\n", 
-        (ret == 0 ? "SUCCSESS" : "FAIL"));
+    fprintf(stderr, "[DATALOG][API] VERBOSE: %zu bytes of commands run:        %s\n", 
+        cmds->len, (ret == 0 ? "SUCCSESS" : "FAIL"));
 #endif
 
-    if(ret) return DATALOG_LIT;
+    return ret;
+}
 
-    if(lit->predicate != NULL){
-        //push predicate symbol onto the stack via string
-#ifdef DATALOG_TIMING
-        tmp_start = clock();
-#endif
-        ret = dl_pushlstring(datalog_db, lit->predicate, 
-                (size_t)strlen(lit->predicate) + 1);
-#ifdef DATALOG_TIMING
-        tmp_end = clock();
-        tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-        datalog_time_g += tmp_diff;
-#endif
-    }else return DATALOG_MEM;
-        
-#ifdef DATALOG_DEBUG_VERBOSE 
-    fprintf(stderr, "[DATALOG][API] VERBOSE: predicate string pushed onto stack: %s \"%s\"\n", 
-        (ret == 0 ? "SUCCSESS" : "FAIL"), lit->predicate);
-#endif
+/**
+* @brief Runs a command buffer on the global database and appends it to the
+* write-ahead log when one is open, must hold the writer lock
+*
+* @param cmds Commands to be run
+* @param upto Set to the bytes of the log to be synced for the commands, left
+* at 0 with nothing run when the log refuses writes
+* @return int Return value of dl_exec, -1 when an unsafe clause was asserted
+*/
+static int datalog_exec_logged(dl_cmds_t* cmds, uint64_t* upto)
+{
+    if(datalog_wal_is_open() && datalog_wal_writable()) return 0;
 
-    if(ret) return DATALOG_LIT;
-   
-#ifdef DATALOG_TIMING
-    tmp_start = clock();
-#endif
-    ret = dl_addpred(datalog_db); 
-#ifdef DATALOG_TIMING
-    tmp_end = clock();
-    tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
+    int ret = datalog_exec_in(datalog_db, cmds);
 
-#ifdef DATALOG_DEBUG_VERBOSE 
-    fprintf(stderr, "[DATALOG][API] VERBOSE: predicate created:                  %s\n", 
-        (ret == 0 ? "SUCCSESS" : "FAIL"));
-#endif
+    if(datalog_wal_is_open() && !cmds->err) 
+        *upto = datalog_wal_log_commands(cmds);
 
-    if(ret) return DATALOG_LIT;
+    return ret;
+}
 
-    //push args onto the stack
-    datalog_term_t* tmp;
-    for(int i = 0; i < lit->term_count; i++){
-        tmp = datalog_literal_get_term_index(lit, i);
-        if(tmp != NULL){ 
-#ifdef DATALOG_TIMING
-            tmp_start = clock();
-#endif
-            ret = dl_pushlstring(datalog_db, tmp->value,
-                (size_t)strlen(tmp->value) + 1);
-#ifdef DATALOG_TIMING
-            tmp_end = clock();
-            tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-            datalog_time_g += tmp_diff;
-#endif
-        }
+DATALOG_ERR_t datalog_commands_exec(dl_cmds_t* cmds)
+{
+    uint64_t upto = 0;
+    int ret = DATALOG_GLOBAL(true, datalog_exec_logged(cmds, &upto));
 
-#ifdef DATALOG_DEBUG_VERBOSE 
-        fprintf(stderr, "[DATALOG][API] VERBOSE: term #%d string pushed onto stack:   %s \"%s\"\n" 
-            , i, (ret == 0 ? "SUCCSESS" : "FAIL"), tmp->value);
-#endif
+    if(ret > 0) return DATALOG_ASRT;
+    if(datalog_wal_commit_wait(upto) != DATALOG_OK) return DATALOG_FILE;
 
-        if(ret) return DATALOG_LIT;
+    return (ret < 0 ? DATALOG_UNSAFE : DATALOG_OK);
+}
+
+static DATALOG_ERR_t datalog_literal_create_in(dl_db_t db,
+        datalog_literal_t* lit)
+{
+    dl_cmds_t cmds;
+    DATALOG_ERR_t ret;
+
+    dl_cmds_init(&cmds);
+    ret = datalog_literal_encode(lit, &cmds);
+    if(ret == DATALOG_OK && datalog_exec_in(db, &cmds)) ret = DATALOG_LIT;
+    dl_cmds_free(&cmds);
 
-        if(tmp->type == DL_TERM_C){
-#ifdef DATALOG_TIMING
-            tmp_start = clock();
-#endif
-            ret = dl_addconst(datalog_db);
-#ifdef DATALOG_TIMING
-            tmp_end = clock();
-            tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-            datalog_time_g += tmp_diff;
-#endif
-#ifdef DATALOG_DEBUG_VERBOSE 
-            fprintf(stderr, "[DATALOG][API] VERBOSE: term #%d added as constant:          %s\n" 
-                , i, (ret == 0 ? "SUCCSESS" : "FAIL"));
-#endif
-        }else if(tmp->type == DL_TERM_V){
-#ifdef DATALOG_TIMING
-            tmp_start = clock();
-#endif
-            ret = dl_addvar(datalog_db);
-#ifdef DATALOG_TIMING
-            tmp_end = clock();
-            tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-            datalog_time_g += tmp_diff;
-#endif
-#ifdef DATALOG_DEBUG_VERBOSE 
-            fprintf(stderr, "[DATALOG][API] VERBOSE: term #%d added as variable:          %s\n" 
-                , i, (ret == 0 ? "SUCCSESS" : "FAIL"));
-#endif
-        }else return DATALOG_TERM;
-        
 #ifdef DATALOG_DEBUG_VERBOSE
-        fprintf(stderr, "[DATALOG][API] VERBOSE: term %d created:                     %s\n", 
-            i, (ret == 0 ? "SUCCSESS" : "FAIL"));
+    fprintf(stderr, "[DATALOG][API] VERBOSE: literal created:                    %s\n", 
+        (ret == DATALOG_OK ? "SUCCSESS" : "FAIL"));
 #endif
 
-        if(ret) return DATALOG_LIT;
+    return ret;
+}
+
+DATALOG_ERR_t datalog_literal_create(datalog_literal_t* lit)
+{
+    return (DATALOG_ERR_t)DATALOG_GLOBAL(false, 
+            datalog_literal_create_in(datalog_db, lit));
+}
+
+DATALOG_ERR_t datalog_literal_create_and_assert(datalog_literal_t* lit)
+{
+    dl_cmds_t cmds;
+    DATALOG_ERR_t ret;
+
+    //the fact is built and asserted in one call into the engine
+    dl_cmds_init(&cmds);
+    ret = datalog_literal_encode(lit, &cmds);
+    dl_cmd(&cmds, DL_OP_PUSHHEAD);
+    dl_cmd(&cmds, DL_OP_MAKECLAUSE);
+    dl_cmd(&cmds, DL_OP_ASSERT);
+    if(ret != DATALOG_OK){
+        dl_cmds_free(&cmds);
+        return DATALOG_LIT;
     }
-    
-    //finish creating literal
+    if(datalog_commands_exec(&cmds) != DATALOG_OK) ret = DATALOG_ASRT;
+    dl_cmds_free(&cmds);
+
+    return ret;
+}
+
+DATALOG_ERR_t datalog_literal_materialize(datalog_literal_t* lit)
+{
+    int ret = 0;
+
+    if(datalog_literal_create(lit) != DATALOG_OK) return DATALOG_LIT;
+
 #ifdef DATALOG_TIMING
-    tmp_start = clock();
+    clock_t tmp_start = clock();
 #endif
-    ret = dl_makeliteral(datalog_db);
+    ret = DATALOG_GLOBAL(true, dl_materialize(datalog_db));
 #ifdef DATALOG_TIMING
-    tmp_end = clock();
-    tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
+    clock_t tmp_end = clock();
+    double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
     datalog_time_g += tmp_diff;
 #endif
-
 #ifdef DATALOG_DEBUG_VERBOSE
-    fprintf(stderr, "[DATALOG][API] VERBOSE: literal created:                    %s\n", 
+    fprintf(stderr, "[DATALOG][API] VERBOSE: literal materialized:               %s\n",
         (ret == 0 ? "SUCCSESS" : "FAIL"));
 #endif
 
-   if(ret) return DATALOG_LIT;
+    if(ret) return DATALOG_VIEW;
 
-   return (DATALOG_ERR_t)ret;
+    return DATALOG_OK;
 }
 
-DATALOG_ERR_t datalog_literal_create_and_assert(datalog_literal_t* lit)
+/**
+* @brief Asserts a batch of facts into the global database and appends it to
+* the write-ahead log when one is open, must hold the writer lock
+*
+* @param upto Set to the bytes of the log to be synced for the facts, left at
+* 0 with nothing asserted when the log refuses writes
+* @return int Return value of dl_assert_lfacts
+*/
+static int datalog_facts_assert_logged(char* predicate, int arity, 
+        size_t count, char** terms, const size_t* lens, uint64_t* upto)
 {
-    if(datalog_literal_create(lit) != DATALOG_OK) return DATALOG_LIT;
-    if(datalog_clause_assert(0) != DATALOG_OK) return DATALOG_ASRT;
+    if(datalog_wal_is_open() && datalog_wal_writable()) return 0;
 
-    return DATALOG_OK;
+    size_t pred_len = strlen(predicate) + 1;
+    int ret = dl_assert_lfacts(datalog_db, predicate, pred_len, arity, count,
+            (const char**)terms, lens);
+
+    if(ret == 0 && datalog_wal_is_open())
+        *upto = datalog_wal_log_facts(predicate, pred_len, arity, count, 
+                terms, lens);
+
+    return ret;
+}
+
+DATALOG_ERR_t datalog_facts_assert(char* predicate, int arity, int count,
+        char** terms)
+{
+    if(arity < 0 || count < 0) return DATALOG_ASRT;
+    if(count == 0) return DATALOG_OK;
+
+    //the strings are passed with their zeros, as datalog_literal_create does
+    size_t cells = (size_t)arity * count;
+    size_t* lens = (size_t*)malloc(sizeof(size_t) * (cells + 1));
+    if(lens == NULL) return DATALOG_MEM;
+    for(size_t i = 0; i < cells; i++)
+        lens[i] = strlen(terms[i]) + 1;
+
+#ifdef DATALOG_TIMING
+    clock_t tmp_start = clock();
+#endif
+    uint64_t upto = 0;
+    int ret = DATALOG_GLOBAL(true, datalog_facts_assert_logged(predicate, 
+                arity, (size_t)count, terms, lens, &upto));
+#ifdef DATALOG_TIMING
+    clock_t tmp_end = clock();
+    double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
+    datalog_time_g += tmp_diff;
+#endif
+#ifdef DATALOG_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][API] VERBOSE: %d facts asserted:               %s\n",
+        count, (ret == 0 ? "SUCCSESS" : "FAIL"));
+#endif
+
+    free(lens);
+    if(ret) return DATALOG_ASRT;
+
+    return datalog_wal_commit_wait(upto);
 }
 
 DATALOG_ERR_t datalog_literal_stand_alone_create_and_assert(char* predicate,
@@ -405,87 +830,43 @@ DATALOG_ERR_t datalog_clause_add_literal(datalog_clause_t* clause,
 
 DATALOG_ERR_t datalog_clause_create(datalog_clause_t* clause)
 {
-    int ret = 0;
-    
-    //create head on the stack
-    if(datalog_literal_create(clause->head) != DATALOG_OK){
-#ifdef DATALOG_ERR
-            fprintf(stderr, "[DATALOG][API]   ERROR: failed to assert clause head \n");
-#endif
-        return DATALOG_LIT;
-    }
-
-#ifdef DATALOG_TIMING
-    clock_t tmp_start = clock();
-#endif
-    ret = dl_pushhead(datalog_db);
-#ifdef DATALOG_TIMING
-    clock_t tmp_end = clock();
-    double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
-
-    if(ret){
-#ifdef DATALOG_ERR
-        fprintf(stderr, "[DATALOG][API]   ERROR: asserting clause head failed\n");
-#endif
-        return DATALOG_ASRT;
-    }
-        
-    //Create clause literals 
-    for(int i = 0; i < clause->literal_count; i++){
-        ret = datalog_literal_create(clause->body_list[i]);
-#ifdef DATALOG_ERR
-        fprintf(stderr, "[DATALOG][API]   ERROR: creating clause literal #%d:         %s\n"
-                , i, (ret == DATALOG_OK ? "SUCCSESS" : "FAIL"));
-#endif
-        if(ret != DATALOG_OK) return DATALOG_LIT;
-        
-#ifdef DATALOG_TIMING
-        tmp_start = clock();
-#endif
-        ret = dl_addliteral(datalog_db);
-#ifdef DATALOG_TIMING
-        tmp_end = clock();
-        tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-        datalog_time_g += tmp_diff;
-#endif
+    dl_cmds_t cmds;
+    DATALOG_ERR_t ret;
 
-#ifdef DATALOG_DEBUG_VERBOSE
-        fprintf(stderr, "[DATALOG][API] VERBOSE: adding clause literal #%d            %s\n"
-                , i, (ret == 0 ? "SUCCSESS" : "FAIL"));
-#endif
-        if(ret) return DATALOG_ASRT;
-    }
-
-#ifdef DATALOG_TIMING
-    tmp_start = clock();
-#endif
-    ret = dl_makeclause(datalog_db);
-#ifdef DATALOG_TIMING
-    tmp_end = clock();
-    tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
+    dl_cmds_init(&cmds);
+    ret = datalog_clause_encode(clause, &cmds);
+    if(ret == DATALOG_OK && 
+            DATALOG_GLOBAL(false, datalog_exec_in(datalog_db, &cmds))) 
+        ret = DATALOG_ASRT;
+    dl_cmds_free(&cmds);
 
 #ifdef DATALOG_DEBUG_VERBOSE
     fprintf(stderr, "[DATALOG][API] VERBOSE: making clause:                      %s\n",
-        (ret == 0 ? "SUCCSESS" : "FAIL"));
+        (ret == DATALOG_OK ? "SUCCSESS" : "FAIL"));
 #endif
-    if(ret) return DATALOG_ASRT;
 
-    return (DATALOG_ERR_t)ret;
+    return ret;
 }
 
 DATALOG_ERR_t datalog_clause_assert(int literal_count)
 {
     int ret = 0;
 
+    //the literals on the stack were built by calls that are not logged, so
+    //the clause could not be replayed from the log
+    if(datalog_wal_is_open()){
+#ifdef DATALOG_ERR
+        fprintf(stderr, "[DATALOG][API]   ERROR: clause on the stack not"
+                " asserted, a write-ahead log is open\n");
+#endif
+        return DATALOG_INIT;
+    }
+
     //create empty clause
 #ifdef DATALOG_TIMING
     clock_t tmp_start = clock();
 #endif
-    ret = dl_pushhead(datalog_db);
+    ret = DATALOG_GLOBAL(false, dl_pushhead(datalog_db));
 #ifdef DATALOG_TIMING
     clock_t tmp_end = clock();
     double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
@@ -501,7 +882,7 @@ DATALOG_ERR_t datalog_clause_assert(int literal_count)
 #ifdef DATALOG_TIMING
         tmp_start = clock();
 #endif
-        ret = dl_addliteral(datalog_db);
+        ret = DATALOG_GLOBAL(false, dl_addliteral(datalog_db));
 #ifdef DATALOG_TIMING
         tmp_end = clock();
         tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
@@ -518,7 +899,7 @@ DATALOG_ERR_t datalog_clause_assert(int literal_count)
 #ifdef DATALOG_TIMING
     tmp_start = clock();
 #endif
-    ret = dl_makeclause(datalog_db);
+    ret = DATALOG_GLOBAL(false, dl_makeclause(datalog_db));
 #ifdef DATALOG_TIMING
     tmp_end = clock();
     tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
@@ -534,7 +915,7 @@ DATALOG_ERR_t datalog_clause_assert(int literal_count)
 #ifdef DATALOG_TIMING
     tmp_start = clock();
 #endif
-    ret = dl_assert(datalog_db);
+    ret = DATALOG_GLOBAL(true, dl_assert(datalog_db));
 #ifdef DATALOG_TIMING
     tmp_end = clock();
     tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
@@ -549,51 +930,42 @@ DATALOG_ERR_t datalog_clause_assert(int literal_count)
     return DATALOG_OK;
 }
 
-DATALOG_ERR_t datalog_clause_create_and_assert(datalog_clause_t* clause)
+/**
+* @brief Builds a clause and asserts or retracts it in one call into the engine
+*
+* @param clause Clause to be built
+* @param op DL_OP_ASSERT or DL_OP_RETRACT
+* @return DATALOG_ERR_t error message, DATALOG_UNSAFE when the clause is unsafe
+*/
+static DATALOG_ERR_t datalog_clause_create_and_run(datalog_clause_t* clause,
+        int op)
 {
-    int ret = 0;
+    dl_cmds_t cmds;
+    DATALOG_ERR_t ret;
+
+    dl_cmds_init(&cmds);
+    ret = datalog_clause_encode(clause, &cmds);
+    dl_cmd(&cmds, op);
+    if(ret == DATALOG_OK) ret = datalog_commands_exec(&cmds);
+    dl_cmds_free(&cmds);
 
-    datalog_clause_create(clause);
-    
-#ifdef DATALOG_TIMING
-    clock_t tmp_start = clock();
-#endif
-    ret = dl_assert(datalog_db);
-#ifdef DATALOG_TIMING
-    clock_t tmp_end = clock();
-    double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
 #ifdef DATALOG_DEBUG_VERBOSE
-    fprintf(stderr, "[DATALOG][API] VERBOSE: asserting clause:                   %s\n",
-        (ret == 0 ? "SUCCSESS" : "FAIL"));
+    fprintf(stderr, "[DATALOG][API] VERBOSE: clause %s:                   %s\n",
+        (op == DL_OP_ASSERT ? "asserted " : "retracted"),
+        (ret == DATALOG_OK ? "SUCCSESS" : "FAIL"));
 #endif
 
-    return (DATALOG_ERR_t)ret;
+    return ret;
 }
 
-DATALOG_ERR_t datalog_clause_create_and_retract(datalog_clause_t* clause)
+DATALOG_ERR_t datalog_clause_create_and_assert(datalog_clause_t* clause)
 {
-    int ret = 0; 
-
-    datalog_clause_create(clause);
-    
-#ifdef DATALOG_TIMING
-    clock_t tmp_start = clock();
-#endif
-    ret = dl_retract(datalog_db);
-#ifdef DATALOG_TIMING
-    clock_t tmp_end = clock();
-    double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
-
-#ifdef DATALOG_DEBUG_VERBOSE
-    fprintf(stderr, "[DATALOG][API] VERBOSE: clause retracted:                   %s\n", 
-        (ret == 0 ? "SUCCSESS" : "FAIL"));
-#endif
+    return datalog_clause_create_and_run(clause, DL_OP_ASSERT);
+}
 
-    return (DATALOG_ERR_t)ret;
+DATALOG_ERR_t datalog_clause_create_and_retract(datalog_clause_t* clause)
+{
+    return datalog_clause_create_and_run(clause, DL_OP_RETRACT);
 }
 
 DATALOG_ERR_t datalog_clause_print(datalog_clause_t* clause)
@@ -630,24 +1002,87 @@ datalog_query_t* datalog_query_init(datalog_literal_t* lit)
     if(query == NULL) return NULL;
 
     query->literal = lit;
+    query->processed_answer = NULL;
+    query->cursor = NULL;
+    query->replica = NULL;
     query->ask = &datalog_query_ask;
     query->print = &datalog_query_print;
     query->print_answers = &datalog_query_print_answers;
     query->free = &datalog_free_query;
 
-    return query;
+    return query;
+}
+
+DATALOG_ERR_t datalog_query_ask(datalog_query_t* query)  
+{
+#ifdef DATALOG_DEBUG 
+    fprintf(stderr, "[DATALOG][API]   DEBUG: query clause for predicate: %s\n"
+            , query->literal->predicate); 
+#endif
+
+    DATALOG_ERR_t ret = DATALOG_OK;
+    datalog_replica_t* rep = datalog_replica_acquire();
+    dl_db_t db = (rep != NULL ? rep->db : datalog_db);
+
+    ret = datalog_literal_create_in(db, query->literal);
+
+#ifdef DATALOG_DEBUG_VERBOSE 
+    fprintf(stderr, "[DATALOG][API] VERBOSE: query literal created:              %s\n", 
+            (ret == DATALOG_OK ? "SUCCSESS" : "FAIL"));
+#endif
+
+    dl_answers_t a;
+
+#ifdef DATALOG_TIMING
+    clock_t tmp_start = clock();
+#endif
+#ifdef QUERY_TIMING
+    clock_t query_s = clock();
+#endif 
+    ret = (DATALOG_ERR_t) dl_ask(db, &a);
+    datalog_replica_release(rep);
+#ifdef QUERY_TIMING
+    clock_t query_f = clock();
+    double query_tmp = (double)(query_f - query_s)/CLOCKS_PER_SEC;
+    query_time_g += query_tmp;
+    query_count_g++;
+#endif
+#ifdef DATALOG_TIMING
+    clock_t tmp_end = clock();
+    double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
+    datalog_time_g += tmp_diff;
+#endif
+
+#ifdef DATALOG_DEBUG_VERBOSE 
+    fprintf(stderr, "[DATALOG][API] VERBOSE: query sent:                         %s\n", 
+            (ret == 0 ? "SUCCSESS" : "FAIL"));
+#endif
+#ifdef DATALOG_DEBUG 
+    fprintf(stderr, "[DATALOG][API] VERBOSE: query resulted in answer:           %s\n", 
+            (a != NULL ? "SUCCSESS" : "FAIL"));
+#endif
+
+    if(a != NULL){
+        query->processed_answer = datalog_process_answer(a);
+        dl_free(a);
+    }
+
+    return DATALOG_OK;
 }
 
-DATALOG_ERR_t datalog_query_ask(datalog_query_t* query)  
+DATALOG_ERR_t datalog_query_aggregate(datalog_query_t* query, int op,
+        int column, uint32_t group_mask)
 {
 #ifdef DATALOG_DEBUG 
-    fprintf(stderr, "[DATALOG][API]   DEBUG: query clause for predicate: %s\n"
+    fprintf(stderr, "[DATALOG][API]   DEBUG: aggregate query for predicate: %s\n"
             , query->literal->predicate); 
 #endif
 
     DATALOG_ERR_t ret = DATALOG_OK;
+    datalog_replica_t* rep = datalog_replica_acquire();
+    dl_db_t db = (rep != NULL ? rep->db : datalog_db);
 
-    ret = datalog_literal_create(query->literal);
+    ret = datalog_literal_create_in(db, query->literal);
 
 #ifdef DATALOG_DEBUG_VERBOSE 
     fprintf(stderr, "[DATALOG][API] VERBOSE: query literal created:              %s\n", 
@@ -662,7 +1097,9 @@ DATALOG_ERR_t datalog_query_ask(datalog_query_t* query)
 #ifdef QUERY_TIMING
     clock_t query_s = clock();
 #endif 
-    ret = (DATALOG_ERR_t) dl_ask(datalog_db, &a);
+    ret = (DATALOG_ERR_t) dl_aggregate(db, &a, op, column,
+            (unsigned long)group_mask);
+    datalog_replica_release(rep);
 #ifdef QUERY_TIMING
     clock_t query_f = clock();
     double query_tmp = (double)(query_f - query_s)/CLOCKS_PER_SEC;
@@ -676,33 +1113,183 @@ DATALOG_ERR_t datalog_query_ask(datalog_query_t* query)
 #endif
 
 #ifdef DATALOG_DEBUG_VERBOSE 
-    fprintf(stderr, "[DATALOG][API] VERBOSE: query sent:                         %s\n", 
+    fprintf(stderr, "[DATALOG][API] VERBOSE: aggregate query sent:               %s\n", 
             (ret == 0 ? "SUCCSESS" : "FAIL"));
 #endif
+
+    if(ret != DATALOG_OK) return DATALOG_QUE;
+
+    if(a != NULL){
+        query->processed_answer = datalog_process_answer(a);
+        dl_free(a);
+    }
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_query_open(datalog_query_t* query)
+{
 #ifdef DATALOG_DEBUG 
-    fprintf(stderr, "[DATALOG][API] VERBOSE: query resulted in answer:           %s\n", 
-            (a != NULL ? "SUCCSESS" : "FAIL"));
+    fprintf(stderr, "[DATALOG][API]   DEBUG: cursor opened for predicate: %s\n"
+            , query->literal->predicate); 
+#endif
+
+    datalog_replica_t* rep = datalog_replica_acquire();
+    dl_db_t db = (rep != NULL ? rep->db : datalog_db);
+
+    //the replica, or the writer lock, is held until the cursor is closed
+    if(datalog_literal_create_in(db, query->literal) != DATALOG_OK ||
+            dl_ask_open(db, &query->cursor)){
+        query->cursor = NULL;
+        datalog_replica_release(rep);
+        return DATALOG_QUE;
+    }
+    query->replica = rep;
+    __atomic_add_fetch(&datalog_cursors_open, 1, __ATOMIC_RELAXED);
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_query_next_batch(datalog_query_t* query, int count,
+        dl_answers_t* batch)
+{
+    *batch = NULL;
+    if(query->cursor == NULL || count < 0) return DATALOG_QUE;
+    if(dl_ask_next_batch(query->cursor, (size_t)count, batch)) 
+        return DATALOG_MEM;
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_query_close(datalog_query_t* query)
+{
+    if(query->cursor == NULL) return DATALOG_OK;
+
+    dl_ask_close(query->cursor);
+    query->cursor = NULL;
+    datalog_replica_release(query->replica);
+    query->replica = NULL;
+    __atomic_sub_fetch(&datalog_cursors_open, 1, __ATOMIC_RELAXED);
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_query_ask_view(datalog_query_t* query,
+        datalog_answers_view_t* view)
+{
+#ifdef DATALOG_DEBUG 
+    fprintf(stderr, "[DATALOG][API]   DEBUG: query view for predicate: %s\n"
+            , query->literal->predicate); 
+#endif
+
+    datalog_replica_t* rep = datalog_replica_acquire();
+    dl_db_t db = (rep != NULL ? rep->db : datalog_db);
+    dl_answers_t a = NULL;
+    int ret;
+
+    datalog_answers_view_init(view, NULL, false);
+    if(datalog_literal_create_in(db, query->literal) != DATALOG_OK){
+        datalog_replica_release(rep);
+        return DATALOG_LIT;
+    }
+
+#ifdef QUERY_TIMING
+    clock_t query_s = clock();
+#endif 
+    ret = dl_ask(db, &a);
+    datalog_replica_release(rep);
+#ifdef QUERY_TIMING
+    clock_t query_f = clock();
+    double query_tmp = (double)(query_f - query_s)/CLOCKS_PER_SEC;
+    query_time_g += query_tmp;
+    query_count_g++;
 #endif
+    if(ret) return DATALOG_QUE;
 
-    if(a != NULL) query->processed_answer = datalog_process_answer(a);
+    datalog_answers_view_init(view, a, true);
+
+#ifdef DATALOG_DEBUG_VERBOSE 
+    fprintf(stderr, "[DATALOG][API] VERBOSE: query view holds %d answers\n", 
+            view->answer_count);
+#endif
 
     return DATALOG_OK;
 }
 
+void datalog_answers_view_init(datalog_answers_view_t* view, dl_answers_t a,
+        bool owned)
+{
+    view->answers = a;
+    view->owned = owned;
+    view->answer_count = (int)dl_getlen(a);
+    view->answer_term_count = (int)dl_getpredarity(a);
+}
+
+const char* datalog_answers_view_predicate(const datalog_answers_view_t* view,
+        size_t* len)
+{
+    if(len != NULL) *len = dl_getpredlen(view->answers);
+    return dl_getpred(view->answers);
+}
+
+const char* datalog_answers_view_term(const datalog_answers_view_t* view,
+        int row, int col, size_t* len)
+{
+    if(len != NULL) *len = dl_getconstlen(view->answers, row, col);
+    return dl_getconst(view->answers, row, col);
+}
+
+void datalog_answers_view_free(datalog_answers_view_t* view)
+{
+    if(view->owned) dl_free(view->answers);
+    datalog_answers_view_init(view, NULL, false);
+}
+
+/**
+* @brief Allocates processed answers as one block, laid out as the struct, the
+* rows, the row pointers, the row-major table of terms and then the strings
+*
+* @param answer_count Number of answers
+* @param term_count Number of terms in each answer
+* @param chars Room for the predicate and the terms, including their zeros
+* @return datalog_query_processed_answers_t* Pointer to the block, NULL on error
+*/
+static datalog_query_processed_answers_t* datalog_processed_answers_alloc(
+        int answer_count, int term_count, size_t chars)
+{
+    size_t cells = (size_t)answer_count * term_count;
+    datalog_query_processed_answers_t* ret = 
+        (datalog_query_processed_answers_t*)malloc(
+            sizeof(datalog_query_processed_answers_t) 
+            + answer_count * (sizeof(datalog_query_answers_t) 
+                + sizeof(datalog_query_answers_t*))
+            + cells * sizeof(char*) + chars);
+    if(ret == NULL) return NULL;
+
+    datalog_query_answers_t* rows = (datalog_query_answers_t*)(ret + 1);
+    ret->answers = (datalog_query_answers_t**)(rows + answer_count);
+    ret->table = (char**)(ret->answers + answer_count);
+    ret->predic = (char*)(ret->table + cells);
+    ret->answer_count = answer_count;
+    ret->answer_term_count = term_count;
+    ret->free = &datalog_free_query_processed_answers;
+    for(int i = 0; i < answer_count; i++){
+        rows[i].term_count = term_count;
+        rows[i].term_list = ret->table + (size_t)i * term_count;
+        ret->answers[i] = &rows[i];
+    }
+
+    return ret;
+}
+
 datalog_query_processed_answers_t* datalog_query_stand_alone_create_and_ask(
     char* predicate, int num_of_terms, char** terms, uint32_t term_type_mask)
 {
     DATALOG_ERR_t err = DATALOG_OK;
-    datalog_query_processed_answers_t* ret = (datalog_query_processed_answers_t*)
-        calloc(1,sizeof(datalog_query_processed_answers_t));
-    if(ret == NULL) return NULL;
+    datalog_query_processed_answers_t* ret = NULL;
         
     datalog_literal_stand_alone_create_and_assert(predicate, num_of_terms, terms, 
             term_type_mask, false);
-
-    ret->predic = (char*)malloc(sizeof(char) * (strlen(predicate) + 1));
-    if(ret->predic == NULL) return NULL;
-    strcpy(ret->predic, predicate);
    
     dl_answers_t a;
 
@@ -712,7 +1299,7 @@ datalog_query_processed_answers_t* datalog_query_stand_alone_create_and_ask(
 #ifdef QUERY_TIMING
     clock_t query_s = clock();
 #endif 
-    err = dl_ask(datalog_db, &a);
+    err = DATALOG_GLOBAL(false, dl_ask(datalog_db, &a));
 #ifdef QUERY_TIMING
     clock_t query_f = clock();
     double query_tmp = (double)(query_f - query_s)/CLOCKS_PER_SEC;
@@ -733,11 +1320,261 @@ datalog_query_processed_answers_t* datalog_query_stand_alone_create_and_ask(
             (a != NULL ? "SUCCSESS" : "FAIL"));
 #endif
     
-    if(a != NULL) ret = datalog_process_answer(a);
+    if(a != NULL){
+        ret = datalog_process_answer(a);
+        dl_free(a);
+    }else{
+        ret = datalog_processed_answers_alloc(0, 0, strlen(predicate) + 1);
+        if(ret != NULL) strcpy(ret->predic, predicate);
+    }
 
     return ret;
 }
 
+datalog_prepared_t* datalog_query_prepare(char* predicate, int num_of_terms,
+        char** terms, uint32_t term_type_mask, uint32_t param_mask)
+{
+    if(predicate == NULL || num_of_terms < 0 || num_of_terms > 32) return NULL;
+
+    datalog_prepared_t* prep = 
+        (datalog_prepared_t*)calloc(1, sizeof(datalog_prepared_t));
+    if(prep == NULL) return NULL;
+
+    prep->term_count = num_of_terms;
+    prep->term_type_mask = term_type_mask;
+    prep->param_mask = param_mask;
+    prep->predicate = (char*)malloc(strlen(predicate) + 1);
+    prep->terms = (char**)calloc(num_of_terms + 1, sizeof(char*));
+    if(prep->predicate == NULL || prep->terms == NULL){
+        datalog_free_prepared(&prep);
+        return NULL;
+    }
+    strcpy(prep->predicate, predicate);
+    for(int i = 0; i < num_of_terms; i++){
+        if((param_mask >> i) & 1U){
+            prep->param_count++;
+            continue;
+        }
+        if(terms[i] == NULL){
+            datalog_free_prepared(&prep);
+            return NULL;
+        }
+        prep->terms[i] = (char*)malloc(strlen(terms[i]) + 1);
+        if(prep->terms[i] == NULL){
+            datalog_free_prepared(&prep);
+            return NULL;
+        }
+        strcpy(prep->terms[i], terms[i]);
+    }
+    prep->values = (char**)calloc(prep->param_count + 1, sizeof(char*));
+    prep->value_caps = (size_t*)calloc(prep->param_count + 1, sizeof(size_t));
+    if(prep->values == NULL || prep->value_caps == NULL){
+        datalog_free_prepared(&prep);
+        return NULL;
+    }
+
+#ifdef DATALOG_DEBUG 
+    fprintf(stderr, "[DATALOG][API]   DEBUG: query prepared for predicate: %s, %d parameters\n"
+            , predicate, prep->param_count); 
+#endif
+
+    return prep;
+}
+
+DATALOG_ERR_t datalog_prepared_bind(datalog_prepared_t* prep, int param,
+        char* value)
+{
+    if(param < 0 || param >= prep->param_count || value == NULL) 
+        return DATALOG_TERM;
+
+    //the value's buffer is kept and only grows, so rebinding allocates nothing
+    size_t len = strlen(value) + 1;
+    if(len > prep->value_caps[param]){
+        char* tmp = (char*)realloc(prep->values[param], len);
+        if(tmp == NULL) return DATALOG_MEM;
+        prep->values[param] = tmp;
+        prep->value_caps[param] = len;
+    }
+    memcpy(prep->values[param], value, len);
+
+    return DATALOG_OK;
+}
+
+/**
+* @brief Prepares a query's literal in a database, with its parameters added
+* in place of the terms selected by its parameter mask
+*
+* @param db Database the query is prepared in
+* @param prep Pointer to the prepared query
+* @param handle Returns the library's handle to the query
+* @return DATALOG_ERR_t error message
+*/
+static DATALOG_ERR_t datalog_prepared_create_in(dl_db_t db, 
+        datalog_prepared_t* prep, dl_prepared_t* handle)
+{
+    int mark = dl_mark(db);
+    int ret = dl_pushliteral(db) ||
+        dl_pushlstring(db, prep->predicate, strlen(prep->predicate) + 1) ||
+        dl_addpred(db);
+
+    for(int i = 0; i < prep->term_count && !ret; i++){
+        if((prep->param_mask >> i) & 1U) ret = dl_addparam(db);
+        else{
+            ret = dl_pushlstring(db, prep->terms[i], strlen(prep->terms[i]) + 1);
+            if(ret) break;
+            if(((prep->term_type_mask >> i) & 1U) == DL_TERM_V) 
+                ret = dl_addvar(db);
+            else ret = dl_addconst(db);
+        }
+    }
+    if(!ret) ret = dl_makeliteral(db) || dl_prepare(db, handle);
+
+    if(ret){
+        dl_reset(db, mark);
+        return DATALOG_LIT;
+    }
+
+#ifdef DATALOG_DEBUG_VERBOSE 
+    fprintf(stderr, "[DATALOG][API] VERBOSE: query prepared in database:      %s\n", 
+            prep->predicate);
+#endif
+
+    return DATALOG_OK;
+}
+
+/**
+* @brief Pushes the literal of a prepared query, with its parameters bound, on
+* the stack of the database of a replica, or of the global database when
+* there is no replica. The query is prepared in the database the first time
+* it is asked there.
+*
+* @param prep Pointer to the prepared query
+* @param rep Replica held by the caller, NULL for the global database
+* @param db Database of the replica, or the global database
+* @return DATALOG_ERR_t error message
+*/
+static DATALOG_ERR_t datalog_prepared_push(datalog_prepared_t* prep,
+        datalog_replica_t* rep, dl_db_t db)
+{
+    //handles belong to their databases, so they are forgotten, not
+    //released, once those are closed
+    if(prep->replica_epoch != datalog_replica_epoch || prep->slots == NULL){
+        dl_prepared_t global = NULL;
+        if(prep->slots != NULL && prep->db_epoch == datalog_db_epoch) 
+            global = prep->slots[0];
+        dl_prepared_t* tmp = (dl_prepared_t*)realloc(prep->slots, 
+                (datalog_replica_count + 1) * sizeof(dl_prepared_t));
+        if(tmp == NULL) return DATALOG_MEM;
+        prep->slots = tmp;
+        prep->slot_count = datalog_replica_count + 1;
+        for(int i = 0; i < prep->slot_count; i++) prep->slots[i] = NULL;
+        prep->slots[0] = global;
+        prep->replica_epoch = datalog_replica_epoch;
+        prep->db_epoch = datalog_db_epoch;
+    }
+    if(prep->db_epoch != datalog_db_epoch){
+        prep->slots[0] = NULL;
+        prep->db_epoch = datalog_db_epoch;
+    }
+
+    int slot = (rep != NULL ? (int)(rep - datalog_replicas) + 1 : 0);
+    if(prep->slots[slot] == NULL){
+        DATALOG_ERR_t err = datalog_prepared_create_in(db, prep, 
+                &prep->slots[slot]);
+        if(err != DATALOG_OK) return err;
+    }
+
+    dl_prepared_t handle = prep->slots[slot];
+    for(int i = 0; i < prep->param_count; i++){
+        if(prep->values[i] == NULL) return DATALOG_TERM;
+        if(dl_bindlstring(handle, i, prep->values[i], 
+                    strlen(prep->values[i]) + 1))
+            return DATALOG_LIT;
+    }
+    if(dl_pushprepared(handle)) return DATALOG_LIT;
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_prepared_ask(datalog_prepared_t* prep,
+        datalog_query_processed_answers_t** answers)
+{
+    datalog_replica_t* rep = datalog_replica_acquire();
+    dl_db_t db = (rep != NULL ? rep->db : datalog_db);
+    dl_answers_t a = NULL;
+
+    *answers = NULL;
+    DATALOG_ERR_t ret = datalog_prepared_push(prep, rep, db);
+    if(ret != DATALOG_OK){
+        datalog_replica_release(rep);
+        return ret;
+    }
+
+#ifdef QUERY_TIMING
+    clock_t query_s = clock();
+#endif 
+    ret = (dl_ask(db, &a) ? DATALOG_QUE : DATALOG_OK);
+    datalog_replica_release(rep);
+#ifdef QUERY_TIMING
+    clock_t query_f = clock();
+    double query_tmp = (double)(query_f - query_s)/CLOCKS_PER_SEC;
+    query_time_g += query_tmp;
+    query_count_g++;
+#endif
+
+#ifdef DATALOG_DEBUG_VERBOSE 
+    fprintf(stderr, "[DATALOG][API] VERBOSE: prepared query sent:                %s\n", 
+            (ret == DATALOG_OK ? "SUCCSESS" : "FAIL"));
+#endif
+
+    if(ret != DATALOG_OK) return ret;
+
+    if(a != NULL){
+        *answers = datalog_process_answer(a);
+        dl_free(a);
+        if(*answers == NULL) return DATALOG_MEM;
+    }
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_prepared_ask_view(datalog_prepared_t* prep,
+        datalog_answers_view_t* view)
+{
+    datalog_replica_t* rep = datalog_replica_acquire();
+    dl_db_t db = (rep != NULL ? rep->db : datalog_db);
+    dl_answers_t a = NULL;
+
+    datalog_answers_view_init(view, NULL, false);
+    DATALOG_ERR_t ret = datalog_prepared_push(prep, rep, db);
+    if(ret != DATALOG_OK){
+        datalog_replica_release(rep);
+        return ret;
+    }
+
+#ifdef QUERY_TIMING
+    clock_t query_s = clock();
+#endif 
+    ret = (dl_ask(db, &a) ? DATALOG_QUE : DATALOG_OK);
+    datalog_replica_release(rep);
+#ifdef QUERY_TIMING
+    clock_t query_f = clock();
+    double query_tmp = (double)(query_f - query_s)/CLOCKS_PER_SEC;
+    query_time_g += query_tmp;
+    query_count_g++;
+#endif
+    if(ret != DATALOG_OK) return ret;
+
+    datalog_answers_view_init(view, a, true);
+
+#ifdef DATALOG_DEBUG_VERBOSE 
+    fprintf(stderr, "[DATALOG][API] VERBOSE: prepared query view holds %d answers\n", 
+            view->answer_count);
+#endif
+
+    return DATALOG_OK;
+}
+
 DATALOG_ERR_t datalog_query_print(datalog_query_t* query)
 {
     printf("!!=========QUERY=========!!\n");
@@ -827,12 +1664,11 @@ char* datalog_query_return_answers(datalog_query_t* a)
 
 datalog_query_processed_answers_t* datalog_query_processed_answers_init(void)
 {
-    //alloc return struct
-    datalog_query_processed_answers_t* ret_struct = (datalog_query_processed_answers_t*)
-        calloc(1, sizeof(datalog_query_processed_answers_t));
-    ret_struct->free = &datalog_free_query_processed_answers;
+    datalog_query_processed_answers_t* ret_struct = 
+        datalog_processed_answers_alloc(0, 0, 0);
 
     if(ret_struct == NULL) return NULL;
+    ret_struct->predic = NULL;
     return ret_struct;
 }
 
@@ -841,106 +1677,48 @@ datalog_query_processed_answers_t* datalog_process_answer(dl_answers_t a)
 #ifdef DATALOG_DEBUG 
     fprintf(stderr, "[DATALOG][API]   DEBUG: processing query answers\n"); 
 #endif
-    datalog_query_processed_answers_t* ret_struct = 
-            datalog_query_processed_answers_init();
 #ifdef DATALOG_TIMING
     clock_t tmp_start = clock();
 #endif
-    char* tmp_pred = dl_getpred(a);
-#ifdef DATALOG_TIMING
-    clock_t tmp_end = clock();
-    double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
-    ret_struct->predic = (char*)malloc(sizeof(char) * strlen(tmp_pred) + 1);
-    if(ret_struct->predic == NULL) return NULL;
-    strcpy(ret_struct->predic, tmp_pred);
+    int answer_count = (int)dl_getlen(a);
+    int answer_term_count = (int)dl_getpredarity(a);
+    size_t len = dl_getpredlen(a);
+    size_t chars = len + 1;
+
+    //size the block up front, the strings may contain zeros
+    for(int i = 0; i < answer_count; i++)
+        for(int j = 0; j < answer_term_count; j++)
+            chars += dl_getconstlen(a, i, j) + 1;
+
+    datalog_query_processed_answers_t* ret_struct = 
+        datalog_processed_answers_alloc(answer_count, answer_term_count, chars);
+    if(ret_struct == NULL) return NULL;
+
+    char* s = ret_struct->predic;
+    memcpy(s, dl_getpred(a), len);
+    s[len] = '\0';
+    s += len + 1;
 
 #ifdef DATALOG_DEBUG_VERBOSE 
     fprintf(stderr, "[DATALOG][API] VERBOSE: predicate:                          %s\n", 
         ret_struct->predic);
 #endif
-   
-    //alloc list pointer
-    ret_struct->answers = (datalog_query_answers_t**)
-        malloc(sizeof(datalog_query_answers_t*));
-    if(ret_struct->answers == NULL) return NULL;
-
-#ifdef DATALOG_TIMING
-    tmp_start = clock();
-#endif
-    int answer_term_count = dl_getpredarity(a);
-#ifdef DATALOG_TIMING
-    tmp_end = clock();
-    tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
-    int answer_count = 0;
-    size_t ans_length;
-    int i = 0;
-#ifdef DATALOG_TIMING
-    tmp_start = clock();
-#endif
-    char* tmp = dl_getconst(a, answer_count, 0);
-#ifdef DATALOG_TIMING
-    tmp_end = clock();
-    tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
-    while(tmp != NULL){
-        ret_struct->answers = (datalog_query_answers_t**)
-            realloc(ret_struct->answers, sizeof(datalog_query_answers_t*) * (answer_count + 1));
-        ret_struct->answers[answer_count] = (datalog_query_answers_t*)
-            calloc(1, sizeof(datalog_query_answers_t));
-        if(ret_struct->answers[answer_count] == NULL) return NULL;
-
-        ret_struct->answers[answer_count]->term_list = (char**)
-            calloc(answer_term_count, sizeof(char*));
-        if(ret_struct->answers[answer_count]->term_list == NULL) return NULL;
 
-        ret_struct->answers[answer_count]->term_count = answer_term_count;
-        
-        for(i = 0; i < answer_term_count; i++){
-#ifdef DATALOG_TIMING
-    tmp_start = clock();
-#endif
-            tmp = dl_getconst(a, answer_count, i);
-#ifdef DATALOG_TIMING
-    tmp_end = clock();
-    tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
-#ifdef DATALOG_TIMING
-    tmp_start = clock();
-#endif
-            ans_length = dl_getconstlen(a, answer_count, i);
-#ifdef DATALOG_TIMING
-    tmp_end = clock();
-    tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
-    datalog_time_g += tmp_diff;
-#endif
-            if(tmp == NULL) break;
-       
-            ret_struct->answers[answer_count]->term_list[i] = (char*)
-                malloc(sizeof(char) * ans_length);
-            if(ret_struct->answers[answer_count]->term_list[i] == NULL) 
-                return NULL;
-            
-            strcpy(ret_struct->answers[answer_count]->term_list[i], tmp);
+    char** cell = ret_struct->table;
+    for(int i = 0; i < answer_count; i++)
+        for(int j = 0; j < answer_term_count; j++){
+            len = dl_getconstlen(a, i, j);
+            memcpy(s, dl_getconst(a, i, j), len);
+            s[len] = '\0';
+            *cell++ = s;
+            s += len + 1;
         }
-        answer_count++;
-#ifdef DATALOG_TIMING
-    tmp_start = clock();
-#endif
-        tmp = dl_getconst(a, answer_count, 0);
+
 #ifdef DATALOG_TIMING
-    tmp_end = clock();
-    tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
+    clock_t tmp_end = clock();
+    double tmp_diff = (double)(tmp_end - tmp_start)/CLOCKS_PER_SEC;
     datalog_time_g += tmp_diff;
 #endif
-    }
-    ret_struct->answer_term_count = answer_term_count;
-    ret_struct->answer_count = answer_count;
     
     return ret_struct;
 }
@@ -1041,31 +1819,17 @@ void datalog_free_string_array(char** array, int array_size)
     }
 }
 
-void datalog_free_query_answers(datalog_query_answers_t** answers)
-{
-    if((*answers)->term_list != NULL){
-        datalog_free_string_array((*answers)->term_list, (*answers)->term_count);
-        free((*answers)->term_list);
-    }
-    (*answers)->term_list = NULL;
-    if(*answers != NULL) free(*answers);
-    *answers = NULL;
-}
-
 void datalog_free_query_processed_answers( 
         datalog_query_processed_answers_t** answers)
 {
-    if((*answers)->predic != NULL) free((*answers)->predic);
-    if((*answers)->answers != NULL){
-        datalog_free_query_answers((*answers)->answers);
-        (*answers)->answers = NULL;
-    }
+    //the struct is one block with everything it points to
     if(*answers != NULL) free(*answers);
     *answers = NULL;
 }
 
 void datalog_free_query(datalog_query_t** query)
 {
+    datalog_query_close(*query);
     if((*query)->literal != NULL) free((*query)->literal);
     //TODO
     //if((*query)->answer != NULL) dl_free(*(*query)->answer);
@@ -1077,6 +1841,44 @@ void datalog_free_query(datalog_query_t** query)
     *query = NULL;
 }
 
+void datalog_free_prepared(datalog_prepared_t** prep)
+{
+    datalog_prepared_t* p = *prep;
+
+    if(p == NULL) return;
+
+    //release the handles in the databases that are still open, each under
+    //the lock of its database
+    if(p->slots != NULL){
+        if(p->db_epoch == datalog_db_epoch && p->slots[0] != NULL){
+            datalog_write_lock();
+            dl_unprepare(p->slots[0]);
+            pthread_mutex_unlock(&datalog_writer);
+        }
+        pthread_rwlock_rdlock(&datalog_pool);
+        if(p->replica_epoch == datalog_replica_epoch){
+            for(int i = 1; i < p->slot_count; i++){
+                if(p->slots[i] == NULL) continue;
+                pthread_mutex_lock(&datalog_replicas[i - 1].lock);
+                dl_unprepare(p->slots[i]);
+                pthread_mutex_unlock(&datalog_replicas[i - 1].lock);
+            }
+        }
+        pthread_rwlock_unlock(&datalog_pool);
+        free(p->slots);
+    }
+    if(p->terms != NULL)
+        for(int i = 0; i < p->term_count; i++) free(p->terms[i]);
+    if(p->values != NULL)
+        for(int i = 0; i < p->param_count; i++) free(p->values[i]);
+    free(p->terms);
+    free(p->values);
+    free(p->value_caps);
+    free(p->predicate);
+    free(p);
+    *prep = NULL;
+}
+
 void datalog_free_clause(datalog_clause_t** clause)
 {
     if((*clause)->head != NULL) 
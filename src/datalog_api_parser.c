@@ -28,87 +28,262 @@
 
 #include "datalog_api_parser.h"
 
+//largest number of facts handed to the engine in one call
+#define DATALOG_FACT_BATCH 65536
+
+//size of coded rules and facts with variables gathered while streaming a
+//document before they are asserted
+#define DATALOG_STREAM_CMDS (1 << 20)
+
+/**
+* @brief Frees a literal made by datalog_wrap_literal, its terms' strings 
+* belong to the parser literal and are left alone
+*
+* @param lit Wrapped literal, set to NULL
+* @return void
+*/
+static void datalog_unwrap_literal(datalog_literal_t** lit)
+{
+    datalog_term_t *head, *next;
+
+    if(*lit == NULL) return;
+    for(head = (*lit)->term_head; head != NULL; head = next){
+        next = head->next;
+        free(head);
+    }
+    free((*lit)->predicate);
+    free(*lit);
+    *lit = NULL;
+}
+
+/**
+* @brief Frees a clause made by datalog_wrap_rule
+*
+* @param clause Wrapped clause, set to NULL
+* @return void
+*/
+static void datalog_unwrap_rule(datalog_clause_t** clause)
+{
+    if(*clause == NULL) return;
+    datalog_unwrap_literal(&(*clause)->head);
+    for(int i = 0; i < (*clause)->literal_count; i++)
+        datalog_unwrap_literal(&(*clause)->body_list[i]);
+    free((*clause)->body_list);
+    free(*clause);
+    *clause = NULL;
+}
+
 DATALOG_ERR_t datalog_parser_assert_doc(dl_parser_return_doc_t* doc)
 {
     DATALOG_ERR_t ret = DATALOG_OK;
+    DATALOG_ERR_t err = DATALOG_OK;
 
-    ret = datalog_assert_fact_list(doc);
-    if(ret != DATALOG_OK) return DATALOG_ASRT;
+    //as when streaming, the rules are asserted whatever became of the facts
+    //and the first error is returned
+    err = datalog_assert_fact_list(doc);
 
 #ifdef PARSER_DEBUG
     fprintf(stderr, "[DATALOG][PARSER] Debug: fact list asserted\n");
 #endif
      
     ret = datalog_assert_rule_list(doc);
-    if(ret != DATALOG_OK) return DATALOG_ASRT;
+    if(err == DATALOG_OK) err = ret;
 
 #ifdef PARSER_DEBUG
     fprintf(stderr, "[DATALOG][PARSER] Debug: rule list asserted\n");
 #endif
 
-    return DATALOG_OK;
+    return err;
 }
 
 DATALOG_ERR_t datalog_assert_rule_list(dl_parser_return_doc_t* doc)
 {
     DATALOG_ERR_t ret = DATALOG_OK;
 
-    dl_parser_rule_t* dl_p_rule_tmp = doc->rules_head;
-    dl_parser_rule_t* rule_to_free;
+    dl_parser_rule_t* dl_p_rule_tmp;
     datalog_clause_t* clause_tmp;
+    dl_cmds_t cmds;
 
-    while(dl_p_rule_tmp != NULL){
+    //all the rules are coded into one buffer and asserted in one call
+    dl_cmds_init(&cmds);
+    for(int i = 0; i < doc->rule_count; i++){
+        dl_p_rule_tmp = &doc->rules[i];
+        if(dl_p_rule_tmp->head == NULL || dl_p_rule_tmp->body == NULL) continue;
         
         clause_tmp = datalog_wrap_rule(dl_p_rule_tmp);
+        if(clause_tmp == NULL){
+            dl_cmds_free(&cmds);
+            return DATALOG_WRAP;
+        }
        
 #ifdef PARSER_DEBUG_VERBOSE
         fprintf(stderr, "[DATALOG][PARSER] Verbose: rule clause wrapped\n");
 #endif
 
-        ret = datalog_clause_create_and_assert(clause_tmp);
+        ret = datalog_clause_encode(clause_tmp, &cmds);
+        dl_cmd(&cmds, DL_OP_ASSERT);
+        datalog_unwrap_rule(&clause_tmp);
         
         if(ret != DATALOG_OK){
 #ifdef DATALOG_ERR
-            fprintf(stderr, "[DATALOG][API] Err: failed to assert"
+            fprintf(stderr, "[DATALOG][API] Err: failed to code"
                     " clause from rule list\n");
 #endif
+            dl_cmds_free(&cmds);
             return DATALOG_ASRT;
         }
+    }
 
-#ifdef PARSER_DEBUG_VERBOSE
-        fprintf(stderr, "[DATALOG][PARSER] Verbose: rule asserted\n");
+    ret = (cmds.len > 0 ? datalog_commands_exec(&cmds) : DATALOG_OK);
+    dl_cmds_free(&cmds);
+    if(ret != DATALOG_OK){
+#ifdef DATALOG_ERR
+        fprintf(stderr, "[DATALOG][API] Err: failed to assert"
+                " clauses from rule list\n");
 #endif
-        rule_to_free = dl_p_rule_tmp;
-        dl_p_rule_tmp = dl_p_rule_tmp->next;
+        return ret;
     }
+
+#ifdef PARSER_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][PARSER] Verbose: rules asserted\n");
+#endif
+
     return DATALOG_OK;
 }
 
+/**
+* @brief Asserts the ground facts gathered by datalog_assert_fact_list
+*
+* @param predicate Predicate of the facts
+* @param arity Number of terms in each fact
+* @param count Number of facts gathered, reset to zero
+* @param terms Terms of the facts in order
+* @return DATALOG_ERR_t DATALOG_ASRT if the facts could not be asserted
+*/
+static DATALOG_ERR_t datalog_assert_fact_batch(char* predicate, int arity, 
+        int* count, char** terms)
+{
+    DATALOG_ERR_t ret = DATALOG_OK;
+
+    if(*count == 0) return DATALOG_OK;
+    if(datalog_facts_assert(predicate, arity, *count, terms) != DATALOG_OK){
+#ifdef DATALOG_ERR
+        fprintf(stderr, "[DATALOG][API] Err: failed to assert"
+                " %d facts from fact list\n", *count);
+#endif
+        ret = DATALOG_ASRT;
+    }
+    *count = 0;
+    return ret;
+}
+
+/**
+* @brief Checks that a fact's terms are all constants, listing them
+*
+* @param literal Fact's literal
+* @param terms Set to the terms, must have room for term_count terms
+* @return bool True if the fact is ground
+*/
+static bool datalog_fact_terms(dl_parser_literal_t* literal, char** terms)
+{
+    dl_parser_term_t* term = literal->term_head;
+
+    for(int i = 0; i < literal->term_count; i++){
+        if(term == NULL || term->type != DL_PARSE_TERM_C) return false;
+        terms[i] = term->value;
+        term = term->next;
+    }
+    return true;
+}
+
 DATALOG_ERR_t datalog_assert_fact_list(dl_parser_return_doc_t* doc)
 {
     DATALOG_ERR_t ret = DATALOG_OK;
+    DATALOG_ERR_t err = DATALOG_OK;
 
-    dl_parser_fact_t* dl_p_fact_tmp = doc->facts_head;
+    dl_parser_fact_t* dl_p_fact_tmp;
     datalog_literal_t* lit_tmp;
-
-    while(dl_p_fact_tmp != NULL){
+    dl_parser_literal_t* fact;
+
+    //consecutive ground facts of one predicate are asserted in batches, the
+    //other facts are coded into a command buffer asserted at the end. A 
+    //failed batch does not stop the rest, the first error is returned
+    dl_cmds_t cmds;
+    char** terms = NULL;
+    int terms_size = 0;
+    char* predicate = NULL;
+    int arity = 0;
+    int count = 0;
+
+    dl_cmds_init(&cmds);
+    for(int i = 0; i < doc->fact_count; i++){
+        dl_p_fact_tmp = &doc->facts[i];
+        fact = dl_p_fact_tmp->literal;
+        if(fact == NULL || fact->predicate == NULL) continue;
         
-        lit_tmp = datalog_wrap_fact(dl_p_fact_tmp);
+        if(count > 0 && (count == DATALOG_FACT_BATCH || 
+                    fact->term_count != arity || 
+                    strcmp(fact->predicate, predicate) != 0)){
+            ret = datalog_assert_fact_batch(predicate, arity, &count, terms);
+            if(err == DATALOG_OK) err = ret;
+        }
 
-        if(lit_tmp == NULL) return DATALOG_WRAP; 
-        ret = (DATALOG_ERR_t)datalog_literal_create_and_assert(lit_tmp);
+        if((count + 1) * fact->term_count > terms_size){
+            int size = terms_size ? terms_size * 2 : 64;
+            while(size < (count + 1) * fact->term_count) size *= 2;
+            char** tmp = (char**)realloc(terms, sizeof(char*) * size);
+            if(tmp == NULL){
+                free(terms);
+                dl_cmds_free(&cmds);
+                return DATALOG_MEM;
+            }
+            terms = tmp;
+            terms_size = size;
+        }
 
-        if(ret != DATALOG_OK){
+        if(datalog_fact_terms(fact, terms + count * fact->term_count)){
+            predicate = fact->predicate;
+            arity = fact->term_count;
+            count++;
+        }else{
+            lit_tmp = datalog_wrap_fact(dl_p_fact_tmp);
+
+            if(lit_tmp == NULL){
+                free(terms);
+                dl_cmds_free(&cmds);
+                return DATALOG_WRAP; 
+            }
+            ret = datalog_literal_encode(lit_tmp, &cmds);
+            dl_cmd(&cmds, DL_OP_PUSHHEAD);
+            dl_cmd(&cmds, DL_OP_MAKECLAUSE);
+            dl_cmd(&cmds, DL_OP_ASSERT);
+            datalog_unwrap_literal(&lit_tmp);
+
+            if(ret != DATALOG_OK){
 
 #ifdef DATALOG_ERR
-            fprintf(stderr, "[DATALOG][API] Err: failed to assert"
-                    " literal from fact list\n");
+                fprintf(stderr, "[DATALOG][API] Err: failed to code"
+                        " literal from fact list\n");
 #endif
-        }   
-            dl_p_fact_tmp = dl_p_fact_tmp->next;
+                if(err == DATALOG_OK) err = ret;
+            }   
+        }
     }
+    ret = datalog_assert_fact_batch(predicate, arity, &count, terms);
+    if(err == DATALOG_OK) err = ret;
+    free(terms);
 
-    return DATALOG_OK;
+    ret = (cmds.len > 0 ? datalog_commands_exec(&cmds) : DATALOG_OK);
+    dl_cmds_free(&cmds);
+    if(ret != DATALOG_OK){
+#ifdef DATALOG_ERR
+        fprintf(stderr, "[DATALOG][API] Err: failed to assert"
+                " literals from fact list\n");
+#endif
+        if(err == DATALOG_OK) err = ret;
+    }
+
+    return err;
 }
 
 // wrap data types
@@ -218,3 +393,248 @@ datalog_literal_t* datalog_wrap_fact(dl_parser_fact_t* fact)
   
     return ret;
 }
+
+/**
+* @typedef datalog_stream_t
+* @brief Typdef for struct datalog_stream
+*/
+/**
+* @struct datalog_stream
+* @brief What is gathered while a document is streamed, each part is asserted
+* once it reaches its bound
+*/
+typedef struct datalog_stream{
+    char* predicate;    /*!< predicate of the gathered ground facts */
+    int arity;          /*!< number of terms in each gathered fact */
+    int count;          /*!< number of gathered ground facts */
+
+    char* strings;      /*!< terms of the gathered facts, one after the other */
+    size_t strings_len;
+    size_t strings_size;
+
+    char** terms;       /*!< terms of the gathered facts, set when asserting */
+    int terms_size;
+
+    datalog_literal_t* views;   /*!< head and body of the streamed rule */
+    datalog_literal_t** body;
+    int views_size;
+
+    dl_cmds_t cmds;     /*!< coded rules and facts with variables */
+
+    DATALOG_ERR_t err;  /*!< first assertion error */
+}datalog_stream_t;
+
+/**
+* @brief Sets up an API literal that refers to a parser literal's strings and 
+* terms, which have the layout of the API's terms as datalog_wrap_literal
+* relies on
+*
+* @param literal Parser literal
+* @param view Set to the API literal
+* @return void
+*/
+static void datalog_stream_view(dl_parser_literal_t* literal, 
+        datalog_literal_t* view)
+{
+    memset(view, 0, sizeof(datalog_literal_t));
+    view->predicate = literal->predicate;
+    view->term_count = literal->term_count;
+    view->term_head = (datalog_term_t*)literal->term_head;
+}
+
+/**
+* @brief Asserts the ground facts gathered while streaming
+*
+* @param stream Stream state
+* @return void
+*/
+static void datalog_stream_facts(datalog_stream_t* stream)
+{
+    int n = stream->count * stream->arity;
+    char* string = stream->strings;
+
+    if(stream->count == 0) return;
+    if(n > stream->terms_size){
+        char** tmp = (char**)realloc(stream->terms, sizeof(char*) * n);
+        if(tmp == NULL){
+            if(stream->err == DATALOG_OK) stream->err = DATALOG_MEM;
+            stream->count = 0;
+            stream->strings_len = 0;
+            return;
+        }
+        stream->terms = tmp;
+        stream->terms_size = n;
+    }
+    for(int i = 0; i < n; i++){
+        stream->terms[i] = string;
+        string += strlen(string) + 1;
+    }
+
+    DATALOG_ERR_t ret = datalog_assert_fact_batch(stream->predicate, 
+            stream->arity, &stream->count, stream->terms);
+    if(stream->err == DATALOG_OK) stream->err = ret;
+    stream->strings_len = 0;
+}
+
+/**
+* @brief Asserts the rules and facts with variables coded while streaming
+*
+* @param stream Stream state
+* @return void
+*/
+static void datalog_stream_cmds(datalog_stream_t* stream)
+{
+    if(stream->cmds.len == 0) return;
+    DATALOG_ERR_t ret = datalog_commands_exec(&stream->cmds);
+    if(ret != DATALOG_OK){
+#ifdef DATALOG_ERR
+        fprintf(stderr, "[DATALOG][API] Err: failed to assert"
+                " streamed clauses\n");
+#endif
+        if(stream->err == DATALOG_OK) stream->err = ret;
+    }
+    stream->cmds.len = 0;
+}
+
+/**
+* @brief Gathers a streamed fact, see dl_parser_fact_cb_t
+*/
+static DL_PARSER_ERR_t datalog_stream_fact(dl_parser_fact_t* fact, void* data)
+{
+    datalog_stream_t* stream = (datalog_stream_t*)data;
+    dl_parser_literal_t* literal = fact->literal;
+    dl_parser_term_t* term;
+    size_t len = 0;
+
+    for(term = literal->term_head; term != NULL; term = term->next)
+        if(term->type != DL_PARSE_TERM_C || term->value == NULL) break;
+
+    if(term != NULL || literal->term_count == 0){
+        datalog_literal_t view;
+        size_t mark = stream->cmds.len;
+
+        datalog_stream_view(literal, &view);
+        if(datalog_literal_encode(&view, &stream->cmds) != DATALOG_OK){
+#ifdef DATALOG_ERR
+            fprintf(stderr, "[DATALOG][API] Err: failed to code"
+                    " streamed fact\n");
+#endif
+            //the commands of a fact coded in part are dropped
+            stream->cmds.len = mark;
+            return (stream->cmds.err ? DL_PARSER_MEM : DL_PARSER_OK);
+        }
+        dl_cmd(&stream->cmds, DL_OP_PUSHHEAD);
+        dl_cmd(&stream->cmds, DL_OP_MAKECLAUSE);
+        dl_cmd(&stream->cmds, DL_OP_ASSERT);
+        if(stream->cmds.len >= DATALOG_STREAM_CMDS) datalog_stream_cmds(stream);
+        return DL_PARSER_OK;
+    }
+
+    if(stream->count > 0 && (stream->count == DATALOG_FACT_BATCH || 
+                literal->term_count != stream->arity || 
+                strcmp(literal->predicate, stream->predicate) != 0))
+        datalog_stream_facts(stream);
+
+    if(stream->count == 0){
+        char* predicate = strdup(literal->predicate);
+        if(predicate == NULL) return DL_PARSER_MEM;
+        free(stream->predicate);
+        stream->predicate = predicate;
+        stream->arity = literal->term_count;
+    }
+
+    for(term = literal->term_head; term != NULL; term = term->next)
+        len += strlen(term->value) + 1;
+    if(stream->strings_len + len > stream->strings_size){
+        size_t size = stream->strings_size ? stream->strings_size * 2 : 65536;
+        while(size < stream->strings_len + len) size *= 2;
+        char* tmp = (char*)realloc(stream->strings, size);
+        if(tmp == NULL) return DL_PARSER_MEM;
+        stream->strings = tmp;
+        stream->strings_size = size;
+    }
+    for(term = literal->term_head; term != NULL; term = term->next){
+        len = strlen(term->value) + 1;
+        memcpy(stream->strings + stream->strings_len, term->value, len);
+        stream->strings_len += len;
+    }
+    stream->count++;
+
+    return DL_PARSER_OK;
+}
+
+/**
+* @brief Codes a streamed rule, see dl_parser_rule_cb_t
+*/
+static DL_PARSER_ERR_t datalog_stream_rule(dl_parser_rule_t* rule, void* data)
+{
+    datalog_stream_t* stream = (datalog_stream_t*)data;
+    int n = rule->body->literal_count + 1;
+    datalog_clause_t clause;
+    size_t mark = stream->cmds.len;
+
+    if(n > stream->views_size){
+        datalog_literal_t* views = (datalog_literal_t*)realloc(stream->views,
+                sizeof(datalog_literal_t) * n);
+        if(views == NULL) return DL_PARSER_MEM;
+        stream->views = views;
+        datalog_literal_t** body = (datalog_literal_t**)realloc(stream->body,
+                sizeof(datalog_literal_t*) * n);
+        if(body == NULL) return DL_PARSER_MEM;
+        stream->body = body;
+        stream->views_size = n;
+    }
+
+    memset(&clause, 0, sizeof(datalog_clause_t));
+    datalog_stream_view(rule->head, &stream->views[0]);
+    clause.head = &stream->views[0];
+    for(int i = 1; i < n; i++){
+        datalog_stream_view(rule->body->literals[i - 1], &stream->views[i]);
+        stream->body[i - 1] = &stream->views[i];
+    }
+    clause.body_list = stream->body;
+    clause.literal_count = n - 1;
+
+    if(datalog_clause_encode(&clause, &stream->cmds) != DATALOG_OK){
+#ifdef DATALOG_ERR
+        fprintf(stderr, "[DATALOG][API] Err: failed to code"
+                " streamed rule\n");
+#endif
+        stream->cmds.len = mark;
+        return (stream->cmds.err ? DL_PARSER_MEM : DL_PARSER_OK);
+    }
+    dl_cmd(&stream->cmds, DL_OP_ASSERT);
+    if(stream->cmds.len >= DATALOG_STREAM_CMDS) datalog_stream_cmds(stream);
+
+    return DL_PARSER_OK;
+}
+
+DATALOG_ERR_t datalog_parser_assert_stream(char* filename)
+{
+    datalog_stream_t stream;
+    DL_PARSER_ERR_t ret;
+
+    memset(&stream, 0, sizeof(datalog_stream_t));
+    dl_cmds_init(&stream.cmds);
+
+    ret = dl_parser_stream(filename, datalog_stream_fact, datalog_stream_rule,
+            &stream);
+
+    datalog_stream_facts(&stream);
+    datalog_stream_cmds(&stream);
+
+    dl_cmds_free(&stream.cmds);
+    free(stream.predicate);
+    free(stream.strings);
+    free(stream.terms);
+    free(stream.views);
+    free(stream.body);
+
+#ifdef PARSER_DEBUG
+    fprintf(stderr, "[DATALOG][PARSER] Debug: document streamed\n");
+#endif
+
+    if(ret == DL_PARSER_MEM) return DATALOG_MEM;
+    if(ret != DL_PARSER_OK) return DATALOG_FILE;
+    return stream.err;
+}
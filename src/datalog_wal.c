@@ -0,0 +1,932 @@
+/**
+ * @file        datalog_wal.c
+ * @author      Alexander Hoffman
+ * @email       alxhoff@gmail.com
+ * @website     http://alexhoffman.info
+ * @copyright   GNU GPL v3
+ * @brief       Write-ahead log of the global database of the Datalog API
+ *  
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "datalog_wal.h"
+
+//the files of generation N are the log path.N.log and the image 
+//path.N.image holding the database as it was when that log was started, the
+//latest image and the logs from its generation on make up the database
+#define DATALOG_WAL_VERSION 1
+#define DATALOG_WAL_HEADER 8            //record length and CRC-32
+#define DATALOG_WAL_COMMANDS 'C'
+#define DATALOG_WAL_FACTS 'F'
+
+static const char datalog_wal_magic[8] = 
+    {'D', 'L', 'W', 'A', 'L', 0, 0, DATALOG_WAL_VERSION};
+
+/**
+* @struct datalog_wal
+* @brief The write-ahead log of the global database, records are appended
+* under the writer lock and written by the flusher thread
+*/
+typedef struct datalog_wal{
+    char* dir;                  //directory of the files
+    char* base;                 //prefix of their names
+    datalog_wal_config_t config;
+    pthread_mutex_t lock;       //guards the fields below
+    pthread_cond_t wake;        //records are pending, or the log is closing
+    pthread_cond_t synced_cond; //more records are synced
+    int fd;                     //log appended to
+    unsigned long gen;          //its generation
+    unsigned char* buf;         //records not yet written
+    size_t len, cap;
+    unsigned char* spare;       //the other buffer, written by the flusher
+    size_t spare_cap;
+    uint64_t appended;          //bytes of records appended since opened
+    uint64_t synced;            //bytes of them written and synced
+    size_t log_bytes;           //size of the log appended to
+    bool failed;                //has a write or sync failed?
+    bool closing;
+    pthread_t flusher;
+    pthread_t compactor;
+    bool compacting;            //is the compactor started and not joined?
+    bool compacted;             //has it finished?
+    bool compact_failed;        //has a compaction or an image failed?
+}datalog_wal_t;
+
+static datalog_wal_t* datalog_wal = NULL;
+
+bool datalog_wal_is_open(void)
+{
+    return datalog_wal != NULL;
+}
+
+static uint32_t datalog_wal_crc_table[256];
+static pthread_once_t datalog_wal_crc_once = PTHREAD_ONCE_INIT;
+
+static void datalog_wal_crc_init(void)
+{
+    for(uint32_t i = 0; i < 256; i++){
+        uint32_t c = i;
+        for(int k = 0; k < 8; k++)
+            c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        datalog_wal_crc_table[i] = c;
+    }
+}
+
+static uint32_t datalog_wal_crc(const unsigned char* p, size_t n)
+{
+    uint32_t c = 0xffffffffu;
+
+    while(n--)
+        c = datalog_wal_crc_table[(c ^ *p++) & 0xff] ^ (c >> 8);
+
+    return c ^ 0xffffffffu;
+}
+
+static size_t datalog_wal_put_varint(unsigned char* p, size_t n)
+{
+    size_t i = 0;
+
+    while(n >= 0x80){
+        p[i++] = (unsigned char)(n | 0x80);
+        n >>= 7;
+    }
+    p[i++] = (unsigned char)n;
+
+    return i;
+}
+
+static size_t datalog_wal_varint_size(size_t n)
+{
+    size_t i = 1;
+
+    while(n >= 0x80){
+        n >>= 7;
+        i++;
+    }
+
+    return i;
+}
+
+//reads a varint at *p before end, false when it does not fit
+static bool datalog_wal_get_varint(const unsigned char** p, 
+        const unsigned char* end, size_t* n)
+{
+    size_t v = 0;
+    int shift = 0;
+
+    while(*p < end && shift < 64){
+        unsigned char b = *(*p)++;
+        v |= (size_t)(b & 0x7f) << shift;
+        if(!(b & 0x80)){
+            *n = v;
+            return true;
+        }
+        shift += 7;
+    }
+
+    return false;
+}
+
+/**
+* @brief Makes the name of a file of the log
+*
+* @param gen Generation of the file
+* @param ext "log" or "image"
+* @return char* Name to be freed, NULL when out of memory
+*/
+static char* datalog_wal_file(unsigned long gen, const char* ext)
+{
+    size_t n = strlen(datalog_wal->dir) + strlen(datalog_wal->base) + 
+        strlen(ext) + 32;
+    char* name = (char*)malloc(n);
+
+    if(name != NULL)
+        snprintf(name, n, "%s/%s.%lu.%s", datalog_wal->dir, datalog_wal->base, 
+                gen, ext);
+
+    return name;
+}
+
+/**
+* @brief Finds the files of the log, removing those of generations before
+* keep, unless keep is 0
+*
+* @param image Set to the generation of the latest image, 0 when none
+* @param first Set to the generation of the first log, 0 when none
+* @param last Set to the generation of the last log, 0 when none
+* @return int 0 on success
+*/
+static int datalog_wal_scan(unsigned long keep, unsigned long* image, 
+        unsigned long* first, unsigned long* last)
+{
+    size_t n = strlen(datalog_wal->base);
+    DIR* dir = opendir(datalog_wal->dir);
+    struct dirent* e;
+
+    *image = *first = *last = 0;
+    if(dir == NULL) return -1;
+    while((e = readdir(dir)) != NULL){
+        char* end;
+        unsigned long gen;
+        bool is_log;
+
+        if(strncmp(e->d_name, datalog_wal->base, n) || e->d_name[n] != '.')
+            continue;
+        gen = strtoul(e->d_name + n + 1, &end, 10);
+        if(gen == 0 || end == e->d_name + n + 1) continue;
+        if(!strcmp(end, ".log")) is_log = true;
+        else if(!strcmp(end, ".image")) is_log = false;
+        else continue;
+        if(gen < keep){
+            char* name = datalog_wal_file(gen, is_log ? "log" : "image");
+            if(name != NULL) remove(name);
+            free(name);
+        }
+        else if(is_log){
+            if(*first == 0 || gen < *first) *first = gen;
+            if(gen > *last) *last = gen;
+        }
+        else if(gen > *image) *image = gen;
+    }
+    closedir(dir);
+
+    return 0;
+}
+
+//makes the creation, removal and renaming of files of the log durable
+static int datalog_wal_sync_dir(void)
+{
+    int fd = open(datalog_wal->dir, O_RDONLY);
+    int ret;
+
+    if(fd < 0) return -1;
+    ret = fsync(fd);
+    close(fd);
+
+    return ret;
+}
+
+static int datalog_wal_sync_fd(int fd)
+{
+#if defined(__APPLE__)
+    return fsync(fd);
+#else
+    return fdatasync(fd);
+#endif
+}
+
+static int datalog_wal_write_all(int fd, const unsigned char* p, size_t n)
+{
+    while(n > 0){
+        ssize_t w = write(fd, p, n);
+        if(w < 0){
+            if(errno == EINTR) continue;
+            return -1;
+        }
+        p += w;
+        n -= (size_t)w;
+    }
+
+    return 0;
+}
+
+/**
+* @brief Creates the log of a generation, with its header
+*
+* @return int File descriptor open for appending, -1 on failure
+*/
+static int datalog_wal_create_log(unsigned long gen)
+{
+    char* name = datalog_wal_file(gen, "log");
+    int fd;
+
+    if(name == NULL) return -1;
+    fd = open(name, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+    free(name);
+    if(fd < 0) return -1;
+    if(datalog_wal_write_all(fd, (const unsigned char*)datalog_wal_magic, 
+                sizeof(datalog_wal_magic)) || datalog_wal_sync_fd(fd) || 
+            datalog_wal_sync_dir()){
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+/**
+* @brief Runs a record on the global database, as it was run when logged
+*
+* @return int 0 on success, -1 when the record is malformed
+*/
+static int datalog_wal_apply(const unsigned char* p, size_t n)
+{
+    const unsigned char* end = p + n;
+
+    if(n == 0) return -1;
+    if(*p == DATALOG_WAL_COMMANDS){
+        int mark = dl_mark(datalog_db);
+        dl_exec(datalog_db, p + 1, n - 1);
+        dl_reset(datalog_db, mark);
+        return 0;
+    }
+    if(*p != DATALOG_WAL_FACTS) return -1;
+
+    size_t pred_len, arity, count;
+    const char* pred;
+    p++;
+    if(!datalog_wal_get_varint(&p, end, &pred_len) || 
+            pred_len > (size_t)(end - p))
+        return -1;
+    pred = (const char*)p;
+    p += pred_len;
+    if(!datalog_wal_get_varint(&p, end, &arity) || 
+            !datalog_wal_get_varint(&p, end, &count) || arity > INT_MAX ||
+            (arity > 0 && count > (size_t)(end - p) / arity))
+        return -1;
+
+    size_t cells = arity * count;
+    const char** terms = (const char**)malloc(sizeof(char*) * (cells + 1));
+    size_t* lens = (size_t*)malloc(sizeof(size_t) * (cells + 1));
+    int ret = 0;
+    if(terms == NULL || lens == NULL) ret = -1;
+    for(size_t i = 0; ret == 0 && i < cells; i++){
+        if(!datalog_wal_get_varint(&p, end, &lens[i]) || 
+                lens[i] > (size_t)(end - p))
+            ret = -1;
+        else{
+            terms[i] = (const char*)p;
+            p += lens[i];
+        }
+    }
+    if(ret == 0)
+        dl_assert_lfacts(datalog_db, pred, pred_len, (int)arity, count, 
+                terms, lens);
+    free(terms);
+    free(lens);
+
+    return ret;
+}
+
+/**
+* @brief Replays the log of a generation on the global database
+*
+* A record that is cut short or fails its check ends the log. At the end of
+* the last log, it is the trace of a crash while it was written, and it is
+* cut off; anywhere else the log is damaged.
+*
+* @param last Is this the last log?
+* @param size Set to the size of the log, once cut
+* @return int 0 on success
+*/
+static int datalog_wal_replay(unsigned long gen, bool last, size_t* size)
+{
+    char* name = datalog_wal_file(gen, "log");
+    struct stat st;
+    unsigned char* data = NULL;
+    size_t n = 0, off;
+    int fd, ret = 0;
+
+    if(name == NULL) return -1;
+    fd = open(name, last ? O_RDWR : O_RDONLY);
+    free(name);
+    if(fd < 0 || fstat(fd, &st)){
+        if(fd >= 0) close(fd);
+        return -1;
+    }
+    n = (size_t)st.st_size;
+    data = (unsigned char*)malloc(n + 1);
+    for(off = 0; data != NULL && off < n;){
+        ssize_t r = read(fd, data + off, n - off);
+        if(r < 0 && errno == EINTR) continue;
+        if(r <= 0) break;
+        off += (size_t)r;
+    }
+    // A crash just after the last log was created can leave its header cut
+    if(data != NULL && off == n && last && n < sizeof(datalog_wal_magic) && 
+            !memcmp(data, datalog_wal_magic, n)){
+        if(ftruncate(fd, 0) || lseek(fd, 0, SEEK_SET) != 0 || 
+                datalog_wal_write_all(fd, (const unsigned char*)datalog_wal_magic, 
+                    sizeof(datalog_wal_magic)) || 
+                datalog_wal_sync_fd(fd))
+            ret = -1;
+        *size = sizeof(datalog_wal_magic);
+        free(data);
+        close(fd);
+        return ret;
+    }
+    if(data == NULL || off != n || n < sizeof(datalog_wal_magic) || 
+            memcmp(data, datalog_wal_magic, sizeof(datalog_wal_magic))){
+        free(data);
+        close(fd);
+        return -1;
+    }
+
+    off = sizeof(datalog_wal_magic);
+    while(n - off >= DATALOG_WAL_HEADER){
+        uint32_t len, crc;
+        memcpy(&len, data + off, 4);
+        memcpy(&crc, data + off + 4, 4);
+        if(len > n - off - DATALOG_WAL_HEADER || 
+                datalog_wal_crc(data + off + DATALOG_WAL_HEADER, len) != crc)
+            break;
+        if(datalog_wal_apply(data + off + DATALOG_WAL_HEADER, len)){
+            ret = -1;
+            break;
+        }
+        off += DATALOG_WAL_HEADER + len;
+    }
+    if(ret == 0 && off < n){
+        if(!last) ret = -1;
+        else if(ftruncate(fd, (off_t)off) || datalog_wal_sync_fd(fd)) ret = -1;
+
+#ifdef DATALOG_ERR
+        fprintf(stderr, "[DATALOG][API]   ERROR: log %lu cut at byte %zu of %zu\n", 
+                gen, off, n);
+#endif
+    }
+    *size = off;
+    free(data);
+    close(fd);
+
+    return ret;
+}
+
+/**
+* @brief Reserves room for a record at the end of the buffer of pending
+* records, must hold the log's lock
+*
+* @return unsigned char* Start of the record, NULL when out of memory
+*/
+static unsigned char* datalog_wal_reserve(size_t payload)
+{
+    size_t need = datalog_wal->len + DATALOG_WAL_HEADER + payload;
+
+    if(payload > UINT32_MAX) return NULL;
+    if(need > datalog_wal->cap){
+        size_t cap = datalog_wal->cap ? datalog_wal->cap : 65536;
+        while(cap < need) cap *= 2;
+        unsigned char* buf = (unsigned char*)realloc(datalog_wal->buf, cap);
+        if(buf == NULL) return NULL;
+        datalog_wal->buf = buf;
+        datalog_wal->cap = cap;
+    }
+
+    return datalog_wal->buf + datalog_wal->len;
+}
+
+/**
+* @brief Completes a record written at the end of the buffer and hands it to
+* the flusher, must hold the log's lock
+*
+* @return uint64_t Bytes appended once the record is written
+*/
+static uint64_t datalog_wal_commit(unsigned char* rec, size_t payload)
+{
+    uint32_t len = (uint32_t)payload;
+    uint32_t crc = datalog_wal_crc(rec + DATALOG_WAL_HEADER, payload);
+    bool was_empty = datalog_wal->len == 0;
+
+    memcpy(rec, &len, 4);
+    memcpy(rec + 4, &crc, 4);
+    datalog_wal->len += DATALOG_WAL_HEADER + payload;
+    datalog_wal->appended += DATALOG_WAL_HEADER + payload;
+    datalog_wal->log_bytes += DATALOG_WAL_HEADER + payload;
+    if(was_empty || datalog_wal->len >= datalog_wal->config.commit_bytes)
+        pthread_cond_signal(&datalog_wal->wake);
+
+    return datalog_wal->appended;
+}
+
+static int datalog_wal_compact_locked(void);
+
+int datalog_wal_writable(void)
+{
+    bool failed;
+
+    if(datalog_wal->config.compact_bytes > 0 && 
+            datalog_wal->log_bytes >= datalog_wal->config.compact_bytes)
+        datalog_wal_compact_locked();
+
+    pthread_mutex_lock(&datalog_wal->lock);
+    failed = datalog_wal->failed || datalog_wal->compact_failed;
+    pthread_mutex_unlock(&datalog_wal->lock);
+
+    return (failed ? -1 : 0);
+}
+
+uint64_t datalog_wal_log_commands(const dl_cmds_t* cmds)
+{
+    uint64_t lsn = 0;
+    unsigned char* rec;
+
+    pthread_mutex_lock(&datalog_wal->lock);
+    rec = datalog_wal_reserve(cmds->len + 1);
+    if(rec != NULL){
+        rec[DATALOG_WAL_HEADER] = DATALOG_WAL_COMMANDS;
+        memcpy(rec + DATALOG_WAL_HEADER + 1, cmds->buf, cmds->len);
+        lsn = datalog_wal_commit(rec, cmds->len + 1);
+    }
+    else datalog_wal->failed = true;
+    pthread_mutex_unlock(&datalog_wal->lock);
+
+    return lsn;
+}
+
+uint64_t datalog_wal_log_facts(const char* predicate, size_t pred_len,
+        int arity, size_t count, char** terms, const size_t* lens)
+{
+    size_t cells = (size_t)arity * count;
+    size_t payload = 1 + datalog_wal_varint_size(pred_len) + pred_len + 
+        datalog_wal_varint_size((size_t)arity) + datalog_wal_varint_size(count);
+    uint64_t lsn = 0;
+    unsigned char* rec;
+
+    for(size_t i = 0; i < cells; i++)
+        payload += datalog_wal_varint_size(lens[i]) + lens[i];
+
+    pthread_mutex_lock(&datalog_wal->lock);
+    rec = datalog_wal_reserve(payload);
+    if(rec != NULL){
+        unsigned char* p = rec + DATALOG_WAL_HEADER;
+        *p++ = DATALOG_WAL_FACTS;
+        p += datalog_wal_put_varint(p, pred_len);
+        memcpy(p, predicate, pred_len);
+        p += pred_len;
+        p += datalog_wal_put_varint(p, (size_t)arity);
+        p += datalog_wal_put_varint(p, count);
+        for(size_t i = 0; i < cells; i++){
+            p += datalog_wal_put_varint(p, lens[i]);
+            memcpy(p, terms[i], lens[i]);
+            p += lens[i];
+        }
+        lsn = datalog_wal_commit(rec, payload);
+    }
+    else datalog_wal->failed = true;
+    pthread_mutex_unlock(&datalog_wal->lock);
+
+    return lsn;
+}
+
+/**
+* @brief Writes and syncs the pending records in groups, waiting at most the
+* commit interval for a group to fill up
+*/
+static void* datalog_wal_flush(void* arg)
+{
+    datalog_wal_t* wal = (datalog_wal_t*)arg;
+
+    pthread_mutex_lock(&wal->lock);
+    for(;;){
+        while(wal->len == 0 && !wal->closing)
+            pthread_cond_wait(&wal->wake, &wal->lock);
+        if(wal->len == 0) break;
+
+        if(wal->config.commit_interval_us > 0 && !wal->closing){
+            struct timespec until;
+            clock_gettime(CLOCK_REALTIME, &until);
+            until.tv_nsec += (long)(wal->config.commit_interval_us % 1000000) 
+                * 1000;
+            until.tv_sec += wal->config.commit_interval_us / 1000000 + 
+                until.tv_nsec / 1000000000;
+            until.tv_nsec %= 1000000000;
+            while(wal->len < wal->config.commit_bytes && !wal->closing &&
+                    pthread_cond_timedwait(&wal->wake, &wal->lock, &until) 
+                    != ETIMEDOUT)
+                ;
+        }
+
+        //write the group from the spare buffer while records go on being
+        //appended to the other one
+        unsigned char* group = wal->buf;
+        size_t len = wal->len, cap = wal->cap;
+        uint64_t upto = wal->appended;
+        int fd = wal->fd;
+        wal->buf = wal->spare;
+        wal->cap = wal->spare_cap;
+        wal->len = 0;
+        pthread_mutex_unlock(&wal->lock);
+
+        int err = datalog_wal_write_all(fd, group, len) || 
+            datalog_wal_sync_fd(fd);
+
+        pthread_mutex_lock(&wal->lock);
+        wal->spare = group;
+        wal->spare_cap = cap;
+        if(err) wal->failed = true;
+        wal->synced = upto;
+        pthread_cond_broadcast(&wal->synced_cond);
+    }
+    pthread_mutex_unlock(&wal->lock);
+
+    return NULL;
+}
+
+/**
+* @brief Waits until the records appended up to a byte count are synced
+*
+* @return DATALOG_ERR_t DATALOG_FILE when the log failed
+*/
+static DATALOG_ERR_t datalog_wal_wait(uint64_t upto)
+{
+    bool failed;
+
+    pthread_mutex_lock(&datalog_wal->lock);
+    while(datalog_wal->synced < upto && !datalog_wal->failed)
+        pthread_cond_wait(&datalog_wal->synced_cond, &datalog_wal->lock);
+    failed = datalog_wal->failed;
+    pthread_mutex_unlock(&datalog_wal->lock);
+
+    return (failed ? DATALOG_FILE : DATALOG_OK);
+}
+
+DATALOG_ERR_t datalog_wal_commit_wait(uint64_t upto)
+{
+    if(datalog_wal == NULL) return DATALOG_OK;
+    if(upto == 0) return DATALOG_FILE;
+    if(!datalog_wal->config.durable) return DATALOG_OK;
+
+    return datalog_wal_wait(upto);
+}
+
+/**
+* @brief Ends the current log and starts the next generation's, once every
+* record is synced, must hold the writer lock
+*
+* @return int 0 on success
+*/
+static int datalog_wal_rotate_locked(void)
+{
+    int fd;
+
+    if(datalog_wal_wait(datalog_wal->appended) != DATALOG_OK) return -1;
+    fd = datalog_wal_create_log(datalog_wal->gen + 1);
+    if(fd < 0) return -1;
+
+    pthread_mutex_lock(&datalog_wal->lock);
+    close(datalog_wal->fd);
+    datalog_wal->fd = fd;
+    datalog_wal->gen++;
+    datalog_wal->log_bytes = sizeof(datalog_wal_magic);
+    pthread_mutex_unlock(&datalog_wal->lock);
+
+    return 0;
+}
+
+//writes the image of a generation from a database and, once the image and
+//its name are on disk, removes the files it replaces
+static int datalog_wal_write_image(dl_db_t db, unsigned long gen)
+{
+    char* name = datalog_wal_file(gen, "image");
+    unsigned long image, first, last;
+    int ret;
+
+    if(name == NULL) return -1;
+    ret = dl_save_image(db, name);
+    free(name);
+    if(ret == 0) ret = datalog_wal_sync_dir();
+    if(ret == 0) datalog_wal_scan(gen, &image, &first, &last);
+
+    return ret;
+}
+
+typedef struct{
+    dl_db_t replica;
+    unsigned long gen;
+}datalog_wal_compaction_t;
+
+/**
+* @brief Puts the log in the failed state after a compaction or an image
+* failed, writes are then refused, must hold the writer lock
+*
+* @return int -1
+*/
+static int datalog_wal_compact_fail(void)
+{
+    pthread_mutex_lock(&datalog_wal->lock);
+    datalog_wal->compact_failed = true;
+    pthread_mutex_unlock(&datalog_wal->lock);
+
+#ifdef DATALOG_ERR
+    fprintf(stderr, "[DATALOG][API]   ERROR: log compaction failed, writes are"
+            " refused until the log is opened again\n");
+#endif
+
+    return -1;
+}
+
+static void* datalog_wal_compact_run(void* arg)
+{
+    datalog_wal_compaction_t* c = (datalog_wal_compaction_t*)arg;
+    int ret = datalog_wal_write_image(c->replica, c->gen);
+
+    dl_close(c->replica);
+#ifdef DATALOG_DEBUG_VERBOSE
+    fprintf(stderr, "[DATALOG][API] VERBOSE: log compacted into image %lu:  %s\n",
+        c->gen, (ret == 0 ? "SUCCSESS" : "FAIL"));
+#endif
+#ifdef DATALOG_ERR
+    if(ret) fprintf(stderr, "[DATALOG][API]   ERROR: image %lu of the log not"
+            " written, writes are refused\n", c->gen);
+#endif
+    free(c);
+
+    //the writers see the failure at their next write
+    pthread_mutex_lock(&datalog_wal->lock);
+    datalog_wal->compacted = true;
+    if(ret) datalog_wal->compact_failed = true;
+    pthread_mutex_unlock(&datalog_wal->lock);
+
+    return NULL;
+}
+
+//joins the compactor if it was started, waiting for it when wait is true
+static void datalog_wal_join(bool wait)
+{
+    bool done;
+
+    if(!datalog_wal->compacting) return;
+    pthread_mutex_lock(&datalog_wal->lock);
+    done = datalog_wal->compacted;
+    pthread_mutex_unlock(&datalog_wal->lock);
+    if(!done && !wait) return;
+    pthread_join(datalog_wal->compactor, NULL);
+    datalog_wal->compacting = false;
+}
+
+/**
+* @brief Starts a new log and writes the image of the database as it is now
+* from a replica in the background, must hold the writer lock
+*
+* @return int 0 on success, or when a compaction is already running, -1 when
+* this or an earlier compaction failed
+*/
+static int datalog_wal_compact_locked(void)
+{
+    datalog_wal_compaction_t* c;
+
+    datalog_wal_join(false);
+    if(datalog_wal->compacting) return 0;
+    if(datalog_wal->compact_failed) return -1;
+    if(datalog_wal_rotate_locked() || datalog_publish_now_locked()) 
+        return datalog_wal_compact_fail();
+
+    c = (datalog_wal_compaction_t*)malloc(sizeof(datalog_wal_compaction_t));
+    if(c == NULL) return datalog_wal_compact_fail();
+    c->gen = datalog_wal->gen;
+    c->replica = dl_open_replica(datalog_db);
+    if(c->replica == NULL){
+        free(c);
+        return datalog_wal_compact_fail();
+    }
+    datalog_wal->compacted = false;
+    if(pthread_create(&datalog_wal->compactor, NULL, datalog_wal_compact_run,
+                c)){
+        dl_close(c->replica);
+        free(c);
+        return datalog_wal_compact_fail();
+    }
+    datalog_wal->compacting = true;
+
+    return 0;
+}
+
+int datalog_wal_checkpoint_locked(void)
+{
+    if(datalog_wal == NULL) return 0;
+    datalog_wal_join(true);
+    if(datalog_wal_rotate_locked() || 
+            datalog_wal_write_image(datalog_db, datalog_wal->gen))
+        return datalog_wal_compact_fail();
+
+    return 0;
+}
+
+static void datalog_wal_free(datalog_wal_t* wal)
+{
+    pthread_mutex_destroy(&wal->lock);
+    pthread_cond_destroy(&wal->wake);
+    pthread_cond_destroy(&wal->synced_cond);
+    free(wal->buf);
+    free(wal->spare);
+    free(wal->dir);
+    free(wal->base);
+    free(wal);
+}
+
+/**
+* @brief Loads the latest image and replays the logs after it, then opens the
+* last log for appending, must hold the writer lock
+*
+* @return DATALOG_ERR_t error message
+*/
+static DATALOG_ERR_t datalog_wal_recover(void)
+{
+    unsigned long image, first, last, gen;
+    size_t size = 0;
+
+    if(datalog_wal_scan(0, &image, &first, &last)) return DATALOG_FILE;
+    if(image > 0){
+        char* name = datalog_wal_file(image, "image");
+        int ret = (name == NULL ? -1 : dl_load_image(datalog_db, name));
+        free(name);
+        if(ret) return DATALOG_FILE;
+    }
+
+    //replay the logs from the image on, a log older than the image was
+    //written into it by a compaction that had not yet removed it
+    gen = (image > first ? image : first);
+    for(; gen > 0 && gen <= last; gen++)
+        if(datalog_wal_replay(gen, gen == last, &size)) return DATALOG_FILE;
+
+    if(last >= image && last > 0){
+        char* name = datalog_wal_file(last, "log");
+        datalog_wal->fd = (name == NULL ? -1 : 
+                open(name, O_WRONLY | O_APPEND));
+        free(name);
+        datalog_wal->gen = last;
+        datalog_wal->log_bytes = size;
+    }
+    else{
+        datalog_wal->gen = (image > 0 ? image : 1);
+        datalog_wal->fd = datalog_wal_create_log(datalog_wal->gen);
+        datalog_wal->log_bytes = sizeof(datalog_wal_magic);
+    }
+    if(datalog_wal->fd < 0) return DATALOG_FILE;
+
+    //files older than the image are no longer needed
+    if(image > 0) datalog_wal_scan(image, &image, &first, &last);
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_wal_open(const char* path, 
+        const datalog_wal_config_t* config)
+{
+    const char* slash = (path == NULL ? NULL : strrchr(path, '/'));
+    const char* base = (slash == NULL ? path : slash + 1);
+    datalog_wal_t* wal;
+    int ret;
+
+    if(datalog_wal != NULL || path == NULL || *base == '\0') 
+        return DATALOG_INIT;
+    pthread_once(&datalog_wal_crc_once, datalog_wal_crc_init);
+
+    wal = (datalog_wal_t*)calloc(1, sizeof(datalog_wal_t));
+    if(wal == NULL) return DATALOG_MEM;
+    if(config != NULL) wal->config = *config;
+    else{
+        wal->config.commit_interval_us = 0;
+        wal->config.commit_bytes = 1 << 20;
+        wal->config.durable = true;
+        wal->config.compact_bytes = (size_t)64 << 20;
+    }
+    if(slash == NULL) wal->dir = strdup(".");
+    else if(slash == path) wal->dir = strdup("/");
+    else wal->dir = strndup(path, (size_t)(slash - path));
+    wal->base = strdup(base);
+    wal->fd = -1;
+    pthread_mutex_init(&wal->lock, NULL);
+    pthread_cond_init(&wal->wake, NULL);
+    pthread_cond_init(&wal->synced_cond, NULL);
+    if(wal->dir == NULL || wal->base == NULL){
+        datalog_wal_free(wal);
+        return DATALOG_MEM;
+    }
+
+    datalog_write_lock();
+    datalog_wal = wal;
+    ret = datalog_wal_recover();
+    if(ret == DATALOG_OK && 
+            pthread_create(&wal->flusher, NULL, datalog_wal_flush, wal))
+        ret = DATALOG_INIT;
+    if(ret != DATALOG_OK){
+        if(wal->fd >= 0) close(wal->fd);
+        datalog_wal = NULL;
+        datalog_wal_free(wal);
+    }
+    datalog_write_unlock(true, ret);
+
+#ifdef DATALOG_DEBUG
+    fprintf(stderr, "[DATALOG][API]   DEBUG: log %s opened:        %s\n", path,
+        (ret == DATALOG_OK ? "SUCCSESS" : "FAIL"));
+#endif
+
+    return (DATALOG_ERR_t)ret;
+}
+
+DATALOG_ERR_t datalog_engine_wal_sync(void)
+{
+    uint64_t upto;
+
+    if(datalog_wal == NULL) return DATALOG_OK;
+    pthread_mutex_lock(&datalog_wal->lock);
+    upto = datalog_wal->appended;
+    pthread_mutex_unlock(&datalog_wal->lock);
+
+    return datalog_wal_wait(upto);
+}
+
+DATALOG_ERR_t datalog_engine_wal_compact(void)
+{
+    if(datalog_wal == NULL) return DATALOG_INIT;
+    datalog_write_lock();
+    if(datalog_write_unlock(false, datalog_wal_compact_locked())) 
+        return DATALOG_FILE;
+
+    return DATALOG_OK;
+}
+
+DATALOG_ERR_t datalog_engine_wal_close(void)
+{
+    datalog_wal_t* wal = datalog_wal;
+    DATALOG_ERR_t ret;
+
+    if(wal == NULL) return DATALOG_OK;
+    datalog_write_lock();
+    ret = datalog_engine_wal_sync();
+    datalog_wal_join(true);
+    if(wal->compact_failed) ret = DATALOG_FILE;
+    pthread_mutex_lock(&wal->lock);
+    wal->closing = true;
+    pthread_cond_signal(&wal->wake);
+    pthread_mutex_unlock(&wal->lock);
+    pthread_join(wal->flusher, NULL);
+    if(wal->failed || close(wal->fd)) ret = DATALOG_FILE;
+    datalog_wal = NULL;
+    datalog_wal_free(wal);
+    datalog_write_unlock(false, 0);
+
+#ifdef DATALOG_DEBUG
+    fprintf(stderr, "[DATALOG][API]   DEBUG: log closed\n");
+#endif
+
+    return ret;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file        datalog_wal_test.c
+ * @author      Alexander Hoffman
+ * @email       alxhoff@gmail.com
+ * @website     http://alexhoffman.info
+ * @copyright   GNU GPL v3
+ * @brief       Regression test of the write-ahead log of the Datalog API
+ *
+@verbatim
+   ----------------------------------------------------------------------
+    Copyright (C) Alexander Hoffman, 2017
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    any later version.
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+   ----------------------------------------------------------------------
+@endverbatim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "datalog_api.h"
+
+// global datalog database
+dl_db_t datalog_db;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do{ \
+        if(!(cond)){ \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, \
+                    __LINE__, #cond); \
+            failures++; \
+        } \
+    }while(0)
+
+//number of reading(X, Y) facts in the global database
+static int count_readings(void)
+{
+    datalog_literal_t* lit = datalog_literal_init("reading");
+    datalog_query_t* query;
+    int ret = 0;
+
+    lit->add_term(lit, "X", DL_TERM_V);
+    lit->add_term(lit, "Y", DL_TERM_V);
+    query = datalog_query_init(lit);
+    if(datalog_query_ask(query) != DATALOG_OK) ret = -1;
+    else if(query->processed_answer != NULL)
+        ret = query->processed_answer->answer_count;
+    query->free(&query);
+
+    return ret;
+}
+
+//asserts the facts reading(s<i>, v<i % 7>) for i in [from, from + n)
+static DATALOG_ERR_t add_readings(int from, int n)
+{
+    char** terms = (char**)malloc(sizeof(char*) * 2 * n);
+    DATALOG_ERR_t ret;
+
+    for(int i = 0; i < n; i++){
+        terms[2 * i] = (char*)malloc(16);
+        terms[2 * i + 1] = (char*)malloc(16);
+        snprintf(terms[2 * i], 16, "s%d", from + i);
+        snprintf(terms[2 * i + 1], 16, "v%d", (from + i) % 7);
+    }
+    ret = datalog_facts_assert("reading", 2, n, terms);
+    for(int i = 0; i < 2 * n; i++) free(terms[i]);
+    free(terms);
+
+    return ret;
+}
+
+static void remove_files(const char* dir)
+{
+    char cmd[512];
+
+    snprintf(cmd, sizeof(cmd), "rm -rf '%s'", dir);
+    if(system(cmd)) fprintf(stderr, "could not remove %s\n", dir);
+}
+
+//compacts, then recovers from the image and the log after it, compacts
+//again from the recovered database and reopens
+static void test_compact_reopen(const char* path)
+{
+    datalog_wal_config_t config = {0, 1 << 20, true, 0};
+
+    for(int round = 0; round < 3; round++){
+        CHECK(datalog_engine_db_init() == DATALOG_OK);
+        CHECK(datalog_engine_wal_open(path, &config) == DATALOG_OK);
+        CHECK(count_readings() == 1010 * round);
+        if(round < 2){
+            CHECK(add_readings(1010 * round, 1000) == DATALOG_OK);
+            CHECK(datalog_engine_wal_compact() == DATALOG_OK);
+            CHECK(add_readings(1010 * round + 1000, 10) == DATALOG_OK);
+            CHECK(count_readings() == 1010 * (round + 1));
+        }
+        CHECK(datalog_engine_wal_close() == DATALOG_OK);
+        datalog_engine_db_deinit();
+    }
+}
+
+//a compaction whose image cannot be written puts the log in the failed
+//state, later writes are refused and the reopened log has the earlier ones
+static void test_compact_failed(const char* path)
+{
+    datalog_wal_config_t config = {0, 1 << 20, true, 0};
+    char image[512];
+
+    //a directory stands where the image of the next generation goes
+    snprintf(image, sizeof(image), "%s.2.image", path);
+
+    CHECK(datalog_engine_db_init() == DATALOG_OK);
+    CHECK(datalog_engine_wal_open(path, &config) == DATALOG_OK);
+    CHECK(add_readings(0, 100) == DATALOG_OK);
+    CHECK(mkdir(image, 0755) == 0);
+    CHECK(datalog_engine_wal_compact() == DATALOG_OK);
+    CHECK(datalog_engine_wal_close() == DATALOG_FILE);
+    datalog_engine_db_deinit();
+
+    //the logs still hold every write, the new log of the failed compaction
+    //is now the last one
+    CHECK(rmdir(image) == 0);
+    CHECK(datalog_engine_db_init() == DATALOG_OK);
+    CHECK(datalog_engine_wal_open(path, &config) == DATALOG_OK);
+    CHECK(count_readings() == 100);
+    snprintf(image, sizeof(image), "%s.3.image", path);
+    CHECK(mkdir(image, 0755) == 0);
+    CHECK(datalog_engine_wal_compact() == DATALOG_OK);
+    //writes go on until the compactor has failed, for at most ten seconds
+    for(int i = 0; i < 10000 && add_readings(100, 10) == DATALOG_OK; i++)
+        usleep(1000);
+    int count = count_readings();
+    CHECK(count == 100 || count == 110);
+    CHECK(add_readings(200, 10) == DATALOG_FILE);
+    CHECK(count_readings() == count);
+    CHECK(datalog_engine_wal_compact() == DATALOG_FILE);
+    CHECK(datalog_engine_wal_close() == DATALOG_FILE);
+    datalog_engine_db_deinit();
+    CHECK(rmdir(image) == 0);
+}
+
+int main(void)
+{
+    char dir[] = "/tmp/datalog_wal_test.XXXXXX";
+    char path[512];
+
+    if(mkdtemp(dir) == NULL){
+        perror("mkdtemp");
+        return 1;
+    }
+
+    snprintf(path, sizeof(path), "%s/reopen", dir);
+    test_compact_reopen(path);
+    snprintf(path, sizeof(path), "%s/failed", dir);
+    test_compact_failed(path);
+
+    remove_files(dir);
+    if(failures) fprintf(stderr, "%d checks failed\n", failures);
+
+    return (failures ? 1 : 0);
+}